@@ -4,9 +4,60 @@
 
 #pragma once
 
+#include <cassert>
 #include <stdexcept>
 
 /** Throw exception _e_ with message _msg_ if _cond_ is false. */
 #define cml_require(_cond_, _e_, _msg_)                                        \
   if((_cond_)) {                                                               \
   } else throw _e_(_msg_)
+
+/** @name Size-check policies
+ *
+ * CML_SIZE_CHECK_POLICY selects how the run-time vector and matrix size
+ * checks (check_same_size(), check_square(), and so on, including those
+ * made by expression nodes) report a failure:
+ *
+ * - CML_SIZE_CHECK_THROW (the default) throws the documented exception.
+ * - CML_SIZE_CHECK_ASSERT fails an assert() instead, and so checks only
+ *   when NDEBUG is not defined.
+ * - CML_SIZE_CHECK_NONE does not check.
+ *
+ * With the last two, the size checks and the expression node constructors
+ * are noexcept.  Compile-time size checks are unaffected.  The CMake option
+ * CML_SIZE_CHECK (THROW, ASSERT, or NONE) sets the policy for the cml
+ * target.
+ *
+ * @warning Every translation unit of a program must use the same policy.
+ * Mixing policies changes the definitions of the same inline functions
+ * and templates, which violates the one-definition rule.
+ */
+/*@{*/
+
+#define CML_SIZE_CHECK_THROW 0
+#define CML_SIZE_CHECK_ASSERT 1
+#define CML_SIZE_CHECK_NONE 2
+
+#ifndef CML_SIZE_CHECK_POLICY
+#  define CML_SIZE_CHECK_POLICY CML_SIZE_CHECK_THROW
+#endif
+
+#if CML_SIZE_CHECK_POLICY == CML_SIZE_CHECK_THROW
+#  define cml_size_require(_cond_, _e_, _msg_) cml_require(_cond_, _e_, _msg_)
+#  define CML_SIZE_CHECK_NOEXCEPT
+#elif CML_SIZE_CHECK_POLICY == CML_SIZE_CHECK_ASSERT                        \
+  && !defined(NDEBUG)
+#  define cml_size_require(_cond_, _e_, _msg_) assert((_cond_) && #_e_)
+#  define CML_SIZE_CHECK_NOEXCEPT noexcept
+#elif CML_SIZE_CHECK_POLICY == CML_SIZE_CHECK_ASSERT                        \
+  || CML_SIZE_CHECK_POLICY == CML_SIZE_CHECK_NONE
+/* The condition is kept as an unevaluated operand, so the arguments of the
+ * size checks are still used:
+ */
+#  define cml_size_require(_cond_, _e_, _msg_) ((void) sizeof(_cond_))
+#  define CML_SIZE_CHECK_NOEXCEPT noexcept
+#else
+#  error "CML_SIZE_CHECK_POLICY must be CML_SIZE_CHECK_THROW, _ASSERT or _NONE"
+#endif
+
+/*@}*/
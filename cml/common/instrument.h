@@ -0,0 +1,299 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cstddef>
+
+#ifdef CML_ENABLE_INSTRUMENTATION
+#  include <functional>
+#  include <map>
+#  include <mutex>
+#  include <string>
+#endif
+
+/** @defgroup common_instrument Instrumentation
+ *
+ * When CML_ENABLE_INSTRUMENTATION is defined at compile time, CML counts,
+ * per operation type, the dynamic allocations made by resizable vectors
+ * and matrices, the hidden temporaries materialized by eager operations
+ * (matrix products, determinant(), inverse(), lu(), transpose(), ...),
+ * and the elements written when expressions are evaluated into a vector
+ * or matrix.  An allocation is attributed to the outermost instrumented
+ * operation in progress on the calling thread, or to "other" if there is
+ * none.
+ *
+ * Without CML_ENABLE_INSTRUMENTATION, the hooks are empty inline functions
+ * and have no cost; instrument_query() and instrument_total() then return
+ * zero counts.  The registry functions instrument_snapshot() and
+ * instrument_set_callback(), which need <map> and <functional>, are
+ * declared only when instrumentation is enabled, so that disabled builds
+ * include no extra headers.
+ *
+ * @note The counters are global and shared by all threads.  Every
+ * instrumented event takes a lock, so instrumented builds are intended
+ * for profiling only.
+ */
+
+namespace cml {
+/** @addtogroup common_instrument */
+/*@{*/
+
+/** The kinds of instrumented events. */
+enum instrument_kind
+{
+  instrument_allocation_c = 1,
+  instrument_temporary_c = 2,
+  instrument_evaluation_c = 3
+};
+
+/** Counters accumulated for one operation type. */
+struct instrument_counters
+{
+  /** The number of dynamic allocations. */
+  long long allocations = 0;
+
+  /** The total size of the dynamic allocations, in bytes. */
+  long long allocated_bytes = 0;
+
+  /** The number of temporaries materialized. */
+  long long temporaries = 0;
+
+  /** The number of elements evaluated. */
+  long long elements = 0;
+};
+
+#ifdef CML_ENABLE_INSTRUMENTATION
+
+/** Tracing callback, invoked for every instrumented event with the event
+ * kind, the operation name, and the event size: the number of bytes for
+ * an allocation, 1 for a temporary, and the number of elements for an
+ * evaluation.
+ */
+using instrument_callback =
+  std::function<void(instrument_kind, const char*, long long)>;
+#endif
+
+/** Return true if CML was compiled with CML_ENABLE_INSTRUMENTATION. */
+constexpr bool
+instrument_enabled()
+{
+#ifdef CML_ENABLE_INSTRUMENTATION
+  return true;
+#else
+  return false;
+#endif
+}
+
+namespace detail {
+
+#ifdef CML_ENABLE_INSTRUMENTATION
+
+/** The global instrumentation state. */
+struct instrument_state
+{
+  std::mutex mutex;
+  std::map<std::string, instrument_counters> counters;
+  instrument_callback callback;
+};
+
+inline instrument_state&
+instrument_get_state()
+{
+  static instrument_state state;
+  return state;
+}
+
+/** The name of the outermost instrumented operation in progress on the
+ * calling thread, or nullptr.
+ */
+inline const char*&
+instrument_current_op()
+{
+  thread_local const char* op = nullptr;
+  return op;
+}
+
+/** Record an event of size @c n for operation @c op. */
+inline void
+instrument_record(instrument_kind kind, const char* op, long long n)
+{
+  auto& state = instrument_get_state();
+  instrument_callback callback;
+  {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto& c = state.counters[op];
+    switch(kind) {
+      case instrument_allocation_c:
+        c.allocations += 1;
+        c.allocated_bytes += n;
+        break;
+      case instrument_temporary_c: c.temporaries += 1; break;
+      case instrument_evaluation_c: c.elements += n; break;
+    }
+    callback = state.callback;
+  }
+  if(callback) callback(kind, op, n);
+}
+
+/** Record a dynamic allocation of @c bytes bytes, attributed to the
+ * current operation.
+ */
+inline void
+instrument_allocation(std::size_t bytes)
+{
+  const char* op = instrument_current_op();
+  instrument_record(instrument_allocation_c, op ? op : "other",
+    (long long) bytes);
+}
+
+/** Record a temporary materialized by operation @c op. */
+inline void
+instrument_temporary(const char* op)
+{
+  instrument_record(instrument_temporary_c, op, 1);
+}
+
+/** Record @c n elements evaluated by operation @c op. */
+inline void
+instrument_evaluation(const char* op, long long n)
+{
+  instrument_record(instrument_evaluation_c, op, n);
+}
+
+/** Marks operation @c op as in progress on the calling thread for the
+ * lifetime of the object, so that allocations are attributed to it unless
+ * an enclosing operation is already in progress.
+ */
+class instrument_scope
+{
+  public:
+  explicit instrument_scope(const char* op)
+    : m_prev(instrument_current_op())
+  {
+    if(!this->m_prev) instrument_current_op() = op;
+  }
+
+  ~instrument_scope() { instrument_current_op() = this->m_prev; }
+
+  instrument_scope(const instrument_scope&) = delete;
+  instrument_scope& operator=(const instrument_scope&) = delete;
+
+  private:
+  const char* m_prev;
+};
+
+#else
+
+inline void
+instrument_allocation(std::size_t)
+{
+}
+
+inline void
+instrument_temporary(const char*)
+{
+}
+
+inline void
+instrument_evaluation(const char*, long long)
+{
+}
+
+class instrument_scope
+{
+  public:
+  explicit instrument_scope(const char*) {}
+};
+
+#endif
+
+} // namespace detail
+
+#ifdef CML_ENABLE_INSTRUMENTATION
+
+/** Return the counters for operation @c op. */
+inline instrument_counters
+instrument_query(const std::string& op)
+{
+  auto& state = detail::instrument_get_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  auto it = state.counters.find(op);
+  return it == state.counters.end() ? instrument_counters() : it->second;
+}
+
+/** Return the counters for all operations recorded since the last reset,
+ * keyed by operation name.
+ */
+inline std::map<std::string, instrument_counters>
+instrument_snapshot()
+{
+  auto& state = detail::instrument_get_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  return state.counters;
+}
+
+/** Return the sum of the counters over all operations. */
+inline instrument_counters
+instrument_total()
+{
+  instrument_counters total;
+  for(const auto& entry : instrument_snapshot()) {
+    total.allocations += entry.second.allocations;
+    total.allocated_bytes += entry.second.allocated_bytes;
+    total.temporaries += entry.second.temporaries;
+    total.elements += entry.second.elements;
+  }
+  return total;
+}
+
+/** Reset all counters to zero. */
+inline void
+instrument_reset()
+{
+  auto& state = detail::instrument_get_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.counters.clear();
+}
+
+/** Install @c callback to be invoked for every instrumented event, or
+ * remove the current callback if @c callback is empty.  The callback is
+ * invoked without holding the instrumentation lock, on the thread that
+ * produced the event.
+ */
+inline void
+instrument_set_callback(instrument_callback callback)
+{
+  auto& state = detail::instrument_get_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.callback = std::move(callback);
+}
+
+#else
+
+/** Return zero counters; @c op is any operation name. */
+template<class String>
+inline instrument_counters
+instrument_query(const String&)
+{
+  return instrument_counters();
+}
+
+/** Return zero counters. */
+inline instrument_counters
+instrument_total()
+{
+  return instrument_counters();
+}
+
+/** Does nothing. */
+inline void
+instrument_reset()
+{
+}
+
+#endif
+
+/*@}*/
+} // namespace cml
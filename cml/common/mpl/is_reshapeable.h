@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include <type_traits>
+#include <utility>
+
 namespace cml {
 /** Helper that defines @c type as std::true_type and @c value as true if
  * @c T implements resize(m,n), where m and n are convertible from int.
@@ -0,0 +1,62 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace cml::detail {
+
+/** Return the number of threads to use for a parallel kernel, given the
+ * requested count @c threads and the number of independent work items @c
+ * n.  A request of 0 selects std::thread::hardware_concurrency().  The
+ * result is in [1, max(n,1)].
+ */
+inline int
+parallel_thread_count(int threads, int n)
+{
+  if(threads == 0) threads = int(std::thread::hardware_concurrency());
+  return std::max(1, std::min(threads, n));
+}
+
+/** Invoke @c f(t) for t in [0,threads), running invocations 1 through
+ * threads-1 on separate threads, and invocation 0 on the calling thread.
+ * All threads are joined before returning.
+ *
+ * @note @c f must not throw.
+ */
+template<class F>
+void
+parallel_invoke(int threads, F&& f)
+{
+  if(threads <= 1) {
+    f(0);
+    return;
+  }
+
+  std::vector<std::thread> workers;
+  workers.reserve(threads - 1);
+  for(int t = 1; t < threads; ++t) workers.emplace_back([&f, t]() { f(t); });
+  f(0);
+  for(auto& w : workers) w.join();
+}
+
+/** Invoke @c f(begin,end) over @c threads contiguous, nearly equal
+ * sub-ranges of [0,n).  See parallel_invoke().
+ */
+template<class F>
+void
+parallel_for(int n, int threads, F&& f)
+{
+  threads = parallel_thread_count(threads, n);
+  parallel_invoke(threads, [n, threads, &f](int t) {
+    const int begin = int((long long) n * t / threads);
+    const int end = int((long long) n * (t + 1) / threads);
+    f(begin, end);
+  });
+}
+
+} // namespace cml::detail
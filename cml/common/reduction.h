@@ -0,0 +1,195 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <vector>
+#include <cml/common/parallel.h>
+
+/** The smallest number of elements for which the vector and matrix
+ * reductions use more than one thread, when more than one is requested.
+ */
+#ifndef CML_REDUCTION_PARALLEL_THRESHOLD
+#  define CML_REDUCTION_PARALLEL_THRESHOLD 65536
+#endif
+
+namespace cml::detail {
+
+/** The number of independent accumulators used by the reduction kernels.
+ * Each accumulator handles every reduction_lanes-th element, so that the
+ * compiler can keep them in one or two SIMD registers without reordering
+ * floating-point operations.
+ */
+constexpr int reduction_lanes = 8;
+
+/** The largest range summed directly by reduce_sum(); longer ranges are
+ * split in half recursively.
+ */
+constexpr int reduction_block = 128;
+
+/** Return the sum of @c f(k) for k in [begin,end) as type @c A, using
+ * pairwise summation: ranges longer than reduction_block are split in
+ * half, and the halves are summed recursively.  The rounding error grows
+ * as O(log n) instead of O(n) for a running sum.
+ *
+ * @c Lanes, a power of two, is the number of accumulators.  Callers
+ * reducing fixed-size operands shorter than reduction_lanes should pass
+ * 1, so the lane loop is not instantiated past the end of the operand.
+ */
+template<class A, int Lanes = reduction_lanes, class F>
+A
+reduce_sum(const F& f, int begin, int end)
+{
+  static_assert(Lanes > 0 && (Lanes & (Lanes - 1)) == 0,
+    "the lane count must be a power of two");
+  const int n = end - begin;
+  if(n > reduction_block) {
+    /* Keep the split on a multiple of the lane count: */
+    const int half = (n / 2 + Lanes - 1) / Lanes * Lanes;
+    return reduce_sum<A, Lanes>(f, begin, begin + half)
+      + reduce_sum<A, Lanes>(f, begin + half, end);
+  }
+
+  /* Short ranges are summed directly: */
+  if(n < Lanes) {
+    A sum(0);
+    for(int k = begin; k < end; ++k) sum += A(f(k));
+    return sum;
+  }
+
+  A lanes[Lanes];
+  for(int l = 0; l < Lanes; ++l) lanes[l] = A(0);
+  int k = begin;
+  for(; k + Lanes <= end; k += Lanes)
+    for(int l = 0; l < Lanes; ++l) lanes[l] += A(f(k + l));
+  for(int l = 0; k < end; ++k, ++l) lanes[l] += A(f(k));
+
+  /* Combine the lanes pairwise: */
+  for(int w = Lanes / 2; w > 0; w /= 2)
+    for(int l = 0; l < w; ++l) lanes[l] += lanes[l + w];
+  return lanes[0];
+}
+
+/** Return the element of f(k), k in [begin,end), that is best by @c
+ * better, a strict ordering such as std::less<>.  The range must not be
+ * empty.  See reduce_sum() for @c Lanes.
+ */
+template<class T, int Lanes = reduction_lanes, class F, class Better>
+T
+reduce_extreme(const F& f, int begin, int end, Better better)
+{
+  if(end - begin < Lanes) {
+    T value = T(f(begin));
+    for(int k = begin + 1; k < end; ++k) {
+      const T x = T(f(k));
+      value = better(x, value) ? x : value;
+    }
+    return value;
+  }
+
+  T lanes[Lanes];
+  for(int l = 0; l < Lanes; ++l) lanes[l] = T(f(begin + l));
+
+  int k = begin + Lanes;
+  for(; k + Lanes <= end; k += Lanes)
+    for(int l = 0; l < Lanes; ++l) {
+      const T x = T(f(k + l));
+      lanes[l] = better(x, lanes[l]) ? x : lanes[l];
+    }
+  for(int l = 0; k < end; ++k, ++l) {
+    const T x = T(f(k));
+    lanes[l] = better(x, lanes[l]) ? x : lanes[l];
+  }
+
+  T value = lanes[0];
+  for(int l = 1; l < Lanes; ++l)
+    value = better(lanes[l], value) ? lanes[l] : value;
+  return value;
+}
+
+/** Find the element of f(k), k in [begin,end), that is best by @c better,
+ * a strict ordering such as std::less<>.  The value is stored in @c value,
+ * and the lowest k attaining it in @c index.  The range must not be
+ * empty.  See reduce_sum() for @c Lanes.
+ */
+template<int Lanes = reduction_lanes, class T, class F, class Better>
+void
+reduce_best(const F& f, int begin, int end, Better better, T& value,
+  int& index)
+{
+  if(end - begin < Lanes) {
+    value = T(f(begin));
+    index = begin;
+    for(int k = begin + 1; k < end; ++k) {
+      const T x = T(f(k));
+      if(better(x, value)) {
+        value = x;
+        index = k;
+      }
+    }
+    return;
+  }
+
+  T lanes[Lanes];
+  int at[Lanes];
+  for(int l = 0; l < Lanes; ++l) {
+    lanes[l] = T(f(begin + l));
+    at[l] = begin + l;
+  }
+
+  /* Each lane keeps the first best element among those it sees: */
+  int k = begin + Lanes;
+  for(; k + Lanes <= end; k += Lanes)
+    for(int l = 0; l < Lanes; ++l) {
+      const T x = T(f(k + l));
+      const bool b = better(x, lanes[l]);
+      lanes[l] = b ? x : lanes[l];
+      at[l] = b ? k + l : at[l];
+    }
+  for(int l = 0; k < end; ++k, ++l) {
+    const T x = T(f(k));
+    if(better(x, lanes[l])) {
+      lanes[l] = x;
+      at[l] = k;
+    }
+  }
+
+  /* Ties between lanes go to the lowest index: */
+  value = lanes[0];
+  index = at[0];
+  for(int l = 1; l < Lanes; ++l) {
+    if(better(lanes[l], value) || (!better(value, lanes[l]) && at[l] < index))
+    {
+      value = lanes[l];
+      index = at[l];
+    }
+  }
+}
+
+/** Combine the results @c r(begin,end) of @c threads nearly equal
+ * sub-ranges of [0,n) with @c combine(left,right), in order.  Ranges
+ * shorter than CML_REDUCTION_PARALLEL_THRESHOLD elements, with @c cost
+ * elements per item, use a single thread.  See parallel_invoke().
+ */
+template<class R, class F, class Combine>
+R
+reduce_parallel(int n, long long cost, int threads, const F& r,
+  const Combine& combine)
+{
+  if((long long) n * cost < CML_REDUCTION_PARALLEL_THRESHOLD) threads = 1;
+  threads = parallel_thread_count(threads, n);
+  if(threads == 1) return r(0, n);
+
+  std::vector<R> partial(threads);
+  parallel_invoke(threads, [n, threads, &r, &partial](int t) {
+    const int begin = int((long long) n * t / threads);
+    const int end = int((long long) n * (t + 1) / threads);
+    partial[t] = r(begin, end);
+  });
+  R result = partial[0];
+  for(int t = 1; t < threads; ++t) result = combine(result, partial[t]);
+  return result;
+}
+
+} // namespace cml::detail
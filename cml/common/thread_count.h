@@ -0,0 +1,23 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+namespace cml {
+/** The number of threads requested from a parallel reduction, e.g.
+ * sum(v, thread_count(4)).  0 selects std::thread::hardware_concurrency().
+ * The constructor is explicit, so that a scalar passed to min() or max()
+ * is never mistaken for a thread count.
+ */
+struct thread_count
+{
+  explicit constexpr thread_count(int n = 1)
+    : value(n)
+  {
+  }
+
+  /** The requested number of threads. */
+  int value;
+};
+} // namespace cml
@@ -103,107 +103,3 @@ extract_near_frustum_plane(const readable_matrix<Sub>& m, Plane& plane,
   }
 }
 } // namespace cml
-
-#if 0
-// XXX INCOMPLETE XXX
-
-/* @todo: plane class, and perhaps named arguments instead of an array. */
-
-namespace detail {
-/* This is currently only in support of finding the corners of a frustum.
- * The input planes are assumed to have a single unique intersection, so
- * no tolerance is used.
- */
-
-template<typename Real> vector<Real, fixed<3>>
-intersect_planes(Real p1[4], Real p2[4], Real p3[4])
-{
-  typedef vector<Real, fixed<3>> vector_type;
-  typedef typename vector_type::value_type value_type;
-
-  vector_type n1(p1[0], p1[1], p1[2]);
-  vector_type n2(p2[0], p2[1], p2[2]);
-  vector_type n3(p3[0], p3[1], p3[2]);
-
-  value_type d1 = -p1[3];
-  value_type d2 = -p2[3];
-  value_type d3 = -p3[3];
-
-  vector_type numer =
-    d1 * cross(n2, n3) + d2 * cross(n3, n1) + d3 * cross(n1, n2);
-  value_type denom = triple_product(n1, n2, n3);
-  return numer / denom;
-}
-} // namespace detail
-
-/* Get the corners of a frustum defined by 6 planes. The planes are in
- * ax+by+cz+d = 0 form, and are in the order:
- *     left
- *     right
- *     bottom
- *     top
- *     near
- *     far
- *
- * The corners are in CCW order starting in the lower-left, first at the near
- * plane, then at the far plane.
- */
-
-template<typename Real, typename E, class A> void
-get_frustum_corners(Real planes[6][4], vector<E, A> corners[8])
-{
-  // NOTE: Prefixed with 'PLANE_' due to symbol conflict with Windows
-  // macros PLANE_LEFT and PLANE_RIGHT.
-  enum
-  {
-    PLANE_LEFT,
-    PLANE_RIGHT,
-    PLANE_BOTTOM,
-    PLANE_TOP,
-    PLANE_NEAR,
-    PLANE_FAR
-  };
-
-  corners[0] = detail::intersect_planes(
-    planes[PLANE_LEFT],
-    planes[PLANE_BOTTOM],
-    planes[PLANE_NEAR]
-    );
-  corners[1] = detail::intersect_planes(
-    planes[PLANE_RIGHT],
-    planes[PLANE_BOTTOM],
-    planes[PLANE_NEAR]
-    );
-  corners[2] = detail::intersect_planes(
-    planes[PLANE_RIGHT],
-    planes[PLANE_TOP],
-    planes[PLANE_NEAR]
-    );
-  corners[3] = detail::intersect_planes(
-    planes[PLANE_LEFT],
-    planes[PLANE_TOP],
-    planes[PLANE_NEAR]
-    );
-  corners[4] = detail::intersect_planes(
-    planes[PLANE_LEFT],
-    planes[PLANE_BOTTOM],
-    planes[PLANE_FAR]
-    );
-  corners[5] = detail::intersect_planes(
-    planes[PLANE_RIGHT],
-    planes[PLANE_BOTTOM],
-    planes[PLANE_FAR]
-    );
-  corners[6] = detail::intersect_planes(
-    planes[PLANE_RIGHT],
-    planes[PLANE_TOP],
-    planes[PLANE_FAR]
-    );
-  corners[7] = detail::intersect_planes(
-    planes[PLANE_LEFT],
-    planes[PLANE_TOP],
-    planes[PLANE_FAR]
-    );
-}
-
-#endif
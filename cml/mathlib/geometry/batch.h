@@ -0,0 +1,131 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <vector>
+#include <cml/mathlib/geometry/primitives.h>
+
+namespace cml {
+/** @addtogroup mathlib_geometry */
+/*@{*/
+
+/** @defgroup mathlib_geometry_batch Batch Intersection
+ *
+ * Batches store primitives in structure-of-arrays form, one array per
+ * coordinate, so that the batch kernels are straight-line loops over
+ * contiguous arrays that the compiler can vectorize across primitives.
+ * Each kernel writes one result per primitive; a miss is reported as
+ * std::numeric_limits<E>::infinity().
+ */
+/*@{*/
+
+/** A batch of axis-aligned boxes in structure-of-arrays form. */
+template<class Element> struct aabb_batch
+{
+  using value_type = Element;
+
+  /** The x, y, and z coordinates of the minimum corners. */
+  std::vector<value_type> min[3];
+
+  /** The x, y, and z coordinates of the maximum corners. */
+  std::vector<value_type> max[3];
+
+  /** Return the number of boxes. */
+  int size() const;
+
+  /** Reserve storage for @c n boxes. */
+  void reserve(int n);
+
+  /** Remove all boxes. */
+  void clear();
+
+  /** Append @c box. */
+  void push_back(const aabb<Element>& box);
+
+  /** Return box @c i. */
+  aabb<Element> get(int i) const;
+};
+
+/** A batch of triangles in structure-of-arrays form.  Each triangle is
+ * stored as its first vertex and the two edges from it, as used by the
+ * Moller-Trumbore test.
+ */
+template<class Element> struct triangle_batch
+{
+  using value_type = Element;
+
+  /** The x, y, and z coordinates of the first vertices. */
+  std::vector<value_type> v0[3];
+
+  /** The x, y, and z coordinates of the edges v1-v0. */
+  std::vector<value_type> e1[3];
+
+  /** The x, y, and z coordinates of the edges v2-v0. */
+  std::vector<value_type> e2[3];
+
+  /** Return the number of triangles. */
+  int size() const;
+
+  /** Reserve storage for @c n triangles. */
+  void reserve(int n);
+
+  /** Remove all triangles. */
+  void clear();
+
+  /** Append @c tri. */
+  void push_back(const triangle<Element>& tri);
+
+  /** Return triangle @c i. */
+  triangle<Element> get(int i) const;
+};
+
+/** Intersect ray @c r with each box in @c boxes, writing the entry ray
+ * parameter of box @c i (0 if the ray starts inside it) to @c t[i], or
+ * infinity on a miss.  @c t is resized to boxes.size().
+ */
+template<class E>
+void intersect(const ray<E>& r, const aabb_batch<E>& boxes,
+  std::vector<E>& t);
+
+/** Return the index of the box in @c boxes with the nearest entry point
+ * along @c r, and its ray parameter in @c t, or -1 if no box is hit.
+ */
+template<class E>
+int intersect_nearest(const ray<E>& r, const aabb_batch<E>& boxes, E& t);
+
+/** Intersect ray @c r with each triangle in @c tris using the
+ * Moller-Trumbore algorithm, writing the ray parameter of the hit on
+ * triangle @c i to @c t[i], or infinity on a miss.  @c t is resized to
+ * tris.size().  If @c cull_backfaces is true, triangles seen from behind
+ * are not hit.
+ */
+template<class E>
+void intersect(const ray<E>& r, const triangle_batch<E>& tris,
+  std::vector<E>& t, bool cull_backfaces = false);
+
+/** Return the index of the triangle in @c tris with the nearest hit along
+ * @c r, and its ray parameter in @c t, or -1 if no triangle is hit.
+ */
+template<class E>
+int intersect_nearest(const ray<E>& r, const triangle_batch<E>& tris, E& t,
+  bool cull_backfaces = false);
+
+/** Test each box in @c boxes against the 6 @c planes of a frustum (see
+ * intersect_frustum()), writing 1 to @c visible[i] if box @c i may be
+ * visible, and 0 if it is entirely outside.  @c visible is resized to
+ * boxes.size().
+ */
+template<class E>
+void intersect_frustum(const plane<E> planes[6], const aabb_batch<E>& boxes,
+  std::vector<unsigned char>& visible);
+
+/*@}*/
+
+/*@}*/
+} // namespace cml
+
+#define __CML_MATHLIB_GEOMETRY_BATCH_TPP
+#include <cml/mathlib/geometry/batch.tpp>
+#undef __CML_MATHLIB_GEOMETRY_BATCH_TPP
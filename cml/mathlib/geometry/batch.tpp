@@ -0,0 +1,276 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#ifndef __CML_MATHLIB_GEOMETRY_BATCH_TPP
+#  error "mathlib/geometry/batch.tpp not included correctly"
+#endif
+
+#include <algorithm>
+#include <limits>
+#include <cml/scalar/traits.h>
+#include <cml/vector/binary_ops.h>
+
+namespace cml {
+
+/* aabb_batch: */
+
+template<class E>
+int
+aabb_batch<E>::size() const
+{
+  return int(this->min[0].size());
+}
+
+template<class E>
+void
+aabb_batch<E>::reserve(int n)
+{
+  for(int j = 0; j < 3; ++j) {
+    this->min[j].reserve(n);
+    this->max[j].reserve(n);
+  }
+}
+
+template<class E>
+void
+aabb_batch<E>::clear()
+{
+  for(int j = 0; j < 3; ++j) {
+    this->min[j].clear();
+    this->max[j].clear();
+  }
+}
+
+template<class E>
+void
+aabb_batch<E>::push_back(const aabb<E>& box)
+{
+  for(int j = 0; j < 3; ++j) {
+    this->min[j].push_back(box.min[j]);
+    this->max[j].push_back(box.max[j]);
+  }
+}
+
+template<class E>
+aabb<E>
+aabb_batch<E>::get(int i) const
+{
+  using vector_type = typename aabb<E>::vector_type;
+  return aabb<E>(vector_type(this->min[0][i], this->min[1][i], this->min[2][i]),
+    vector_type(this->max[0][i], this->max[1][i], this->max[2][i]));
+}
+
+
+/* triangle_batch: */
+
+template<class E>
+int
+triangle_batch<E>::size() const
+{
+  return int(this->v0[0].size());
+}
+
+template<class E>
+void
+triangle_batch<E>::reserve(int n)
+{
+  for(int j = 0; j < 3; ++j) {
+    this->v0[j].reserve(n);
+    this->e1[j].reserve(n);
+    this->e2[j].reserve(n);
+  }
+}
+
+template<class E>
+void
+triangle_batch<E>::clear()
+{
+  for(int j = 0; j < 3; ++j) {
+    this->v0[j].clear();
+    this->e1[j].clear();
+    this->e2[j].clear();
+  }
+}
+
+template<class E>
+void
+triangle_batch<E>::push_back(const triangle<E>& tri)
+{
+  for(int j = 0; j < 3; ++j) {
+    this->v0[j].push_back(tri.v0[j]);
+    this->e1[j].push_back(tri.v1[j] - tri.v0[j]);
+    this->e2[j].push_back(tri.v2[j] - tri.v0[j]);
+  }
+}
+
+template<class E>
+triangle<E>
+triangle_batch<E>::get(int i) const
+{
+  using vector_type = typename triangle<E>::vector_type;
+  vector_type v0(this->v0[0][i], this->v0[1][i], this->v0[2][i]);
+  vector_type e1(this->e1[0][i], this->e1[1][i], this->e1[2][i]);
+  vector_type e2(this->e2[0][i], this->e2[1][i], this->e2[2][i]);
+  return triangle<E>(v0, v0 + e1, v0 + e2);
+}
+
+
+namespace detail {
+
+/** Return the index and value of the smallest of the @c n values in @c t,
+ * or -1 if all are infinite.
+ */
+template<class E>
+inline int
+batch_nearest(const E* t, int n, E& t_min)
+{
+  int index = -1;
+  E best = std::numeric_limits<E>::infinity();
+  for(int i = 0; i < n; ++i) {
+    if(t[i] < best) {
+      best = t[i];
+      index = i;
+    }
+  }
+  t_min = best;
+  return index;
+}
+
+} // namespace detail
+
+
+/* Batch kernels: */
+
+template<class E>
+void
+intersect(const ray<E>& r, const aabb_batch<E>& boxes, std::vector<E>& t)
+{
+  const int n = boxes.size();
+  t.resize(n);
+
+  const E ox = r.origin[0], oy = r.origin[1], oz = r.origin[2];
+  const E ix = E(1) / r.direction[0];
+  const E iy = E(1) / r.direction[1];
+  const E iz = E(1) / r.direction[2];
+  const E inf = std::numeric_limits<E>::infinity();
+
+  const E* min_x = boxes.min[0].data();
+  const E* min_y = boxes.min[1].data();
+  const E* min_z = boxes.min[2].data();
+  const E* max_x = boxes.max[0].data();
+  const E* max_y = boxes.max[1].data();
+  const E* max_z = boxes.max[2].data();
+  E* out = t.data();
+
+  /* Branch-free slab test, vectorizable across boxes: */
+  for(int i = 0; i < n; ++i) {
+    const E ax = (min_x[i] - ox) * ix, bx = (max_x[i] - ox) * ix;
+    const E ay = (min_y[i] - oy) * iy, by = (max_y[i] - oy) * iy;
+    const E az = (min_z[i] - oz) * iz, bz = (max_z[i] - oz) * iz;
+    const E t0 = std::max(std::max(std::min(ax, bx), std::min(ay, by)),
+      std::max(std::min(az, bz), E(0)));
+    const E t1 = std::min(std::min(std::max(ax, bx), std::max(ay, by)),
+      std::max(az, bz));
+    out[i] = (t0 <= t1) ? t0 : inf;
+  }
+}
+
+template<class E>
+int
+intersect_nearest(const ray<E>& r, const aabb_batch<E>& boxes, E& t)
+{
+  std::vector<E> hits;
+  intersect(r, boxes, hits);
+  return detail::batch_nearest(hits.data(), int(hits.size()), t);
+}
+
+template<class E>
+void
+intersect(const ray<E>& r, const triangle_batch<E>& tris, std::vector<E>& t,
+  bool cull_backfaces)
+{
+  const int n = tris.size();
+  t.resize(n);
+
+  const E ox = r.origin[0], oy = r.origin[1], oz = r.origin[2];
+  const E dx = r.direction[0], dy = r.direction[1], dz = r.direction[2];
+  const E eps = scalar_traits<E>::epsilon();
+  const E inf = std::numeric_limits<E>::infinity();
+
+  /* With culling, det must exceed eps; without, |det| must: */
+  const E det_scale = cull_backfaces ? E(1) : E(-1);
+
+  const E* v0x = tris.v0[0].data();
+  const E* v0y = tris.v0[1].data();
+  const E* v0z = tris.v0[2].data();
+  const E* e1x = tris.e1[0].data();
+  const E* e1y = tris.e1[1].data();
+  const E* e1z = tris.e1[2].data();
+  const E* e2x = tris.e2[0].data();
+  const E* e2y = tris.e2[1].data();
+  const E* e2z = tris.e2[2].data();
+  E* out = t.data();
+
+  /* Branch-free Moller-Trumbore, vectorizable across triangles: */
+  for(int i = 0; i < n; ++i) {
+    /* pvec = d x e2, det = e1 . pvec: */
+    const E px = dy * e2z[i] - dz * e2y[i];
+    const E py = dz * e2x[i] - dx * e2z[i];
+    const E pz = dx * e2y[i] - dy * e2x[i];
+    const E det = e1x[i] * px + e1y[i] * py + e1z[i] * pz;
+    const E inv_det = E(1) / det;
+
+    /* u = (o - v0) . pvec / det: */
+    const E tx = ox - v0x[i], ty = oy - v0y[i], tz = oz - v0z[i];
+    const E u = (tx * px + ty * py + tz * pz) * inv_det;
+
+    /* qvec = tvec x e1, v = d . qvec / det, t = e2 . qvec / det: */
+    const E qx = ty * e1z[i] - tz * e1y[i];
+    const E qy = tz * e1x[i] - tx * e1z[i];
+    const E qz = tx * e1y[i] - ty * e1x[i];
+    const E v = (dx * qx + dy * qy + dz * qz) * inv_det;
+    const E s = (e2x[i] * qx + e2y[i] * qy + e2z[i] * qz) * inv_det;
+
+    const E det_test = std::max(det, det_scale * det);
+    const bool hit = (det_test > eps) & (u >= E(0)) & (v >= E(0))
+      & (u + v <= E(1)) & (s >= E(0));
+    out[i] = hit ? s : inf;
+  }
+}
+
+template<class E>
+int
+intersect_nearest(const ray<E>& r, const triangle_batch<E>& tris, E& t,
+  bool cull_backfaces)
+{
+  std::vector<E> hits;
+  intersect(r, tris, hits, cull_backfaces);
+  return detail::batch_nearest(hits.data(), int(hits.size()), t);
+}
+
+template<class E>
+void
+intersect_frustum(const plane<E> planes[6], const aabb_batch<E>& boxes,
+  std::vector<unsigned char>& visible)
+{
+  const int n = boxes.size();
+  visible.assign(n, 1);
+  unsigned char* out = visible.data();
+
+  for(int p = 0; p < 6; ++p) {
+    const E a = planes[p].normal[0];
+    const E b = planes[p].normal[1];
+    const E c = planes[p].normal[2];
+    const E d = planes[p].d;
+
+    /* The box corner farthest along the normal, per axis: */
+    const E* xs = (a >= E(0)) ? boxes.max[0].data() : boxes.min[0].data();
+    const E* ys = (b >= E(0)) ? boxes.max[1].data() : boxes.min[1].data();
+    const E* zs = (c >= E(0)) ? boxes.max[2].data() : boxes.min[2].data();
+    for(int i = 0; i < n; ++i)
+      out[i] &= (a * xs[i] + b * ys[i] + c * zs[i] + d >= E(0));
+  }
+}
+
+} // namespace cml
@@ -0,0 +1,98 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cml/mathlib/geometry/primitives.h>
+
+namespace cml {
+/** @addtogroup mathlib_geometry */
+/*@{*/
+
+/** @defgroup mathlib_geometry_intersect Intersection Tests */
+/*@{*/
+
+/** Intersect ray @c r with @c box using the slab method.  On a hit, the
+ * ray parameters of the entry and exit points are returned in @c t_near
+ * and @c t_far; @c t_near is 0 if the ray starts inside the box.
+ *
+ * @returns true if the ray hits the box at some t >= 0.
+ */
+template<class E>
+bool intersect(const ray<E>& r, const aabb<E>& box, E& t_near, E& t_far);
+
+/** Intersect ray @c r with sphere @c s.  On a hit, the smallest ray
+ * parameter t >= 0 of an intersection point is returned in @c t.
+ *
+ * @returns true if the ray hits the sphere at some t >= 0.
+ */
+template<class E> bool intersect(const ray<E>& r, const sphere<E>& s, E& t);
+
+/** Intersect ray @c r with plane @c p.  On a hit, the ray parameter of the
+ * intersection point is returned in @c t.
+ *
+ * @returns true if the ray is not parallel to the plane, and hits it at
+ * some t >= 0.
+ */
+template<class E> bool intersect(const ray<E>& r, const plane<E>& p, E& t);
+
+/** Intersect ray @c r with triangle @c tri using the Moller-Trumbore
+ * algorithm.  On a hit, the ray parameter is returned in @c t, and the
+ * barycentric coordinates of the hit point relative to v1 and v2 in @c u
+ * and @c v.  If @c cull_backfaces is true, triangles seen from behind
+ * (i.e. wound clockwise from the ray origin) are not hit.
+ *
+ * @returns true if the ray hits the triangle at some t >= 0.
+ */
+template<class E>
+bool intersect(const ray<E>& r, const triangle<E>& tri, E& t, E& u, E& v,
+  bool cull_backfaces = false);
+
+/** Return true if boxes @c a and @c b overlap. */
+template<class E> bool intersect(const aabb<E>& a, const aabb<E>& b);
+
+/** Return true if spheres @c a and @c b overlap. */
+template<class E> bool intersect(const sphere<E>& a, const sphere<E>& b);
+
+/** Return true if sphere @c s and box @c box overlap. */
+template<class E> bool intersect(const sphere<E>& s, const aabb<E>& box);
+
+/** Return true if @c box is not entirely behind any of the 6 @c planes,
+ * such as those returned by extract_frustum_planes().  The test is
+ * conservative: boxes near the frustum corners may be reported as visible
+ * when they are not.
+ */
+template<class E>
+bool intersect_frustum(const plane<E> planes[6], const aabb<E>& box);
+
+/** Return true if sphere @c s is not entirely behind any of the 6 @c
+ * planes.  The planes must be normalized.
+ */
+template<class E>
+bool intersect_frustum(const plane<E> planes[6], const sphere<E>& s);
+
+/** Return the point common to planes @c p1, @c p2, and @c p3, which must
+ * have a single unique intersection.
+ */
+template<class E>
+auto intersect_planes(const plane<E>& p1, const plane<E>& p2,
+  const plane<E>& p3) -> vector<E, compiled<3>>;
+
+/** Compute the 8 corners of the frustum bounded by @c planes, in the
+ * order left, right, bottom, top, near, far used by
+ * extract_frustum_planes().  The corners are in CCW order starting at the
+ * lower-left, first on the near plane, then on the far plane.
+ */
+template<class E>
+void frustum_corners(const plane<E> planes[6],
+  vector<E, compiled<3>> corners[8]);
+
+/*@}*/
+
+/*@}*/
+} // namespace cml
+
+#define __CML_MATHLIB_GEOMETRY_INTERSECT_TPP
+#include <cml/mathlib/geometry/intersect.tpp>
+#undef __CML_MATHLIB_GEOMETRY_INTERSECT_TPP
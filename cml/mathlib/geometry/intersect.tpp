@@ -0,0 +1,193 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#ifndef __CML_MATHLIB_GEOMETRY_INTERSECT_TPP
+#  error "mathlib/geometry/intersect.tpp not included correctly"
+#endif
+
+#include <algorithm>
+#include <limits>
+#include <cml/scalar/traits.h>
+#include <cml/vector/binary_ops.h>
+#include <cml/vector/scalar_ops.h>
+#include <cml/vector/cross.h>
+#include <cml/vector/dot.h>
+#include <cml/vector/triple_product.h>
+
+namespace cml {
+
+template<class E>
+bool
+intersect(const ray<E>& r, const aabb<E>& box, E& t_near, E& t_far)
+{
+  E t0 = E(0), t1 = std::numeric_limits<E>::max();
+  for(int i = 0; i < 3; ++i) {
+    const E inv_d = E(1) / r.direction[i];
+    E ta = (box.min[i] - r.origin[i]) * inv_d;
+    E tb = (box.max[i] - r.origin[i]) * inv_d;
+    if(ta > tb) std::swap(ta, tb);
+    t0 = std::max(t0, ta);
+    t1 = std::min(t1, tb);
+    if(t0 > t1) return false;
+  }
+
+  t_near = t0;
+  t_far = t1;
+  return true;
+}
+
+template<class E>
+bool
+intersect(const ray<E>& r, const sphere<E>& s, E& t)
+{
+  using element_traits = scalar_traits<E>;
+
+  /* Solve |o + t*d - c|^2 = r^2, i.e. a*t^2 + 2*b*t + c = 0: */
+  auto oc = r.origin - s.center;
+  const E a = r.direction.length_squared();
+  const E b = cml::dot(oc, r.direction);
+  const E c = oc.length_squared() - s.radius * s.radius;
+  const E disc = b * b - a * c;
+  if(disc < E(0) || a == E(0)) return false;
+
+  const E root = element_traits::sqrt(disc);
+  E t0 = (-b - root) / a;
+  if(t0 < E(0)) t0 = (-b + root) / a;
+  if(t0 < E(0)) return false;
+
+  t = t0;
+  return true;
+}
+
+template<class E>
+bool
+intersect(const ray<E>& r, const plane<E>& p, E& t)
+{
+  const E denom = cml::dot(p.normal, r.direction);
+  if(denom == E(0)) return false;
+
+  const E t0 = -p.distance(r.origin) / denom;
+  if(t0 < E(0)) return false;
+
+  t = t0;
+  return true;
+}
+
+template<class E>
+bool
+intersect(const ray<E>& r, const triangle<E>& tri, E& t, E& u, E& v,
+  bool cull_backfaces)
+{
+  using element_traits = scalar_traits<E>;
+
+  auto e1 = tri.v1 - tri.v0;
+  auto e2 = tri.v2 - tri.v0;
+  auto pvec = cml::cross(r.direction, e2);
+  const E det = cml::dot(e1, pvec);
+
+  /* Parallel, or seen from behind when culling: */
+  const E eps = element_traits::epsilon();
+  if(cull_backfaces ? det <= eps : element_traits::fabs(det) <= eps)
+    return false;
+
+  const E inv_det = E(1) / det;
+  auto tvec = r.origin - tri.v0;
+  const E u0 = cml::dot(tvec, pvec) * inv_det;
+  if(u0 < E(0) || u0 > E(1)) return false;
+
+  auto qvec = cml::cross(tvec, e1);
+  const E v0 = cml::dot(r.direction, qvec) * inv_det;
+  if(v0 < E(0) || u0 + v0 > E(1)) return false;
+
+  const E t0 = cml::dot(e2, qvec) * inv_det;
+  if(t0 < E(0)) return false;
+
+  t = t0;
+  u = u0;
+  v = v0;
+  return true;
+}
+
+template<class E>
+bool
+intersect(const aabb<E>& a, const aabb<E>& b)
+{
+  for(int i = 0; i < 3; ++i)
+    if(a.max[i] < b.min[i] || b.max[i] < a.min[i]) return false;
+  return true;
+}
+
+template<class E>
+bool
+intersect(const sphere<E>& a, const sphere<E>& b)
+{
+  const E r = a.radius + b.radius;
+  return (a.center - b.center).length_squared() <= r * r;
+}
+
+template<class E>
+bool
+intersect(const sphere<E>& s, const aabb<E>& box)
+{
+  /* Squared distance from the center to the box: */
+  E d2 = E(0);
+  for(int i = 0; i < 3; ++i) {
+    const E c = s.center[i];
+    if(c < box.min[i]) d2 += (box.min[i] - c) * (box.min[i] - c);
+    else if(c > box.max[i]) d2 += (c - box.max[i]) * (c - box.max[i]);
+  }
+  return d2 <= s.radius * s.radius;
+}
+
+template<class E>
+bool
+intersect_frustum(const plane<E> planes[6], const aabb<E>& box)
+{
+  for(int i = 0; i < 6; ++i) {
+    /* Test the box corner farthest along the plane normal: */
+    const auto& n = planes[i].normal;
+    E d = planes[i].d;
+    for(int j = 0; j < 3; ++j)
+      d += n[j] * ((n[j] >= E(0)) ? box.max[j] : box.min[j]);
+    if(d < E(0)) return false;
+  }
+  return true;
+}
+
+template<class E>
+bool
+intersect_frustum(const plane<E> planes[6], const sphere<E>& s)
+{
+  for(int i = 0; i < 6; ++i)
+    if(planes[i].distance(s.center) < -s.radius) return false;
+  return true;
+}
+
+template<class E>
+auto
+intersect_planes(const plane<E>& p1, const plane<E>& p2, const plane<E>& p3)
+  -> vector<E, compiled<3>>
+{
+  using vector_type = vector<E, compiled<3>>;
+  const auto& n1 = p1.normal;
+  const auto& n2 = p2.normal;
+  const auto& n3 = p3.normal;
+  vector_type numer = -p1.d * cml::cross(n2, n3) - p2.d * cml::cross(n3, n1)
+    - p3.d * cml::cross(n1, n2);
+  return numer / cml::triple_product(n1, n2, n3);
+}
+
+template<class E>
+void
+frustum_corners(const plane<E> planes[6], vector<E, compiled<3>> corners[8])
+{
+  /* Left/right and bottom/top plane of each corner, CCW from lower-left: */
+  static const int sides[4][2] = {{0, 2}, {1, 2}, {1, 3}, {0, 3}};
+  for(int k = 0; k < 2; ++k)
+    for(int c = 0; c < 4; ++c)
+      corners[4 * k + c] = intersect_planes(planes[sides[c][0]],
+        planes[sides[c][1]], planes[4 + k]);
+}
+
+} // namespace cml
@@ -0,0 +1,50 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cml/matrix/fwd.h>
+#include <cml/mathlib/constants.h>
+#include <cml/mathlib/geometry/primitives.h>
+
+namespace cml {
+/** @addtogroup mathlib_geometry */
+/*@{*/
+
+/** Return the world-space ray through window point (@c pick_x, @c pick_y)
+ * of the viewport with lower-left corner (@c viewport_x, @c viewport_y)
+ * and size @c viewport_width x @c viewport_height.  @c inv_view_projection
+ * is the inverse of the concatenated view and projection matrices, e.g.
+ * inverse(matrix_concat(view, projection)), with the projection built by
+ * matrix_perspective() or matrix_orthographic() using @c z_clip.
+ *
+ * The ray starts on the near plane, and its direction is unit length, so
+ * ray parameters are world-space distances from the near plane.
+ *
+ * @throws minimum_matrix_size_error at run-time if @c inv_view_projection
+ * is dynamically-sized, and is not 4x4.  The size is checked at
+ * compile-time for fixed-size matrices.
+ */
+template<class Sub, class E>
+auto make_pick_ray(E pick_x, E pick_y, E viewport_x, E viewport_y,
+  E viewport_width, E viewport_height,
+  const readable_matrix<Sub>& inv_view_projection, ZClip z_clip)
+  -> ray<value_type_trait_of_t<Sub>>;
+
+/** Return the world-space pick ray through window point (@c pick_x, @c
+ * pick_y), given separate @c view and @c projection matrices.  See
+ * make_pick_ray(pick_x, pick_y, ..., inv_view_projection, z_clip).
+ */
+template<class Sub1, class Sub2, class E>
+auto make_pick_ray(E pick_x, E pick_y, E viewport_x, E viewport_y,
+  E viewport_width, E viewport_height, const readable_matrix<Sub1>& view,
+  const readable_matrix<Sub2>& projection, ZClip z_clip)
+  -> ray<value_type_trait_of_t<Sub1>>;
+
+/*@}*/
+} // namespace cml
+
+#define __CML_MATHLIB_GEOMETRY_PICK_TPP
+#include <cml/mathlib/geometry/pick.tpp>
+#undef __CML_MATHLIB_GEOMETRY_PICK_TPP
@@ -0,0 +1,56 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#ifndef __CML_MATHLIB_GEOMETRY_PICK_TPP
+#  error "mathlib/geometry/pick.tpp not included correctly"
+#endif
+
+#include <cml/matrix/inverse.h>
+#include <cml/mathlib/matrix/concat.h>
+#include <cml/mathlib/vector/transform.h>
+
+namespace cml {
+
+template<class Sub, class E>
+auto
+make_pick_ray(E pick_x, E pick_y, E viewport_x, E viewport_y,
+  E viewport_width, E viewport_height,
+  const readable_matrix<Sub>& inv_view_projection, ZClip z_clip)
+  -> ray<value_type_trait_of_t<Sub>>
+{
+  using value_type = value_type_trait_of_t<Sub>;
+  using vector_type = vector<value_type, compiled<3>>;
+
+  /* Normalized device coordinates of the pick point: */
+  const value_type x =
+    value_type(2 * (pick_x - viewport_x) / viewport_width - 1);
+  const value_type y =
+    value_type(2 * (pick_y - viewport_y) / viewport_height - 1);
+  const value_type z_near =
+    (z_clip == z_clip_neg_one) ? value_type(-1) : value_type(0);
+
+  /* Unproject points on the near and far planes: */
+  vector_type p_near = cml::transform_point_4D(inv_view_projection,
+    vector_type(x, y, z_near));
+  vector_type p_far = cml::transform_point_4D(inv_view_projection,
+    vector_type(x, y, value_type(1)));
+
+  vector_type direction = p_far - p_near;
+  direction.normalize();
+  return ray<value_type>(p_near, direction);
+}
+
+template<class Sub1, class Sub2, class E>
+auto
+make_pick_ray(E pick_x, E pick_y, E viewport_x, E viewport_y,
+  E viewport_width, E viewport_height, const readable_matrix<Sub1>& view,
+  const readable_matrix<Sub2>& projection, ZClip z_clip)
+  -> ray<value_type_trait_of_t<Sub1>>
+{
+  return make_pick_ray(pick_x, pick_y, viewport_x, viewport_y,
+    viewport_width, viewport_height,
+    cml::inverse(cml::matrix_concat(view, projection)), z_clip);
+}
+
+} // namespace cml
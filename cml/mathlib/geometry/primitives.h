@@ -0,0 +1,218 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cml/vector/fixed_compiled.h>
+#include <cml/vector/readable_vector.h>
+
+/** @defgroup mathlib_geometry Geometry Primitives */
+
+namespace cml {
+/** @addtogroup mathlib_geometry */
+/*@{*/
+
+/** A ray with an origin and a direction.  The direction need not be unit
+ * length; ray parameters @c t returned by the intersection functions are
+ * in units of the direction length.
+ */
+template<class Element> struct ray
+{
+  using value_type = Element;
+  using vector_type = vector<Element, compiled<3>>;
+
+  /** The ray origin. */
+  vector_type origin;
+
+  /** The ray direction. */
+  vector_type direction;
+
+  /** Construct a ray at the origin, pointing along +z. */
+  ray();
+
+  /** Construct a ray from @c origin along @c direction.
+   *
+   * @throws vector_size_error at run-time if @c origin or @c direction is
+   * dynamically-sized, and is not 3D.  If fixed-size, the size is checked
+   * at compile-time.
+   */
+  template<class Sub1, class Sub2>
+  ray(const readable_vector<Sub1>& origin,
+    const readable_vector<Sub2>& direction);
+
+  /** Return the point at parameter @c t along the ray. */
+  vector_type at(value_type t) const;
+};
+
+/** An axis-aligned bounding box. */
+template<class Element> struct aabb
+{
+  using value_type = Element;
+  using vector_type = vector<Element, compiled<3>>;
+
+  /** The minimum corner. */
+  vector_type min;
+
+  /** The maximum corner. */
+  vector_type max;
+
+  /** Construct an empty box, with min > max, that can be grown with
+   * extend().
+   */
+  aabb();
+
+  /** Construct a box from its corners.
+   *
+   * @throws vector_size_error at run-time if @c min or @c max is
+   * dynamically-sized, and is not 3D.  If fixed-size, the size is checked
+   * at compile-time.
+   */
+  template<class Sub1, class Sub2>
+  aabb(const readable_vector<Sub1>& min, const readable_vector<Sub2>& max);
+
+  /** Return true if the box contains no points. */
+  bool empty() const;
+
+  /** Return the center of the box. */
+  vector_type center() const;
+
+  /** Return the half-extents of the box. */
+  vector_type extent() const;
+
+  /** Return true if @c p is inside or on the box. */
+  template<class Sub> bool contains(const readable_vector<Sub>& p) const;
+
+  /** Grow the box to contain @c p. */
+  template<class Sub> aabb& extend(const readable_vector<Sub>& p);
+
+  /** Grow the box to contain @c other. */
+  aabb& extend(const aabb& other);
+};
+
+/** A sphere with a center and radius. */
+template<class Element> struct sphere
+{
+  using value_type = Element;
+  using vector_type = vector<Element, compiled<3>>;
+
+  /** The sphere center. */
+  vector_type center;
+
+  /** The sphere radius. */
+  value_type radius;
+
+  /** Construct a unit sphere at the origin. */
+  sphere();
+
+  /** Construct a sphere from its center and radius.
+   *
+   * @throws vector_size_error at run-time if @c center is
+   * dynamically-sized, and is not 3D.  If fixed-size, the size is checked
+   * at compile-time.
+   */
+  template<class Sub>
+  sphere(const readable_vector<Sub>& center, value_type radius);
+
+  /** Return true if @c p is inside or on the sphere. */
+  template<class Sub> bool contains(const readable_vector<Sub>& p) const;
+};
+
+/** A plane in ax+by+cz+d = 0 form, matching the planes produced by
+ * extract_frustum_planes().  Points with positive signed distance are in
+ * front of the plane.
+ */
+template<class Element> struct plane
+{
+  using value_type = Element;
+  using vector_type = vector<Element, compiled<3>>;
+
+  /** The plane normal (a, b, c). */
+  vector_type normal;
+
+  /** The plane offset. */
+  value_type d;
+
+  /** Construct the plane z = 0. */
+  plane();
+
+  /** Construct a plane from its coefficients. */
+  plane(value_type a, value_type b, value_type c, value_type d);
+
+  /** Construct a plane from a 4-element coefficient array, such as one
+   * row of the output of extract_frustum_planes().
+   */
+  template<class E> explicit plane(const E abcd[4]);
+
+  /** Construct the plane through @c p with normal @c n.
+   *
+   * @throws vector_size_error at run-time if @c p or @c n is
+   * dynamically-sized, and is not 3D.  If fixed-size, the size is checked
+   * at compile-time.
+   */
+  template<class Sub1, class Sub2>
+  plane(const readable_vector<Sub1>& p, const readable_vector<Sub2>& n);
+
+  /** Return the signed distance from the plane to @c p, in units of the
+   * normal length.
+   */
+  template<class Sub> value_type distance(const readable_vector<Sub>& p) const;
+
+  /** Scale the plane to unit normal length. */
+  plane& normalize();
+};
+
+/** A triangle given by its vertices, wound counter-clockwise about its
+ * normal.
+ */
+template<class Element> struct triangle
+{
+  using value_type = Element;
+  using vector_type = vector<Element, compiled<3>>;
+
+  /** The vertices. */
+  vector_type v0, v1, v2;
+
+  /** Construct a degenerate triangle at the origin. */
+  triangle();
+
+  /** Construct a triangle from its vertices.
+   *
+   * @throws vector_size_error at run-time if any vertex is
+   * dynamically-sized, and is not 3D.  If fixed-size, the size is checked
+   * at compile-time.
+   */
+  template<class Sub0, class Sub1, class Sub2>
+  triangle(const readable_vector<Sub0>& v0, const readable_vector<Sub1>& v1,
+    const readable_vector<Sub2>& v2);
+
+  /** Return the unnormalized normal (v1-v0)x(v2-v0). */
+  vector_type normal() const;
+
+  /** Return the area of the triangle. */
+  value_type area() const;
+};
+
+
+/** @defgroup mathlib_geometry_types Predefined Geometry Types */
+/*@{*/
+
+using rayf = ray<float>;
+using rayd = ray<double>;
+using aabbf = aabb<float>;
+using aabbd = aabb<double>;
+using spheref = sphere<float>;
+using sphered = sphere<double>;
+using planef = plane<float>;
+using planed = plane<double>;
+using trianglef = triangle<float>;
+using triangled = triangle<double>;
+
+/*@}*/
+
+/*@}*/
+} // namespace cml
+
+#define __CML_MATHLIB_GEOMETRY_PRIMITIVES_TPP
+#include <cml/mathlib/geometry/primitives.tpp>
+#undef __CML_MATHLIB_GEOMETRY_PRIMITIVES_TPP
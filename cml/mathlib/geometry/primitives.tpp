@@ -0,0 +1,243 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#ifndef __CML_MATHLIB_GEOMETRY_PRIMITIVES_TPP
+#  error "mathlib/geometry/primitives.tpp not included correctly"
+#endif
+
+#include <algorithm>
+#include <limits>
+#include <cml/vector/size_checking.h>
+#include <cml/vector/binary_ops.h>
+#include <cml/vector/scalar_ops.h>
+#include <cml/vector/cross.h>
+#include <cml/vector/dot.h>
+
+namespace cml {
+
+/* ray: */
+
+template<class E>
+ray<E>::ray()
+  : origin(E(0), E(0), E(0))
+    , direction(E(0), E(0), E(1))
+{
+}
+
+template<class E>
+template<class Sub1, class Sub2>
+ray<E>::ray(const readable_vector<Sub1>& origin,
+  const readable_vector<Sub2>& direction)
+{
+  cml::check_size(origin, int_c<3>());
+  cml::check_size(direction, int_c<3>());
+  this->origin = origin;
+  this->direction = direction;
+}
+
+template<class E>
+auto
+ray<E>::at(value_type t) const -> vector_type
+{
+  return this->origin + t * this->direction;
+}
+
+
+/* aabb: */
+
+template<class E>
+aabb<E>::aabb()
+{
+  const E big = std::numeric_limits<E>::max();
+  this->min = vector_type(big, big, big);
+  this->max = vector_type(-big, -big, -big);
+}
+
+template<class E>
+template<class Sub1, class Sub2>
+aabb<E>::aabb(const readable_vector<Sub1>& min,
+  const readable_vector<Sub2>& max)
+{
+  cml::check_size(min, int_c<3>());
+  cml::check_size(max, int_c<3>());
+  this->min = min;
+  this->max = max;
+}
+
+template<class E>
+bool
+aabb<E>::empty() const
+{
+  return this->min[0] > this->max[0] || this->min[1] > this->max[1]
+    || this->min[2] > this->max[2];
+}
+
+template<class E>
+auto
+aabb<E>::center() const -> vector_type
+{
+  return E(.5) * (this->min + this->max);
+}
+
+template<class E>
+auto
+aabb<E>::extent() const -> vector_type
+{
+  return E(.5) * (this->max - this->min);
+}
+
+template<class E>
+template<class Sub>
+bool
+aabb<E>::contains(const readable_vector<Sub>& p) const
+{
+  cml::check_size(p, int_c<3>());
+  for(int i = 0; i < 3; ++i)
+    if(p[i] < this->min[i] || p[i] > this->max[i]) return false;
+  return true;
+}
+
+template<class E>
+template<class Sub>
+auto
+aabb<E>::extend(const readable_vector<Sub>& p) -> aabb&
+{
+  cml::check_size(p, int_c<3>());
+  for(int i = 0; i < 3; ++i) {
+    this->min[i] = std::min(this->min[i], E(p[i]));
+    this->max[i] = std::max(this->max[i], E(p[i]));
+  }
+  return *this;
+}
+
+template<class E>
+auto
+aabb<E>::extend(const aabb& other) -> aabb&
+{
+  if(other.empty()) return *this;
+  this->extend(other.min);
+  return this->extend(other.max);
+}
+
+
+/* sphere: */
+
+template<class E>
+sphere<E>::sphere()
+  : center(E(0), E(0), E(0))
+    , radius(E(1))
+{
+}
+
+template<class E>
+template<class Sub>
+sphere<E>::sphere(const readable_vector<Sub>& center, value_type radius)
+  : radius(radius)
+{
+  cml::check_size(center, int_c<3>());
+  this->center = center;
+}
+
+template<class E>
+template<class Sub>
+bool
+sphere<E>::contains(const readable_vector<Sub>& p) const
+{
+  cml::check_size(p, int_c<3>());
+  return (p - this->center).length_squared() <= this->radius * this->radius;
+}
+
+
+/* plane: */
+
+template<class E>
+plane<E>::plane()
+  : normal(E(0), E(0), E(1))
+    , d(E(0))
+{
+}
+
+template<class E>
+plane<E>::plane(value_type a, value_type b, value_type c, value_type d)
+  : normal(a, b, c)
+    , d(d)
+{
+}
+
+template<class E>
+template<class OtherE>
+plane<E>::plane(const OtherE abcd[4])
+  : normal(E(abcd[0]), E(abcd[1]), E(abcd[2]))
+    , d(E(abcd[3]))
+{
+}
+
+template<class E>
+template<class Sub1, class Sub2>
+plane<E>::plane(const readable_vector<Sub1>& p, const readable_vector<Sub2>& n)
+{
+  cml::check_size(p, int_c<3>());
+  cml::check_size(n, int_c<3>());
+  this->normal = n;
+  this->d = -cml::dot(this->normal, p);
+}
+
+template<class E>
+template<class Sub>
+auto
+plane<E>::distance(const readable_vector<Sub>& p) const -> value_type
+{
+  cml::check_size(p, int_c<3>());
+  return cml::dot(this->normal, p) + this->d;
+}
+
+template<class E>
+auto
+plane<E>::normalize() -> plane&
+{
+  const E inv_length = E(1) / this->normal.length();
+  this->normal *= inv_length;
+  this->d *= inv_length;
+  return *this;
+}
+
+
+/* triangle: */
+
+template<class E>
+triangle<E>::triangle()
+  : v0(E(0), E(0), E(0))
+    , v1(E(0), E(0), E(0))
+    , v2(E(0), E(0), E(0))
+{
+}
+
+template<class E>
+template<class Sub0, class Sub1, class Sub2>
+triangle<E>::triangle(const readable_vector<Sub0>& v0,
+  const readable_vector<Sub1>& v1, const readable_vector<Sub2>& v2)
+{
+  cml::check_size(v0, int_c<3>());
+  cml::check_size(v1, int_c<3>());
+  cml::check_size(v2, int_c<3>());
+  this->v0 = v0;
+  this->v1 = v1;
+  this->v2 = v2;
+}
+
+template<class E>
+auto
+triangle<E>::normal() const -> vector_type
+{
+  return cml::cross(this->v1 - this->v0, this->v2 - this->v0);
+}
+
+template<class E>
+auto
+triangle<E>::area() const -> value_type
+{
+  return E(.5) * this->normal().length();
+}
+
+} // namespace cml
@@ -0,0 +1,185 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cml/vector/fixed_compiled.h>
+#include <cml/matrix/fixed_compiled.h>
+#include <cml/quaternion/fixed_compiled.h>
+
+/** @defgroup mathlib_lie SO(3) and SE(3) Exponential and Logarithm Maps
+ *
+ * Closed-form (Rodrigues) exponential and logarithm maps between rotation
+ * vectors omega and SO(3), and between twists xi = (rho, omega) and SE(3),
+ * with the corresponding left and right Jacobians.  Taylor expansions are
+ * used near zero angle.  None of the functions allocate.
+ *
+ * Like matrix_rotation_axis_angle(), rotations and Jacobians are written
+ * as basis vectors, so that they apply to column vectors for col-basis
+ * matrices, and to row vectors for row-basis matrices.  The exponential
+ * of omega is the rotation by |omega| about omega, and the left Jacobian
+ * J_l of omega satisfies exp(omega + d) = exp(J_l*d)*exp(omega) to first
+ * order in d (likewise for SE(3)).  The right Jacobian is J_r(omega) =
+ * J_l(-omega).
+ */
+
+namespace cml {
+/** @addtogroup mathlib_lie */
+/*@{*/
+
+/** Set the linear part of @c R to the rotation exp(omega), and the rest of
+ * @c R to the identity.
+ *
+ * @throws minimum_matrix_size_error at run-time if @c R is
+ * dynamically-sized, and is not at least 3x3.  If @c R is fixed-size, the
+ * size is checked at compile-time.
+ *
+ * @throws vector_size_error at run-time if @c omega is dynamically-sized,
+ * and is not 3D.  If @c omega is fixed-size, the size is checked at
+ * compile-time.
+ */
+template<class Sub, class VSub>
+void so3_exp(writable_matrix<Sub>& R, const readable_vector<VSub>& omega);
+
+/** Set @c q to the unit quaternion of the rotation exp(omega), as by
+ * quaternion_rotation_axis_angle().
+ *
+ * @throws vector_size_error at run-time if @c omega is dynamically-sized,
+ * and is not 3D.  If @c omega is fixed-size, the size is checked at
+ * compile-time.
+ */
+template<class Sub, class VSub>
+void so3_exp(writable_quaternion<Sub>& q, const readable_vector<VSub>& omega);
+
+/** Return the rotation vector omega, with |omega| in [0,pi], of the
+ * rotation in the linear part of @c R.
+ *
+ * @throws minimum_matrix_size_error at run-time if @c R is
+ * dynamically-sized, and is not at least 3x3.  If @c R is fixed-size, the
+ * size is checked at compile-time.
+ */
+template<class Sub>
+auto so3_log(const readable_matrix<Sub>& R)
+  -> vector<value_type_trait_of_t<Sub>, compiled<3>>;
+
+/** Return the rotation vector omega, with |omega| in [0,pi], of the unit
+ * quaternion @c q.
+ */
+template<class Sub>
+auto so3_log(const readable_quaternion<Sub>& q)
+  -> vector<value_type_trait_of_t<Sub>, compiled<3>>;
+
+/** Set @c J to the 3x3 left Jacobian of SO(3) at @c omega.
+ *
+ * @throws matrix_size_error at run-time if @c J is dynamically-sized, and
+ * is not 3x3.  If @c J is fixed-size, the size is checked at compile-time.
+ *
+ * @throws vector_size_error at run-time if @c omega is dynamically-sized,
+ * and is not 3D.  If @c omega is fixed-size, the size is checked at
+ * compile-time.
+ */
+template<class Sub, class VSub>
+void so3_left_jacobian(writable_matrix<Sub>& J,
+  const readable_vector<VSub>& omega);
+
+/** Set @c J to the 3x3 right Jacobian of SO(3) at @c omega. */
+template<class Sub, class VSub>
+void so3_right_jacobian(writable_matrix<Sub>& J,
+  const readable_vector<VSub>& omega);
+
+/** Set @c J to the inverse of the 3x3 left Jacobian of SO(3) at @c omega,
+ * which is singular when |omega| is a non-zero multiple of 2*pi.
+ */
+template<class Sub, class VSub>
+void so3_left_jacobian_inverse(writable_matrix<Sub>& J,
+  const readable_vector<VSub>& omega);
+
+/** Set @c J to the inverse of the 3x3 right Jacobian of SO(3) at @c
+ * omega.
+ */
+template<class Sub, class VSub>
+void so3_right_jacobian_inverse(writable_matrix<Sub>& J,
+  const readable_vector<VSub>& omega);
+
+/** Set the 3D affine transformation @c T to exp(xi), where the twist @c xi
+ * = (rho, omega) holds the translational part rho in elements 0-2 and the
+ * rotation vector omega in elements 3-5.  The rotation of @c T is
+ * exp(omega), and its translation J_l(omega)*rho.
+ *
+ * @throws minimum_matrix_size_error at run-time if @c T is
+ * dynamically-sized, and is not sized for a 3D affine transformation.  If
+ * @c T is fixed-size, the size is checked at compile-time.
+ *
+ * @throws vector_size_error at run-time if @c xi is dynamically-sized, and
+ * is not 6D.  If @c xi is fixed-size, the size is checked at compile-time.
+ */
+template<class Sub, class XiSub>
+void se3_exp(writable_matrix<Sub>& T, const readable_vector<XiSub>& xi);
+
+/** Return the twist xi = (rho, omega) of the 3D rigid transformation @c T.
+ *
+ * @throws minimum_matrix_size_error at run-time if @c T is
+ * dynamically-sized, and is not sized for a 3D affine transformation.  If
+ * @c T is fixed-size, the size is checked at compile-time.
+ */
+template<class Sub>
+auto se3_log(const readable_matrix<Sub>& T)
+  -> vector<value_type_trait_of_t<Sub>, compiled<6>>;
+
+/** Set @c J to the 6x6 left Jacobian of SE(3) at the twist @c xi = (rho,
+ * omega).
+ *
+ * @throws matrix_size_error at run-time if @c J is dynamically-sized, and
+ * is not 6x6.  If @c J is fixed-size, the size is checked at compile-time.
+ *
+ * @throws vector_size_error at run-time if @c xi is dynamically-sized, and
+ * is not 6D.  If @c xi is fixed-size, the size is checked at compile-time.
+ */
+template<class Sub, class XiSub>
+void se3_left_jacobian(writable_matrix<Sub>& J,
+  const readable_vector<XiSub>& xi);
+
+/** Set @c J to the 6x6 right Jacobian of SE(3) at the twist @c xi. */
+template<class Sub, class XiSub>
+void se3_right_jacobian(writable_matrix<Sub>& J,
+  const readable_vector<XiSub>& xi);
+
+/** @defgroup mathlib_lie_batch Batch Exponential and Logarithm Maps
+ *
+ * Apply the maps to the @c n elements of contiguous arrays.
+ */
+/*@{*/
+
+template<class E, class BasisOrient, class Layout>
+void so3_exp(const vector<E, compiled<3>>* omega, int n,
+  matrix<E, compiled<3, 3>, BasisOrient, Layout>* R);
+
+template<class E, class Order, class Cross>
+void so3_exp(const vector<E, compiled<3>>* omega, int n,
+  quaternion<E, fixed<>, Order, Cross>* q);
+
+template<class E, class BasisOrient, class Layout>
+void so3_log(const matrix<E, compiled<3, 3>, BasisOrient, Layout>* R, int n,
+  vector<E, compiled<3>>* omega);
+
+template<class E, class Order, class Cross>
+void so3_log(const quaternion<E, fixed<>, Order, Cross>* q, int n,
+  vector<E, compiled<3>>* omega);
+
+template<class E, class BasisOrient, class Layout>
+void se3_exp(const vector<E, compiled<6>>* xi, int n,
+  matrix<E, compiled<4, 4>, BasisOrient, Layout>* T);
+
+template<class E, class BasisOrient, class Layout>
+void se3_log(const matrix<E, compiled<4, 4>, BasisOrient, Layout>* T, int n,
+  vector<E, compiled<6>>* xi);
+
+/*@}*/
+
+/*@}*/
+} // namespace cml
+
+#define __CML_MATHLIB_LIE_TPP
+#include <cml/mathlib/lie.tpp>
+#undef __CML_MATHLIB_LIE_TPP
@@ -0,0 +1,535 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#ifndef __CML_MATHLIB_LIE_TPP
+#  error "mathlib/lie.tpp not included correctly"
+#endif
+
+#include <cml/scalar/traits.h>
+#include <cml/vector/size_checking.h>
+#include <cml/matrix/size_checking.h>
+#include <cml/mathlib/matrix/size_checking.h>
+
+namespace cml {
+namespace detail {
+
+/** Return the squared angle below which Taylor expansions are used. */
+template<class E>
+inline E
+lie_small_angle2()
+{
+  using element_traits = scalar_traits<E>;
+  static const E small =
+    element_traits::sqrt(element_traits::sqrt(element_traits::epsilon()));
+  return small;
+}
+
+/** Compute the Rodrigues coefficients a = sin(t)/t, b = (1-cos(t))/t^2,
+ * and c = (t-sin(t))/t^3 for the squared angle @c t2 = t^2.
+ */
+template<class E>
+inline void
+lie_coefficients(E t2, E& a, E& b, E& c)
+{
+  using element_traits = scalar_traits<E>;
+  if(t2 < lie_small_angle2<E>()) {
+    a = E(1) - t2 / E(6) * (E(1) - t2 / E(20));
+    b = E(.5) - t2 / E(24) * (E(1) - t2 / E(30));
+    c = E(1) / E(6) - t2 / E(120) * (E(1) - t2 / E(42));
+  } else {
+    const E t = element_traits::sqrt(t2);
+    const E s = element_traits::sin(t);
+    const E h = element_traits::sin(t / E(2));
+    a = s / t;
+    b = E(2) * h * h / t2;
+    c = (t - s) / (t2 * t);
+  }
+}
+
+/** Return d = (1 - a/(2*b))/t^2, the coefficient of K^2 in the inverse of
+ * the SO(3) Jacobians, for the squared angle @c t2 = t^2.
+ */
+template<class E>
+inline E
+lie_inverse_coefficient(E t2, E a, E b)
+{
+  if(t2 < lie_small_angle2<E>())
+    return E(1) / E(12) + t2 / E(720) * (E(1) + t2 / E(42));
+  return (E(1) - a / (E(2) * b)) / t2;
+}
+
+/** Set @c M to the skew-symmetric matrix of @c v, such that M*x = v x x. */
+template<class E>
+inline void
+lie_hat(const E v[3], E M[3][3])
+{
+  M[0][0] = E(0);
+  M[0][1] = -v[2];
+  M[0][2] = v[1];
+  M[1][0] = v[2];
+  M[1][1] = E(0);
+  M[1][2] = -v[0];
+  M[2][0] = -v[1];
+  M[2][1] = v[0];
+  M[2][2] = E(0);
+}
+
+/** Set @c C to A*B for 3x3 arrays. */
+template<class E>
+inline void
+lie_mul(const E A[3][3], const E B[3][3], E C[3][3])
+{
+  for(int i = 0; i < 3; ++i)
+    for(int j = 0; j < 3; ++j)
+      C[i][j] = A[i][0] * B[0][j] + A[i][1] * B[1][j] + A[i][2] * B[2][j];
+}
+
+/** Set @c M to I + s1*K + s2*K^2, where K is the skew-symmetric matrix of
+ * @c w, and @c t2 = |w|^2.
+ */
+template<class E>
+inline void
+lie_rodrigues(const E w[3], E t2, E s1, E s2, E M[3][3])
+{
+  lie_hat(w, M);
+  for(int i = 0; i < 3; ++i)
+    for(int j = 0; j < 3; ++j)
+      M[i][j] = s1 * M[i][j] + s2 * w[i] * w[j]
+        + (i == j ? E(1) - s2 * t2 : E(0));
+}
+
+/** Set @c y to x + s1*(w x x) + s2*(w x (w x x)). */
+template<class E>
+inline void
+lie_rodrigues_apply(const E w[3], E s1, E s2, const E x[3], E y[3])
+{
+  const E c[3] = {w[1] * x[2] - w[2] * x[1], w[2] * x[0] - w[0] * x[2],
+    w[0] * x[1] - w[1] * x[0]};
+  const E cc[3] = {w[1] * c[2] - w[2] * c[1], w[2] * c[0] - w[0] * c[2],
+    w[0] * c[1] - w[1] * c[0]};
+  for(int i = 0; i < 3; ++i) y[i] = x[i] + s1 * c[i] + s2 * cc[i];
+}
+
+/** Set @c R to exp(w). */
+template<class E>
+inline void
+so3_exp(const E w[3], E R[3][3])
+{
+  const E t2 = w[0] * w[0] + w[1] * w[1] + w[2] * w[2];
+  E a, b, c;
+  lie_coefficients(t2, a, b, c);
+  lie_rodrigues(w, t2, a, b, R);
+}
+
+/** Set @c w to log(R), with |w| in [0,pi]. */
+template<class E>
+inline void
+so3_log(const E R[3][3], E w[3])
+{
+  using element_traits = scalar_traits<E>;
+
+  /* v = 2*sin(t)*axis, cos(t) = (trace(R) - 1)/2: */
+  const E v[3] = {R[2][1] - R[1][2], R[0][2] - R[2][0], R[1][0] - R[0][1]};
+  const E n = element_traits::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+  const E co = (R[0][0] + R[1][1] + R[2][2] - E(1)) / E(2);
+  const E t = element_traits::atan2(n / E(2), co);
+
+  if(co >= E(0)) {
+    const E t2 = t * t;
+    const E f = t2 < lie_small_angle2<E>()
+      ? E(.5) * (E(1) + t2 / E(6) * (E(1) + t2 * E(7) / E(60)))
+      : t / n;
+    for(int i = 0; i < 3; ++i) w[i] = f * v[i];
+    return;
+  }
+
+  /* Near pi, v vanishes, so take the axis from the symmetric part
+   * (R + R^T)/2 - cos(t)*I = (1 - cos(t))*axis*axis^T instead, using its
+   * largest column:
+   */
+  int k = 0;
+  for(int i = 1; i < 3; ++i)
+    if(R[i][i] > R[k][k]) k = i;
+  E axis[3];
+  for(int i = 0; i < 3; ++i)
+    axis[i] = (R[i][k] + R[k][i]) / E(2) - (i == k ? co : E(0));
+  E s = t / element_traits::sqrt(axis[k] * (E(1) - co));
+  if(axis[0] * v[0] + axis[1] * v[1] + axis[2] * v[2] < E(0)) s = -s;
+  for(int i = 0; i < 3; ++i) w[i] = s * axis[i];
+}
+
+/** Set @c R and @c t to the rotation and translation of exp(xi). */
+template<class E>
+inline void
+se3_exp(const E xi[6], E R[3][3], E t[3])
+{
+  const E* w = xi + 3;
+  const E t2 = w[0] * w[0] + w[1] * w[1] + w[2] * w[2];
+  E a, b, c;
+  lie_coefficients(t2, a, b, c);
+  lie_rodrigues(w, t2, a, b, R);
+  lie_rodrigues_apply(w, b, c, xi, t);
+}
+
+/** Set @c xi to log of the rigid transformation with rotation @c R and
+ * translation @c t.
+ */
+template<class E>
+inline void
+se3_log(const E R[3][3], const E t[3], E xi[6])
+{
+  E* w = xi + 3;
+  so3_log(R, w);
+  const E t2 = w[0] * w[0] + w[1] * w[1] + w[2] * w[2];
+  E a, b, c;
+  lie_coefficients(t2, a, b, c);
+  lie_rodrigues_apply(w, E(-.5), lie_inverse_coefficient(t2, a, b), t, xi);
+}
+
+/** Set @c J to the 6x6 left Jacobian of SE(3) at @c xi = (rho, omega):
+ * [[J_l(omega), Q], [0, J_l(omega)]].
+ */
+template<class E>
+inline void
+se3_left_jacobian(const E xi[6], E J[6][6])
+{
+  const E* rho = xi;
+  const E* w = xi + 3;
+  const E t2 = w[0] * w[0] + w[1] * w[1] + w[2] * w[2];
+  E a, b, c, q2, q3;
+  lie_coefficients(t2, a, b, c);
+  if(t2 < lie_small_angle2<E>()) {
+    q2 = E(1) / E(24) - t2 / E(720) * (E(1) - t2 / E(56));
+    q3 = E(1) / E(120) - t2 / E(2520) * (E(1) - t2 / E(48));
+  } else {
+    q2 = (E(1) - E(2) * b) / (E(2) * t2);
+    q3 = (E(3) - E(3) * a - b * t2) / (E(2) * t2 * t2);
+  }
+
+  E Jw[3][3];
+  lie_rodrigues(w, t2, b, c, Jw);
+
+  /* Q = rho^/2 + c*(W P + P W + W P W) + q2*(W W P + P W W - 3 W P W)
+   *   + q3*(W P W W + W W P W), with W = omega^ and P = rho^:
+   */
+  E W[3][3], P[3][3], WP[3][3], PW[3][3], WW[3][3], WPW[3][3], WWP[3][3],
+    PWW[3][3], WPWW[3][3], WWPW[3][3];
+  lie_hat(w, W);
+  lie_hat(rho, P);
+  lie_mul(W, P, WP);
+  lie_mul(P, W, PW);
+  lie_mul(W, W, WW);
+  lie_mul(WP, W, WPW);
+  lie_mul(WW, P, WWP);
+  lie_mul(PW, W, PWW);
+  lie_mul(WPW, W, WPWW);
+  lie_mul(W, WPW, WWPW);
+
+  for(int i = 0; i < 3; ++i)
+    for(int j = 0; j < 3; ++j) {
+      J[i][j] = J[i + 3][j + 3] = Jw[i][j];
+      J[i + 3][j] = E(0);
+      J[i][j + 3] = E(.5) * P[i][j] + c * (WP[i][j] + PW[i][j] + WPW[i][j])
+        + q2 * (WWP[i][j] + PWW[i][j] - E(3) * WPW[i][j])
+        + q3 * (WPWW[i][j] + WWPW[i][j]);
+    }
+}
+
+/** Set @c M to the linear part of @c m, written as basis vectors. */
+template<class Sub, class E>
+inline void
+lie_get_linear(const readable_matrix<Sub>& m, E M[3][3])
+{
+  for(int i = 0; i < 3; ++i)
+    for(int j = 0; j < 3; ++j) M[i][j] = m.basis_element(j, i);
+}
+
+/** Set the N x N linear part of @c m to @c M, written as basis vectors. */
+template<int N, class Sub, class E>
+inline void
+lie_set_linear(writable_matrix<Sub>& m, const E M[N][N])
+{
+  for(int i = 0; i < N; ++i)
+    for(int j = 0; j < N; ++j) m.set_basis_element(j, i, M[i][j]);
+}
+
+} // namespace detail
+
+template<class Sub, class VSub>
+void
+so3_exp(writable_matrix<Sub>& R, const readable_vector<VSub>& omega)
+{
+  using value_type = value_type_trait_of_t<Sub>;
+  cml::check_linear_3D(R);
+  cml::check_size(omega, int_c<3>());
+
+  const value_type w[3] = {omega[0], omega[1], omega[2]};
+  value_type M[3][3];
+  detail::so3_exp(w, M);
+  R.identity();
+  detail::lie_set_linear<3>(R, M);
+}
+
+template<class Sub, class VSub>
+void
+so3_exp(writable_quaternion<Sub>& q, const readable_vector<VSub>& omega)
+{
+  using value_type = value_type_trait_of_t<Sub>;
+  using element_traits = scalar_traits<value_type>;
+  cml::check_size(omega, int_c<3>());
+
+  const value_type t2 =
+    omega[0] * omega[0] + omega[1] * omega[1] + omega[2] * omega[2];
+  const value_type t = element_traits::sqrt(t2);
+
+  /* h = sin(t/2)/t: */
+  const value_type h = t2 < detail::lie_small_angle2<value_type>()
+    ? value_type(.5) * (1 - t2 / 24 * (1 - t2 / 80))
+    : element_traits::sin(t / 2) / t;
+  q.set(element_traits::cos(t / 2),
+    vector<value_type, compiled<3>>(h * omega[0], h * omega[1],
+      h * omega[2]));
+}
+
+template<class Sub>
+auto
+so3_log(const readable_matrix<Sub>& R)
+  -> vector<value_type_trait_of_t<Sub>, compiled<3>>
+{
+  using value_type = value_type_trait_of_t<Sub>;
+  cml::check_linear_3D(R);
+
+  value_type M[3][3], w[3];
+  detail::lie_get_linear(R, M);
+  detail::so3_log(M, w);
+  return vector<value_type, compiled<3>>(w[0], w[1], w[2]);
+}
+
+template<class Sub>
+auto
+so3_log(const readable_quaternion<Sub>& q)
+  -> vector<value_type_trait_of_t<Sub>, compiled<3>>
+{
+  using value_type = value_type_trait_of_t<Sub>;
+  using element_traits = scalar_traits<value_type>;
+
+  /* Use the hemisphere with non-negative real part, so that the angle is
+   * at most pi:
+   */
+  const auto v = q.imaginary();
+  const value_type sign = q.real() < 0 ? value_type(-1) : value_type(1);
+  const value_type w0 = sign * q.real();
+  const value_type n2 = v[0] * v[0] + v[1] * v[1] + v[2] * v[2];
+
+  /* f = 2*atan2(n, w0)/n: */
+  value_type f;
+  if(n2 < detail::lie_small_angle2<value_type>() * w0 * w0) {
+    const value_type x2 = n2 / (w0 * w0);
+    f = 2 / w0 * (1 - x2 / 3 * (1 - x2 * 3 / 5));
+  } else {
+    const value_type n = element_traits::sqrt(n2);
+    f = 2 * element_traits::atan2(n, w0) / n;
+  }
+  f *= sign;
+  return vector<value_type, compiled<3>>(f * v[0], f * v[1], f * v[2]);
+}
+
+template<class Sub, class VSub>
+void
+so3_left_jacobian(writable_matrix<Sub>& J, const readable_vector<VSub>& omega)
+{
+  using value_type = value_type_trait_of_t<Sub>;
+  cml::check_size(J, int_c<3>(), int_c<3>());
+  cml::check_size(omega, int_c<3>());
+
+  const value_type w[3] = {omega[0], omega[1], omega[2]};
+  const value_type t2 = w[0] * w[0] + w[1] * w[1] + w[2] * w[2];
+  value_type a, b, c, M[3][3];
+  detail::lie_coefficients(t2, a, b, c);
+  detail::lie_rodrigues(w, t2, b, c, M);
+  detail::lie_set_linear<3>(J, M);
+}
+
+template<class Sub, class VSub>
+void
+so3_right_jacobian(writable_matrix<Sub>& J, const readable_vector<VSub>& omega)
+{
+  using value_type = value_type_trait_of_t<Sub>;
+  cml::check_size(J, int_c<3>(), int_c<3>());
+  cml::check_size(omega, int_c<3>());
+
+  const value_type w[3] = {omega[0], omega[1], omega[2]};
+  const value_type t2 = w[0] * w[0] + w[1] * w[1] + w[2] * w[2];
+  value_type a, b, c, M[3][3];
+  detail::lie_coefficients(t2, a, b, c);
+  detail::lie_rodrigues(w, t2, -b, c, M);
+  detail::lie_set_linear<3>(J, M);
+}
+
+template<class Sub, class VSub>
+void
+so3_left_jacobian_inverse(writable_matrix<Sub>& J,
+  const readable_vector<VSub>& omega)
+{
+  using value_type = value_type_trait_of_t<Sub>;
+  cml::check_size(J, int_c<3>(), int_c<3>());
+  cml::check_size(omega, int_c<3>());
+
+  const value_type w[3] = {omega[0], omega[1], omega[2]};
+  const value_type t2 = w[0] * w[0] + w[1] * w[1] + w[2] * w[2];
+  value_type a, b, c, M[3][3];
+  detail::lie_coefficients(t2, a, b, c);
+  detail::lie_rodrigues(w, t2, value_type(-.5),
+    detail::lie_inverse_coefficient(t2, a, b), M);
+  detail::lie_set_linear<3>(J, M);
+}
+
+template<class Sub, class VSub>
+void
+so3_right_jacobian_inverse(writable_matrix<Sub>& J,
+  const readable_vector<VSub>& omega)
+{
+  using value_type = value_type_trait_of_t<Sub>;
+  cml::check_size(J, int_c<3>(), int_c<3>());
+  cml::check_size(omega, int_c<3>());
+
+  const value_type w[3] = {omega[0], omega[1], omega[2]};
+  const value_type t2 = w[0] * w[0] + w[1] * w[1] + w[2] * w[2];
+  value_type a, b, c, M[3][3];
+  detail::lie_coefficients(t2, a, b, c);
+  detail::lie_rodrigues(w, t2, value_type(.5),
+    detail::lie_inverse_coefficient(t2, a, b), M);
+  detail::lie_set_linear<3>(J, M);
+}
+
+template<class Sub, class XiSub>
+void
+se3_exp(writable_matrix<Sub>& T, const readable_vector<XiSub>& xi)
+{
+  using value_type = value_type_trait_of_t<Sub>;
+  cml::check_affine_3D(T);
+  cml::check_size(xi, int_c<6>());
+
+  value_type x[6], R[3][3], t[3];
+  for(int i = 0; i < 6; ++i) x[i] = xi[i];
+  detail::se3_exp(x, R, t);
+  T.identity();
+  detail::lie_set_linear<3>(T, R);
+  for(int i = 0; i < 3; ++i) T.set_basis_element(3, i, t[i]);
+}
+
+template<class Sub>
+auto
+se3_log(const readable_matrix<Sub>& T)
+  -> vector<value_type_trait_of_t<Sub>, compiled<6>>
+{
+  using value_type = value_type_trait_of_t<Sub>;
+  cml::check_affine_3D(T);
+
+  value_type R[3][3], t[3], x[6];
+  detail::lie_get_linear(T, R);
+  for(int i = 0; i < 3; ++i) t[i] = T.basis_element(3, i);
+  detail::se3_log(R, t, x);
+  return vector<value_type, compiled<6>>(x[0], x[1], x[2], x[3], x[4], x[5]);
+}
+
+template<class Sub, class XiSub>
+void
+se3_left_jacobian(writable_matrix<Sub>& J, const readable_vector<XiSub>& xi)
+{
+  using value_type = value_type_trait_of_t<Sub>;
+  cml::check_size(J, int_c<6>(), int_c<6>());
+  cml::check_size(xi, int_c<6>());
+
+  value_type x[6], M[6][6];
+  for(int i = 0; i < 6; ++i) x[i] = xi[i];
+  detail::se3_left_jacobian(x, M);
+  detail::lie_set_linear<6>(J, M);
+}
+
+template<class Sub, class XiSub>
+void
+se3_right_jacobian(writable_matrix<Sub>& J, const readable_vector<XiSub>& xi)
+{
+  using value_type = value_type_trait_of_t<Sub>;
+  cml::check_size(J, int_c<6>(), int_c<6>());
+  cml::check_size(xi, int_c<6>());
+
+  value_type x[6], M[6][6];
+  for(int i = 0; i < 6; ++i) x[i] = -xi[i];
+  detail::se3_left_jacobian(x, M);
+  detail::lie_set_linear<6>(J, M);
+}
+
+template<class E, class BasisOrient, class Layout>
+void
+so3_exp(const vector<E, compiled<3>>* omega, int n,
+  matrix<E, compiled<3, 3>, BasisOrient, Layout>* R)
+{
+  for(int k = 0; k < n; ++k) {
+    const E w[3] = {omega[k][0], omega[k][1], omega[k][2]};
+    E M[3][3];
+    detail::so3_exp(w, M);
+    detail::lie_set_linear<3>(R[k], M);
+  }
+}
+
+template<class E, class Order, class Cross>
+void
+so3_exp(const vector<E, compiled<3>>* omega, int n,
+  quaternion<E, fixed<>, Order, Cross>* q)
+{
+  for(int k = 0; k < n; ++k) so3_exp(q[k], omega[k]);
+}
+
+template<class E, class BasisOrient, class Layout>
+void
+so3_log(const matrix<E, compiled<3, 3>, BasisOrient, Layout>* R, int n,
+  vector<E, compiled<3>>* omega)
+{
+  for(int k = 0; k < n; ++k) {
+    E M[3][3], w[3];
+    detail::lie_get_linear(R[k], M);
+    detail::so3_log(M, w);
+    omega[k].set(w[0], w[1], w[2]);
+  }
+}
+
+template<class E, class Order, class Cross>
+void
+so3_log(const quaternion<E, fixed<>, Order, Cross>* q, int n,
+  vector<E, compiled<3>>* omega)
+{
+  for(int k = 0; k < n; ++k) omega[k] = so3_log(q[k]);
+}
+
+template<class E, class BasisOrient, class Layout>
+void
+se3_exp(const vector<E, compiled<6>>* xi, int n,
+  matrix<E, compiled<4, 4>, BasisOrient, Layout>* T)
+{
+  for(int k = 0; k < n; ++k) {
+    E x[6], R[3][3], t[3];
+    for(int i = 0; i < 6; ++i) x[i] = xi[k][i];
+    detail::se3_exp(x, R, t);
+    T[k].identity();
+    detail::lie_set_linear<3>(T[k], R);
+    for(int i = 0; i < 3; ++i) T[k].set_basis_element(3, i, t[i]);
+  }
+}
+
+template<class E, class BasisOrient, class Layout>
+void
+se3_log(const matrix<E, compiled<4, 4>, BasisOrient, Layout>* T, int n,
+  vector<E, compiled<6>>* xi)
+{
+  for(int k = 0; k < n; ++k) {
+    E R[3][3], t[3], x[6];
+    detail::lie_get_linear(T[k], R);
+    for(int i = 0; i < 3; ++i) t[i] = T[k].basis_element(3, i);
+    detail::se3_log(R, t, x);
+    for(int i = 0; i < 6; ++i) xi[k][i] = x[i];
+  }
+}
+} // namespace cml
@@ -21,10 +21,18 @@
 #include <cml/mathlib/matrix/projection.h>
 #include <cml/mathlib/matrix/generators.h>
 #include <cml/mathlib/matrix/misc.h>
+#include <cml/mathlib/matrix/orthonormalize.h>
 
 #include <cml/mathlib/quaternion/basis.h>
 #include <cml/mathlib/quaternion/rotation.h>
+#include <cml/mathlib/quaternion/dual_quaternion.h>
 
 #include <cml/mathlib/coordinate_conversion.h>
 #include <cml/mathlib/random_unit.h>
 #include <cml/mathlib/frustum.h>
+#include <cml/mathlib/lie.h>
+
+#include <cml/mathlib/geometry/primitives.h>
+#include <cml/mathlib/geometry/intersect.h>
+#include <cml/mathlib/geometry/batch.h>
+#include <cml/mathlib/geometry/pick.h>
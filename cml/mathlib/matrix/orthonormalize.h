@@ -0,0 +1,94 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cml/matrix/fixed_compiled.h>
+#include <cml/quaternion/fixed_compiled.h>
+
+/** @defgroup mathlib_matrix_ortho Matrix Orthonormalization Functions
+ *
+ * These functions restore orthonormality to rotation matrices and unit
+ * length to quaternions that have drifted through repeated composition or
+ * integration.  The batched versions process arrays of fixed-size matrices
+ * or quaternions a block at a time, in structure-of-arrays form, so that
+ * the inner loops are straight-line code the compiler can vectorize across
+ * elements.
+ *
+ * The batched versions normalize using Newton-Raphson refinement of the
+ * reciprocal square root, starting from 1.  This avoids the square root
+ * and division entirely, and is accurate when the inputs are already near
+ * unit length: after one refinement, a length error of e is reduced to
+ * about 1.5*e^2.  Passing a refinement count of 0 selects the exact
+ * reciprocal square root instead.
+ */
+
+namespace cml {
+/** @addtogroup mathlib_matrix_ortho */
+/*@{*/
+
+/** Orthonormalize the basis vectors of the upper-left 3x3 submatrix of @c
+ * m using Gram-Schmidt, accounting for the basis orientation.  The
+ * direction of the basis vector indexed by @c stable_axis is unchanged,
+ * the next basis vector (cyclically) is made orthogonal to it, and the
+ * last is set to their cross product, so that the result is a rotation if
+ * @c m was close to one.  Other elements of @c m are not modified.
+ *
+ * @throws minimum_matrix_size_error if @c m is dynamically-sized, and is
+ * not at least 3x3.  If @c m is fixed-size, the size is checked at
+ * compile-time.
+ *
+ * @throws std::invalid_argument if @c stable_axis is not 0, 1, or 2.
+ */
+template<class Sub>
+void matrix_orthonormalize(writable_matrix<Sub>& m, int stable_axis = 2);
+
+/** Replace the upper-left 3x3 submatrix of @c m by an approximation of its
+ * orthogonal polar factor, the rotation nearest to it in the Frobenius
+ * norm, using @c iterations steps of the Newton-Schulz iteration
+ * X <- 1.5*X - 0.5*X*X^T*X.  Unlike Gram-Schmidt, the correction is
+ * distributed symmetrically over the basis vectors.  The iteration
+ * converges quadratically when @c m is near a rotation, and requires the
+ * singular values of @c m to lie in (0, sqrt(3)).  Other elements of @c m
+ * are not modified.
+ *
+ * @throws minimum_matrix_size_error if @c m is dynamically-sized, and is
+ * not at least 3x3.  If @c m is fixed-size, the size is checked at
+ * compile-time.
+ */
+template<class Sub>
+void matrix_orthonormalize_symmetric(writable_matrix<Sub>& m,
+  int iterations = 2);
+
+/** Orthonormalize the upper-left 3x3 submatrices of the @c n matrices
+ * starting at @c m using Gram-Schmidt, keeping the direction of the z
+ * basis vector, as by matrix_orthonormalize(m, 2).  Normalization uses @c
+ * refinements Newton-Raphson steps (see @ref mathlib_matrix_ortho).
+ */
+template<class E, int Rows, int Cols, class BasisOrient, class Layout>
+void matrix_orthonormalize(
+  matrix<E, compiled<Rows, Cols>, BasisOrient, Layout>* m, int n,
+  int refinements = 1);
+
+/** Apply matrix_orthonormalize_symmetric() with @c iterations steps to the
+ * @c n matrices starting at @c m.
+ */
+template<class E, int Rows, int Cols, class BasisOrient, class Layout>
+void matrix_orthonormalize_symmetric(
+  matrix<E, compiled<Rows, Cols>, BasisOrient, Layout>* m, int n,
+  int iterations = 2);
+
+/** Normalize the @c n quaternions starting at @c q, using @c refinements
+ * Newton-Raphson steps (see @ref mathlib_matrix_ortho).
+ */
+template<class E, class Order, class Cross>
+void quaternion_normalize(quaternion<E, fixed<>, Order, Cross>* q, int n,
+  int refinements = 1);
+
+/*@}*/
+} // namespace cml
+
+#define __CML_MATHLIB_MATRIX_ORTHONORMALIZE_TPP
+#include <cml/mathlib/matrix/orthonormalize.tpp>
+#undef __CML_MATHLIB_MATRIX_ORTHONORMALIZE_TPP
@@ -0,0 +1,237 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#ifndef __CML_MATHLIB_MATRIX_ORTHONORMALIZE_TPP
+#  error "mathlib/matrix/orthonormalize.tpp not included correctly"
+#endif
+
+#include <algorithm>
+#include <cml/common/exception.h>
+#include <cml/scalar/functions.h>
+#include <cml/scalar/traits.h>
+#include <cml/matrix/writable_matrix.h>
+#include <cml/mathlib/matrix/size_checking.h>
+
+namespace cml {
+namespace detail {
+
+/** The number of matrices or quaternions processed at a time by the
+ * batched kernels.
+ */
+const int ortho_block_size = 64;
+
+/** Set @c s[b] to the reciprocal square root of @c x2[b] for @c count
+ * values, using @c refinements Newton-Raphson steps starting from 1, or
+ * exactly if @c refinements is 0.
+ */
+template<class E>
+inline void
+ortho_rsqrt(const E* x2, E* s, int count, int refinements)
+{
+  using element_traits = scalar_traits<E>;
+  if(refinements <= 0) {
+    for(int b = 0; b < count; ++b) s[b] = E(1) / element_traits::sqrt(x2[b]);
+    return;
+  }
+
+  for(int b = 0; b < count; ++b) s[b] = E(1);
+  for(int r = 0; r < refinements; ++r)
+    for(int b = 0; b < count; ++b)
+      s[b] *= E(1.5) - E(.5) * x2[b] * s[b] * s[b];
+}
+
+/** Gram-Schmidt kernel for @c count 3x3 bases stored in
+ * structure-of-arrays form, such that component j of basis vector i of
+ * basis b is v[(3*i+j)*stride + b].  Basis vector 0 keeps its direction,
+ * basis vector 1 is made orthogonal to it, and basis vector 2 is replaced
+ * by their cross product.
+ */
+template<class E>
+inline void
+ortho_gram_schmidt(E* v, int stride, int count, int refinements)
+{
+  E* x0 = v;
+  E* y0 = v + stride;
+  E* z0 = v + 2 * stride;
+  E* x1 = v + 3 * stride;
+  E* y1 = v + 4 * stride;
+  E* z1 = v + 5 * stride;
+  E* x2 = v + 6 * stride;
+  E* y2 = v + 7 * stride;
+  E* z2 = v + 8 * stride;
+  E n2[ortho_block_size], s[ortho_block_size];
+
+  for(int b = 0; b < count; ++b)
+    n2[b] = x0[b] * x0[b] + y0[b] * y0[b] + z0[b] * z0[b];
+  ortho_rsqrt(n2, s, count, refinements);
+  for(int b = 0; b < count; ++b) {
+    x0[b] *= s[b];
+    y0[b] *= s[b];
+    z0[b] *= s[b];
+    const E d = x0[b] * x1[b] + y0[b] * y1[b] + z0[b] * z1[b];
+    x1[b] -= d * x0[b];
+    y1[b] -= d * y0[b];
+    z1[b] -= d * z0[b];
+    n2[b] = x1[b] * x1[b] + y1[b] * y1[b] + z1[b] * z1[b];
+  }
+
+  ortho_rsqrt(n2, s, count, refinements);
+  for(int b = 0; b < count; ++b) {
+    x1[b] *= s[b];
+    y1[b] *= s[b];
+    z1[b] *= s[b];
+    x2[b] = y0[b] * z1[b] - z0[b] * y1[b];
+    y2[b] = z0[b] * x1[b] - x0[b] * z1[b];
+    z2[b] = x0[b] * y1[b] - y0[b] * x1[b];
+  }
+}
+
+/** Newton-Schulz kernel for @c count 3x3 matrices stored in
+ * structure-of-arrays form, such that element (i,j) of matrix b is
+ * a[(3*i+j)*stride + b].
+ */
+template<class E>
+inline void
+ortho_newton_schulz(E* a, int stride, int count, int iterations)
+{
+  for(int it = 0; it < iterations; ++it) {
+    for(int b = 0; b < count; ++b) {
+      E x[9];
+      for(int k = 0; k < 9; ++k) x[k] = a[k * stride + b];
+
+      /* S = X*X^T, symmetric: */
+      const E s00 = x[0] * x[0] + x[1] * x[1] + x[2] * x[2];
+      const E s01 = x[0] * x[3] + x[1] * x[4] + x[2] * x[5];
+      const E s02 = x[0] * x[6] + x[1] * x[7] + x[2] * x[8];
+      const E s11 = x[3] * x[3] + x[4] * x[4] + x[5] * x[5];
+      const E s12 = x[3] * x[6] + x[4] * x[7] + x[5] * x[8];
+      const E s22 = x[6] * x[6] + x[7] * x[7] + x[8] * x[8];
+
+      /* X <- 1.5*X - 0.5*S*X: */
+      for(int j = 0; j < 3; ++j) {
+        const E c0 = x[j], c1 = x[3 + j], c2 = x[6 + j];
+        a[j * stride + b] =
+          E(1.5) * c0 - E(.5) * (s00 * c0 + s01 * c1 + s02 * c2);
+        a[(3 + j) * stride + b] =
+          E(1.5) * c1 - E(.5) * (s01 * c0 + s11 * c1 + s12 * c2);
+        a[(6 + j) * stride + b] =
+          E(1.5) * c2 - E(.5) * (s02 * c0 + s12 * c1 + s22 * c2);
+      }
+    }
+  }
+}
+
+} // namespace detail
+
+template<class Sub>
+void
+matrix_orthonormalize(writable_matrix<Sub>& m, int stable_axis)
+{
+  using value_type = value_type_trait_of_t<Sub>;
+  cml::check_linear_3D(m);
+  cml_require(0 <= stable_axis && stable_axis <= 2, std::invalid_argument,
+    "invalid 3D index");
+
+  int axis[3];
+  cyclic_permutation(stable_axis, axis[0], axis[1], axis[2]);
+
+  value_type v[9];
+  for(int i = 0; i < 3; ++i)
+    for(int j = 0; j < 3; ++j) v[3 * i + j] = m.basis_element(axis[i], j);
+  detail::ortho_gram_schmidt(v, 1, 1, 0);
+  for(int i = 0; i < 3; ++i)
+    for(int j = 0; j < 3; ++j) m.set_basis_element(axis[i], j, v[3 * i + j]);
+}
+
+template<class Sub>
+void
+matrix_orthonormalize_symmetric(writable_matrix<Sub>& m, int iterations)
+{
+  using value_type = value_type_trait_of_t<Sub>;
+  cml::check_linear_3D(m);
+
+  value_type a[9];
+  for(int i = 0; i < 3; ++i)
+    for(int j = 0; j < 3; ++j) a[3 * i + j] = m(i, j);
+  detail::ortho_newton_schulz(a, 1, 1, iterations);
+  for(int i = 0; i < 3; ++i)
+    for(int j = 0; j < 3; ++j) m(i, j) = a[3 * i + j];
+}
+
+template<class E, int Rows, int Cols, class BasisOrient, class Layout>
+void
+matrix_orthonormalize(matrix<E, compiled<Rows, Cols>, BasisOrient, Layout>* m,
+  int n, int refinements)
+{
+  static_assert(Rows >= 3 && Cols >= 3, "matrix must be at least 3x3");
+
+  /* Bases are gathered z, x, y, so that z keeps its direction: */
+  const int axis[3] = {2, 0, 1};
+  const int B = detail::ortho_block_size;
+  E v[9 * B];
+  for(int first = 0; first < n; first += B) {
+    const int count = std::min(B, n - first);
+    for(int b = 0; b < count; ++b)
+      for(int i = 0; i < 3; ++i)
+        for(int j = 0; j < 3; ++j)
+          v[(3 * i + j) * B + b] = m[first + b].basis_element(axis[i], j);
+
+    detail::ortho_gram_schmidt(v, B, count, refinements);
+
+    for(int b = 0; b < count; ++b)
+      for(int i = 0; i < 3; ++i)
+        for(int j = 0; j < 3; ++j)
+          m[first + b].set_basis_element(axis[i], j, v[(3 * i + j) * B + b]);
+  }
+}
+
+template<class E, int Rows, int Cols, class BasisOrient, class Layout>
+void
+matrix_orthonormalize_symmetric(
+  matrix<E, compiled<Rows, Cols>, BasisOrient, Layout>* m, int n,
+  int iterations)
+{
+  static_assert(Rows >= 3 && Cols >= 3, "matrix must be at least 3x3");
+
+  const int B = detail::ortho_block_size;
+  E a[9 * B];
+  for(int first = 0; first < n; first += B) {
+    const int count = std::min(B, n - first);
+    for(int b = 0; b < count; ++b)
+      for(int i = 0; i < 3; ++i)
+        for(int j = 0; j < 3; ++j) a[(3 * i + j) * B + b] = m[first + b](i, j);
+
+    detail::ortho_newton_schulz(a, B, count, iterations);
+
+    for(int b = 0; b < count; ++b)
+      for(int i = 0; i < 3; ++i)
+        for(int j = 0; j < 3; ++j) m[first + b](i, j) = a[(3 * i + j) * B + b];
+  }
+}
+
+template<class E, class Order, class Cross>
+void
+quaternion_normalize(quaternion<E, fixed<>, Order, Cross>* q, int n,
+  int refinements)
+{
+  const int B = detail::ortho_block_size;
+  E c[4 * B], n2[B], s[B];
+  for(int first = 0; first < n; first += B) {
+    const int count = std::min(B, n - first);
+    for(int b = 0; b < count; ++b)
+      for(int k = 0; k < 4; ++k) c[k * B + b] = q[first + b][k];
+
+    for(int b = 0; b < count; ++b)
+      n2[b] = c[b] * c[b] + c[B + b] * c[B + b] + c[2 * B + b] * c[2 * B + b]
+        + c[3 * B + b] * c[3 * B + b];
+    detail::ortho_rsqrt(n2, s, count, refinements);
+    for(int k = 0; k < 4; ++k)
+      for(int b = 0; b < count; ++b) c[k * B + b] *= s[b];
+
+    for(int b = 0; b < count; ++b)
+      for(int k = 0; k < 4; ++k) q[first + b][k] = c[k * B + b];
+  }
+}
+
+} // namespace cml
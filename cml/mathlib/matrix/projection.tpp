@@ -230,66 +230,3 @@ matrix_perspective_yfov_RH(writable_matrix<Sub>& m, E yfov, E aspect, E n, E f,
   matrix_perspective_yfov(m, yfov, aspect, n, f, right_handed, z_clip);
 }
 } // namespace cml
-
-#if 0
-// XXX INCOMPLETE XXX
-
-/* Build a viewport matrix
- *
- * Note: A viewport matrix is in a sense the opposite of an orthographics
- * projection matrix, and can be build by constructing and inverting the
- * latter.
- *
- * @todo: Need to look into D3D viewport conventions and see if this needs to
- * be adapted accordingly.
- */
-
-template<typename E, class A, class B, class L> void
-matrix_viewport(matrix<E, A, B, L>& m, E left, E right, E bottom,
-  E top, ZClip z_clip, E n = E(0), E f = E(1))
-{
-  matrix_orthographic_LH(m, left, right, bottom, top, n, f, z_clip);
-  /* @todo: invert(m), when available */
-  m = inverse(m);
-}
-
-//////////////////////////////////////////////////////////////////////////////
-// 3D picking volume
-//////////////////////////////////////////////////////////////////////////////
-
-/* Build a pick volume matrix
- *
- * When post-concatenated with a projection matrix, the pick matrix modifies
- * the view volume to create a 'picking volume'. This volume corresponds to
- * a screen rectangle centered at (pick_x, pick_y) and with dimensions
- * pick_widthXpick_height.
- *
- * @todo: Representation of viewport between this function and
- * matrix_viewport() is inconsistent (position and dimensions vs. bounds).
- * Should this be addressed?
- */
-
-template<typename E, class A, class B, class L> void
-matrix_pick(
-  matrix<E, A, B, L>& m, E pick_x, E pick_y, E pick_width, E pick_height,
-  E viewport_x, E viewport_y, E viewport_width, E viewport_height)
-{
-  typedef matrix<E, A, B, L> matrix_type;
-  typedef typename matrix_type::value_type value_type;
-
-  /* Checking */
-  detail::CheckMatHomogeneous3D(m);
-
-  identity_transform(m);
-
-  value_type inv_width = value_type(1) / pick_width;
-  value_type inv_height = value_type(1) / pick_height;
-
-  m.set_basis_element(0, 0, viewport_width * inv_width);
-  m.set_basis_element(1, 1, viewport_height * inv_height);
-  m.set_basis_element(3, 0,
-    (viewport_width + value_type(2) * (viewport_x - pick_x)) * inv_width);
-  m.set_basis_element(3, 1,
-    (viewport_height + value_type(2) * (viewport_y - pick_y)) * inv_height);
-}
-#endif
@@ -31,7 +31,8 @@ struct affine_matrix_size_error : std::runtime_error
  * dynamically-sized, and is not sized for a 2D affine transformation.  If
  * @c m is fixed-size, the size is checked at compile-time.
  */
-template<class Sub> void check_affine_2D(const readable_matrix<Sub>& m);
+template<class Sub>
+void check_affine_2D(const readable_matrix<Sub>& m) CML_SIZE_CHECK_NOEXCEPT;
 
 /** Front-end for both compile-time and run-time 3D affine matrix size
  * checking.  A row-basis matrix must be at least 4x3, while a column-basis
@@ -43,7 +44,8 @@ template<class Sub> void check_affine_2D(const readable_matrix<Sub>& m);
  * dynamically-sized, and is not sized for a 3D affine transformation.  If
  * @c m is fixed-size, the size is checked at compile-time.
  */
-template<class Sub> void check_affine_3D(const readable_matrix<Sub>& m);
+template<class Sub>
+void check_affine_3D(const readable_matrix<Sub>& m) CML_SIZE_CHECK_NOEXCEPT;
 
 /** Front-end for both compile-time and run-time affine matrix size
  * checking.  A row-basis matrix must have size (N,N) or (N+1,N), while
@@ -55,7 +57,8 @@ template<class Sub> void check_affine_3D(const readable_matrix<Sub>& m);
  * dynamically-sized, and is not sized for an affine transformation.  If @c
  * m is fixed-size, the size is checked at compile-time.
  */
-template<class Sub> void check_affine(const readable_matrix<Sub>& m);
+template<class Sub>
+void check_affine(const readable_matrix<Sub>& m) CML_SIZE_CHECK_NOEXCEPT;
 
 /** Front-end for both compile-time and run-time 2D linear matrix size
  * checking.  A linear matrix must be at least 2x2.
@@ -66,7 +69,8 @@ template<class Sub> void check_affine(const readable_matrix<Sub>& m);
  * dynamically-sized, and is not sized for a 2D linear transformation.  If
  * @c m is fixed-size, the size is checked at compile-time.
  */
-template<class Sub> void check_linear_2D(const readable_matrix<Sub>& m);
+template<class Sub>
+void check_linear_2D(const readable_matrix<Sub>& m) CML_SIZE_CHECK_NOEXCEPT;
 
 /** Front-end for both compile-time and run-time 3D linear matrix size
  * checking.  A linear matrix must be at least 3x3.
@@ -77,7 +81,8 @@ template<class Sub> void check_linear_2D(const readable_matrix<Sub>& m);
  * dynamically-sized, and is not sized for a 3D linear transformation.  If
  * @c m is fixed-size, the size is checked at compile-time.
  */
-template<class Sub> void check_linear_3D(const readable_matrix<Sub>& m);
+template<class Sub>
+void check_linear_3D(const readable_matrix<Sub>& m) CML_SIZE_CHECK_NOEXCEPT;
 } // namespace cml
 
 #define __CML_MATHLIB_MATRIX_SIZE_CHECKING_TPP
@@ -13,14 +13,15 @@ namespace detail {
 /* No-op matrix size checking. */
 template<class Sub>
 void
-check_affine_2D(const readable_matrix<Sub>&, any_basis)
+check_affine_2D(const readable_matrix<Sub>&, any_basis) CML_SIZE_CHECK_NOEXCEPT
 {
 }
 
 /* Size checking for a row-basis matrix: */
 template<class Sub>
 void
-check_affine_2D(const readable_matrix<Sub>& m, row_basis)
+check_affine_2D(const readable_matrix<Sub>& m,
+  row_basis) CML_SIZE_CHECK_NOEXCEPT
 {
   cml::check_minimum_size(m, cml::int_c<3>(), cml::int_c<2>());
 }
@@ -28,7 +29,8 @@ check_affine_2D(const readable_matrix<Sub>& m, row_basis)
 /* Size checking for a column-basis matrix: */
 template<class Sub>
 void
-check_affine_2D(const readable_matrix<Sub>& m, col_basis)
+check_affine_2D(const readable_matrix<Sub>& m,
+  col_basis) CML_SIZE_CHECK_NOEXCEPT
 {
   cml::check_minimum_size(m, cml::int_c<2>(), cml::int_c<3>());
 }
@@ -36,14 +38,15 @@ check_affine_2D(const readable_matrix<Sub>& m, col_basis)
 /* No-op matrix size checking. */
 template<class Sub>
 void
-check_affine_3D(const readable_matrix<Sub>&, any_basis)
+check_affine_3D(const readable_matrix<Sub>&, any_basis) CML_SIZE_CHECK_NOEXCEPT
 {
 }
 
 /* Size checking for a row-basis matrix: */
 template<class Sub>
 void
-check_affine_3D(const readable_matrix<Sub>& m, row_basis)
+check_affine_3D(const readable_matrix<Sub>& m,
+  row_basis) CML_SIZE_CHECK_NOEXCEPT
 {
   cml::check_minimum_size(m, cml::int_c<4>(), cml::int_c<3>());
 }
@@ -51,7 +54,8 @@ check_affine_3D(const readable_matrix<Sub>& m, row_basis)
 /* Size checking for a column-basis matrix: */
 template<class Sub>
 void
-check_affine_3D(const readable_matrix<Sub>& m, col_basis)
+check_affine_3D(const readable_matrix<Sub>& m,
+  col_basis) CML_SIZE_CHECK_NOEXCEPT
 {
   cml::check_minimum_size(m, cml::int_c<3>(), cml::int_c<4>());
 }
@@ -59,7 +63,8 @@ check_affine_3D(const readable_matrix<Sub>& m, col_basis)
 /* Compile-time affine matrix size checking: */
 template<class Sub>
 void
-check_affine(const readable_matrix<Sub>&, fixed_size_tag)
+check_affine(const readable_matrix<Sub>&,
+  fixed_size_tag) CML_SIZE_CHECK_NOEXCEPT
 {
   using traits = matrix_traits<Sub>;
 
@@ -76,7 +81,8 @@ check_affine(const readable_matrix<Sub>&, fixed_size_tag)
 /* Run-time affine matrix size checking: */
 template<class Sub>
 void
-check_affine(const readable_matrix<Sub>& m, dynamic_size_tag)
+check_affine(const readable_matrix<Sub>& m,
+  dynamic_size_tag) CML_SIZE_CHECK_NOEXCEPT
 {
   using traits = matrix_traits<Sub>;
 
@@ -85,13 +91,13 @@ check_affine(const readable_matrix<Sub>& m, dynamic_size_tag)
    */
   int M = is_row_basis<traits>::value ? m.rows() : m.cols();
   int N = is_row_basis<traits>::value ? m.cols() : m.rows();
-  cml_require(M == N || M == N + 1, affine_matrix_size_error, /**/);
+  cml_size_require(M == N || M == N + 1, affine_matrix_size_error, /**/);
 }
 } // namespace detail
 
 template<class Sub>
 void
-check_affine_2D(const readable_matrix<Sub>& m)
+check_affine_2D(const readable_matrix<Sub>& m) CML_SIZE_CHECK_NOEXCEPT
 {
   using tag = basis_tag_of_t<Sub>;
   detail::check_affine_2D(m, tag());
@@ -99,7 +105,7 @@ check_affine_2D(const readable_matrix<Sub>& m)
 
 template<class Sub>
 void
-check_affine_3D(const readable_matrix<Sub>& m)
+check_affine_3D(const readable_matrix<Sub>& m) CML_SIZE_CHECK_NOEXCEPT
 {
   using tag = basis_tag_of_t<Sub>;
   detail::check_affine_3D(m, tag());
@@ -107,7 +113,7 @@ check_affine_3D(const readable_matrix<Sub>& m)
 
 template<class Sub>
 void
-check_affine(const readable_matrix<Sub>& m)
+check_affine(const readable_matrix<Sub>& m) CML_SIZE_CHECK_NOEXCEPT
 {
   using size_tag = size_tag_of_t<Sub>;
   static_assert(!is_any_basis<Sub>::value, "row_basis or col_basis required");
@@ -116,14 +122,14 @@ check_affine(const readable_matrix<Sub>& m)
 
 template<class Sub>
 void
-check_linear_2D(const readable_matrix<Sub>& m)
+check_linear_2D(const readable_matrix<Sub>& m) CML_SIZE_CHECK_NOEXCEPT
 {
   cml::check_minimum_size(m, cml::int_c<2>(), cml::int_c<2>());
 }
 
 template<class Sub>
 void
-check_linear_3D(const readable_matrix<Sub>& m)
+check_linear_3D(const readable_matrix<Sub>& m) CML_SIZE_CHECK_NOEXCEPT
 {
   cml::check_minimum_size(m, cml::int_c<3>(), cml::int_c<3>());
 }
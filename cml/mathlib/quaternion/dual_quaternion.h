@@ -0,0 +1,46 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cml/matrix/fwd.h>
+#include <cml/quaternion/dual_quaternion.h>
+
+/** @defgroup mathlib_quaternion_dual Dual Quaternion Conversion Functions */
+
+namespace cml {
+/** @addtogroup mathlib_quaternion_dual */
+/*@{*/
+
+/** Build a 3D rigid transformation matrix from the unit dual quaternion
+ * @c dq.  The rotation is set from the real part, and the translation from
+ * the decoded translation of @c dq.
+ *
+ * @throws minimum_matrix_size_error at run-time if @c m is
+ * dynamically-sized, and is not sized for a 3D affine transformation.  If
+ * @c m is fixed-size, the size is checked at compile-time.
+ */
+template<class Sub, class E, class S, class O, class C>
+void matrix_rigid_dual_quaternion(writable_matrix<Sub>& m,
+  const dual_quaternion<E, S, O, C>& dq);
+
+/** Set the dual quaternion @c dq from the rotation and translation of the
+ * 3D rigid transformation matrix @c m.
+ *
+ * @note Any scale or shear in the linear part of @c m is not removed.
+ *
+ * @throws minimum_matrix_size_error at run-time if @c m is
+ * dynamically-sized, and is not sized for a 3D affine transformation.  If
+ * @c m is fixed-size, the size is checked at compile-time.
+ */
+template<class E, class S, class O, class C, class Sub>
+void dual_quaternion_rigid_matrix(dual_quaternion<E, S, O, C>& dq,
+  const readable_matrix<Sub>& m);
+
+/*@}*/
+} // namespace cml
+
+#define __CML_MATHLIB_QUATERNION_DUAL_QUATERNION_TPP
+#include <cml/mathlib/quaternion/dual_quaternion.tpp>
+#undef __CML_MATHLIB_QUATERNION_DUAL_QUATERNION_TPP
@@ -0,0 +1,43 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#ifndef __CML_MATHLIB_QUATERNION_DUAL_QUATERNION_TPP
+#  error "mathlib/quaternion/dual_quaternion.tpp not included correctly"
+#endif
+
+#include <cml/common/mpl/are_convertible.h>
+#include <cml/mathlib/matrix/size_checking.h>
+#include <cml/mathlib/matrix/rotation.h>
+#include <cml/mathlib/matrix/translation.h>
+#include <cml/mathlib/quaternion/rotation.h>
+
+namespace cml {
+
+template<class Sub, class E, class S, class O, class C>
+void
+matrix_rigid_dual_quaternion(writable_matrix<Sub>& m,
+  const dual_quaternion<E, S, O, C>& dq)
+{
+  static_assert(cml::are_convertible<value_type_trait_of_t<Sub>, E>::value,
+    "incompatible scalar types");
+
+  cml::check_affine_3D(m);
+  matrix_rotation_quaternion(m, dq.real());
+  matrix_set_translation(m, dq.translation());
+}
+
+template<class E, class S, class O, class C, class Sub>
+void
+dual_quaternion_rigid_matrix(dual_quaternion<E, S, O, C>& dq,
+  const readable_matrix<Sub>& m)
+{
+  static_assert(cml::are_convertible<E, value_type_trait_of_t<Sub>>::value,
+    "incompatible scalar types");
+
+  cml::check_affine_3D(m);
+  quaternion_rotation_matrix(dq.real(), m);
+  dq.set_rigid(dq.real(), matrix_get_translation(m));
+}
+
+} // namespace cml
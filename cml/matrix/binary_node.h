@@ -99,7 +99,7 @@ class matrix_binary_node
    * both Sub1 and Sub2 are fixed-size expressions, then the sizes are
    * checked at compile time.
    */
-  matrix_binary_node(Sub1 left, Sub2 right);
+  matrix_binary_node(Sub1 left, Sub2 right) CML_SIZE_CHECK_NOEXCEPT;
 
   /** Move constructor. */
   matrix_binary_node(node_type&& other);
@@ -12,7 +12,8 @@ namespace cml {
 /* matrix_binary_node 'structors: */
 
 template<class Sub1, class Sub2, class Op>
-matrix_binary_node<Sub1, Sub2, Op>::matrix_binary_node(Sub1 left, Sub2 right)
+matrix_binary_node<Sub1, Sub2, Op>::matrix_binary_node(Sub1 left,
+  Sub2 right) CML_SIZE_CHECK_NOEXCEPT
   : m_left(std::move(left))
     , m_right(std::move(right))
 {
@@ -0,0 +1,372 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cml/storage/allocated_selector.h>
+#include <cml/matrix/writable_matrix.h>
+#include <cml/matrix/matrix.h>
+
+namespace cml {
+
+template<class Element, class BasisOrient, class Layout> class matrix_block;
+
+/** matrix_traits for writable matrix_block<>. */
+template<class Element, class BasisOrient, class Layout>
+struct matrix_traits<matrix_block<Element, BasisOrient, Layout>>
+{
+  /* Traits and types for the matrix element: */
+  using element_traits = scalar_traits<Element>;
+  using value_type = typename element_traits::value_type;
+  using pointer = typename element_traits::pointer;
+  using reference = typename element_traits::reference;
+  using const_pointer = typename element_traits::const_pointer;
+  using const_reference = typename element_traits::const_reference;
+  using mutable_value = typename element_traits::mutable_value;
+  using immutable_value = typename element_traits::immutable_value;
+
+  /* Temporaries are dense and dynamically-allocated: */
+  using storage_type = rebind_t<allocated<>, matrix_storage_tag>;
+  using size_tag = typename storage_type::size_tag;
+  using basis_tag = BasisOrient;
+  using layout_tag = Layout;
+
+  /* Unspecified rows and columns: */
+  static const int array_rows = -1;
+  static const int array_cols = -1;
+
+  /** Constant containing the matrix basis enumeration value. */
+  static const basis_kind matrix_basis = basis_tag::value;
+
+  /** Constant containing the array layout enumeration value. */
+  static const layout_kind array_layout = layout_tag::value;
+};
+
+/** matrix_traits for read-only matrix_block<>. */
+template<class Element, class BasisOrient, class Layout>
+struct matrix_traits<matrix_block<const Element, BasisOrient, Layout>>
+{
+  /* Traits and types for the matrix element: */
+  using element_traits = scalar_traits<Element>;
+  using value_type = typename element_traits::value_type;
+  using const_pointer = typename element_traits::const_pointer;
+  using const_reference = typename element_traits::const_reference;
+  using immutable_value = typename element_traits::immutable_value;
+
+  /* Temporaries are dense and dynamically-allocated: */
+  using storage_type = rebind_t<allocated<>, matrix_storage_tag>;
+  using size_tag = typename storage_type::size_tag;
+  using basis_tag = BasisOrient;
+  using layout_tag = Layout;
+
+  /* Unspecified rows and columns: */
+  static const int array_rows = -1;
+  static const int array_cols = -1;
+
+  /** Constant containing the matrix basis enumeration value. */
+  static const basis_kind matrix_basis = basis_tag::value;
+
+  /** Constant containing the array layout enumeration value. */
+  static const layout_kind array_layout = layout_tag::value;
+};
+
+/** A rows x cols view of strided matrix storage, such as a submatrix of a
+ * larger matrix.  Element (i,j) of a row-major block is at data()[i*ld +
+ * j], and of a column-major block at data()[j*ld + i], where ld is the
+ * leading dimension: the distance between consecutive rows (row_major) or
+ * columns (col_major) of the underlying storage.
+ *
+ * A block does not own its elements.  Copying a block copies the view,
+ * while assigning to a block writes through it to the underlying storage.
+ * Blocks are dynamic-size matrices, and can be used wherever a
+ * readable_matrix or writable_matrix is expected.  Kernels can check
+ * is_contiguous(), and use data() and leading_dimension() directly.
+ *
+ * @note The result of assigning overlapping blocks of the same matrix to
+ * each other is undefined.
+ */
+template<class Element, class BasisOrient, class Layout>
+class matrix_block
+  : public writable_matrix<matrix_block<Element, BasisOrient, Layout>>
+{
+  // The layout must be col_major or row_major (NOT is_layout_tag!):
+  static_assert(std::is_same<Layout, row_major>::value
+    || std::is_same<Layout, col_major>::value,
+    "invalid layout");
+
+  public:
+  using matrix_type = matrix_block<Element, BasisOrient, Layout>;
+  using readable_type = readable_matrix<matrix_type>;
+  using writable_type = writable_matrix<matrix_type>;
+  using traits_type = matrix_traits<matrix_type>;
+  using element_traits = typename traits_type::element_traits;
+  using value_type = typename traits_type::value_type;
+  using pointer = typename traits_type::pointer;
+  using reference = typename traits_type::reference;
+  using const_pointer = typename traits_type::const_pointer;
+  using const_reference = typename traits_type::const_reference;
+  using mutable_value = typename traits_type::mutable_value;
+  using immutable_value = typename traits_type::immutable_value;
+  using storage_type = typename traits_type::storage_type;
+  using size_tag = typename traits_type::size_tag;
+  using basis_tag = typename traits_type::basis_tag;
+  using layout_tag = typename traits_type::layout_tag;
+
+  public:
+  /* Include methods from writable_type: */
+  using writable_type::operator();
+  using writable_type::operator=;
+
+  public:
+  /** Constant containing the number of rows. */
+  static const int array_rows = traits_type::array_rows;
+
+  /** Constant containing the number of columns. */
+  static const int array_cols = traits_type::array_cols;
+
+  /** Constant containing the matrix basis enumeration value. */
+  static const basis_kind matrix_basis = traits_type::matrix_basis;
+
+  /** Constant containing the array layout enumeration value. */
+  static const layout_kind array_layout = traits_type::array_layout;
+
+  public:
+  /** Construct a view of the @c rows x @c cols matrix at @c data, with
+   * leading dimension @c ld.
+   *
+   * @throws std::invalid_argument if @c rows or @c cols is negative, or if
+   * @c ld is smaller than the number of columns (row_major) or rows
+   * (col_major).
+   */
+  matrix_block(pointer data, int rows, int cols, int ld);
+
+  /** Copy the view, not the elements. */
+  matrix_block(const matrix_type& other) = default;
+
+  public:
+  /** Return access to the first element of the block. */
+  pointer data() const;
+
+  /** Return the leading dimension of the block. */
+  int leading_dimension() const;
+
+  /** Returns true if the elements of the block are consecutive in
+   * memory, so that data() can be treated as a dense rows x cols array.
+   */
+  bool is_contiguous() const;
+
+  public:
+  /** Copy the elements of @c other through the view. */
+  matrix_type& operator=(const matrix_type& other);
+
+  protected:
+  /** @name readable_matrix Interface */
+  /*@{*/
+
+  friend readable_type;
+
+  /** Return the number of rows. */
+  int i_rows() const;
+
+  /** Return the number of columns. */
+  int i_cols() const;
+
+  /** Return matrix const element @c (i,j). */
+  immutable_value i_get(int i, int j) const;
+
+  /*@}*/
+
+
+  protected:
+  /** @name writeable_matrix Interface */
+  /*@{*/
+
+  friend writable_type;
+
+  /** Return matrix element @c (i,j). */
+  mutable_value i_get(int i, int j);
+
+  /** Set element @c i. */
+  template<class Other>
+  matrix_type& i_put(int i, int j, const Other& v) &;
+
+  /** Set element @c i on a temporary. */
+  template<class Other> matrix_type&& i_put(int i, int j, const Other& v) &&;
+
+  /*@}*/
+
+
+  protected:
+  /** Return a reference to element @c (i,j). */
+  reference s_access(int i, int j, row_major) const
+  {
+    return this->m_data[i * this->m_ld + j];
+  }
+
+  /** Return a reference to element @c (i,j). */
+  reference s_access(int i, int j, col_major) const
+  {
+    return this->m_data[j * this->m_ld + i];
+  }
+
+  protected:
+  /** Wrapped pointer. */
+  pointer m_data;
+
+  /** Row count. */
+  int m_rows;
+
+  /** Column count. */
+  int m_cols;
+
+  /** Leading dimension. */
+  int m_ld;
+};
+
+/** A read-only rows x cols view of strided matrix storage.  See
+ * matrix_block<Element, BasisOrient, Layout>.
+ */
+template<class Element, class BasisOrient, class Layout>
+class matrix_block<const Element, BasisOrient, Layout>
+  : public readable_matrix<matrix_block<const Element, BasisOrient, Layout>>
+{
+  // The layout must be col_major or row_major (NOT is_layout_tag!):
+  static_assert(std::is_same<Layout, row_major>::value
+    || std::is_same<Layout, col_major>::value,
+    "invalid layout");
+
+  public:
+  using matrix_type = matrix_block<const Element, BasisOrient, Layout>;
+  using readable_type = readable_matrix<matrix_type>;
+  using traits_type = matrix_traits<matrix_type>;
+  using element_traits = typename traits_type::element_traits;
+  using value_type = typename traits_type::value_type;
+  using const_pointer = typename traits_type::const_pointer;
+  using const_reference = typename traits_type::const_reference;
+  using immutable_value = typename traits_type::immutable_value;
+  using storage_type = typename traits_type::storage_type;
+  using size_tag = typename traits_type::size_tag;
+  using basis_tag = typename traits_type::basis_tag;
+  using layout_tag = typename traits_type::layout_tag;
+
+  public:
+  /** Constant containing the number of rows. */
+  static const int array_rows = traits_type::array_rows;
+
+  /** Constant containing the number of columns. */
+  static const int array_cols = traits_type::array_cols;
+
+  /** Constant containing the matrix basis enumeration value. */
+  static const basis_kind matrix_basis = traits_type::matrix_basis;
+
+  /** Constant containing the array layout enumeration value. */
+  static const layout_kind array_layout = traits_type::array_layout;
+
+  public:
+  /** Construct a view of the @c rows x @c cols matrix at @c data, with
+   * leading dimension @c ld.
+   *
+   * @throws std::invalid_argument if @c rows or @c cols is negative, or if
+   * @c ld is smaller than the number of columns (row_major) or rows
+   * (col_major).
+   */
+  matrix_block(const_pointer data, int rows, int cols, int ld);
+
+  /** Construct a read-only view of a writable block. */
+  matrix_block(const matrix_block<Element, BasisOrient, Layout>& other);
+
+  public:
+  /** Return access to the first element of the block. */
+  const_pointer data() const;
+
+  /** Return the leading dimension of the block. */
+  int leading_dimension() const;
+
+  /** Returns true if the elements of the block are consecutive in
+   * memory, so that data() can be treated as a dense rows x cols array.
+   */
+  bool is_contiguous() const;
+
+  protected:
+  /** @name readable_matrix Interface */
+  /*@{*/
+
+  friend readable_type;
+
+  /** Return the number of rows. */
+  int i_rows() const;
+
+  /** Return the number of columns. */
+  int i_cols() const;
+
+  /** Return matrix const element @c (i,j). */
+  immutable_value i_get(int i, int j) const;
+
+  /*@}*/
+
+
+  protected:
+  /** Return a reference to element @c (i,j). */
+  const_reference s_access(int i, int j, row_major) const
+  {
+    return this->m_data[i * this->m_ld + j];
+  }
+
+  /** Return a reference to element @c (i,j). */
+  const_reference s_access(int i, int j, col_major) const
+  {
+    return this->m_data[j * this->m_ld + i];
+  }
+
+  protected:
+  /** Wrapped pointer. */
+  const_pointer m_data;
+
+  /** Row count. */
+  int m_rows;
+
+  /** Column count. */
+  int m_cols;
+
+  /** Leading dimension. */
+  int m_ld;
+};
+
+/** Return a writable view of the @c rows x @c cols block of @c M with its
+ * first element at @c (i,j).
+ *
+ * @throws std::invalid_argument if the block does not lie within @c M.
+ */
+template<class E, class Storage, class BasisOrient, class Layout>
+auto block(matrix<E, Storage, BasisOrient, Layout>& M, int i, int j,
+  int rows, int cols) -> matrix_block<E, BasisOrient, Layout>;
+
+/** Return a read-only view of the @c rows x @c cols block of @c M with
+ * its first element at @c (i,j).
+ *
+ * @throws std::invalid_argument if the block does not lie within @c M.
+ */
+template<class E, class Storage, class BasisOrient, class Layout>
+auto block(const matrix<E, Storage, BasisOrient, Layout>& M, int i, int j,
+  int rows, int cols) -> matrix_block<const E, BasisOrient, Layout>;
+
+/* Blocks of temporary matrices would dangle: */
+template<class E, class Storage, class BasisOrient, class Layout>
+void block(matrix<E, Storage, BasisOrient, Layout>&& M, int i, int j,
+  int rows, int cols) = delete;
+
+/** Return a view of the @c rows x @c cols block of @c M with its first
+ * element at @c (i,j).  The view is writable if @c M is.
+ *
+ * @throws std::invalid_argument if the block does not lie within @c M.
+ */
+template<class E, class BasisOrient, class Layout>
+auto block(const matrix_block<E, BasisOrient, Layout>& M, int i, int j,
+  int rows, int cols) -> matrix_block<E, BasisOrient, Layout>;
+
+} // namespace cml
+
+#define __CML_MATRIX_BLOCK_TPP
+#include <cml/matrix/block.tpp>
+#undef __CML_MATRIX_BLOCK_TPP
@@ -0,0 +1,253 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#ifndef __CML_MATRIX_BLOCK_TPP
+#  error "matrix/block.tpp not included correctly"
+#endif
+
+#include <cml/common/exception.h>
+
+namespace cml {
+namespace detail {
+
+/* Ensure a block view of the given size and leading dimension is valid: */
+template<class Layout>
+inline void
+check_block_view(int rows, int cols, int ld)
+{
+  cml_require(rows >= 0, std::invalid_argument, "rows < 0");
+  cml_require(cols >= 0, std::invalid_argument, "cols < 0");
+  cml_require(ld >= (Layout::value == row_major_c ? cols : rows),
+    std::invalid_argument, "leading dimension too small");
+}
+
+/* Ensure the block (i,j,rows,cols) lies within @c M: */
+template<class Sub>
+inline void
+check_block_range(const readable_matrix<Sub>& M, int i, int j, int rows,
+  int cols)
+{
+  cml_require(i >= 0 && j >= 0 && rows >= 0 && cols >= 0
+      && i + rows <= M.rows() && j + cols <= M.cols(),
+    std::invalid_argument, "block out of range");
+}
+
+/* The leading dimension of a dense matrix: */
+template<class Sub>
+inline int
+dense_leading_dimension(const readable_matrix<Sub>& M)
+{
+  return layout_tag_trait_of_t<Sub>::value == row_major_c ? M.cols()
+                                                          : M.rows();
+}
+
+} // namespace detail
+
+/* matrix_block 'structors: */
+
+template<class E, class BO, class L>
+matrix_block<E, BO, L>::matrix_block(pointer data, int rows, int cols,
+  int ld)
+  : m_data(data)
+  , m_rows(rows)
+  , m_cols(cols)
+  , m_ld(ld)
+{
+  detail::check_block_view<L>(rows, cols, ld);
+}
+
+/* Public methods: */
+
+template<class E, class BO, class L>
+auto
+matrix_block<E, BO, L>::data() const -> pointer
+{
+  return this->m_data;
+}
+
+template<class E, class BO, class L>
+int
+matrix_block<E, BO, L>::leading_dimension() const
+{
+  return this->m_ld;
+}
+
+template<class E, class BO, class L>
+bool
+matrix_block<E, BO, L>::is_contiguous() const
+{
+  return this->m_ld == (L::value == row_major_c ? this->m_cols : this->m_rows)
+    || (L::value == row_major_c ? this->m_rows : this->m_cols) <= 1;
+}
+
+template<class E, class BO, class L>
+auto
+matrix_block<E, BO, L>::operator=(const matrix_type& other) -> matrix_type&
+{
+  return this->assign(other);
+}
+
+/* Internal methods: */
+
+/* readable_matrix interface: */
+
+template<class E, class BO, class L>
+int
+matrix_block<E, BO, L>::i_rows() const
+{
+  return this->m_rows;
+}
+
+template<class E, class BO, class L>
+int
+matrix_block<E, BO, L>::i_cols() const
+{
+  return this->m_cols;
+}
+
+template<class E, class BO, class L>
+auto
+matrix_block<E, BO, L>::i_get(int i, int j) const -> immutable_value
+{
+  return this->s_access(i, j, layout_tag());
+}
+
+/* writable_matrix interface: */
+
+template<class E, class BO, class L>
+auto
+matrix_block<E, BO, L>::i_get(int i, int j) -> mutable_value
+{
+  return this->s_access(i, j, layout_tag());
+}
+
+template<class E, class BO, class L>
+template<class Other>
+auto
+matrix_block<E, BO, L>::i_put(int i, int j, const Other& v) & -> matrix_type&
+{
+  this->s_access(i, j, layout_tag()) = value_type(v);
+  return *this;
+}
+
+template<class E, class BO, class L>
+template<class Other>
+auto
+matrix_block<E, BO, L>::i_put(int i, int j,
+  const Other& v) && -> matrix_type&&
+{
+  this->s_access(i, j, layout_tag()) = value_type(v);
+  return (matrix_type&&) *this;
+}
+
+/* Read-only matrix_block 'structors: */
+
+template<class E, class BO, class L>
+matrix_block<const E, BO, L>::matrix_block(const_pointer data, int rows,
+  int cols, int ld)
+  : m_data(data)
+  , m_rows(rows)
+  , m_cols(cols)
+  , m_ld(ld)
+{
+  detail::check_block_view<L>(rows, cols, ld);
+}
+
+template<class E, class BO, class L>
+matrix_block<const E, BO, L>::matrix_block(
+  const matrix_block<E, BO, L>& other)
+  : m_data(other.data())
+  , m_rows(other.rows())
+  , m_cols(other.cols())
+  , m_ld(other.leading_dimension())
+{
+}
+
+/* Public methods: */
+
+template<class E, class BO, class L>
+auto
+matrix_block<const E, BO, L>::data() const -> const_pointer
+{
+  return this->m_data;
+}
+
+template<class E, class BO, class L>
+int
+matrix_block<const E, BO, L>::leading_dimension() const
+{
+  return this->m_ld;
+}
+
+template<class E, class BO, class L>
+bool
+matrix_block<const E, BO, L>::is_contiguous() const
+{
+  return this->m_ld == (L::value == row_major_c ? this->m_cols : this->m_rows)
+    || (L::value == row_major_c ? this->m_rows : this->m_cols) <= 1;
+}
+
+/* Internal methods: */
+
+/* readable_matrix interface: */
+
+template<class E, class BO, class L>
+int
+matrix_block<const E, BO, L>::i_rows() const
+{
+  return this->m_rows;
+}
+
+template<class E, class BO, class L>
+int
+matrix_block<const E, BO, L>::i_cols() const
+{
+  return this->m_cols;
+}
+
+template<class E, class BO, class L>
+auto
+matrix_block<const E, BO, L>::i_get(int i, int j) const -> immutable_value
+{
+  return this->s_access(i, j, layout_tag());
+}
+
+/* block(): */
+
+template<class E, class Storage, class BasisOrient, class Layout>
+auto
+block(matrix<E, Storage, BasisOrient, Layout>& M, int i, int j, int rows,
+  int cols) -> matrix_block<E, BasisOrient, Layout>
+{
+  detail::check_block_range(M, i, j, rows, cols);
+  const int ld = detail::dense_leading_dimension(M);
+  const int offset = Layout::value == row_major_c ? i * ld + j : j * ld + i;
+  return matrix_block<E, BasisOrient, Layout>(M.data() + offset, rows, cols,
+    ld);
+}
+
+template<class E, class Storage, class BasisOrient, class Layout>
+auto
+block(const matrix<E, Storage, BasisOrient, Layout>& M, int i, int j,
+  int rows, int cols) -> matrix_block<const E, BasisOrient, Layout>
+{
+  detail::check_block_range(M, i, j, rows, cols);
+  const int ld = detail::dense_leading_dimension(M);
+  const int offset = Layout::value == row_major_c ? i * ld + j : j * ld + i;
+  return matrix_block<const E, BasisOrient, Layout>(M.data() + offset, rows,
+    cols, ld);
+}
+
+template<class E, class BasisOrient, class Layout>
+auto
+block(const matrix_block<E, BasisOrient, Layout>& M, int i, int j, int rows,
+  int cols) -> matrix_block<E, BasisOrient, Layout>
+{
+  detail::check_block_range(M, i, j, rows, cols);
+  const int ld = M.leading_dimension();
+  const int offset = Layout::value == row_major_c ? i * ld + j : j * ld + i;
+  return matrix_block<E, BasisOrient, Layout>(M.data() + offset, rows, cols,
+    ld);
+}
+} // namespace cml
@@ -6,9 +6,39 @@
 #  error "matrix/comparison.tpp not included correctly"
 #endif
 
+#include <cml/scalar/functions.h>
 #include <cml/matrix/size_checking.h>
 
 namespace cml {
+namespace detail {
+
+/* Early-exit element-wise comparison of arbitrary matrices: */
+template<class Sub1, class Sub2, class E>
+inline bool
+matrix_approx_equal(const readable_matrix<Sub1>& left,
+  const readable_matrix<Sub2>& right, E abs_tol, E rel_tol)
+{
+  if(left.rows() != right.rows() || left.cols() != right.cols()) return false;
+  for(int i = 0; i < left.rows(); ++i)
+    for(int j = 0; j < left.cols(); ++j)
+      if(!cml::approx_equal(E(left(i, j)), E(right(i, j)), abs_tol, rel_tol))
+        return false;
+  return true;
+}
+
+/* Branch-free comparison of fixed-size matrices of the same type: */
+template<class E, int R, int C, class BasisOrient, class Layout>
+inline bool
+matrix_approx_equal(const matrix<E, compiled<R, C>, BasisOrient, Layout>& left,
+  const matrix<E, compiled<R, C>, BasisOrient, Layout>& right, E abs_tol,
+  E rel_tol)
+{
+  return detail::approx_equal_n<R * C>(left.data(), right.data(), abs_tol,
+    rel_tol);
+}
+
+} // namespace detail
+
 template<class Sub1, class Sub2>
 bool
 operator==(const readable_matrix<Sub1>& left,
@@ -35,4 +65,56 @@ operator!=(const readable_matrix<Sub1>& left,
 {
   return !(left == right);
 }
+
+template<class Sub1, class Sub2>
+bool
+approx_equal(const readable_matrix<Sub1>& left,
+  const readable_matrix<Sub2>& right,
+  value_type_trait_promote_t<Sub1, Sub2> abs_tol,
+  value_type_trait_promote_t<Sub1, Sub2> rel_tol)
+{
+  return detail::matrix_approx_equal(left.actual(), right.actual(), abs_tol,
+    rel_tol);
+}
+
+template<class Sub1, class Sub2>
+bool
+approx_equal_ulps(const readable_matrix<Sub1>& left,
+  const readable_matrix<Sub2>& right, std::int64_t max_ulps)
+{
+  using value_type = value_type_trait_promote_t<Sub1, Sub2>;
+  if(left.rows() != right.rows() || left.cols() != right.cols()) return false;
+  for(int i = 0; i < left.rows(); ++i)
+    for(int j = 0; j < left.cols(); ++j)
+      if(cml::ulp_distance(value_type(left(i, j)), value_type(right(i, j)))
+        > max_ulps)
+        return false;
+  return true;
+}
+
+template<class E, int R, int C, class BasisOrient, class Layout>
+int
+find_approx_equal(const matrix<E, compiled<R, C>, BasisOrient, Layout>* items,
+  int n, const matrix<E, compiled<R, C>, BasisOrient, Layout>& key, E abs_tol,
+  E rel_tol)
+{
+  for(int k = 0; k < n; ++k)
+    if(detail::approx_equal_n<R * C>(items[k].data(), key.data(), abs_tol,
+         rel_tol))
+      return k;
+  return -1;
+}
+
+template<class E, int R, int C, class BasisOrient, class Layout>
+bool
+all_approx_equal(const matrix<E, compiled<R, C>, BasisOrient, Layout>* left,
+  const matrix<E, compiled<R, C>, BasisOrient, Layout>* right, int n,
+  E abs_tol, E rel_tol)
+{
+  for(int k = 0; k < n; ++k)
+    if(!detail::approx_equal_n<R * C>(left[k].data(), right[k].data(),
+         abs_tol, rel_tol))
+      return false;
+  return true;
+}
 } // namespace cml
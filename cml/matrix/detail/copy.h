@@ -5,6 +5,11 @@
 #pragma once
 
 #include <cml/matrix/detail/get.h>
+#include <cml/matrix/detail/transpose_blocked.h>
+
+namespace cml {
+template<class Sub> class matrix_transpose_node;
+}
 
 namespace cml::detail {
 /** Assign @c left from the elements of @c right, where @c left is assumed
@@ -28,4 +33,28 @@ copy(writable_matrix<Sub>& left, const Other& right, col_major)
   for(int j = 0; j < left.cols(); ++j)
     for(int i = 0; i < left.rows(); ++i) left.put(i, j, get(right, i, j));
 }
+
+/** Assign @c left from the transpose expression @c right using tiles, to
+ * avoid striding through the transposed subexpression one element at a
+ * time.
+ */
+template<class Sub, class Other>
+void
+copy(writable_matrix<Sub>& left,
+  const readable_matrix<matrix_transpose_node<Other>>& right, row_major)
+{
+  copy_blocked(left, right, CML_MATRIX_TRANSPOSE_THREADS);
+}
+
+/** Assign @c left from the transpose expression @c right using tiles, to
+ * avoid striding through the transposed subexpression one element at a
+ * time.
+ */
+template<class Sub, class Other>
+void
+copy(writable_matrix<Sub>& left,
+  const readable_matrix<matrix_transpose_node<Other>>& right, col_major)
+{
+  copy_blocked(left, right, CML_MATRIX_TRANSPOSE_THREADS);
+}
 }
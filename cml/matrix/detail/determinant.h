@@ -44,6 +44,27 @@ auto determinant(const readable_matrix<Sub>& M, int_c<N>)
 template<class Sub>
 auto determinant(const readable_matrix<Sub>& M, int_c<-1>)
   -> value_type_trait_of_t<Sub>;
+
+/** Determinant implementation for statically-sized matrices that ignores
+ * @c scratch.
+ *
+ * @note It is up to the caller to ensure @c M is a square matrix.
+ */
+template<class Sub, int N, class Scratch>
+auto determinant(const readable_matrix<Sub>& M, int_c<N>, Scratch& scratch)
+  -> value_type_trait_of_t<Sub>;
+
+/** Determinant implementation for dynamically-sized matrices.  This
+ * dispatches to a small matrix implementation when the dimension of @c M
+ * is no more than 4.  Otherwise, the general pivoting implementation is
+ * used, with the LU factors and pivot order stored in @c scratch (a
+ * matrix_scratch).
+ *
+ * @note It is up to the caller to ensure @c M is a square matrix.
+ */
+template<class Sub, class Scratch>
+auto determinant(const readable_matrix<Sub>& M, int_c<-1>, Scratch& scratch)
+  -> value_type_trait_of_t<Sub>;
 }
 
 #define __CML_MATRIX_DETAIL_DETERMINANT_TPP
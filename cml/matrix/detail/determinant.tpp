@@ -6,8 +6,9 @@
 #  error "matrix/detail/determinant.tpp not included correctly"
 #endif
 
-#include <vector>
+#include <cml/common/instrument.h>
 #include <cml/matrix/temporary.h>
+#include <cml/matrix/workspace.h>
 #include <cml/matrix/detail/lu.h>
 
 namespace cml::detail {
@@ -86,6 +87,8 @@ auto
 determinant(const readable_matrix<Sub>& M, int_c<N>)
   -> value_type_trait_of_t<Sub>
 {
+  instrument_scope scope("determinant");
+  instrument_temporary("determinant");
   temporary_of_t<Sub> A(M);
   std::array<int, N> order;
   int sign = lu_pivot_inplace(A, order);
@@ -106,6 +109,25 @@ auto
 determinant(const readable_matrix<Sub>& M, int_c<-1>)
   -> value_type_trait_of_t<Sub>
 {
+  matrix_scratch<value_type_trait_of_t<Sub>> scratch;
+  return determinant(M, int_c<-1>(), scratch);
+}
+
+template<class Sub, int N, class Scratch>
+auto
+determinant(const readable_matrix<Sub>& M, int_c<N>, Scratch&)
+  -> value_type_trait_of_t<Sub>
+{
+  return determinant(M, int_c<N>());
+}
+
+template<class Sub, class Scratch>
+auto
+determinant(const readable_matrix<Sub>& M, int_c<-1>, Scratch& scratch)
+  -> value_type_trait_of_t<Sub>
+{
+  using value_type = value_type_trait_of_t<Sub>;
+
   /* Size of matrix */
   int N = M.rows();
 
@@ -119,8 +141,12 @@ determinant(const readable_matrix<Sub>& M, int_c<-1>)
       break;
   }
 
-  temporary_of_t<Sub> A(M);
-  std::vector<int> order(A.rows());
+  /* Factor a copy of M in the scratch storage: */
+  instrument_scope scope("determinant");
+  instrument_temporary("determinant");
+  matrix<value_type, external<>> A(scratch.values(N * N), N, N);
+  A = M;
+  int* order = scratch.indices(N);
   int sign = lu_pivot_inplace(A, order);
 
   /* Compute the determinant from the diagonals: */
@@ -4,10 +4,21 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
-#include <vector>
 #include <cml/common/mpl/int_c.h>
 #include <cml/matrix/writable_matrix.h>
+#include <cml/matrix/workspace.h>
+#include <cml/matrix/detail/lu.h>
+#include <cml/common/parallel.h>
+
+/** The smallest dimension of a dynamically-sized matrix that inverse()
+ * inverts by blocked LU decomposition, rather than by Gauss-Jordan
+ * elimination with full pivoting.
+ */
+#ifndef CML_MATRIX_LU_INVERSE_SIZE
+#  define CML_MATRIX_LU_INVERSE_SIZE 16
+#endif
 
 namespace cml::detail {
 /** 2x2 inverse implementation. */
@@ -179,8 +190,10 @@ inverse_pivot(writable_matrix<Sub>& M, RowIndexArray& row_index,
       }
     }
 
-    /* TODO: Check pivot against epsilon here to catch singularity */
-    // cml_require(pivot >= epsilon, singular_matrix_error, /**/);
+    /* Singularity is not checked here, as for the closed-form small
+     * inverses; a singular M yields a non-finite result.  try_inverse()
+     * reports singularity instead.
+     */
 
     row_index[i] = row;
     col_index[i] = col;
@@ -217,6 +230,83 @@ inverse_pivot(writable_matrix<Sub>& M, RowIndexArray& row_index,
 }
 } // namespace
 
+/** NxN inverse implementation using blocked LU decomposition with partial
+ * pivoting (see lu_pivot_blocked()).  The inverse is formed by solving
+ * against the columns of the pivoted identity, in blocks of
+ * CML_MATRIX_LU_BLOCK_SIZE columns so that each pass over the factors
+ * serves a whole block; blocks are split across @c threads threads.  The
+ * factors and right-hand sides are kept in @c scratch (a matrix_scratch).
+ *
+ * @returns false if @c M is singular to working precision, in which case
+ * @c M is not modified.
+ *
+ * @note It is up to the caller to ensure @c M is a square matrix.
+ */
+template<class Sub, class Scratch>
+bool
+inverse_lu(writable_matrix<Sub>& M, Scratch& scratch, int threads)
+{
+  using value_type = value_type_trait_of_t<Sub>;
+
+  const int N = M.rows();
+  const int R = CML_MATRIX_LU_BLOCK_SIZE;
+  const int blocks = (N + R - 1) / R;
+  threads = parallel_thread_count(threads, blocks);
+
+  /* The factors, followed by an N x R block of columns per thread: */
+  value_type* A = scratch.values(N * N + threads * N * R);
+  int* order = scratch.indices(N);
+  for(int i = 0; i < N; ++i)
+    for(int j = 0; j < N; ++j) A[i * N + j] = M(i, j);
+
+  if(lu_pivot_blocked(A, N, order, threads) == 0) return false;
+
+  parallel_invoke(threads, [&M, A, order, N, R, blocks, threads](int t) {
+    value_type* X = A + N * N + t * N * R;
+    for(int b = t; b < blocks; b += threads) {
+      const int j0 = b * R;
+      const int cols = std::min(R, N - j0);
+
+      /* Columns [j0,j0+cols) of the pivoted identity: */
+      std::fill(X, X + N * R, value_type(0));
+      for(int i = 0; i < N; ++i) {
+        const int c = order[i] - j0;
+        if(0 <= c && c < cols) X[i * R + c] = value_type(1);
+      }
+
+      /* Solve L*Y = P*I, with unit diagonal L: */
+      for(int i = 1; i < N; ++i) {
+        const value_type* Ai = A + i * N;
+        value_type* Xi = X + i * R;
+        for(int k = 0; k < i; ++k) {
+          const value_type l = Ai[k];
+          const value_type* Xk = X + k * R;
+          for(int c = 0; c < cols; ++c) Xi[c] -= l * Xk[c];
+        }
+      }
+
+      /* Solve U*X = Y: */
+      for(int i = N - 1; i >= 0; --i) {
+        const value_type* Ai = A + i * N;
+        value_type* Xi = X + i * R;
+        for(int k = i + 1; k < N; ++k) {
+          const value_type u = Ai[k];
+          const value_type* Xk = X + k * R;
+          for(int c = 0; c < cols; ++c) Xi[c] -= u * Xk[c];
+        }
+        const value_type s = value_type(1) / Ai[i];
+        for(int c = 0; c < cols; ++c) Xi[c] *= s;
+      }
+
+      /* Store the block: */
+      for(int i = 0; i < N; ++i)
+        for(int c = 0; c < cols; ++c) M(i, j0 + c) = X[i * R + c];
+    }
+  });
+
+  return true;
+}
+
 /** Inverse implementation for statically-sized square matrices with
  * dimension greater than 4, using a pivoting algorithm to compute the
  * result.
@@ -236,16 +326,34 @@ inverse(writable_matrix<Sub>& M, int_c<N>)
   inverse_pivot(M, row_index, col_index, pivoted);
 }
 
+/** Inverse implementation for statically-sized matrices that ignores
+ * @c scratch.
+ *
+ * @note It is up to the caller to ensure @c M is a square matrix.
+ */
+template<class Sub, int N, class Scratch>
+void
+inverse(writable_matrix<Sub>& M, int_c<N>, Scratch&)
+{
+  inverse(M, int_c<N>());
+}
+
 /** Inverse implementation for dynamically-sized square matrices.  This
  * dispatches to a small matrix implementation when the dimension of @c M
- * is no more than 4.  Otherwise, the general pivoting implementation is
- * used.
+ * is no more than 4, and to the blocked LU implementation when it is at
+ * least CML_MATRIX_LU_INVERSE_SIZE.  Otherwise, the general pivoting
+ * implementation is used, with the pivot bookkeeping stored in @c scratch
+ * (a matrix_scratch).
+ *
+ * If the blocked LU decomposition finds @c M singular, the pivoting
+ * implementation is used instead, so that the result does not depend on
+ * the dimension of @c M.
  *
  * @note It is up to the caller to ensure @c M is a square matrix.
  */
-template<class Sub>
+template<class Sub, class Scratch>
 void
-inverse(writable_matrix<Sub>& M, int_c<-1>)
+inverse(writable_matrix<Sub>& M, int_c<-1>, Scratch& scratch)
 {
   /* Use small matrix inverse if possible: */
   int N = M.rows();
@@ -261,13 +369,32 @@ inverse(writable_matrix<Sub>& M, int_c<-1>)
       break;
   }
 
+  /* Use the blocked LU inverse for large matrices: */
+  if(N >= CML_MATRIX_LU_INVERSE_SIZE && inverse_lu(M, scratch, 1)) return;
+
   /* Otherwise, use the pivoting inverse: */
 
   /* For tracking pivots */
-  std::vector<int> row_index(N), col_index(N);
-  std::vector<bool> pivoted(N, false);
+  int* row_index = scratch.indices(3 * N);
+  int* col_index = row_index + N;
+  int* pivoted = col_index + N;
+  std::fill(pivoted, pivoted + N, 0);
 
   /* Call the implementation: */
   inverse_pivot(M, row_index, col_index, pivoted);
 }
+
+/** Inverse implementation for dynamically-sized square matrices, using
+ * stack-allocated scratch storage when the dimension of @c M is no more
+ * than CML_MATRIX_SMALL_BUFFER_SIZE.
+ *
+ * @note It is up to the caller to ensure @c M is a square matrix.
+ */
+template<class Sub>
+void
+inverse(writable_matrix<Sub>& M, int_c<-1>)
+{
+  matrix_scratch<value_type_trait_of_t<Sub>> scratch;
+  inverse(M, int_c<-1>(), scratch);
+}
 }
@@ -6,6 +6,11 @@
 
 #include <cml/matrix/fwd.h>
 
+/** The panel width used by blocked LU decomposition. */
+#ifndef CML_MATRIX_LU_BLOCK_SIZE
+#  define CML_MATRIX_LU_BLOCK_SIZE 32
+#endif
+
 namespace cml::detail {
 /** In-place LU decomposition using Doolittle's method.
  *
@@ -31,6 +36,21 @@ template<class Sub> void lu_inplace(writable_matrix<Sub>& M);
  */
 template<class Sub, class OrderArray>
 int lu_pivot_inplace(writable_matrix<Sub>& M, OrderArray& order);
+
+/** In-place blocked LU decomposition with partial pivoting of the @c N x
+ * @c N row-major array @c A.  Columns are factored in panels of
+ * CML_MATRIX_LU_BLOCK_SIZE, and the trailing submatrix is updated once per
+ * panel, with its rows split across @c threads threads (0 selects
+ * std::thread::hardware_concurrency()).  @c order receives the row order
+ * after pivoting.
+ *
+ * @returns 1 if no pivots or an even number of pivots are performed, -1 if
+ * an odd number of pivots are performed, 0 if a pivot is no larger than
+ * epsilon times the largest magnitude in @c A (i.e. @c A is singular to
+ * working precision).
+ */
+template<class Element>
+int lu_pivot_blocked(Element* A, int N, int* order, int threads);
 }
 
 #define __CML_MATRIX_DETAIL_LU_TPP
@@ -6,28 +6,31 @@
 #  error "matrix/detail/lu.tpp not included correctly"
 #endif
 
+#include <algorithm>
 #include <cml/common/traits.h>
+#include <cml/scalar/accumulator.h>
+#include <cml/common/parallel.h>
 
 namespace cml::detail {
 template<class Sub>
 void
 lu_inplace(writable_matrix<Sub>& M)
 {
-  using value_type = value_type_trait_of_t<Sub>;
+  using accumulator_type = accumulator_of_t<value_type_trait_of_t<Sub>>;
 
   int N = M.rows();
   for(int k = 0; k < N; ++k) {
     /* Compute the upper triangle: */
     for(int j = k; j < N; ++j) {
-      value_type sum(0);
-      for(int p = 0; p < k; ++p) sum += M(k, p) * M(p, j);
+      accumulator_type sum(0);
+      for(int p = 0; p < k; ++p) sum += accumulator_type(M(k, p)) * M(p, j);
       M(k, j) -= sum;
     }
 
     /* Compute the lower triangle: */
     for(int i = k + 1; i < N; ++i) {
-      value_type sum(0);
-      for(int p = 0; p < k; ++p) sum += M(i, p) * M(p, k);
+      accumulator_type sum(0);
+      for(int p = 0; p < k; ++p) sum += accumulator_type(M(i, p)) * M(p, k);
       M(i, k) = (M(i, k) - sum) / M(k, k);
     }
   }
@@ -49,7 +52,7 @@ lu_pivot_inplace(writable_matrix<Sub>& M, OrderArray& order)
   for(int k = 0; k < N - 1; ++k) {
     /* Find the next pivot row: */
     int row = k;
-    value_type max = M(k, k);
+    value_type max = value_traits::fabs(M(k, k));
     for(int i = k + 1; i < N; ++i) {
       value_type mag = value_traits::fabs(M(i, k));
       if(mag > max) {
@@ -79,4 +82,84 @@ lu_pivot_inplace(writable_matrix<Sub>& M, OrderArray& order)
   /* Done: */
   return flag;
 }
+
+template<class Element>
+int
+lu_pivot_blocked(Element* A, int N, int* order, int threads)
+{
+  using value_traits = traits_of_t<Element>;
+
+  /* Initialize the order, and find the scale for the singularity test: */
+  Element scale(0);
+  for(int i = 0; i < N; ++i) order[i] = i;
+  for(int i = 0; i < N * N; ++i)
+    scale = std::max(scale, value_traits::fabs(A[i]));
+  const Element tiny = scale * value_traits::epsilon();
+  if(scale == Element(0)) return 0;
+
+  int flag = 1;
+  for(int k0 = 0; k0 < N; k0 += CML_MATRIX_LU_BLOCK_SIZE) {
+    const int k1 = std::min(N, k0 + CML_MATRIX_LU_BLOCK_SIZE);
+
+    /* Factor the panel of columns [k0,k1), swapping whole rows: */
+    for(int k = k0; k < k1; ++k) {
+      int row = k;
+      Element max = value_traits::fabs(A[k * N + k]);
+      for(int i = k + 1; i < N; ++i) {
+        Element mag = value_traits::fabs(A[i * N + k]);
+        if(mag > max) {
+          max = mag;
+          row = i;
+        }
+      }
+
+      /* Check for a singular matrix: */
+      if(max <= tiny) return 0;
+
+      if(row != k) {
+        std::swap(order[k], order[row]);
+        std::swap_ranges(A + k * N, A + (k + 1) * N, A + row * N);
+        flag = -flag;
+      }
+
+      const Element* Ak = A + k * N;
+      const Element inv_pivot = Element(1) / Ak[k];
+      for(int i = k + 1; i < N; ++i) {
+        Element* Ai = A + i * N;
+        const Element l = (Ai[k] *= inv_pivot);
+        for(int j = k + 1; j < k1; ++j) Ai[j] -= l * Ak[j];
+      }
+    }
+
+    if(k1 == N) break;
+
+    /* Compute the panel rows of U to the right of the panel: */
+    for(int k = k0; k < k1; ++k) {
+      const Element* Ak = A + k * N;
+      for(int i = k + 1; i < k1; ++i) {
+        Element* Ai = A + i * N;
+        const Element l = Ai[k];
+        for(int j = k1; j < N; ++j) Ai[j] -= l * Ak[j];
+      }
+    }
+
+    /* Update the trailing submatrix, one row at a time: */
+    const int rows = N - k1;
+    const int work_threads =
+      (rows >= 2 * CML_MATRIX_LU_BLOCK_SIZE) ? threads : 1;
+    parallel_for(rows, work_threads, [A, N, k0, k1](int begin, int end) {
+      for(int i = k1 + begin; i < k1 + end; ++i) {
+        Element* Ai = A + i * N;
+        for(int k = k0; k < k1; ++k) {
+          const Element* Ak = A + k * N;
+          const Element l = Ai[k];
+          for(int j = k1; j < N; ++j) Ai[j] -= l * Ak[j];
+        }
+      }
+    });
+  }
+
+  /* Done: */
+  return flag;
+}
 }
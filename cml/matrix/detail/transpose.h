@@ -4,10 +4,12 @@
 
 #pragma once
 
+#include <cml/common/instrument.h>
 #include <cml/common/mpl/enable_if_reshapeable.h>
 #include <cml/matrix/writable_matrix.h>
 #include <cml/matrix/temporary.h>
 #include <cml/matrix/transpose.h>
+#include <cml/matrix/detail/transpose_blocked.h>
 
 namespace cml::detail {
 /** Transpose a fixed-size square matrix. */
@@ -22,11 +24,20 @@ transpose(writable_matrix<Sub>& M, fixed_size_tag)
     for(int j = 0; j < i; ++j) std::swap(M.get(i, j), M.get(j, i));
 }
 
-/** Transpose a resizable matrix using a temporary. */
+/** Transpose a resizable matrix, in place if it is square, and otherwise
+ * using a temporary.
+ */
 template<class Sub, enable_if_reshapeable_t<Sub>* = nullptr>
 void
 transpose(writable_matrix<Sub>& M, dynamic_size_tag)
 {
+  if(M.rows() == M.cols()) {
+    transpose_square_blocked(M);
+    return;
+  }
+
+  instrument_scope scope("transpose");
+  instrument_temporary("transpose");
   temporary_of_t<Sub> T(M);
   M = cml::transpose(T);
 }
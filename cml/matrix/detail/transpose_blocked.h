@@ -0,0 +1,81 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <cml/common/parallel.h>
+#include <cml/matrix/fwd.h>
+
+/** The tile size used by blocked matrix transposition. */
+#ifndef CML_MATRIX_TRANSPOSE_BLOCK_SIZE
+#  define CML_MATRIX_TRANSPOSE_BLOCK_SIZE 32
+#endif
+
+/** The number of threads used to assign a transpose expression to a
+ * matrix (0 selects std::thread::hardware_concurrency()).
+ */
+#ifndef CML_MATRIX_TRANSPOSE_THREADS
+#  define CML_MATRIX_TRANSPOSE_THREADS 1
+#endif
+
+namespace cml::detail {
+/** Assign @c left from the elements of @c right one square tile at a
+ * time, so that both a row-major and a column-major traversal stay within
+ * cache.  This is used to materialize transpose expressions, where @c
+ * right reads its subexpression with a stride of a full row or column.
+ * Rows of tiles are split across @c threads threads (0 selects
+ * std::thread::hardware_concurrency()).
+ *
+ * @note It is up to the caller to ensure @c left is sized to match @c
+ * right.
+ */
+template<class Sub, class Other>
+void
+copy_blocked(writable_matrix<Sub>& left, const readable_matrix<Other>& right,
+  int threads)
+{
+  const int B = CML_MATRIX_TRANSPOSE_BLOCK_SIZE;
+  const int rows = left.rows(), cols = left.cols();
+  const int row_blocks = (rows + B - 1) / B;
+
+  /* Threads only pay off once there are several tiles per thread: */
+  if(rows * cols < 64 * B * B) threads = 1;
+
+  auto copy_rows = [&left, &right, rows, cols, B](int begin, int end) {
+    for(int bi = begin; bi < end; ++bi) {
+      const int i0 = bi * B, i1 = std::min(i0 + B, rows);
+      for(int j0 = 0; j0 < cols; j0 += B) {
+        const int j1 = std::min(j0 + B, cols);
+        for(int i = i0; i < i1; ++i)
+          for(int j = j0; j < j1; ++j) left.put(i, j, right.get(i, j));
+      }
+    }
+  };
+  parallel_for(row_blocks, threads, copy_rows);
+}
+
+/** Transpose the square matrix @c M in place, swapping the elements of
+ * each pair of tiles mirrored across the diagonal.
+ *
+ * @note It is up to the caller to ensure @c M is square.
+ */
+template<class Sub>
+void
+transpose_square_blocked(writable_matrix<Sub>& M)
+{
+  const int B = CML_MATRIX_TRANSPOSE_BLOCK_SIZE;
+  const int n = M.rows();
+  for(int i0 = 0; i0 < n; i0 += B) {
+    const int i1 = std::min(i0 + B, n);
+    for(int j0 = 0; j0 <= i0; j0 += B) {
+      const int j1 = std::min(j0 + B, n);
+      for(int i = i0; i < i1; ++i)
+        for(int j = j0; j < std::min(j1, i); ++j)
+          std::swap(M.get(i, j), M.get(j, i));
+    }
+  }
+}
+}
@@ -6,6 +6,7 @@
 
 #include <cml/common/traits.h>
 #include <cml/matrix/fwd.h>
+#include <cml/matrix/workspace.h>
 
 namespace cml {
 /** Compute the determinant of square matrix @c M.  For matrices of
@@ -19,6 +20,21 @@ namespace cml {
  */
 template<class Sub>
 auto determinant(const readable_matrix<Sub>& M) -> value_type_trait_of_t<Sub>;
+
+/** Compute the determinant of square matrix @c M, using @c workspace for
+ * the LU decomposition when @c M is dynamically-sized with dimension
+ * greater than CML_MATRIX_SMALL_BUFFER_SIZE.  Smaller dynamic matrices use
+ * stack storage.  Reusing @c workspace across calls avoids allocating on
+ * every call.
+ *
+ * @throws non_square_matrix_error at run-time if the matrix is
+ * dynamically-sized and not square.  Fixed-size matrices are checked at
+ * compile-time.
+ */
+template<class Sub>
+auto determinant(const readable_matrix<Sub>& M,
+  matrix_workspace<value_type_trait_of_t<Sub>>& workspace)
+  -> value_type_trait_of_t<Sub>;
 } // namespace cml
 
 #define __CML_MATRIX_DETERMINANT_TPP
@@ -7,6 +7,7 @@
 #endif
 
 #include <cml/matrix/readable_matrix.h>
+#include <cml/matrix/detail/determinant.h>
 
 namespace cml {
 template<class Sub>
@@ -15,4 +16,16 @@ determinant(const readable_matrix<Sub>& M) -> value_type_trait_of_t<Sub>
 {
   return M.determinant();
 }
+
+template<class Sub>
+auto
+determinant(const readable_matrix<Sub>& M,
+  matrix_workspace<value_type_trait_of_t<Sub>>& workspace)
+  -> value_type_trait_of_t<Sub>
+{
+  cml::check_square(M);
+  detail::matrix_scratch<value_type_trait_of_t<Sub>> scratch(&workspace);
+  return detail::determinant(M, int_c<matrix_traits<Sub>::array_rows>(),
+    scratch);
+}
 } // namespace cml
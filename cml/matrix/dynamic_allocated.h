@@ -11,6 +11,11 @@
 #include <cml/matrix/writable_matrix.h>
 #include <cml/matrix/matrix.h>
 
+/* Dynamic-size determinants factor into external<> views of scratch
+ * storage:
+ */
+#include <cml/matrix/dynamic_external.h>
+
 namespace cml {
 template<class Element, class Allocator, typename BasisOrient, typename Layout>
 struct matrix_traits<matrix<Element, dynamic<Allocator>, BasisOrient, Layout>>
@@ -9,6 +9,7 @@
 #endif
 
 #include <cml/common/exception.h>
+#include <cml/common/instrument.h>
 
 namespace cml {
 /* dynamic 'structors: */
@@ -166,6 +167,7 @@ matrix<E, dynamic<A>, BO, L>::resize(int rows, int cols)
   /* Allocate the new array: */
   pointer data = this->m_data;
   pointer copy = allocator_traits::allocate(allocator, n_new);
+  detail::instrument_allocation(n_new * sizeof(E));
   try {
     /* Destruct elements if necessary: */
     this->destruct(data, n_old,
@@ -215,6 +217,7 @@ matrix<E, dynamic<A>, BO, L>::resize_fast(int rows, int cols)
   /* Allocate the new array: */
   pointer data = this->m_data;
   pointer copy = allocator_traits::allocate(allocator, n_new);
+  detail::instrument_allocation(n_new * sizeof(E));
   try {
     /* Destruct elements if necessary: */
     this->destruct(data, n_old,
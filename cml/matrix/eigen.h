@@ -0,0 +1,76 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cml/vector/fixed_compiled.h>
+#include <cml/matrix/fixed_compiled.h>
+
+namespace cml {
+/** Compute the eigenvalues and eigenvectors of the symmetric 3x3 matrix @c
+ * A.  The eigenvalues are returned in ascending order in @c values, and
+ * the corresponding unit eigenvectors as the basis vectors of @c vectors
+ * (i.e. matrix_get_basis_vector(vectors, i) is the eigenvector of
+ * values[i]), which form a rotation.
+ *
+ * The eigenvalues are found in closed form, and the eigenvector of the
+ * eigenvalue farthest from the other two from the cross product of two
+ * rows of A - lambda*I.  The remaining pair is then found with a single
+ * Jacobi rotation in the plane orthogonal to it, which is exact even when
+ * the two eigenvalues are equal.
+ *
+ * @note Only the upper triangle of @c A is used.
+ */
+template<class E, class BasisOrient, class Layout>
+void symmetric_eigen_3x3(
+  const matrix<E, compiled<3, 3>, BasisOrient, Layout>& A,
+  vector<E, compiled<3>>& values,
+  matrix<E, compiled<3, 3>, BasisOrient, Layout>& vectors);
+
+/** Apply symmetric_eigen_3x3() to the @c n matrices starting at @c A,
+ * returning the results in the @c n elements starting at @c values and @c
+ * vectors.  The matrices are split across @c threads threads (0 selects
+ * std::thread::hardware_concurrency()).
+ */
+template<class E, class BasisOrient, class Layout>
+void symmetric_eigen_3x3(
+  const matrix<E, compiled<3, 3>, BasisOrient, Layout>* A, int n,
+  vector<E, compiled<3>>* values,
+  matrix<E, compiled<3, 3>, BasisOrient, Layout>* vectors, int threads = 1);
+
+/** Compute only the eigenvalues of the @c n symmetric 3x3 matrices
+ * starting at @c A, as by symmetric_eigen_3x3(), returning them in the @c
+ * n elements starting at @c values.
+ */
+template<class E, class BasisOrient, class Layout>
+void symmetric_eigen_3x3(
+  const matrix<E, compiled<3, 3>, BasisOrient, Layout>* A, int n,
+  vector<E, compiled<3>>* values, int threads = 1);
+
+/** Compute the eigenvalues and eigenvectors of the symmetric matrix @c A
+ * using the cyclic Jacobi method.  The eigenvalues are returned in
+ * ascending order in @c values, and the corresponding unit eigenvectors as
+ * the basis vectors of @c vectors.  @c values and @c vectors are resized
+ * if they are resizable.  At most @c max_sweeps sweeps over the
+ * off-diagonal elements are made.
+ *
+ * @returns true if the off-diagonal elements converged to zero (relative
+ * to the norm of @c A) within @c max_sweeps sweeps.
+ *
+ * @throws non_square_matrix_error if @c A is not square.
+ *
+ * @throws vector_size_error or matrix_size_error if @c values or @c
+ * vectors is not resizable and does not match the size of @c A.
+ *
+ * @note Only the upper triangle of @c A is used.
+ */
+template<class Sub, class ValuesSub, class VectorsSub>
+bool symmetric_eigen(const readable_matrix<Sub>& A,
+  writable_vector<ValuesSub>& values, writable_matrix<VectorsSub>& vectors,
+  int max_sweeps = 32);
+} // namespace cml
+
+#define __CML_MATRIX_EIGEN_TPP
+#include <cml/matrix/eigen.tpp>
+#undef __CML_MATRIX_EIGEN_TPP
@@ -0,0 +1,322 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#ifndef __CML_MATRIX_EIGEN_TPP
+#  error "matrix/eigen.tpp not included correctly"
+#endif
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <cml/common/parallel.h>
+#include <cml/scalar/constants.h>
+#include <cml/scalar/traits.h>
+#include <cml/vector/writable_vector.h>
+#include <cml/vector/detail/check_or_resize.h>
+#include <cml/matrix/writable_matrix.h>
+#include <cml/matrix/size_checking.h>
+#include <cml/matrix/detail/check_or_resize.h>
+
+namespace cml {
+namespace detail {
+
+/** Return the cross product of 3D vectors @c a and @c b in @c c. */
+template<class E>
+inline void
+eigen_cross(const E a[3], const E b[3], E c[3])
+{
+  c[0] = a[1] * b[2] - a[2] * b[1];
+  c[1] = a[2] * b[0] - a[0] * b[2];
+  c[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+/** Return the quadratic form u^T*A*w for the symmetric matrix with upper
+ * triangle @c a = {a00, a01, a02, a11, a12, a22}.
+ */
+template<class E>
+inline E
+eigen_form(const E a[6], const E u[3], const E w[3])
+{
+  return u[0] * (a[0] * w[0] + a[1] * w[1] + a[2] * w[2])
+    + u[1] * (a[1] * w[0] + a[3] * w[1] + a[4] * w[2])
+    + u[2] * (a[2] * w[0] + a[4] * w[1] + a[5] * w[2]);
+}
+
+/** Eigen-decomposition of the symmetric 3x3 matrix with upper triangle @c
+ * m = {m00, m01, m02, m11, m12, m22}.  The eigenvalues are returned in
+ * ascending order in @c values, and eigenvector i in @c vectors[i].
+ */
+template<class E>
+void
+symmetric_eigen_3x3(const E m[6], E values[3], E vectors[3][3])
+{
+  using element_traits = scalar_traits<E>;
+
+  /* Scale by the largest element to avoid overflow and underflow: */
+  E scale = E(0);
+  for(int k = 0; k < 6; ++k)
+    scale = std::max(scale, element_traits::fabs(m[k]));
+
+  E a[6];
+  for(int k = 0; k < 6; ++k) a[k] = (scale > E(0)) ? m[k] / scale : E(0);
+
+  /* Eigenvalues in closed form, from the characteristic polynomial of
+   * B = (A - q*I)/p, whose eigenvalues are 2*cos(phi + 2*pi*k/3):
+   */
+  const E q = (a[0] + a[3] + a[5]) / E(3);
+  const E b00 = a[0] - q, b11 = a[3] - q, b22 = a[5] - q;
+  const E p1 = a[1] * a[1] + a[2] * a[2] + a[4] * a[4];
+  const E p2 = b00 * b00 + b11 * b11 + b22 * b22 + E(2) * p1;
+  if(p2 == E(0)) {
+    /* A is a multiple of the identity: */
+    for(int i = 0; i < 3; ++i) {
+      values[i] = q * scale;
+      for(int j = 0; j < 3; ++j) vectors[i][j] = (i == j) ? E(1) : E(0);
+    }
+    return;
+  }
+
+  const E p = element_traits::sqrt(p2 / E(6));
+  const E c00 = b00 / p, c11 = b11 / p, c22 = b22 / p;
+  const E c01 = a[1] / p, c02 = a[2] / p, c12 = a[4] / p;
+  const E det = c00 * (c11 * c22 - c12 * c12) - c01 * (c01 * c22 - c12 * c02)
+    + c02 * (c01 * c12 - c11 * c02);
+  const E r = std::min(std::max(det / E(2), E(-1)), E(1));
+  const E phi = element_traits::acos(r) / E(3);
+  const E l_max = q + E(2) * p * element_traits::cos(phi);
+  const E l_min =
+    q + E(2) * p * element_traits::cos(phi + constants<E>::two_pi() / E(3));
+  const E l_mid = E(3) * q - l_max - l_min;
+
+  /* The eigenvalue farthest from the other two is well separated, and its
+   * eigenvector is the largest cross product of two rows of A - l*I:
+   */
+  const E l = (l_max - l_mid >= l_mid - l_min) ? l_max : l_min;
+  const E r0[3] = {a[0] - l, a[1], a[2]};
+  const E r1[3] = {a[1], a[3] - l, a[4]};
+  const E r2[3] = {a[2], a[4], a[5] - l};
+  E x[3][3];
+  eigen_cross(r0, r1, x[0]);
+  eigen_cross(r0, r2, x[1]);
+  eigen_cross(r1, r2, x[2]);
+
+  int best = 0;
+  E best_n2 = E(0);
+  for(int k = 0; k < 3; ++k) {
+    const E n2 = x[k][0] * x[k][0] + x[k][1] * x[k][1] + x[k][2] * x[k][2];
+    if(n2 > best_n2) {
+      best = k;
+      best_n2 = n2;
+    }
+  }
+
+  E v[3] = {E(1), E(0), E(0)};
+  if(best_n2 > E(0)) {
+    const E inv_n = E(1) / element_traits::sqrt(best_n2);
+    for(int j = 0; j < 3; ++j) v[j] = x[best][j] * inv_n;
+  }
+
+  /* An orthonormal basis {u, w} of the plane orthogonal to v: */
+  E u[3], w[3];
+  if(element_traits::fabs(v[0]) > element_traits::fabs(v[1])) {
+    const E inv_n = E(1) / element_traits::sqrt(v[0] * v[0] + v[2] * v[2]);
+    u[0] = -v[2] * inv_n;
+    u[1] = E(0);
+    u[2] = v[0] * inv_n;
+  } else {
+    const E inv_n = E(1) / element_traits::sqrt(v[1] * v[1] + v[2] * v[2]);
+    u[0] = E(0);
+    u[1] = v[2] * inv_n;
+    u[2] = -v[1] * inv_n;
+  }
+  eigen_cross(v, u, w);
+
+  /* Diagonalize the restriction of A to the plane with a Jacobi
+   * rotation:
+   */
+  const E auu = eigen_form(a, u, u);
+  const E auw = eigen_form(a, u, w);
+  const E aww = eigen_form(a, w, w);
+  E cs = E(1), sn = E(0), t = E(0);
+  if(auw != E(0)) {
+    const E theta = (aww - auu) / (E(2) * auw);
+    t = E(1) / (element_traits::fabs(theta)
+          + element_traits::sqrt(theta * theta + E(1)));
+    if(theta < E(0)) t = -t;
+    cs = E(1) / element_traits::sqrt(t * t + E(1));
+    sn = t * cs;
+  }
+
+  E lambda[3] = {eigen_form(a, v, v), auu - t * auw, aww + t * auw};
+  E vec[3][3];
+  for(int j = 0; j < 3; ++j) {
+    vec[0][j] = v[j];
+    vec[1][j] = cs * u[j] - sn * w[j];
+    vec[2][j] = sn * u[j] + cs * w[j];
+  }
+
+  /* Sort ascending: */
+  int order[3] = {0, 1, 2};
+  if(lambda[order[1]] < lambda[order[0]]) std::swap(order[0], order[1]);
+  if(lambda[order[2]] < lambda[order[1]]) std::swap(order[1], order[2]);
+  if(lambda[order[1]] < lambda[order[0]]) std::swap(order[0], order[1]);
+  for(int i = 0; i < 3; ++i) {
+    values[i] = lambda[order[i]] * scale;
+    for(int j = 0; j < 3; ++j) vectors[i][j] = vec[order[i]][j];
+  }
+
+  /* Make the basis right-handed: */
+  E z[3];
+  eigen_cross(vectors[0], vectors[1], z);
+  if(z[0] * vectors[2][0] + z[1] * vectors[2][1] + z[2] * vectors[2][2]
+    < E(0))
+    for(int j = 0; j < 3; ++j) vectors[2][j] = -vectors[2][j];
+}
+
+/** Cyclic Jacobi eigen-decomposition of the symmetric @c N x @c N
+ * row-major array @c a, which is overwritten.  The eigenvalues are
+ * returned on the diagonal of @c a, and the eigenvectors in the columns of
+ * the row-major array @c V.
+ *
+ * @returns true if the off-diagonal elements converged to zero within @c
+ * max_sweeps sweeps.
+ */
+template<class E>
+bool
+symmetric_eigen_jacobi(E* a, E* V, int N, int max_sweeps)
+{
+  using element_traits = scalar_traits<E>;
+
+  for(int i = 0; i < N; ++i)
+    for(int j = 0; j < N; ++j) V[i * N + j] = (i == j) ? E(1) : E(0);
+
+  E norm2 = E(0);
+  for(int k = 0; k < N * N; ++k) norm2 += a[k] * a[k];
+  const E eps = element_traits::epsilon();
+  const E tol2 = eps * eps * norm2;
+
+  for(int sweep = 0; sweep <= max_sweeps; ++sweep) {
+    E off2 = E(0);
+    for(int p = 0; p < N; ++p)
+      for(int q = p + 1; q < N; ++q) off2 += a[p * N + q] * a[p * N + q];
+    if(off2 <= tol2) return true;
+    if(sweep == max_sweeps) break;
+
+    for(int p = 0; p < N; ++p) {
+      for(int q = p + 1; q < N; ++q) {
+        const E apq = a[p * N + q];
+        if(apq == E(0)) continue;
+
+        const E theta = (a[q * N + q] - a[p * N + p]) / (E(2) * apq);
+        E t = E(1) / (element_traits::fabs(theta)
+                + element_traits::sqrt(theta * theta + E(1)));
+        if(theta < E(0)) t = -t;
+        const E c = E(1) / element_traits::sqrt(t * t + E(1));
+        const E s = t * c;
+
+        /* A <- J^T*A*J, V <- V*J: */
+        for(int k = 0; k < N; ++k) {
+          const E akp = a[k * N + p], akq = a[k * N + q];
+          a[k * N + p] = c * akp - s * akq;
+          a[k * N + q] = s * akp + c * akq;
+        }
+        for(int k = 0; k < N; ++k) {
+          const E apk = a[p * N + k], aqk = a[q * N + k];
+          a[p * N + k] = c * apk - s * aqk;
+          a[q * N + k] = s * apk + c * aqk;
+        }
+        for(int k = 0; k < N; ++k) {
+          const E vkp = V[k * N + p], vkq = V[k * N + q];
+          V[k * N + p] = c * vkp - s * vkq;
+          V[k * N + q] = s * vkp + c * vkq;
+        }
+        a[p * N + q] = a[q * N + p] = E(0);
+      }
+    }
+  }
+  return false;
+}
+
+} // namespace detail
+
+template<class E, class BasisOrient, class Layout>
+void
+symmetric_eigen_3x3(const matrix<E, compiled<3, 3>, BasisOrient, Layout>& A,
+  vector<E, compiled<3>>& values,
+  matrix<E, compiled<3, 3>, BasisOrient, Layout>& vectors)
+{
+  const E m[6] = {A(0, 0), A(0, 1), A(0, 2), A(1, 1), A(1, 2), A(2, 2)};
+  E l[3], v[3][3];
+  detail::symmetric_eigen_3x3(m, l, v);
+  values.set(l[0], l[1], l[2]);
+  for(int i = 0; i < 3; ++i)
+    for(int j = 0; j < 3; ++j) vectors.set_basis_element(i, j, v[i][j]);
+}
+
+template<class E, class BasisOrient, class Layout>
+void
+symmetric_eigen_3x3(const matrix<E, compiled<3, 3>, BasisOrient, Layout>* A,
+  int n, vector<E, compiled<3>>* values,
+  matrix<E, compiled<3, 3>, BasisOrient, Layout>* vectors, int threads)
+{
+  auto solve = [A, values, vectors](int begin, int end) {
+    for(int k = begin; k < end; ++k) {
+      const auto& M = A[k];
+      const E m[6] = {M(0, 0), M(0, 1), M(0, 2), M(1, 1), M(1, 2), M(2, 2)};
+      E l[3], v[3][3];
+      detail::symmetric_eigen_3x3(m, l, v);
+      values[k].set(l[0], l[1], l[2]);
+      if(vectors)
+        for(int i = 0; i < 3; ++i)
+          for(int j = 0; j < 3; ++j)
+            vectors[k].set_basis_element(i, j, v[i][j]);
+    }
+  };
+  detail::parallel_for(n, threads, solve);
+}
+
+template<class E, class BasisOrient, class Layout>
+void
+symmetric_eigen_3x3(const matrix<E, compiled<3, 3>, BasisOrient, Layout>* A,
+  int n, vector<E, compiled<3>>* values, int threads)
+{
+  symmetric_eigen_3x3(A, n, values,
+    (matrix<E, compiled<3, 3>, BasisOrient, Layout>*) nullptr, threads);
+}
+
+template<class Sub, class ValuesSub, class VectorsSub>
+bool
+symmetric_eigen(const readable_matrix<Sub>& A,
+  writable_vector<ValuesSub>& values, writable_matrix<VectorsSub>& vectors,
+  int max_sweeps)
+{
+  using value_type = value_type_trait_of_t<VectorsSub>;
+
+  cml::check_square(A);
+  const int N = A.rows();
+  detail::check_or_resize(values, N);
+  detail::check_or_resize(vectors, N, N);
+
+  /* Copy the upper triangle of A to a symmetric row-major array: */
+  std::vector<value_type> a(N * N), V(N * N);
+  for(int i = 0; i < N; ++i)
+    for(int j = i; j < N; ++j) a[i * N + j] = a[j * N + i] = A(i, j);
+
+  bool converged =
+    detail::symmetric_eigen_jacobi(a.data(), V.data(), N, max_sweeps);
+
+  /* Sort the eigenvalues ascending: */
+  std::vector<int> order(N);
+  for(int i = 0; i < N; ++i) order[i] = i;
+  std::stable_sort(order.begin(), order.end(),
+    [&a, N](int i, int j) { return a[i * N + i] < a[j * N + j]; });
+
+  for(int i = 0; i < N; ++i) {
+    const int k = order[i];
+    values[i] = a[k * N + k];
+    for(int j = 0; j < N; ++j) vectors.set_basis_element(i, j, V[j * N + k]);
+  }
+  return converged;
+}
+} // namespace cml
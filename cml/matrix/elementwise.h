@@ -0,0 +1,149 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cml/matrix/unary_ops.h>
+#include <cml/matrix/binary_ops.h>
+#include <cml/matrix/scalar_ops.h>
+#include <cml/matrix/ternary_ops.h>
+
+namespace cml {
+/** @defgroup cml_matrix_elementwise Element-wise Matrix Functions
+ *
+ * Element-wise math functions of matrices and matrix expressions.  Like
+ * the arithmetic operators, these return expression nodes that are
+ * evaluated one element at a time on assignment, so an expression such as
+ * clamp(fma(a, b, c), 0., 1.) needs no temporaries.  The element kernels
+ * are branch-free, so that the compiler can vectorize the assignment loop
+ * into fixed-size or dynamic storage.
+ *
+ * There are no min() or max() overloads taking a matrix and a scalar; use
+ * clamp() instead.  min(M) and max(M) are the reductions of M, and take
+ * their thread count as a thread_count, so min(M, 0.5) does not compile.
+ */
+/*@{*/
+
+/** Return an expression for the absolute values of the elements of @c
+ * sub.
+ */
+template<class Sub, enable_if_matrix_t<Sub>* = nullptr>
+auto
+abs(Sub&& sub)
+  -> decltype(make_matrix_unary_node<unary_abs_t<Sub>>(std::forward<Sub>(sub)))
+{
+  return make_matrix_unary_node<unary_abs_t<Sub>>(std::forward<Sub>(sub));
+}
+
+/** Return an expression for the square roots of the elements of @c sub. */
+template<class Sub, enable_if_matrix_t<Sub>* = nullptr>
+auto
+sqrt(Sub&& sub)
+  -> decltype(make_matrix_unary_node<unary_sqrt_t<Sub>>(std::forward<Sub>(sub)))
+{
+  return make_matrix_unary_node<unary_sqrt_t<Sub>>(std::forward<Sub>(sub));
+}
+
+/** Return an expression for the exponentials of the elements of @c sub.
+ * This is not the matrix exponential.
+ */
+template<class Sub, enable_if_matrix_t<Sub>* = nullptr>
+auto
+exp(Sub&& sub)
+  -> decltype(make_matrix_unary_node<unary_exp_t<Sub>>(std::forward<Sub>(sub)))
+{
+  return make_matrix_unary_node<unary_exp_t<Sub>>(std::forward<Sub>(sub));
+}
+
+/** Return an expression for the element-wise minimum of @c sub1 and @c
+ * sub2.
+ *
+ * @throws incompatible_matrix_size_error at run-time if either matrix is
+ * dynamically-sized and the sizes differ.
+ */
+template<class Sub1, class Sub2, enable_if_matrix_t<Sub1>* = nullptr,
+  enable_if_matrix_t<Sub2>* = nullptr>
+auto
+min(Sub1&& sub1, Sub2&& sub2)
+  -> decltype(make_matrix_binary_node<binary_min_t<Sub1, Sub2>>(
+    std::forward<Sub1>(sub1), std::forward<Sub2>(sub2)))
+{
+  return make_matrix_binary_node<binary_min_t<Sub1, Sub2>>(
+    std::forward<Sub1>(sub1), std::forward<Sub2>(sub2));
+}
+
+/** Return an expression for the element-wise maximum of @c sub1 and @c
+ * sub2.
+ *
+ * @throws incompatible_matrix_size_error at run-time if either matrix is
+ * dynamically-sized and the sizes differ.
+ */
+template<class Sub1, class Sub2, enable_if_matrix_t<Sub1>* = nullptr,
+  enable_if_matrix_t<Sub2>* = nullptr>
+auto
+max(Sub1&& sub1, Sub2&& sub2)
+  -> decltype(make_matrix_binary_node<binary_max_t<Sub1, Sub2>>(
+    std::forward<Sub1>(sub1), std::forward<Sub2>(sub2)))
+{
+  return make_matrix_binary_node<binary_max_t<Sub1, Sub2>>(
+    std::forward<Sub1>(sub1), std::forward<Sub2>(sub2));
+}
+
+/** Return an expression clamping each element of @c sub to the range
+ * [lo, hi].
+ */
+template<class Sub, class Scalar1, class Scalar2,
+  enable_if_matrix_t<Sub>* = nullptr,
+  enable_if_arithmetic_t<cml::unqualified_type_t<Scalar1>>* = nullptr,
+  enable_if_arithmetic_t<cml::unqualified_type_t<Scalar2>>* = nullptr>
+auto
+clamp(Sub&& sub, Scalar1&& lo, Scalar2&& hi)
+{
+  using min_type = binary_min_t<Sub, Scalar2>;
+  auto upper = make_matrix_scalar_node<min_type>(std::forward<Sub>(sub),
+    std::forward<Scalar2>(hi));
+  using max_type = binary_max_t<decltype(upper), Scalar1>;
+  return make_matrix_scalar_node<max_type>(std::move(upper),
+    std::forward<Scalar1>(lo));
+}
+
+/** Return an expression clamping each element of @c sub to the range
+ * given by the corresponding elements of @c lo and @c hi.
+ *
+ * @throws incompatible_matrix_size_error at run-time if any of the
+ * matrices is dynamically-sized and the sizes differ.
+ */
+template<class Sub, class Sub1, class Sub2, enable_if_matrix_t<Sub>* = nullptr,
+  enable_if_matrix_t<Sub1>* = nullptr, enable_if_matrix_t<Sub2>* = nullptr>
+auto
+clamp(Sub&& sub, Sub1&& lo, Sub2&& hi)
+  -> decltype(make_matrix_ternary_node<ternary_clamp_t<Sub, Sub1, Sub2>>(
+    std::forward<Sub>(sub), std::forward<Sub1>(lo), std::forward<Sub2>(hi)))
+{
+  return make_matrix_ternary_node<ternary_clamp_t<Sub, Sub1, Sub2>>(
+    std::forward<Sub>(sub), std::forward<Sub1>(lo), std::forward<Sub2>(hi));
+}
+
+/** Return an expression for the element-wise fused multiply-add sub1 *
+ * sub2 + sub3, with each element rounded once.
+ *
+ * @throws incompatible_matrix_size_error at run-time if any of the
+ * matrices is dynamically-sized and the sizes differ.
+ */
+template<class Sub1, class Sub2, class Sub3,
+  enable_if_matrix_t<Sub1>* = nullptr, enable_if_matrix_t<Sub2>* = nullptr,
+  enable_if_matrix_t<Sub3>* = nullptr>
+auto
+fma(Sub1&& sub1, Sub2&& sub2, Sub3&& sub3)
+  -> decltype(make_matrix_ternary_node<ternary_fma_t<Sub1, Sub2, Sub3>>(
+    std::forward<Sub1>(sub1), std::forward<Sub2>(sub2),
+    std::forward<Sub3>(sub3)))
+{
+  return make_matrix_ternary_node<ternary_fma_t<Sub1, Sub2, Sub3>>(
+    std::forward<Sub1>(sub1), std::forward<Sub2>(sub2),
+    std::forward<Sub3>(sub3));
+}
+
+/*@}*/
+} // namespace cml
@@ -9,3 +9,4 @@
 #include <cml/matrix/transpose.h>
 #include <cml/matrix/determinant.h>
 #include <cml/matrix/trace.h>
+#include <cml/matrix/matrix_function.h>
@@ -0,0 +1,122 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cml/storage/allocated_selector.h>
+#include <cml/storage/compiled_selector.h>
+#include <cml/matrix/readable_matrix.h>
+
+namespace cml {
+template<class Generator, int Rows, int Cols> class matrix_generator_node;
+
+/** matrix_generator_node<> traits. */
+template<class Generator, int Rows, int Cols>
+struct matrix_traits<matrix_generator_node<Generator, Rows, Cols>>
+{
+  using matrix_type = matrix_generator_node<Generator, Rows, Cols>;
+  using generator_type = Generator;
+  using element_traits = scalar_traits<typename Generator::value_type>;
+  using value_type = typename element_traits::value_type;
+  using immutable_value = value_type;
+
+  /* Fixed-size if both Rows and Cols are non-negative, dynamic otherwise: */
+  static const bool is_fixed = Rows >= 0 && Cols >= 0;
+  using fixed_type = compiled<(is_fixed ? Rows : 1), (is_fixed ? Cols : 1)>;
+  using storage_type = rebind_t<cml::if_t<is_fixed, fixed_type, allocated<>>,
+    matrix_storage_tag>;
+
+  /* Traits and types for the storage: */
+  using size_tag = typename storage_type::size_tag;
+
+  /* Array rows: */
+  static const int array_rows = storage_type::array_rows;
+
+  /* Array cols: */
+  static const int array_cols = storage_type::array_cols;
+
+  /* Unspecified basis: */
+  using basis_tag = any_basis;
+
+  /* Unspecified layout: */
+  using layout_tag = any_major;
+
+  /** Constant containing the matrix basis enumeration value. */
+  static const basis_kind matrix_basis = basis_tag::value;
+
+  /** Constant containing the array layout enumeration value. */
+  static const layout_kind array_layout = layout_tag::value;
+};
+
+/** Represents a matrix whose elements are computed from their indices by
+ * @c Generator, such as a constant or identity matrix, in an expression
+ * tree.  No storage is allocated for the elements.
+ */
+template<class Generator, int Rows, int Cols>
+class matrix_generator_node
+  : public readable_matrix<matrix_generator_node<Generator, Rows, Cols>>
+{
+  public:
+  using node_type = matrix_generator_node<Generator, Rows, Cols>;
+  using readable_type = readable_matrix<node_type>;
+  using traits_type = matrix_traits<node_type>;
+  using generator_type = typename traits_type::generator_type;
+  using element_traits = typename traits_type::element_traits;
+  using value_type = typename traits_type::value_type;
+  using immutable_value = typename traits_type::immutable_value;
+  using storage_type = typename traits_type::storage_type;
+  using size_tag = typename traits_type::size_tag;
+  using basis_tag = typename traits_type::basis_tag;
+  using layout_tag = typename traits_type::layout_tag;
+
+  public:
+  /** Constant containing the number of rows. */
+  static const int array_rows = traits_type::array_rows;
+
+  /** Constant containing the number of columns. */
+  static const int array_cols = traits_type::array_cols;
+
+  /** Constant containing the array layout enumeration value. */
+  static const layout_kind array_layout = traits_type::array_layout;
+
+  /** Constant containing the matrix basis enumeration value. */
+  static const basis_kind matrix_basis = traits_type::matrix_basis;
+
+  public:
+  /** Construct a @c rows x @c cols matrix from @c generator. */
+  matrix_generator_node(int rows, int cols, const Generator& generator);
+
+  protected:
+  /** @name readable_matrix Interface */
+  /*@{*/
+
+  friend readable_type;
+
+  /** Return the row size of the matrix expression. */
+  int i_rows() const;
+
+  /** Return the column size of the matrix expression. */
+  int i_cols() const;
+
+  /** Return the generated element @c (i,j). */
+  immutable_value i_get(int i, int j) const;
+
+  /*@}*/
+
+
+  protected:
+  /** The element generator. */
+  Generator m_generator;
+
+  /** The run-time row size, used if Rows is negative. */
+  int m_rows;
+
+  /** The run-time column size, used if Cols is negative. */
+  int m_cols;
+};
+} // namespace cml
+
+#define __CML_MATRIX_GENERATOR_NODE_TPP
+#include <cml/matrix/generator_node.tpp>
+#undef __CML_MATRIX_GENERATOR_NODE_TPP
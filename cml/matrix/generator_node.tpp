@@ -0,0 +1,47 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#ifndef __CML_MATRIX_GENERATOR_NODE_TPP
+#  error "matrix/generator_node.tpp not included correctly"
+#endif
+
+namespace cml {
+/* matrix_generator_node 'structors: */
+
+template<class Generator, int Rows, int Cols>
+matrix_generator_node<Generator, Rows, Cols>::matrix_generator_node(int rows,
+  int cols, const Generator& generator)
+  : m_generator(generator)
+    , m_rows(Rows < 0 ? rows : Rows)
+    , m_cols(Cols < 0 ? cols : Cols)
+{
+}
+
+
+/* Internal methods: */
+
+/* readable_matrix interface: */
+
+template<class Generator, int Rows, int Cols>
+int
+matrix_generator_node<Generator, Rows, Cols>::i_rows() const
+{
+  return Rows < 0 ? this->m_rows : Rows;
+}
+
+template<class Generator, int Rows, int Cols>
+int
+matrix_generator_node<Generator, Rows, Cols>::i_cols() const
+{
+  return Cols < 0 ? this->m_cols : Cols;
+}
+
+template<class Generator, int Rows, int Cols>
+auto
+matrix_generator_node<Generator, Rows, Cols>::i_get(int i, int j) const
+  -> immutable_value
+{
+  return this->m_generator.apply(i, j);
+}
+} // namespace cml
@@ -0,0 +1,63 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cml/scalar/generator_ops.h>
+#include <cml/matrix/generator_node.h>
+
+namespace cml {
+/** @defgroup cml_matrix_generators Matrix Generator Expressions
+ *
+ * Lazy matrices whose elements are computed on demand, for use in matrix
+ * expressions.  Nothing is allocated, and an element costs at most one
+ * integer comparison.  Each size argument is either an int or int_c<N>();
+ * the expression has a fixed size only if both are int_c<>.  Generators
+ * have no basis or layout of their own.
+ *
+ * The default element type is int, which promotes to the element type of
+ * any floating-point expression the generator is combined with, so that A
+ * - identity(4, 4) has the element type of A.  Specify @c Element when the
+ * generator is used on its own and the elements should not be integers.
+ *
+ * @note The fixed-size, concrete double-precision zero<R,C>() and
+ * identity<R,C>() are in mathlib/matrix/generators.h.
+ */
+/*@{*/
+
+/** Return an expression for the @c rows x @c cols zero matrix. */
+template<class Element = int, class Rows, class Cols>
+auto
+zero(Rows rows, Cols cols)
+  -> matrix_generator_node<op::generate_constant<Element>,
+    detail::generator_size<Rows>::value, detail::generator_size<Cols>::value>
+{
+  return {int(rows), int(cols), op::generate_constant<Element>(Element(0))};
+}
+
+/** Return an expression for the @c rows x @c cols identity matrix. */
+template<class Element = int, class Rows, class Cols>
+auto
+identity(Rows rows, Cols cols)
+  -> matrix_generator_node<op::generate_identity<Element>,
+    detail::generator_size<Rows>::value, detail::generator_size<Cols>::value>
+{
+  return {int(rows), int(cols), op::generate_identity<Element>()};
+}
+
+/** Return an expression for the @c rows x @c cols matrix having every
+ * element equal to @c v.
+ */
+template<class Rows, class Cols, class Scalar,
+  enable_if_arithmetic_t<cml::unqualified_type_t<Scalar>>* = nullptr>
+auto
+constant(Rows rows, Cols cols, const Scalar& v)
+  -> matrix_generator_node<op::generate_constant<Scalar>,
+    detail::generator_size<Rows>::value, detail::generator_size<Cols>::value>
+{
+  return {int(rows), int(cols), op::generate_constant<Scalar>(v)};
+}
+
+/*@}*/
+} // namespace cml
@@ -4,16 +4,86 @@
 
 #pragma once
 
+#include <cml/common/instrument.h>
 #include <cml/matrix/temporary.h>
 #include <cml/matrix/size_checking.h>
+#include <cml/matrix/workspace.h>
+#include <cml/matrix/writable_matrix.h>
 
 namespace cml {
-/** Compute the inverse of @c M and return the result in a temporary. */
+/** Compute the inverse of @c M and return the result in a temporary.
+ * Singularity is not detected; use try_inverse() to test for it.
+ */
 template<class Sub>
 temporary_of_t<Sub>
 inverse(const readable_matrix<Sub>& M)
 {
   cml::check_square(M);
+  detail::instrument_scope scope("inverse");
+  detail::instrument_temporary("inverse");
   return temporary_of_t<Sub>(M).inverse();
 }
+
+/** Compute the inverse of @c M into @c Minv, using @c workspace for the
+ * pivot bookkeeping when @c M is dynamically-sized with dimension greater
+ * than CML_MATRIX_SMALL_BUFFER_SIZE.  @c Minv is resized if it is
+ * resizable.  Reusing @c Minv and @c workspace across calls avoids
+ * allocating on every call.
+ *
+ * @note @c Minv may be the same matrix as @c M.
+ *
+ * @throws non_square_matrix_error at run-time if @c M is dynamically-sized
+ * and not square.  Fixed-size matrices are checked at compile-time.
+ *
+ * @note Singularity is not detected; use try_inverse() to test for it.
+ */
+template<class Sub, class ISub>
+void
+inverse(const readable_matrix<Sub>& M, writable_matrix<ISub>& Minv,
+  matrix_workspace<value_type_trait_of_t<ISub>>& workspace)
+{
+  cml::check_square(M);
+  Minv = M;
+  detail::matrix_scratch<value_type_trait_of_t<ISub>> scratch(&workspace);
+  detail::inverse(Minv, int_c<matrix_traits<ISub>::array_rows>(), scratch);
+}
+
+/** Compute the inverse of @c M into @c Minv by blocked LU decomposition
+ * with partial pivoting, and report whether @c M is singular.  The
+ * trailing updates of the factorization and the triangular solves are
+ * split across @c threads threads; 0 selects
+ * std::thread::hardware_concurrency().  @c Minv is resized if it is
+ * resizable, and scratch storage is taken from @c workspace.
+ *
+ * @returns false if @c M is singular to working precision, in which case
+ * @c Minv holds a copy of @c M.
+ *
+ * @note @c Minv may be the same matrix as @c M.
+ *
+ * @throws non_square_matrix_error at run-time if @c M is dynamically-sized
+ * and not square.  Fixed-size matrices are checked at compile-time.
+ */
+template<class Sub, class ISub>
+bool
+try_inverse(const readable_matrix<Sub>& M, writable_matrix<ISub>& Minv,
+  matrix_workspace<value_type_trait_of_t<ISub>>& workspace, int threads = 1)
+{
+  cml::check_square(M);
+  Minv = M;
+  detail::matrix_scratch<value_type_trait_of_t<ISub>> scratch(&workspace);
+  return detail::inverse_lu(Minv, scratch, threads);
+}
+
+/** Compute the inverse of @c M into @c Minv by blocked LU decomposition
+ * with partial pivoting, and report whether @c M is singular.  See
+ * try_inverse(M, Minv, workspace, threads).
+ */
+template<class Sub, class ISub>
+bool
+try_inverse(const readable_matrix<Sub>& M, writable_matrix<ISub>& Minv,
+  int threads = 1)
+{
+  matrix_workspace<value_type_trait_of_t<ISub>> workspace;
+  return try_inverse(M, Minv, workspace, threads);
+}
 } // namespace cml
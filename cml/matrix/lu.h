@@ -27,6 +27,13 @@ struct lu_pivot_result<Matrix, enable_if_fixed_size_t<matrix_traits<Matrix>>>
   std::array<int, N> order;
   int sign;
 
+  /** Construct an empty result for lu_pivot(M, result). */
+  lu_pivot_result()
+    : order()
+      , sign(0)
+  {
+  }
+
   explicit lu_pivot_result(const Matrix& M)
     : lu(M)
       , order()
@@ -42,6 +49,12 @@ struct lu_pivot_result<Matrix, enable_if_dynamic_size_t<matrix_traits<Matrix>>>
   std::vector<int> order;
   int sign;
 
+  /** Construct an empty result for lu_pivot(M, result). */
+  lu_pivot_result()
+    : sign(0)
+  {
+  }
+
   explicit lu_pivot_result(const Matrix& M)
     : lu(M)
       , order(M.rows())
@@ -66,6 +79,16 @@ auto lu_pivot(const readable_matrix<Sub>& M)
  */
 template<class Matrix> void lu_pivot(lu_pivot_result<Matrix>& result);
 
+/** Compute the LU decomposition of @c M, with partial pivoting, into @c
+ * result.  The storage of @c result is reused when it already has the
+ * size of @c M, so repeated decompositions of same-size matrices into the
+ * same result do not allocate.
+ *
+ * @note if @c result.sign is 0, the input matrix is singular.
+ */
+template<class Sub, class Matrix>
+void lu_pivot(const readable_matrix<Sub>& M, lu_pivot_result<Matrix>& result);
+
 /** Compute the LU decomposition of @c M using Doolittle's method,
  * returning the result as a temporary matrix.
  *
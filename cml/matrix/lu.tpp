@@ -6,11 +6,31 @@
 #  error "matrix/lu.tpp not included correctly"
 #endif
 
+#include <cml/common/instrument.h>
+#include <cml/scalar/accumulator.h>
 #include <cml/vector/writable_vector.h>
 #include <cml/matrix/size_checking.h>
 #include <cml/matrix/detail/lu.h>
 
 namespace cml {
+namespace detail {
+
+/* Fixed-size order arrays are already the right size: */
+template<std::size_t N>
+inline void
+lu_resize_order(std::array<int, N>&, int)
+{
+}
+
+/* std::vector::resize() does not reallocate when shrinking: */
+inline void
+lu_resize_order(std::vector<int>& order, int n)
+{
+  order.resize(n);
+}
+
+} // namespace detail
+
 template<class Sub>
 auto
 lu_pivot(const readable_matrix<Sub>& M) -> lu_pivot_result<temporary_of_t<Sub>>
@@ -29,11 +49,23 @@ lu_pivot(lu_pivot_result<Matrix>& result)
   result.sign = detail::lu_pivot_inplace(result.lu, result.order);
 }
 
+template<class Sub, class Matrix>
+void
+lu_pivot(const readable_matrix<Sub>& M, lu_pivot_result<Matrix>& result)
+{
+  cml::check_square(M);
+  result.lu = M;
+  detail::lu_resize_order(result.order, M.rows());
+  result.sign = detail::lu_pivot_inplace(result.lu, result.order);
+}
+
 template<class Sub>
 auto
 lu(const readable_matrix<Sub>& M) -> temporary_of_t<Sub>
 {
   cml::check_square(M);
+  detail::instrument_scope scope("lu");
+  detail::instrument_temporary("lu");
   temporary_of_t<Sub> LU(M);
   detail::lu_inplace(LU);
   return LU;
@@ -44,6 +76,8 @@ auto
 lu_solve(const readable_matrix<LUSub>& LU, const readable_vector<BSub>& b)
   -> temporary_of_t<BSub>
 {
+  detail::instrument_scope scope("lu_solve");
+  detail::instrument_temporary("lu_solve");
   temporary_of_t<BSub> x;
   detail::check_or_resize(x, b);
   lu_solve(LU, x, b);
@@ -55,7 +89,7 @@ void
 lu_solve(const readable_matrix<LUSub>& LU, writable_vector<XSub>& x,
   const readable_vector<BSub>& b)
 {
-  using value_type = value_type_trait_of_t<BSub>;
+  using accumulator_type = accumulator_of_t<value_type_trait_of_t<BSub>>;
 
   cml::check_square(LU);
   cml::check_same_inner_size(LU, x);
@@ -67,11 +101,13 @@ lu_solve(const readable_matrix<LUSub>& LU, writable_vector<XSub>& x,
    * diagonal of LU correspond to L, understood to be below a diagonal of
    * 1's:
    */
+  detail::instrument_scope scope("lu_solve");
+  detail::instrument_temporary("lu_solve");
   temporary_of_t<XSub> y;
   detail::check_or_resize(y, b);
   for(int i = 0; i < N; ++i) {
-    value_type sum(0);
-    for(int j = 0; j < i; ++j) sum += LU(i, j) * y[j];
+    accumulator_type sum(0);
+    for(int j = 0; j < i; ++j) sum += accumulator_type(LU(i, j)) * y[j];
     y[i] = b[i] - sum;
   }
 
@@ -79,8 +115,8 @@ lu_solve(const readable_matrix<LUSub>& LU, writable_vector<XSub>& x,
    * the diagonal of LU correspond to U:
    */
   for(int i = N - 1; i >= 0; --i) {
-    value_type sum(0);
-    for(int j = i + 1; j < N; ++j) sum += LU(i, j) * x[j];
+    accumulator_type sum(0);
+    for(int j = i + 1; j < N; ++j) sum += accumulator_type(LU(i, j)) * x[j];
     x[i] = (y[i] - sum) / LU(i, i);
   }
 
@@ -92,6 +128,8 @@ auto
 lu_solve(const lu_pivot_result<Matrix>& lup, const readable_vector<BSub>& b)
   -> temporary_of_t<BSub>
 {
+  detail::instrument_scope scope("lu_solve");
+  detail::instrument_temporary("lu_solve");
   temporary_of_t<BSub> x;
   detail::check_or_resize(x, b);
   lu_solve(lup, x, b);
@@ -103,7 +141,7 @@ void
 lu_solve(const lu_pivot_result<Matrix>& lup, writable_vector<XSub>& x,
   const readable_vector<BSub>& b)
 {
-  using value_type = value_type_trait_of_t<BSub>;
+  using accumulator_type = accumulator_of_t<value_type_trait_of_t<BSub>>;
 
   cml::check_same_inner_size(lup.lu, x);
   cml::check_same_inner_size(lup.lu, b);
@@ -118,11 +156,13 @@ lu_solve(const lu_pivot_result<Matrix>& lup, writable_vector<XSub>& x,
    * diagonal of LU correspond to L, understood to be below a diagonal of
    * 1's:
    */
+  detail::instrument_scope scope("lu_solve");
+  detail::instrument_temporary("lu_solve");
   temporary_of_t<XSub> y;
   detail::check_or_resize(y, b);
   for(int i = 0; i < N; ++i) {
-    value_type sum(0);
-    for(int j = 0; j < i; ++j) sum += LU(i, j) * y[j];
+    accumulator_type sum(0);
+    for(int j = 0; j < i; ++j) sum += accumulator_type(LU(i, j)) * y[j];
     y[i] = b[P[i]] - sum;
   }
 
@@ -130,8 +170,8 @@ lu_solve(const lu_pivot_result<Matrix>& lup, writable_vector<XSub>& x,
    * the diagonal of LU correspond to U:
    */
   for(int i = N - 1; i >= 0; --i) {
-    value_type sum(0);
-    for(int j = i + 1; j < N; ++j) sum += LU(i, j) * x[j];
+    accumulator_type sum(0);
+    for(int j = i + 1; j < N; ++j) sum += accumulator_type(LU(i, j)) * x[j];
     x[i] = (y[i] - sum) / LU(i, i);
   }
 
@@ -0,0 +1,35 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <utility>
+#include <cml/matrix/matrix_product.h>
+#include <cml/matrix/vector_product.h>
+
+namespace cml {
+/** Return the product of the chain of matrices @c ms, optionally ending
+ * with a vector, evaluated with the cheapest parenthesization for the
+ * operand sizes.  The result has the type of the left-to-right product
+ * ms[0]*ms[1]*...*ms[n-1].
+ *
+ * A chain of matrices is ordered by the classic dynamic programming
+ * solution to the matrix-chain problem, which costs O(n^3) in the number
+ * of operands but nothing in their size.  A chain ending in a vector is
+ * always multiplied right to left, so that only matrix-vector products
+ * are formed; e.g. multiply_chain(A, B, C, x) computes A*(B*(C*x)) in
+ * O(N^2) operations for N x N matrices, where A*B*C*x takes O(N^3).
+ *
+ * @throws incompatible_matrix_inner_size_error if an operand does not
+ * have as many rows (or elements) as the preceding matrix has columns.
+ * The check is made before any product is computed.
+ */
+template<class... Ms>
+auto multiply_chain(const Ms&... ms)
+  -> decltype((... * std::declval<const Ms&>()));
+} // namespace cml
+
+#define __CML_MATRIX_MATRIX_CHAIN_TPP
+#include <cml/matrix/matrix_chain.tpp>
+#undef __CML_MATRIX_MATRIX_CHAIN_TPP
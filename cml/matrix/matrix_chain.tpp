@@ -0,0 +1,171 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#ifndef __CML_MATRIX_MATRIX_CHAIN_TPP
+#  error "matrix/matrix_chain.tpp not included correctly"
+#endif
+
+#include <limits>
+#include <tuple>
+#include <vector>
+#include <cml/common/exception.h>
+#include <cml/vector/dynamic_allocated.h>
+#include <cml/matrix/dynamic_allocated.h>
+#include <cml/matrix/size_checking.h>
+
+namespace cml {
+namespace detail {
+
+/* The shape of a chain operand; a vector is a single column: */
+template<class Sub>
+inline void
+matrix_chain_shape(const readable_matrix<Sub>& M, int& rows, int& cols)
+{
+  rows = M.rows();
+  cols = M.cols();
+}
+
+template<class Sub>
+inline void
+matrix_chain_shape(const readable_vector<Sub>& v, int& rows, int& cols)
+{
+  rows = v.size();
+  cols = 1;
+}
+
+/* Fill split[i*n+j] with the index k of the cheapest split of operands
+ * i..j into (i..k)*(k+1..j), where operand i is dims[i] x dims[i+1].
+ */
+inline void
+matrix_chain_order(const int* dims, int n, int* split)
+{
+  std::vector<double> cost(n * n, 0.);
+  for(int len = 1; len < n; ++len) {
+    for(int i = 0; i + len < n; ++i) {
+      const int j = i + len;
+      double best = std::numeric_limits<double>::infinity();
+      for(int k = i; k < j; ++k) {
+        const double c = cost[i * n + k] + cost[(k + 1) * n + j]
+          + double(dims[i]) * dims[k + 1] * dims[j + 1];
+        if(c < best) {
+          best = c;
+          split[i * n + j] = k;
+        }
+      }
+      cost[i * n + j] = best;
+    }
+  }
+}
+
+/* Invoke @c f with operand @c i of the tuple @c ops: */
+template<class Tuple, class F, std::size_t... I>
+inline void
+matrix_chain_visit(const Tuple& ops, int i, F&& f, std::index_sequence<I...>)
+{
+  ((i == int(I) ? (void) f(std::get<I>(ops)) : (void) 0), ...);
+}
+
+/* Evaluate sub-chains of @c ops by the split table from
+ * matrix_chain_order(), storing intermediate products as Temporary:
+ */
+template<class Temporary, class Tuple> class matrix_chain_evaluator
+{
+  public:
+  matrix_chain_evaluator(const Tuple& ops, const int* split, int n)
+    : m_ops(ops)
+    , m_split(split)
+    , m_n(n)
+  {
+  }
+
+  /* Return the product of operands i..j, i < j: */
+  Temporary product(int i, int j) const
+  {
+    const int k = this->m_split[i * this->m_n + j];
+    Temporary result;
+    this->apply(i, k, [this, k, j, &result](const auto& left) {
+      this->apply(k + 1, j, [&left, &result](const auto& right) {
+        /* Every pair of operand types is instantiated, including pairs
+         * that do not conform; two fixed-size operands would fail the
+         * compile-time size check, so the left one is made dynamic:
+         */
+        using left_type = cml::unqualified_type_t<decltype(left)>;
+        using right_type = cml::unqualified_type_t<decltype(right)>;
+        if constexpr(is_fixed_size<left_type>::value
+          && is_fixed_size<right_type>::value)
+          result = Temporary(left) * right;
+        else
+          result = left * right;
+      });
+    });
+    return result;
+  }
+
+
+  private:
+  /* Invoke @c f with the product of operands i..j: */
+  template<class F> void apply(int i, int j, F&& f) const
+  {
+    if(i == j) {
+      matrix_chain_visit(this->m_ops, i, f,
+        std::make_index_sequence<std::tuple_size<Tuple>::value>());
+    } else {
+      f(this->product(i, j));
+    }
+  }
+
+
+  private:
+  const Tuple& m_ops;
+  const int* m_split;
+  int m_n;
+};
+
+} // namespace detail
+
+template<class... Ms>
+auto
+multiply_chain(const Ms&... ms) -> decltype((... * std::declval<const Ms&>()))
+{
+  using result_type = decltype((... * std::declval<const Ms&>()));
+  using value_type = value_type_trait_of_t<result_type>;
+  constexpr int n = int(sizeof...(Ms));
+  static_assert(n >= 2, "multiply_chain requires at least two operands");
+
+  /* Check all of the inner sizes up front: */
+  int rows[n], cols[n], dims[n + 1];
+  {
+    int k = 0;
+    ((detail::matrix_chain_shape(ms, rows[k], cols[k]), ++k), ...);
+  }
+  for(int k = 1; k < n; ++k) {
+    cml_size_require(rows[k] == cols[k - 1],
+      incompatible_matrix_inner_size_error, /**/);
+  }
+  for(int k = 0; k < n; ++k) dims[k] = rows[k];
+  dims[n] = cols[n - 1];
+
+  const auto ops = std::forward_as_tuple(ms...);
+  using last_type = std::tuple_element_t<n - 1, std::tuple<Ms...>>;
+  if constexpr(is_vector<last_type>::value) {
+    /* Multiply right to left, so that only vectors are formed: */
+    vector<value_type, dynamic<>> y(std::get<n - 1>(ops));
+    for(int k = n - 2; k >= 0; --k) {
+      detail::matrix_chain_visit(ops, k,
+        [&y](const auto& M) { y = M * y; },
+        std::make_index_sequence<n - 1>());
+    }
+    return result_type(y);
+  } else {
+    using temporary_type = matrix<value_type, dynamic<>,
+      basis_tag_trait_of_t<result_type>, layout_tag_trait_of_t<result_type>>;
+    int split[n * n];
+    detail::matrix_chain_order(dims, n, split);
+    return result_type(
+      detail::matrix_chain_evaluator<temporary_type, decltype(ops)>(ops,
+        split, n)
+        .product(0, n - 1));
+  }
+}
+} // namespace cml
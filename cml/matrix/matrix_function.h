@@ -0,0 +1,98 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cml/matrix/temporary.h>
+#include <cml/matrix/workspace.h>
+#include <cml/matrix/writable_matrix.h>
+
+namespace cml {
+/** @defgroup cml_matrix_functions Matrix Functions
+ *
+ * Powers, the exponential and the principal square root of square
+ * matrices.  The kernels work on row-major copies in scratch storage, so
+ * no matrix temporaries are created along the way.  For fixed-size
+ * matrices the dimension is a compile-time constant, so the product loops
+ * are fully unrolled, and up to 30 x 30 the scratch storage is on the
+ * stack, so no call allocates.  For larger fixed-size and for dynamic-size
+ * matrices the scratch storage is taken from @c workspace, and reusing
+ * @c workspace across calls of the same size does not allocate after the
+ * first call; the forms without a workspace allocate on every call.
+ *
+ * The result may be the same matrix as the argument.
+ */
+/*@{*/
+
+/** Compute @c M raised to the integer power @c p into @c Mp by binary
+ * exponentiation, with at most 2*log2(|p|) products.  M^0 is the identity,
+ * and negative powers are the inverse of the positive power.  @c Mp is
+ * resized if it is resizable.
+ *
+ * @throws non_square_matrix_error at run-time if @c M is dynamically-sized
+ * and not square.  Fixed-size matrices are checked at compile-time.
+ */
+template<class Sub, class PSub>
+void matrix_pow(const readable_matrix<Sub>& M, int p,
+  writable_matrix<PSub>& Mp,
+  matrix_workspace<value_type_trait_of_t<PSub>>& workspace);
+
+/** Return @c M raised to the integer power @c p in a temporary.  See
+ * matrix_pow(M, p, Mp, workspace).
+ */
+template<class Sub>
+temporary_of_t<Sub> matrix_pow(const readable_matrix<Sub>& M, int p);
+
+/** Compute the exponential of @c M into @c E by scaling and squaring with
+ * a diagonal Pade approximant (Higham, 2005).  The approximant degree (3,
+ * 5, 7 or 13) and the number of squarings are chosen from the 1-norm of
+ * @c M, so small matrices such as A*dt for a short step need only a few
+ * products.  @c E is resized if it is resizable.
+ *
+ * @throws non_square_matrix_error at run-time if @c M is dynamically-sized
+ * and not square.  Fixed-size matrices are checked at compile-time.
+ *
+ * @throws std::invalid_argument if the Pade denominator is singular to
+ * working precision, which happens only if @c M is not finite.
+ */
+template<class Sub, class ESub>
+void matrix_exp(const readable_matrix<Sub>& M, writable_matrix<ESub>& E,
+  matrix_workspace<value_type_trait_of_t<ESub>>& workspace);
+
+/** Return the exponential of @c M in a temporary.  See matrix_exp(M, E,
+ * workspace).
+ */
+template<class Sub>
+temporary_of_t<Sub> matrix_exp(const readable_matrix<Sub>& M);
+
+/** Compute the principal square root of @c M into @c S by the
+ * Denman-Beavers iteration, and report whether it converged.  The
+ * principal root exists when @c M has no eigenvalues on the closed
+ * negative real axis.  @c S is resized if it is resizable.
+ *
+ * @returns false if an iterate is singular to working precision or the
+ * iteration does not converge, in which case the contents of @c S are
+ * unspecified.
+ *
+ * @throws non_square_matrix_error at run-time if @c M is dynamically-sized
+ * and not square.  Fixed-size matrices are checked at compile-time.
+ */
+template<class Sub, class SSub>
+bool matrix_sqrt(const readable_matrix<Sub>& M, writable_matrix<SSub>& S,
+  matrix_workspace<value_type_trait_of_t<SSub>>& workspace);
+
+/** Return the principal square root of @c M in a temporary.  See
+ * matrix_sqrt(M, S, workspace).
+ *
+ * @throws std::invalid_argument if the iteration does not converge.
+ */
+template<class Sub>
+temporary_of_t<Sub> matrix_sqrt(const readable_matrix<Sub>& M);
+
+/*@}*/
+} // namespace cml
+
+#define __CML_MATRIX_MATRIX_FUNCTION_TPP
+#include <cml/matrix/matrix_function.tpp>
+#undef __CML_MATRIX_MATRIX_FUNCTION_TPP
@@ -0,0 +1,497 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#ifndef __CML_MATRIX_MATRIX_FUNCTION_TPP
+#  error "matrix/matrix_function.tpp not included correctly"
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cml/common/exception.h>
+#include <cml/common/instrument.h>
+#include <cml/scalar/traits.h>
+#include <cml/matrix/size_checking.h>
+#include <cml/matrix/detail/lu.h>
+
+namespace cml {
+namespace detail {
+
+/* Scratch storage for the matrix functions, which need at most 7 n x n
+ * arrays: inline storage when the dimension @c Dim is fixed and at most
+ * function_inline_dim (about 50 KB for 30 x 30 doubles), or a
+ * matrix_scratch backed by the caller's workspace otherwise.
+ */
+const int function_inline_dim = 30;
+
+/* The smallest N with N*N >= 7*Dim*Dim: */
+constexpr int
+function_scratch_size(int Dim, int N = 1)
+{
+  return N * N >= 7 * Dim * Dim ? N : function_scratch_size(Dim, N + 1);
+}
+
+template<class Element, int Dim,
+  bool Inline = (Dim > 0 && Dim <= function_inline_dim)>
+struct function_scratch
+{
+  using type = matrix_scratch<Element, function_scratch_size(Dim)>;
+};
+
+template<class Element, int Dim> struct function_scratch<Element, Dim, false>
+{
+  using type = matrix_scratch<Element>;
+};
+
+/* The kernels below work on n x n row-major arrays.  When @c Dim is not
+ * -1, it replaces @c n so that the loop bounds are compile-time constants.
+ */
+
+/* Return the dimension to use for the kernels: */
+template<int Dim>
+inline int
+function_dim(int n)
+{
+  return Dim > 0 ? Dim : n;
+}
+
+/* Copy @c M into @c A: */
+template<int Dim, class Sub, class E>
+void
+function_load(const readable_matrix<Sub>& M, E* A, int n)
+{
+  n = function_dim<Dim>(n);
+  for(int i = 0; i < n; ++i)
+    for(int j = 0; j < n; ++j) A[i * n + j] = M.get(i, j);
+}
+
+/* Copy @c A into @c M: */
+template<int Dim, class Sub, class E>
+void
+function_store(const E* A, writable_matrix<Sub>& M, int n)
+{
+  n = function_dim<Dim>(n);
+  for(int i = 0; i < n; ++i)
+    for(int j = 0; j < n; ++j) M(i, j) = A[i * n + j];
+}
+
+/* A = the identity: */
+template<int Dim, class E>
+void
+function_identity(E* A, int n)
+{
+  n = function_dim<Dim>(n);
+  for(int i = 0; i < n * n; ++i) A[i] = E(0);
+  for(int i = 0; i < n; ++i) A[i * n + i] = E(1);
+}
+
+/* C = A*B, where @c C does not alias @c A or @c B.  Rows of @c C are
+ * accumulated from rows of @c B, so the inner loop is contiguous.
+ */
+template<int Dim, class E>
+void
+function_product(const E* A, const E* B, E* C, int n)
+{
+  n = function_dim<Dim>(n);
+  for(int i = 0; i < n; ++i) {
+    E* Ci = C + i * n;
+    for(int j = 0; j < n; ++j) Ci[j] = E(0);
+    for(int k = 0; k < n; ++k) {
+      const E a = A[i * n + k];
+      const E* Bk = B + k * n;
+      for(int j = 0; j < n; ++j) Ci[j] += a * Bk[j];
+    }
+  }
+}
+
+/* Return the 1-norm of @c A, its largest absolute column sum: */
+template<int Dim, class E>
+E
+function_norm_1(const E* A, int n)
+{
+  using value_traits = scalar_traits<E>;
+  n = function_dim<Dim>(n);
+  E norm(0);
+  for(int j = 0; j < n; ++j) {
+    E sum(0);
+    for(int i = 0; i < n; ++i) sum += value_traits::fabs(A[i * n + j]);
+    norm = std::max(norm, sum);
+  }
+  return norm;
+}
+
+/* Solve LU*X = P*B in place, where @c LU and @c order are the output of
+ * lu_pivot_blocked(), and @c X holds B on entry.  @c T is an n x n
+ * temporary.
+ */
+template<int Dim, class E>
+void
+function_lu_solve(const E* LU, const int* order, E* X, E* T, int n)
+{
+  n = function_dim<Dim>(n);
+  for(int i = 0; i < n; ++i)
+    std::copy(X + order[i] * n, X + order[i] * n + n, T + i * n);
+
+  /* Solve L*Y = P*B, with unit diagonal L: */
+  for(int i = 1; i < n; ++i) {
+    E* Ti = T + i * n;
+    for(int k = 0; k < i; ++k) {
+      const E l = LU[i * n + k];
+      const E* Tk = T + k * n;
+      for(int j = 0; j < n; ++j) Ti[j] -= l * Tk[j];
+    }
+  }
+
+  /* Solve U*X = Y: */
+  for(int i = n - 1; i >= 0; --i) {
+    E* Ti = T + i * n;
+    for(int k = i + 1; k < n; ++k) {
+      const E u = LU[i * n + k];
+      const E* Tk = T + k * n;
+      for(int j = 0; j < n; ++j) Ti[j] -= u * Tk[j];
+    }
+    const E s = E(1) / LU[i * n + i];
+    for(int j = 0; j < n; ++j) Ti[j] *= s;
+  }
+  std::copy(T, T + n * n, X);
+}
+
+/* X = inverse(A), using @c W and @c T as n x n temporaries.  Returns
+ * false if @c A is singular to working precision.
+ */
+template<int Dim, class E>
+bool
+function_inverse(const E* A, E* X, E* W, E* T, int* order, int n)
+{
+  n = function_dim<Dim>(n);
+  std::copy(A, A + n * n, W);
+  if(lu_pivot_blocked(W, n, order, 1) == 0) return false;
+  function_identity<Dim>(X, n);
+  function_lu_solve<Dim>(W, order, X, T, n);
+  return true;
+}
+
+/* Raise the array @c B to the power @c p by binary exponentiation, using
+ * @c R and @c T as n x n temporaries; @c B is overwritten.  Returns
+ * whichever of the three arrays holds the result.
+ */
+template<int Dim, class E>
+E*
+function_pow(E* B, E* R, E* T, unsigned p, int n)
+{
+  n = function_dim<Dim>(n);
+  if(p == 0) {
+    function_identity<Dim>(R, n);
+    return R;
+  }
+
+  /* The first factor is copied rather than multiplied into the identity: */
+  bool first = true;
+  for(;;) {
+    if(p & 1u) {
+      if(first) {
+        std::copy(B, B + n * n, R);
+        first = false;
+      } else {
+        function_product<Dim>(R, B, T, n);
+        std::swap(R, T);
+      }
+    }
+    p >>= 1;
+    if(p == 0) return R;
+    function_product<Dim>(B, B, T, n);
+    std::swap(B, T);
+  }
+}
+
+/* The Pade approximant degrees tried by function_exp(), and the largest
+ * 1-norm for which each is accurate to double precision (Higham, 2005,
+ * Table 2.3).  Degree 9 is skipped, since it would need a fourth matrix
+ * power.
+ */
+constexpr int exp_pade_degrees[] = {3, 5, 7, 13};
+constexpr double exp_pade_theta[] = {1.495585217958292e-2,
+  2.539398330063230e-1, 9.504178996162932e-1, 5.371920351148152e0};
+
+/* Return the coefficients of the degree @c m Pade approximant: */
+inline const double*
+exp_pade_coefficients(int m)
+{
+  static const double b3[] = {120., 60., 12., 1.};
+  static const double b5[] = {30240., 15120., 3360., 420., 30., 1.};
+  static const double b7[] = {17297280., 8648640., 1995840., 277200.,
+    25200., 1512., 56., 1.};
+  static const double b13[] = {64764752532480000., 32382376266240000.,
+    7771770303897600., 1187353796428800., 129060195264000.,
+    10559470521600., 670442572800., 33522128640., 1323241920., 40840800.,
+    960960., 16380., 182., 1.};
+  switch(m) {
+    case 3: return b3;
+    case 5: return b5;
+    case 7: return b7;
+    default: return b13;
+  }
+}
+
+/* C = a0*I + a2*A2 + a4*A4 + a6*A6, where unused powers have a zero
+ * coefficient and may be null:
+ */
+template<int Dim, class E>
+void
+function_even_sum(E* C, double a0, double a2, const E* A2, double a4,
+  const E* A4, double a6, const E* A6, int n)
+{
+  n = function_dim<Dim>(n);
+  for(int i = 0; i < n * n; ++i) {
+    E c = E(a2) * A2[i];
+    if(A4) c += E(a4) * A4[i];
+    if(A6) c += E(a6) * A6[i];
+    C[i] = c;
+  }
+  for(int i = 0; i < n; ++i) C[i * n + i] += E(a0);
+}
+
+/* Compute the exponential of the array @c S (the first of 7 n x n arrays
+ * in @c S), using the rest of @c S as temporaries.  Returns the array
+ * holding the result, or null if the Pade denominator is singular to
+ * working precision.
+ */
+template<int Dim, class E>
+E*
+function_exp(E* S, int* order, int n)
+{
+  n = function_dim<Dim>(n);
+  const int nn = n * n;
+  E* X = S;
+  E* A2 = S + nn;
+  E* A4 = S + 2 * nn;
+  E* A6 = S + 3 * nn;
+  E* U = S + 4 * nn;
+  E* V = S + 5 * nn;
+  E* T = S + 6 * nn;
+
+  /* Choose the degree, and scale X so its norm is within its range: */
+  const double norm = double(function_norm_1<Dim>(X, n));
+  int m = 13, s = 0;
+  for(int d = 0; d < 3; ++d)
+    if(norm <= exp_pade_theta[d]) {
+      m = exp_pade_degrees[d];
+      break;
+    }
+  if(norm > exp_pade_theta[3]) {
+    s = int(std::ceil(std::log2(norm / exp_pade_theta[3])));
+    const E scale = E(std::ldexp(1., -s));
+    for(int i = 0; i < nn; ++i) X[i] *= scale;
+  }
+
+  /* The even powers needed by the approximant: */
+  const double* b = exp_pade_coefficients(m);
+  function_product<Dim>(X, X, A2, n);
+  if(m >= 5) function_product<Dim>(A2, A2, A4, n);
+  if(m >= 7) function_product<Dim>(A4, A2, A6, n);
+  const E* P4 = m >= 5 ? A4 : nullptr;
+  const E* P6 = m >= 7 ? A6 : nullptr;
+
+  /* U = X*(odd terms), V = even terms: */
+  if(m < 13) {
+    function_even_sum<Dim>(T, b[1], b[3], A2, m >= 5 ? b[5] : 0., P4,
+      m >= 7 ? b[7] : 0., P6, n);
+    function_product<Dim>(X, T, U, n);
+    function_even_sum<Dim>(V, b[0], b[2], A2, m >= 5 ? b[4] : 0., P4,
+      m >= 7 ? b[6] : 0., P6, n);
+  } else {
+    function_even_sum<Dim>(T, 0., b[9], A2, b[11], A4, b[13], A6, n);
+    function_product<Dim>(A6, T, V, n);
+    function_even_sum<Dim>(T, b[1], b[3], A2, b[5], A4, b[7], A6, n);
+    for(int i = 0; i < nn; ++i) V[i] += T[i];
+    function_product<Dim>(X, V, U, n);
+
+    function_even_sum<Dim>(T, 0., b[8], A2, b[10], A4, b[12], A6, n);
+    function_product<Dim>(A6, T, V, n);
+    function_even_sum<Dim>(T, b[0], b[2], A2, b[4], A4, b[6], A6, n);
+    for(int i = 0; i < nn; ++i) V[i] += T[i];
+  }
+
+  /* Solve (V - U)*R = V + U; V - U is well-conditioned for the norms
+   * accepted above, so the factorization fails only for non-finite
+   * input:
+   */
+  for(int i = 0; i < nn; ++i) {
+    const E u = U[i], v = V[i];
+    V[i] = v - u;
+    U[i] = v + u;
+  }
+  if(lu_pivot_blocked(V, n, order, 1) == 0) return nullptr;
+  function_lu_solve<Dim>(V, order, U, T, n);
+
+  /* Undo the scaling by squaring: */
+  E* R = U;
+  for(int k = 0; k < s; ++k) {
+    function_product<Dim>(R, R, T, n);
+    std::swap(R, T);
+  }
+  return R;
+}
+
+/* Compute the principal square root of the array @c S (the first of 6 n
+ * x n arrays in @c S) by the Denman-Beavers iteration, using the rest of
+ * @c S as temporaries.  Returns the array holding the result, or null if
+ * the iteration fails.
+ */
+template<int Dim, class E>
+E*
+function_sqrt(E* S, int* order, int n)
+{
+  using value_traits = scalar_traits<E>;
+  n = function_dim<Dim>(n);
+  const int nn = n * n;
+  E* Y = S;
+  E* Z = S + nn;
+  E* Yinv = S + 2 * nn;
+  E* Zinv = S + 3 * nn;
+  E* W = S + 4 * nn;
+  E* T = S + 5 * nn;
+  function_identity<Dim>(Z, n);
+
+  /* The iteration converges quadratically, so one more step after the
+   * update falls below sqrt(epsilon) reaches working precision:
+   */
+  const E tol = value_traits::sqrt(value_traits::epsilon());
+  bool last = false;
+  for(int k = 0; k < 64; ++k) {
+    if(!function_inverse<Dim>(Y, Yinv, W, T, order, n)) return nullptr;
+    if(!function_inverse<Dim>(Z, Zinv, W, T, order, n)) return nullptr;
+
+    /* Y' = (Y + Z^-1)/2, Z' = (Z + Y^-1)/2: */
+    E change(0), norm(0);
+    for(int j = 0; j < n; ++j) {
+      E dsum(0), ysum(0);
+      for(int i = 0; i < n; ++i) {
+        const int e = i * n + j;
+        const E y = (Y[e] + Zinv[e]) / E(2);
+        dsum += value_traits::fabs(y - Y[e]);
+        ysum += value_traits::fabs(y);
+        Y[e] = y;
+        Z[e] = (Z[e] + Yinv[e]) / E(2);
+      }
+      change = std::max(change, dsum);
+      norm = std::max(norm, ysum);
+    }
+    if(last) return Y;
+    last = change <= tol * norm;
+  }
+  return nullptr;
+}
+
+} // namespace detail
+
+template<class Sub, class PSub>
+void
+matrix_pow(const readable_matrix<Sub>& M, int p, writable_matrix<PSub>& Mp,
+  matrix_workspace<value_type_trait_of_t<PSub>>& workspace)
+{
+  using value_type = value_type_trait_of_t<PSub>;
+  static const int Dim = matrix_traits<PSub>::array_rows;
+  cml::check_square(M);
+  detail::instrument_scope scope("matrix_pow");
+
+  Mp = M;
+  const int n = Mp.rows(), nn = n * n;
+  typename detail::function_scratch<value_type, Dim>::type scratch(
+    &workspace);
+  value_type* S = scratch.values(4 * nn);
+  detail::function_load<Dim>(Mp, S, n);
+
+  /* Invert the base for negative powers: */
+  value_type* B = S;
+  if(p < 0) {
+    B = S + nn;
+    const bool regular = detail::function_inverse<Dim>(S, B, S + 2 * nn,
+      S + 3 * nn, scratch.indices(n), n);
+    cml_require(regular, std::invalid_argument, "matrix is singular");
+  }
+
+  /* |p| as unsigned, so that INT_MIN does not overflow: */
+  const unsigned q = p < 0 ? 0u - unsigned(p) : unsigned(p);
+  value_type* R = detail::function_pow<Dim>(B, S + 2 * nn, S + 3 * nn, q, n);
+  detail::function_store<Dim>(R, Mp, n);
+}
+
+template<class Sub>
+temporary_of_t<Sub>
+matrix_pow(const readable_matrix<Sub>& M, int p)
+{
+  detail::instrument_temporary("matrix_pow");
+  temporary_of_t<Sub> Mp;
+  matrix_workspace<value_type_trait_of_t<Sub>> workspace;
+  matrix_pow(M, p, Mp, workspace);
+  return Mp;
+}
+
+template<class Sub, class ESub>
+void
+matrix_exp(const readable_matrix<Sub>& M, writable_matrix<ESub>& E,
+  matrix_workspace<value_type_trait_of_t<ESub>>& workspace)
+{
+  using value_type = value_type_trait_of_t<ESub>;
+  static const int Dim = matrix_traits<ESub>::array_rows;
+  cml::check_square(M);
+  detail::instrument_scope scope("matrix_exp");
+
+  E = M;
+  const int n = E.rows();
+  typename detail::function_scratch<value_type, Dim>::type scratch(
+    &workspace);
+  value_type* S = scratch.values(7 * n * n);
+  detail::function_load<Dim>(E, S, n);
+  value_type* R = detail::function_exp<Dim>(S, scratch.indices(n), n);
+  cml_require(R, std::invalid_argument, "matrix exponential failed");
+  detail::function_store<Dim>(R, E, n);
+}
+
+template<class Sub>
+temporary_of_t<Sub>
+matrix_exp(const readable_matrix<Sub>& M)
+{
+  detail::instrument_temporary("matrix_exp");
+  temporary_of_t<Sub> E;
+  matrix_workspace<value_type_trait_of_t<Sub>> workspace;
+  matrix_exp(M, E, workspace);
+  return E;
+}
+
+template<class Sub, class SSub>
+bool
+matrix_sqrt(const readable_matrix<Sub>& M, writable_matrix<SSub>& S,
+  matrix_workspace<value_type_trait_of_t<SSub>>& workspace)
+{
+  using value_type = value_type_trait_of_t<SSub>;
+  static const int Dim = matrix_traits<SSub>::array_rows;
+  cml::check_square(M);
+  detail::instrument_scope scope("matrix_sqrt");
+
+  S = M;
+  const int n = S.rows();
+  typename detail::function_scratch<value_type, Dim>::type scratch(
+    &workspace);
+  value_type* A = scratch.values(6 * n * n);
+  detail::function_load<Dim>(S, A, n);
+  value_type* R = detail::function_sqrt<Dim>(A, scratch.indices(n), n);
+  if(R == nullptr) return false;
+  detail::function_store<Dim>(R, S, n);
+  return true;
+}
+
+template<class Sub>
+temporary_of_t<Sub>
+matrix_sqrt(const readable_matrix<Sub>& M)
+{
+  detail::instrument_temporary("matrix_sqrt");
+  temporary_of_t<Sub> S;
+  matrix_workspace<value_type_trait_of_t<Sub>> workspace;
+  const bool converged = matrix_sqrt(M, S, workspace);
+  cml_require(converged, std::invalid_argument,
+    "matrix square root did not converge");
+  return S;
+}
+} // namespace cml
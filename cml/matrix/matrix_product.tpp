@@ -6,9 +6,63 @@
 #  error "matrix/matrix_product.tpp not included correctly"
 #endif
 
+#include <cml/common/instrument.h>
+#include <cml/scalar/accumulator.h>
 #include <cml/matrix/detail/resize.h>
+#include <cml/matrix/structure.h>
+#include <cml/matrix/workspace.h>
 
 namespace cml {
+namespace detail {
+
+/* Compute M = sub1*sub2 for general matrices: */
+template<class Sub1, class Sub2, class Matrix>
+void
+matrix_product(const Sub1& sub1, const Sub2& sub2, Matrix& M,
+  general_structure, general_structure)
+{
+  using accumulator_type = accumulator_of_t<value_type_trait_of_t<Matrix>>;
+  for(int i = 0; i < M.rows(); ++i) {
+    for(int j = 0; j < M.cols(); ++j) {
+      accumulator_type m = accumulator_type(sub1(i, 0)) * sub2(0, j);
+      for(int k = 1; k < sub1.cols(); ++k)
+        m += accumulator_type(sub1(i, k)) * sub2(k, j);
+      M(i, j) = m;
+    }
+  }
+}
+
+/* Compute M = sub1*sub2 when either operand has known zeros, summing only
+ * over the k where both row i of sub1 and column j of sub2 may be
+ * non-zero.  The possibly non-zero part of each row of sub1 is copied
+ * once, so its elements are not re-read for every column of sub2.  The
+ * copy is kept in stack scratch storage unless sub1 has more than
+ * CML_MATRIX_SMALL_BUFFER_SIZE^2 columns.
+ */
+template<class Sub1, class Sub2, class Matrix, class Tag1, class Tag2>
+void
+matrix_product(const Sub1& sub1, const Sub2& sub2, Matrix& M, Tag1, Tag2)
+{
+  using accumulator_type = accumulator_of_t<value_type_trait_of_t<Matrix>>;
+  matrix_scratch<accumulator_type> scratch;
+  accumulator_type* row = scratch.values(sub1.cols());
+  for(int i = 0; i < M.rows(); ++i) {
+    const auto r = structure_row_range(sub1, i, Tag1());
+    for(int k = r.first; k < r.second; ++k)
+      row[k] = accumulator_type(sub1(i, k));
+    for(int j = 0; j < M.cols(); ++j) {
+      const auto c = structure_col_range(sub2, j, Tag2());
+      const int first = r.first < c.first ? c.first : r.first;
+      const int last = r.second < c.second ? r.second : c.second;
+      accumulator_type m(0);
+      for(int k = first; k < last; ++k) m += row[k] * sub2(k, j);
+      M(i, j) = m;
+    }
+  }
+}
+
+} // namespace detail
+
 template<class Sub1, class Sub2, enable_if_matrix_t<Sub1>*,
   enable_if_matrix_t<Sub2>*>
 auto
@@ -22,15 +76,13 @@ operator*(Sub1&& sub1, Sub2&& sub2)
 
   cml::check_same_inner_size(sub1, sub2);
 
+  detail::instrument_scope scope("matrix_product");
+  detail::instrument_temporary("matrix_product");
   result_type M;
   detail::resize(M, array_rows_of(sub1), array_cols_of(sub2));
-  for(int i = 0; i < M.rows(); ++i) {
-    for(int j = 0; j < M.cols(); ++j) {
-      auto m = sub1(i, 0) * sub2(0, j);
-      for(int k = 1; k < sub1.cols(); ++k) m += sub1(i, k) * sub2(k, j);
-      M(i, j) = m;
-    }
-  }
+  detail::instrument_evaluation("matrix_product", M.rows() * M.cols());
+  detail::matrix_product(sub1, sub2, M, matrix_structure_of_t<Sub1>(),
+    matrix_structure_of_t<Sub2>());
   return M;
 }
 } // namespace cml
@@ -0,0 +1,121 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <vector>
+#include <cml/vector/writable_vector.h>
+#include <cml/matrix/dynamic_allocated.h>
+
+/** The number of columns factored as a panel before the remaining columns
+ * are updated by qr() without pivoting.
+ */
+#ifndef CML_MATRIX_QR_BLOCK_SIZE
+#  define CML_MATRIX_QR_BLOCK_SIZE 32
+#endif
+
+namespace cml {
+/** Results from the Householder QR decomposition A*P = Q*R of an M x N
+ * matrix A.  R is stored on and above the diagonal of @c qr, and the
+ * Householder vector of reflector k below the diagonal of column k (its
+ * leading 1 is implicit), so that Q = H_0*H_1*...*H_{K-1} with K =
+ * min(M,N) and H_k = I - tau[k]*v_k*v_k^T.  Column k of A*P is column
+ * order[k] of A.
+ */
+template<class E> struct qr_result
+{
+  using matrix_type = matrix<E, dynamic<>, col_basis, col_major>;
+
+  matrix_type qr;
+  std::vector<E> tau;
+  std::vector<int> order;
+
+  /** The numerical rank: the number of leading diagonal elements of R
+   * larger than max(M,N)*epsilon times the largest one.  This is a
+   * reliable rank estimate only with column pivoting.
+   */
+  int rank;
+
+  /** Construct an empty result for qr(A, result). */
+  qr_result()
+    : rank(0)
+  {
+  }
+};
+
+/** Compute the Householder QR decomposition of @c A, returned as a
+ * qr_result.  If @c pivot is true, the column with the largest remaining
+ * norm is moved to the front at each step (A*P = Q*R), so that the
+ * diagonal of R is non-increasing in magnitude and @c rank is a reliable
+ * rank estimate.  Otherwise, P = I and the columns are factored in panels
+ * of CML_MATRIX_QR_BLOCK_SIZE, each split recursively in half; each block
+ * of reflectors is applied to the remaining columns at once (as I -
+ * V*T*V^T), which cuts the passes over tall matrices.
+ */
+template<class Sub>
+auto qr(const readable_matrix<Sub>& A, bool pivot = false)
+  -> qr_result<value_type_trait_of_t<Sub>>;
+
+/** Compute the Householder QR decomposition of @c A into @c result, as by
+ * qr(A, pivot).  The storage of @c result is reused when it already has
+ * the size of @c A, so repeated decompositions of same-size matrices into
+ * the same result do not allocate.
+ */
+template<class Sub, class E>
+void qr(const readable_matrix<Sub>& A, qr_result<E>& result,
+  bool pivot = false);
+
+/** Replace @c b by Q^T*b, without forming Q.
+ *
+ * @throws incompatible_matrix_row_size_error if @c b does not have as many
+ * elements as @c result.qr has rows.
+ */
+template<class E, class Sub>
+void qr_apply_qt(const qr_result<E>& result, writable_vector<Sub>& b);
+
+/** Replace @c b by Q*b, without forming Q.
+ *
+ * @throws incompatible_matrix_row_size_error if @c b does not have as many
+ * elements as @c result.qr has rows.
+ */
+template<class E, class Sub>
+void qr_apply_q(const qr_result<E>& result, writable_vector<Sub>& b);
+
+/** Solve the linear least squares problem min |A*x - b| for @c x, where
+ * the QR decomposition of A is provided as a qr_result.  Only the leading
+ * @c result.rank columns of A*P are used, and the remaining elements of
+ * P^T*x are zero (the basic solution).  @c x is resized to the number of
+ * columns of A if it is resizable.
+ *
+ * @note @c x can be the same vector as @c b if it is resizable.
+ *
+ * @throws incompatible_matrix_row_size_error if @c b does not have as many
+ * elements as @c result.qr has rows.
+ *
+ * @throws vector_size_error if @c x is not resizable and does not have as
+ * many elements as @c result.qr has columns.
+ */
+template<class E, class XSub, class BSub>
+void least_squares_solve(const qr_result<E>& result, writable_vector<XSub>& x,
+  const readable_vector<BSub>& b);
+
+/** Solve the linear least squares problem min |A*x - b| for @c x using the
+ * column-pivoted QR decomposition of @c A, without forming the normal
+ * equations A^T*A*x = A^T*b.  @c x is resized to the number of columns of
+ * @c A if it is resizable.
+ *
+ * @throws incompatible_matrix_row_size_error if @c b does not have as many
+ * elements as @c A has rows.
+ *
+ * @throws vector_size_error if @c x is not resizable and does not have as
+ * many elements as @c A has columns.
+ */
+template<class ASub, class XSub, class BSub>
+void least_squares_solve(const readable_matrix<ASub>& A,
+  writable_vector<XSub>& x, const readable_vector<BSub>& b);
+} // namespace cml
+
+#define __CML_MATRIX_QR_TPP
+#include <cml/matrix/qr.tpp>
+#undef __CML_MATRIX_QR_TPP
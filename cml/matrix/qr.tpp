@@ -0,0 +1,391 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#ifndef __CML_MATRIX_QR_TPP
+#  error "matrix/qr.tpp not included correctly"
+#endif
+
+#include <algorithm>
+#include <utility>
+#include <cml/common/instrument.h>
+#include <cml/scalar/traits.h>
+#include <cml/vector/detail/check_or_resize.h>
+#include <cml/matrix/size_checking.h>
+
+namespace cml {
+namespace detail {
+
+/** The number of rows processed at a time by the blocked QR update. */
+const int qr_row_block_size = 256;
+
+/** Return the dot product of the @c len elements of @c x and @c y.  Four
+ * partial sums are used to break the dependency chain of the additions.
+ */
+template<class E>
+inline E
+qr_dot(const E* x, const E* y, int len)
+{
+  E s0 = E(0), s1 = E(0), s2 = E(0), s3 = E(0);
+  int i = 0;
+  for(; i + 4 <= len; i += 4) {
+    s0 += x[i] * y[i];
+    s1 += x[i + 1] * y[i + 1];
+    s2 += x[i + 2] * y[i + 2];
+    s3 += x[i + 3] * y[i + 3];
+  }
+  for(; i < len; ++i) s0 += x[i] * y[i];
+  return (s0 + s1) + (s2 + s3);
+}
+
+/** Replace the @c len elements of @c x by the Householder vector v (with
+ * implicit v[0] = 1) and scalar @c tau such that (I - tau*v*v^T)*x = beta*e0,
+ * and store beta in x[0].
+ */
+template<class E>
+inline void
+qr_householder(E* x, int len, E& tau)
+{
+  using element_traits = scalar_traits<E>;
+
+  const E xnorm2 = qr_dot(x + 1, x + 1, len - 1);
+  if(xnorm2 == E(0)) {
+    tau = E(0);
+    return;
+  }
+
+  const E alpha = x[0];
+  E beta = element_traits::sqrt(alpha * alpha + xnorm2);
+  if(alpha >= E(0)) beta = -beta;
+  tau = (beta - alpha) / beta;
+  const E scale = E(1) / (alpha - beta);
+  for(int i = 1; i < len; ++i) x[i] *= scale;
+  x[0] = beta;
+}
+
+/** Apply the reflector with Householder vector @c v (with implicit v[0] =
+ * 1) and scalar @c tau to the @c len elements of @c c.
+ */
+template<class E>
+inline void
+qr_reflect(const E* v, E tau, E* c, int len)
+{
+  if(tau == E(0)) return;
+  const E w = tau * (c[0] + qr_dot(v + 1, c + 1, len - 1));
+  c[0] -= w;
+  for(int i = 1; i < len; ++i) c[i] -= w * v[i];
+}
+
+/** Apply the block reflector (H_k0*...*H_{k0+nb-1})^T, formed from the
+ * Householder vectors stored in columns k0 to k0+nb-1 of the column-major
+ * array @c a with m rows, to its @c nc columns starting at @c j0.  The
+ * product is written as I - V*T*V^T, so that the columns are updated with
+ * two passes over blocks of rows, rather than two passes per reflector.
+ */
+template<class E>
+void
+qr_block_reflect(E* a, int m, int k0, int nb, int j0, int nc, const E* tau,
+  std::vector<E>& T, std::vector<E>& W)
+{
+  const int RB = qr_row_block_size;
+  const int rows = m - k0;
+  const E* V = a + k0 * m + k0;
+  E* C = a + j0 * m + k0;
+
+  /* Element r of Householder vector l is 0 above the diagonal, an implicit
+   * 1 on it, and stored below it.  Rows nb and below are dense, and are
+   * processed in blocks:
+   */
+  auto v = [V, m](int r, int l) {
+    return r < l ? E(0) : (r == l ? E(1) : V[l * m + r]);
+  };
+
+  /* G = V^T*V, in the strict upper triangle of T: */
+  T.assign(nb * nb, E(0));
+  for(int i = 0; i < nb; ++i)
+    for(int j = 0; j < i; ++j) {
+      E d = E(0);
+      for(int r = i; r < nb; ++r) d += v(r, j) * v(r, i);
+      T[i * nb + j] = d;
+    }
+  for(int r0 = nb; r0 < rows; r0 += RB) {
+    const int len = std::min(rows, r0 + RB) - r0;
+    for(int i = 0; i < nb; ++i)
+      for(int j = 0; j < i; ++j)
+        T[i * nb + j] += qr_dot(V + j * m + r0, V + i * m + r0, len);
+  }
+
+  /* Form the upper triangular T such that H_0*...*H_{nb-1} = I -
+   * V*T*V^T:
+   */
+  for(int i = 0; i < nb; ++i) {
+    T[i * nb + i] = tau[k0 + i];
+    for(int j = 0; j < i; ++j) T[i * nb + j] *= -tau[k0 + i];
+    for(int j = 0; j < i; ++j) {
+      E t = E(0);
+      for(int l = j; l < i; ++l) t += T[l * nb + j] * T[i * nb + l];
+      T[i * nb + j] = t;
+    }
+  }
+
+  /* W = V^T*C: */
+  W.assign(nb * nc, E(0));
+  for(int j = 0; j < nc; ++j)
+    for(int l = 0; l < nb; ++l) {
+      E d = E(0);
+      for(int r = l; r < nb; ++r) d += v(r, l) * C[j * m + r];
+      W[j * nb + l] = d;
+    }
+  for(int r0 = nb; r0 < rows; r0 += RB) {
+    const int len = std::min(rows, r0 + RB) - r0;
+    for(int j = 0; j < nc; ++j)
+      for(int l = 0; l < nb; ++l)
+        W[j * nb + l] += qr_dot(V + l * m + r0, C + j * m + r0, len);
+  }
+
+  /* W = T^T*W: */
+  for(int j = 0; j < nc; ++j) {
+    E* wj = W.data() + j * nb;
+    for(int l = nb - 1; l >= 0; --l) {
+      E t = E(0);
+      for(int p = 0; p <= l; ++p) t += T[l * nb + p] * wj[p];
+      wj[l] = t;
+    }
+  }
+
+  /* C = C - V*W: */
+  for(int j = 0; j < nc; ++j)
+    for(int r = 0; r < nb; ++r) {
+      E d = E(0);
+      for(int l = 0; l <= r; ++l) d += v(r, l) * W[j * nb + l];
+      C[j * m + r] -= d;
+    }
+  for(int r0 = nb; r0 < rows; r0 += RB) {
+    const int r1 = std::min(rows, r0 + RB);
+    for(int j = 0; j < nc; ++j) {
+      E* cj = C + j * m;
+      for(int l = 0; l < nb; ++l) {
+        const E* vl = V + l * m;
+        const E w = W[j * nb + l];
+        for(int r = r0; r < r1; ++r) cj[r] -= vl[r] * w;
+      }
+    }
+  }
+}
+
+/** Recursively factor the @c nb columns of the column-major array @c a
+ * with m rows starting at column (and row) k0: the left half is factored,
+ * its reflectors are applied to the right half as a block, and then the
+ * right half is factored.
+ */
+template<class E>
+void
+qr_panel(E* a, int m, int k0, int nb, E* tau, std::vector<E>& T,
+  std::vector<E>& W)
+{
+  if(nb <= 4) {
+    for(int k = k0; k < k0 + nb; ++k) {
+      E* ak = a + k * m + k;
+      qr_householder(ak, m - k, tau[k]);
+      for(int j = k + 1; j < k0 + nb; ++j)
+        qr_reflect(ak, tau[k], a + j * m + k, m - k);
+    }
+    return;
+  }
+
+  const int h = nb / 2;
+  qr_panel(a, m, k0, h, tau, T, W);
+  qr_block_reflect(a, m, k0, h, k0 + h, nb - h, tau, T, W);
+  qr_panel(a, m, k0 + h, nb - h, tau, T, W);
+}
+
+/** Blocked Householder QR of the column-major m x n array @c a without
+ * pivoting.  Each panel of at most CML_MATRIX_QR_BLOCK_SIZE columns is
+ * factored recursively, and its reflectors are then applied to the
+ * remaining columns as a block.
+ */
+template<class E>
+void
+qr_blocked(E* a, int m, int n, E* tau)
+{
+  const int K = std::min(m, n);
+  const int NB = CML_MATRIX_QR_BLOCK_SIZE;
+  std::vector<E> T, W;
+  for(int k0 = 0; k0 < K; k0 += NB) {
+    const int nb = std::min(NB, K - k0);
+    qr_panel(a, m, k0, nb, tau, T, W);
+    if(k0 + nb < n)
+      qr_block_reflect(a, m, k0, nb, k0 + nb, n - (k0 + nb), tau, T, W);
+  }
+}
+
+/** Householder QR of the column-major m x n array @c a with column
+ * pivoting, recording the column order in @c order.
+ */
+template<class E>
+void
+qr_pivoted(E* a, int m, int n, E* tau, int* order)
+{
+  using element_traits = scalar_traits<E>;
+
+  const int K = std::min(m, n);
+  const E tol = element_traits::sqrt(element_traits::epsilon());
+
+  /* The remaining column norms, and the norms at their last
+   * recomputation:
+   */
+  std::vector<E> norms(n), saved(n);
+  for(int j = 0; j < n; ++j) {
+    norms[j] = saved[j] =
+      element_traits::sqrt(qr_dot(a + j * m, a + j * m, m));
+  }
+
+  for(int k = 0; k < K; ++k) {
+    /* Move the column with the largest remaining norm to k: */
+    int p = k;
+    for(int j = k + 1; j < n; ++j)
+      if(norms[j] > norms[p]) p = j;
+    if(p != k) {
+      std::swap_ranges(a + k * m, a + (k + 1) * m, a + p * m);
+      std::swap(order[k], order[p]);
+      std::swap(norms[k], norms[p]);
+      std::swap(saved[k], saved[p]);
+    }
+
+    E* ak = a + k * m + k;
+    qr_householder(ak, m - k, tau[k]);
+    for(int j = k + 1; j < n; ++j) {
+      E* aj = a + j * m + k;
+      qr_reflect(ak, tau[k], aj, m - k);
+
+      /* Downdate the norm, recomputing it when cancellation would make
+       * the downdate inaccurate:
+       */
+      if(norms[j] == E(0)) continue;
+      const E r = element_traits::fabs(aj[0]) / norms[j];
+      const E t = std::max(E(0), E(1) - r * r);
+      const E ratio = norms[j] / saved[j];
+      if(t * ratio * ratio <= tol) {
+        norms[j] = saved[j] =
+          element_traits::sqrt(qr_dot(aj + 1, aj + 1, m - k - 1));
+      } else
+        norms[j] *= element_traits::sqrt(t);
+    }
+  }
+}
+
+} // namespace detail
+
+template<class Sub>
+auto
+qr(const readable_matrix<Sub>& A, bool pivot)
+  -> qr_result<value_type_trait_of_t<Sub>>
+{
+  detail::instrument_scope scope("qr");
+  qr_result<value_type_trait_of_t<Sub>> result;
+  qr(A, result, pivot);
+  return result;
+}
+
+template<class Sub, class E>
+void
+qr(const readable_matrix<Sub>& A, qr_result<E>& result, bool pivot)
+{
+  using element_traits = scalar_traits<E>;
+
+  detail::instrument_scope scope("qr");
+  const int m = A.rows(), n = A.cols(), K = std::min(m, n);
+  result.qr = A;
+  result.tau.resize(K);
+  result.order.resize(n);
+  for(int j = 0; j < n; ++j) result.order[j] = j;
+
+  E* a = result.qr.data();
+  if(pivot) detail::qr_pivoted(a, m, n, result.tau.data(), result.order.data());
+  else detail::qr_blocked(a, m, n, result.tau.data());
+
+  E rmax = E(0);
+  for(int k = 0; k < K; ++k)
+    rmax = std::max(rmax, element_traits::fabs(a[k * m + k]));
+  const E tol = element_traits::epsilon() * std::max(m, n) * rmax;
+  result.rank = 0;
+  while(result.rank < K
+    && element_traits::fabs(a[result.rank * m + result.rank]) > tol)
+    ++result.rank;
+}
+
+template<class E, class Sub>
+void
+qr_apply_qt(const qr_result<E>& result, writable_vector<Sub>& b)
+{
+  cml::check_same_row_size(result.qr, b);
+  const int m = result.qr.rows();
+  const int K = int(result.tau.size());
+  const E* a = result.qr.data();
+
+  std::vector<E> y(m);
+  for(int i = 0; i < m; ++i) y[i] = b[i];
+  for(int k = 0; k < K; ++k)
+    detail::qr_reflect(a + k * m + k, result.tau[k], y.data() + k, m - k);
+  for(int i = 0; i < m; ++i) b[i] = y[i];
+}
+
+template<class E, class Sub>
+void
+qr_apply_q(const qr_result<E>& result, writable_vector<Sub>& b)
+{
+  cml::check_same_row_size(result.qr, b);
+  const int m = result.qr.rows();
+  const int K = int(result.tau.size());
+  const E* a = result.qr.data();
+
+  std::vector<E> y(m);
+  for(int i = 0; i < m; ++i) y[i] = b[i];
+  for(int k = K - 1; k >= 0; --k)
+    detail::qr_reflect(a + k * m + k, result.tau[k], y.data() + k, m - k);
+  for(int i = 0; i < m; ++i) b[i] = y[i];
+}
+
+template<class E, class XSub, class BSub>
+void
+least_squares_solve(const qr_result<E>& result, writable_vector<XSub>& x,
+  const readable_vector<BSub>& b)
+{
+  cml::check_same_row_size(result.qr, b);
+  const int m = result.qr.rows(), n = result.qr.cols();
+  const int K = int(result.tau.size());
+  const int r = result.rank;
+  const E* a = result.qr.data();
+
+  /* y = Q^T*b: */
+  detail::instrument_scope scope("least_squares_solve");
+  std::vector<E> y(m);
+  for(int i = 0; i < m; ++i) y[i] = b[i];
+  for(int k = 0; k < K; ++k)
+    detail::qr_reflect(a + k * m + k, result.tau[k], y.data() + k, m - k);
+
+  /* Solve R[0:r,0:r]*z = y[0:r] by backward substitution, in place: */
+  for(int i = r - 1; i >= 0; --i) {
+    E sum = y[i];
+    for(int j = i + 1; j < r; ++j) sum -= a[j * m + i] * y[j];
+    y[i] = sum / a[i * m + i];
+  }
+
+  /* x = P*z: */
+  detail::check_or_resize(x, n);
+  for(int j = 0; j < n; ++j) x[j] = E(0);
+  for(int k = 0; k < r; ++k) x[result.order[k]] = y[k];
+}
+
+template<class ASub, class XSub, class BSub>
+void
+least_squares_solve(const readable_matrix<ASub>& A, writable_vector<XSub>& x,
+  const readable_vector<BSub>& b)
+{
+  cml::check_same_row_size(A, b);
+  detail::instrument_scope scope("least_squares_solve");
+  qr_result<value_type_trait_of_t<ASub>> result;
+  qr(A, result, true);
+  least_squares_solve(result, x, b);
+}
+} // namespace cml
@@ -0,0 +1,124 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cml/vector/readable_vector.h>
+#include <cml/matrix/writable_matrix.h>
+
+/** The number of elements of the packed rank-k operand that the rank
+ * updates keep in cache while sweeping the rows of the updated matrix.
+ * Wider updates are split into blocks of columns (rows, for a
+ * column-major matrix) of at most this many elements.
+ */
+#ifndef CML_MATRIX_RANK_UPDATE_BLOCK_SIZE
+#  define CML_MATRIX_RANK_UPDATE_BLOCK_SIZE 16384
+#endif
+
+namespace cml {
+/** @defgroup cml_matrix_rank_update Rank Updates
+ *
+ * In-place updates of a matrix by low-rank products, equivalent to the
+ * BLAS ger, syr, syr2, syrk, and syr2k routines.  Unlike the expression
+ * A += alpha*outer(u,v), these write directly into the storage of @c A
+ * when it is a matrix<> or matrix_block<>, one row (or column, for a
+ * column-major matrix) at a time, with an inner loop the compiler can
+ * vectorize.  The rows or columns are
+ * split across @c threads threads (0 selects
+ * std::thread::hardware_concurrency()).
+ *
+ * The symmetric variants update only the lower triangle of @c A,
+ * including the diagonal, and do not reference the upper triangle.
+ */
+/*@{*/
+
+/** Replace @c A by A + alpha*u*v^T.
+ *
+ * @throws incompatible_matrix_row_size_error if @c u does not have as
+ * many elements as @c A has rows.
+ *
+ * @throws incompatible_matrix_col_size_error if @c v does not have as
+ * many elements as @c A has columns.
+ */
+template<class Sub, class Scalar, class Sub1, class Sub2>
+void rank_update(writable_matrix<Sub>& A, const Scalar& alpha,
+  const readable_vector<Sub1>& u, const readable_vector<Sub2>& v,
+  int threads = 1);
+
+/** Replace @c A by A + alpha*U*V^T, where @c U and @c V have the same
+ * number of columns k.
+ *
+ * @throws incompatible_matrix_row_size_error if @c U does not have as
+ * many rows as @c A.
+ *
+ * @throws incompatible_matrix_col_size_error if @c V does not have as
+ * many rows as @c A has columns.
+ *
+ * @throws incompatible_matrix_inner_size_error if @c U and @c V do not
+ * have the same number of columns.
+ */
+template<class Sub, class Scalar, class Sub1, class Sub2>
+void rank_k_update(writable_matrix<Sub>& A, const Scalar& alpha,
+  const readable_matrix<Sub1>& U, const readable_matrix<Sub2>& V,
+  int threads = 1);
+
+/** Replace the lower triangle of the square matrix @c A by that of A +
+ * alpha*u*u^T.
+ *
+ * @throws non_square_matrix_error if @c A is not square.
+ *
+ * @throws incompatible_matrix_row_size_error if @c u does not have as
+ * many elements as @c A has rows.
+ */
+template<class Sub, class Scalar, class Sub1>
+void symmetric_rank_update(writable_matrix<Sub>& A, const Scalar& alpha,
+  const readable_vector<Sub1>& u, int threads = 1);
+
+/** Replace the lower triangle of the square matrix @c A by that of A +
+ * alpha*(u*v^T + v*u^T).
+ *
+ * @throws non_square_matrix_error if @c A is not square.
+ *
+ * @throws incompatible_matrix_row_size_error if @c u or @c v does not
+ * have as many elements as @c A has rows.
+ */
+template<class Sub, class Scalar, class Sub1, class Sub2>
+void symmetric_rank_update(writable_matrix<Sub>& A, const Scalar& alpha,
+  const readable_vector<Sub1>& u, const readable_vector<Sub2>& v,
+  int threads = 1);
+
+/** Replace the lower triangle of the square matrix @c A by that of A +
+ * alpha*U*U^T.
+ *
+ * @throws non_square_matrix_error if @c A is not square.
+ *
+ * @throws incompatible_matrix_row_size_error if @c U does not have as
+ * many rows as @c A.
+ */
+template<class Sub, class Scalar, class Sub1>
+void symmetric_rank_k_update(writable_matrix<Sub>& A, const Scalar& alpha,
+  const readable_matrix<Sub1>& U, int threads = 1);
+
+/** Replace the lower triangle of the square matrix @c A by that of A +
+ * alpha*(U*V^T + V*U^T).
+ *
+ * @throws non_square_matrix_error if @c A is not square.
+ *
+ * @throws incompatible_matrix_row_size_error if @c U or @c V does not
+ * have as many rows as @c A.
+ *
+ * @throws incompatible_matrix_inner_size_error if @c U and @c V do not
+ * have the same number of columns.
+ */
+template<class Sub, class Scalar, class Sub1, class Sub2>
+void symmetric_rank_k_update(writable_matrix<Sub>& A, const Scalar& alpha,
+  const readable_matrix<Sub1>& U, const readable_matrix<Sub2>& V,
+  int threads = 1);
+
+/*@}*/
+} // namespace cml
+
+#define __CML_MATRIX_RANK_UPDATE_TPP
+#include <cml/matrix/rank_update.tpp>
+#undef __CML_MATRIX_RANK_UPDATE_TPP
@@ -0,0 +1,320 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#ifndef __CML_MATRIX_RANK_UPDATE_TPP
+#  error "matrix/rank_update.tpp not included correctly"
+#endif
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+#include <cml/common/exception.h>
+#include <cml/common/parallel.h>
+#include <cml/vector/vector.h>
+#include <cml/matrix/matrix.h>
+#include <cml/matrix/block.h>
+#include <cml/matrix/size_checking.h>
+
+namespace cml {
+namespace detail {
+
+/* Triangles of the row-major view updated by rank_update_kernel(): */
+enum rank_update_part
+{
+  rank_update_full,
+  rank_update_lower,
+  rank_update_upper
+};
+
+/* Return the columns [lo,hi) of row i of an n-column view in @c part. */
+inline void
+rank_update_columns(rank_update_part part, int i, int n, int& lo, int& hi)
+{
+  lo = part == rank_update_upper ? i : 0;
+  hi = part == rank_update_lower ? i + 1 : n;
+}
+
+/* Add alpha*X*Y to the rows x cols row-major array @c a with leading
+ * dimension @c ld, where X is rows x k (x[i*k+p]) and Y is k x cols
+ * (y[p*cols+j]).  Columns are processed in cache-sized blocks, and rows
+ * are split across @c threads threads.
+ */
+template<class E>
+void
+rank_update_kernel(E* a, int rows, int cols, int ld, E alpha, const E* x,
+  const E* y, int k, rank_update_part part, int threads)
+{
+  const int B = std::max(1, CML_MATRIX_RANK_UPDATE_BLOCK_SIZE / k);
+
+  /* Threads only pay off for large updates: */
+  if((long long) rows * cols * k < (1 << 16)) threads = 1;
+
+  auto update_rows = [=](int begin, int end) {
+    for(int j0 = 0; j0 < cols; j0 += B) {
+      for(int i = begin; i < end; ++i) {
+        int lo, hi;
+        rank_update_columns(part, i, cols, lo, hi);
+        lo = std::max(lo, j0);
+        hi = std::min(hi, j0 + B);
+        E* ai = a + (long long) i * ld;
+        for(int p = 0; p < k; ++p) {
+          const E s = alpha * x[i * k + p];
+          const E* yp = y + (long long) p * cols;
+          for(int j = lo; j < hi; ++j) ai[j] += s * yp[j];
+        }
+      }
+    }
+  };
+  parallel_for(rows, threads, update_rows);
+}
+
+/* Row-major view of contiguous matrix storage: */
+template<class E, class Storage, class Basis, class Layout>
+inline void
+rank_update_apply(matrix<E, Storage, Basis, Layout>& A, E alpha, const E* x,
+  const E* y, int k, bool by_row, rank_update_part part, int threads)
+{
+  /* A column-major matrix is the row-major view of A^T, updated by
+   * alpha*Y^T*X^T; the operands were packed for this by the caller:
+   */
+  const int rows = by_row ? A.rows() : A.cols();
+  const int cols = by_row ? A.cols() : A.rows();
+  rank_update_kernel(A.data(), rows, cols, cols, alpha, x, y, k, part,
+    threads);
+}
+
+/* Row-major view of strided block storage: */
+template<class E, class Basis, class Layout>
+inline void
+rank_update_apply(matrix_block<E, Basis, Layout>& A, E alpha, const E* x,
+  const E* y, int k, bool by_row, rank_update_part part, int threads)
+{
+  const int rows = by_row ? A.rows() : A.cols();
+  const int cols = by_row ? A.cols() : A.rows();
+  rank_update_kernel(A.data(), rows, cols, A.leading_dimension(), alpha, x,
+    y, k, part, threads);
+}
+
+/* Generic element-wise update: */
+template<class Sub, class E>
+inline void
+rank_update_apply(writable_matrix<Sub>& A, E alpha, const E* x, const E* y,
+  int k, bool by_row, rank_update_part part, int)
+{
+  const int rows = by_row ? A.rows() : A.cols();
+  const int cols = by_row ? A.cols() : A.rows();
+  for(int i = 0; i < rows; ++i) {
+    int lo, hi;
+    rank_update_columns(part, i, cols, lo, hi);
+    for(int j = lo; j < hi; ++j) {
+      E sum = E(0);
+      for(int p = 0; p < k; ++p) sum += x[i * k + p] * y[p * cols + j];
+      if(by_row) A.put(i, j, A.get(i, j) + alpha * sum);
+      else A.put(j, i, A.get(j, i) + alpha * sum);
+    }
+  }
+}
+
+/* True if the rows of @c A are contiguous in rank_update_apply(): */
+template<class Sub>
+inline bool
+rank_update_by_row(const writable_matrix<Sub>&)
+{
+  return std::is_same<layout_tag_trait_of_t<Sub>, row_major>::value;
+}
+
+/* Return a pointer to the elements of @c v as E, copying them to @c buf
+ * if needed:
+ */
+template<class Sub, class E>
+inline const E*
+rank_update_pack(const readable_vector<Sub>& v, std::vector<E>& buf)
+{
+  buf.resize(v.size());
+  for(int i = 0; i < v.size(); ++i) buf[i] = E(v.get(i));
+  return buf.data();
+}
+
+template<class E, class Storage>
+inline const E*
+rank_update_pack(const vector<E, Storage>& v, std::vector<E>&)
+{
+  return v.data();
+}
+
+/* Copy the elements of @c M as E into @c buf, row-major if @c by_row is
+ * true, and column-major otherwise, starting at column @c offset of a
+ * packed matrix with @c k columns.
+ */
+template<class Sub, class E>
+inline void
+rank_update_pack(const readable_matrix<Sub>& M, bool by_row, int k,
+  int offset, std::vector<E>& buf)
+{
+  const int rows = M.rows(), cols = M.cols();
+  buf.resize(std::size_t(rows) * k);
+  for(int i = 0; i < rows; ++i)
+    for(int p = 0; p < cols; ++p) {
+      const std::size_t at = by_row
+        ? std::size_t(i) * k + offset + p
+        : std::size_t(offset + p) * rows + i;
+      buf[at] = E(M.get(i, p));
+    }
+}
+
+/* Check that @c u has as many elements as @c A has rows, and @c v as many
+ * as @c A has columns:
+ */
+template<class Sub, class Sub1, class Sub2>
+inline void
+rank_update_check(const writable_matrix<Sub>& A,
+  const readable_matrix<Sub1>& U, const readable_matrix<Sub2>& V)
+{
+  cml_size_require(U.rows() == A.rows(), incompatible_matrix_row_size_error,
+    /**/);
+  cml_size_require(V.rows() == A.cols(), incompatible_matrix_col_size_error,
+    /**/);
+  cml_size_require(U.cols() == V.cols(), incompatible_matrix_inner_size_error,
+    /**/);
+}
+
+} // namespace detail
+
+template<class Sub, class Scalar, class Sub1, class Sub2>
+void
+rank_update(writable_matrix<Sub>& A, const Scalar& alpha,
+  const readable_vector<Sub1>& u, const readable_vector<Sub2>& v,
+  int threads)
+{
+  using value_type = value_type_trait_of_t<Sub>;
+  check_same_row_size(A, u);
+  check_same_col_size(A, v);
+
+  /* A row-major A is updated by u*v^T, and a column-major one by v*u^T: */
+  std::vector<value_type> ubuf, vbuf;
+  const value_type* x = detail::rank_update_pack(u.actual(), ubuf);
+  const value_type* y = detail::rank_update_pack(v.actual(), vbuf);
+  const bool by_row = detail::rank_update_by_row(A);
+  if(!by_row) std::swap(x, y);
+  detail::rank_update_apply(A.actual(), value_type(alpha), x, y, 1, by_row,
+    detail::rank_update_full, threads);
+}
+
+template<class Sub, class Scalar, class Sub1, class Sub2>
+void
+rank_k_update(writable_matrix<Sub>& A, const Scalar& alpha,
+  const readable_matrix<Sub1>& U, const readable_matrix<Sub2>& V,
+  int threads)
+{
+  using value_type = value_type_trait_of_t<Sub>;
+  detail::rank_update_check(A, U, V);
+
+  /* A rank-0 update leaves A unchanged: */
+  const int k = U.cols();
+  if(k == 0) return;
+
+  /* Pack X = U and Y = V^T for a row-major A, or X = V and Y = U^T: */
+  const bool by_row = detail::rank_update_by_row(A);
+  std::vector<value_type> x, y;
+  if(by_row) {
+    detail::rank_update_pack(U, true, k, 0, x);
+    detail::rank_update_pack(V, false, k, 0, y);
+  } else {
+    detail::rank_update_pack(V, true, k, 0, x);
+    detail::rank_update_pack(U, false, k, 0, y);
+  }
+  detail::rank_update_apply(A.actual(), value_type(alpha), x.data(),
+    y.data(), k, by_row, detail::rank_update_full, threads);
+}
+
+template<class Sub, class Scalar, class Sub1>
+void
+symmetric_rank_update(writable_matrix<Sub>& A, const Scalar& alpha,
+  const readable_vector<Sub1>& u, int threads)
+{
+  using value_type = value_type_trait_of_t<Sub>;
+  check_square(A);
+  check_same_row_size(A, u);
+
+  /* The lower triangle of A is the upper triangle of A^T: */
+  std::vector<value_type> buf;
+  const value_type* x = detail::rank_update_pack(u.actual(), buf);
+  const bool by_row = detail::rank_update_by_row(A);
+  detail::rank_update_apply(A.actual(), value_type(alpha), x, x, 1, by_row,
+    by_row ? detail::rank_update_lower : detail::rank_update_upper, threads);
+}
+
+template<class Sub, class Scalar, class Sub1, class Sub2>
+void
+symmetric_rank_update(writable_matrix<Sub>& A, const Scalar& alpha,
+  const readable_vector<Sub1>& u, const readable_vector<Sub2>& v,
+  int threads)
+{
+  using value_type = value_type_trait_of_t<Sub>;
+  check_square(A);
+  check_same_row_size(A, u);
+  check_same_row_size(A, v);
+
+  /* Rank-2 update by X = [u v] (n x 2) and Y = [v u]^T (2 x n): */
+  const int n = A.rows();
+  std::vector<value_type> x(2 * n), y(2 * n);
+  for(int i = 0; i < n; ++i) {
+    const value_type ui = value_type(u.get(i)), vi = value_type(v.get(i));
+    x[2 * i] = y[n + i] = ui;
+    x[2 * i + 1] = y[i] = vi;
+  }
+  const bool by_row = detail::rank_update_by_row(A);
+  detail::rank_update_apply(A.actual(), value_type(alpha), x.data(),
+    y.data(), 2, by_row,
+    by_row ? detail::rank_update_lower : detail::rank_update_upper, threads);
+}
+
+template<class Sub, class Scalar, class Sub1>
+void
+symmetric_rank_k_update(writable_matrix<Sub>& A, const Scalar& alpha,
+  const readable_matrix<Sub1>& U, int threads)
+{
+  using value_type = value_type_trait_of_t<Sub>;
+  check_square(A);
+  detail::rank_update_check(A, U, U);
+
+  /* A rank-0 update leaves A unchanged: */
+  const int k = U.cols();
+  if(k == 0) return;
+
+  const bool by_row = detail::rank_update_by_row(A);
+  std::vector<value_type> x, y;
+  detail::rank_update_pack(U, true, k, 0, x);
+  detail::rank_update_pack(U, false, k, 0, y);
+  detail::rank_update_apply(A.actual(), value_type(alpha), x.data(),
+    y.data(), k, by_row,
+    by_row ? detail::rank_update_lower : detail::rank_update_upper, threads);
+}
+
+template<class Sub, class Scalar, class Sub1, class Sub2>
+void
+symmetric_rank_k_update(writable_matrix<Sub>& A, const Scalar& alpha,
+  const readable_matrix<Sub1>& U, const readable_matrix<Sub2>& V,
+  int threads)
+{
+  using value_type = value_type_trait_of_t<Sub>;
+  check_square(A);
+  detail::rank_update_check(A, U, V);
+
+  /* A rank-0 update leaves A unchanged: */
+  const int k = U.cols();
+  if(k == 0) return;
+
+  /* Rank-2k update by X = [U V] and Y = [V U]^T: */
+  const bool by_row = detail::rank_update_by_row(A);
+  std::vector<value_type> x, y;
+  detail::rank_update_pack(U, true, 2 * k, 0, x);
+  detail::rank_update_pack(V, true, 2 * k, k, x);
+  detail::rank_update_pack(V, false, 2 * k, 0, y);
+  detail::rank_update_pack(U, false, 2 * k, k, y);
+  detail::rank_update_apply(A.actual(), value_type(alpha), x.data(),
+    y.data(), 2 * k, by_row,
+    by_row ? detail::rank_update_lower : detail::rank_update_upper, threads);
+}
+} // namespace cml
@@ -0,0 +1,102 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <utility>
+#include <cml/common/thread_count.h>
+#include <cml/matrix/readable_matrix.h>
+
+namespace cml {
+/** @defgroup cml_matrix_reductions Matrix Reductions
+ *
+ * Reductions of the elements of a matrix or matrix expression to a
+ * scalar.  Elements are visited in storage order (by row for a row-major
+ * matrix, by column for a column-major one), and expressions are
+ * evaluated element by element without a temporary.  Sums use pairwise
+ * summation in accumulator_of_t<> precision, as for the vector
+ * reductions.
+ *
+ * Matrices with at least CML_REDUCTION_PARALLEL_THRESHOLD elements are
+ * split across the number of threads given by @c threads, a thread_count
+ * (e.g. sum(M, thread_count(4)); thread_count(0) selects
+ * std::thread::hardware_concurrency()), by row or column.
+ *
+ * The results of min(), max(), argmin(), argmax(), norm_1() and norm_inf()
+ * are unspecified if @c M contains NaN.
+ */
+/*@{*/
+
+/** Return the sum of the elements of @c M, or 0 if @c M is empty. */
+template<class Sub>
+auto sum(const readable_matrix<Sub>& M,
+  thread_count threads = thread_count())
+  -> value_type_trait_of_t<Sub>;
+
+/** Return the smallest element of @c M.
+ *
+ * @throws minimum_matrix_size_error if @c M is empty.
+ */
+template<class Sub>
+auto min(const readable_matrix<Sub>& M,
+  thread_count threads = thread_count())
+  -> value_type_trait_of_t<Sub>;
+
+/** Return the largest element of @c M.
+ *
+ * @throws minimum_matrix_size_error if @c M is empty.
+ */
+template<class Sub>
+auto max(const readable_matrix<Sub>& M,
+  thread_count threads = thread_count())
+  -> value_type_trait_of_t<Sub>;
+
+/** Return the (row, column) of the smallest element of @c M.  Of equal
+ * elements, the first in storage order is returned.
+ *
+ * @throws minimum_matrix_size_error if @c M is empty.
+ */
+template<class Sub>
+std::pair<int, int> argmin(const readable_matrix<Sub>& M,
+  thread_count threads = thread_count());
+
+/** Return the (row, column) of the largest element of @c M.  Of equal
+ * elements, the first in storage order is returned.
+ *
+ * @throws minimum_matrix_size_error if @c M is empty.
+ */
+template<class Sub>
+std::pair<int, int> argmax(const readable_matrix<Sub>& M,
+  thread_count threads = thread_count());
+
+/** Return the 1-norm of @c M, the largest sum of the magnitudes of the
+ * elements of a column, or 0 if @c M is empty.
+ */
+template<class Sub>
+auto norm_1(const readable_matrix<Sub>& M,
+  thread_count threads = thread_count())
+  -> value_type_trait_of_t<Sub>;
+
+/** Return the infinity norm of @c M, the largest sum of the magnitudes
+ * of the elements of a row, or 0 if @c M is empty.
+ */
+template<class Sub>
+auto norm_inf(const readable_matrix<Sub>& M,
+  thread_count threads = thread_count())
+  -> value_type_trait_of_t<Sub>;
+
+/** Return the Frobenius norm of @c M, the square root of the sum of the
+ * squares of its elements.
+ */
+template<class Sub>
+auto norm_frobenius(const readable_matrix<Sub>& M,
+  thread_count threads = thread_count())
+  -> value_type_trait_of_t<Sub>;
+
+/*@}*/
+} // namespace cml
+
+#define __CML_MATRIX_REDUCTIONS_TPP
+#include <cml/matrix/reductions.tpp>
+#undef __CML_MATRIX_REDUCTIONS_TPP
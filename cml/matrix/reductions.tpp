@@ -0,0 +1,256 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#ifndef __CML_MATRIX_REDUCTIONS_TPP
+#  error "matrix/reductions.tpp not included correctly"
+#endif
+
+#include <functional>
+#include <type_traits>
+#include <vector>
+#include <cml/common/reduction.h>
+#include <cml/scalar/accumulator.h>
+#include <cml/scalar/traits.h>
+#include <cml/matrix/size_checking.h>
+
+namespace cml {
+namespace detail {
+
+/* Access to the elements of a matrix in storage order, as lines (rows or
+ * columns) of elements:
+ */
+template<class Sub> class matrix_lines
+{
+  public:
+  explicit matrix_lines(const Sub& M)
+    : m_M(M)
+  {
+  }
+
+  /* True if the lines are rows: */
+  static constexpr bool by_row =
+    std::is_same<layout_tag_trait_of_t<Sub>, row_major>::value;
+
+  /* The number of reduction lanes along a line; short fixed-size lines
+   * use one, so the lane loop is not instantiated past their end:
+   */
+  static constexpr int fixed_length = by_row ? matrix_traits<Sub>::array_cols
+                                             : matrix_traits<Sub>::array_rows;
+  static constexpr int lanes =
+    (0 < fixed_length && fixed_length < reduction_lanes) ? 1 : reduction_lanes;
+
+  /* Return the number of lines, and of elements per line: */
+  int lines() const { return by_row ? this->m_M.rows() : this->m_M.cols(); }
+  int length() const { return by_row ? this->m_M.cols() : this->m_M.rows(); }
+
+  /* Return element k of line l: */
+  auto get(int l, int k) const
+  {
+    if constexpr(by_row) return this->m_M.get(l, k);
+    else return this->m_M.get(k, l);
+  }
+
+  /* Return the (row, column) of element k of line l: */
+  std::pair<int, int> at(int l, int k) const
+  {
+    return by_row ? std::make_pair(l, k) : std::make_pair(k, l);
+  }
+
+  private:
+  const Sub& m_M;
+};
+
+/* Return the sum of f(l,k) over the elements of @c M, in the accumulator
+ * type of its elements:
+ */
+template<class Sub, class F>
+auto
+matrix_reduce_sum(const readable_matrix<Sub>& M, const F& f, int threads)
+  -> accumulator_of_t<value_type_trait_of_t<Sub>>
+{
+  using accumulator_type = accumulator_of_t<value_type_trait_of_t<Sub>>;
+  const matrix_lines<Sub> L(M.actual());
+  const int n = L.length();
+  return reduce_parallel<accumulator_type>(
+    L.lines(), n, threads,
+    [&f, n](int begin, int end) {
+      auto line_sum = [&f, n](int l) {
+        return reduce_sum<accumulator_type, matrix_lines<Sub>::lanes>(
+          [&f, l](int k) { return f(l, k); }, 0, n);
+      };
+      return reduce_sum<accumulator_type>(line_sum, begin, end);
+    },
+    [](accumulator_type a, accumulator_type b) { return a + b; });
+}
+
+/* Return the first element of @c M in storage order that is best by @c
+ * better, and its (row, column):
+ */
+template<class Sub, class Better>
+auto
+matrix_reduce_best(const readable_matrix<Sub>& M, Better better, int threads)
+  -> std::pair<value_type_trait_of_t<Sub>, std::pair<int, int>>
+{
+  using value_type = value_type_trait_of_t<Sub>;
+  using result_type = std::pair<value_type, std::pair<int, int>>;
+  cml::check_minimum_size(M, cml::int_c<1>(), cml::int_c<1>());
+
+  const matrix_lines<Sub> L(M.actual());
+  const int n = L.length();
+  auto best_of_lines = [&L, &better, n](int begin, int end) {
+    result_type r;
+    for(int l = begin; l < end; ++l) {
+      value_type value;
+      int k;
+      reduce_best<matrix_lines<Sub>::lanes>(
+        [&L, l](int k) { return L.get(l, k); }, 0, n, better, value, k);
+      if(l == begin || better(value, r.first)) r = {value, L.at(l, k)};
+    }
+    return r;
+  };
+  return reduce_parallel<result_type>(L.lines(), n, threads, best_of_lines,
+    [&better](const result_type& a, const result_type& b) {
+      return better(b.first, a.first) ? b : a;
+    });
+}
+
+/* Return the element of @c M that is best by @c better: */
+template<class Sub, class Better>
+auto
+matrix_reduce_extreme(const readable_matrix<Sub>& M, Better better,
+  int threads) -> value_type_trait_of_t<Sub>
+{
+  using value_type = value_type_trait_of_t<Sub>;
+  cml::check_minimum_size(M, cml::int_c<1>(), cml::int_c<1>());
+
+  const matrix_lines<Sub> L(M.actual());
+  const int n = L.length();
+  auto best_of_lines = [&L, &better, n](int begin, int end) {
+    auto line_best = [&L, &better, n](int l) {
+      return reduce_extreme<value_type, matrix_lines<Sub>::lanes>(
+        [&L, l](int k) { return L.get(l, k); }, 0, n, better);
+    };
+    return reduce_extreme<value_type>(line_best, begin, end, better);
+  };
+  return reduce_parallel<value_type>(L.lines(), n, threads, best_of_lines,
+    [&better](value_type a, value_type b) { return better(b, a) ? b : a; });
+}
+
+/* Return the largest sum of the magnitudes of the elements of a row of @c
+ * M if @c rows is true, or of a column otherwise:
+ */
+template<class Sub>
+auto
+matrix_max_abs_line_sum(const readable_matrix<Sub>& M, bool rows,
+  int threads) -> value_type_trait_of_t<Sub>
+{
+  using value_type = value_type_trait_of_t<Sub>;
+  using value_traits = scalar_traits<value_type>;
+  using accumulator_type = accumulator_of_t<value_type>;
+
+  const matrix_lines<Sub> L(M.actual());
+  const int lines = L.lines(), n = L.length();
+  if(lines == 0 || n == 0) return value_type(0);
+  if((long long) lines * n < CML_REDUCTION_PARALLEL_THRESHOLD) threads = 1;
+
+  std::vector<accumulator_type> sums;
+  if(rows == L.by_row) {
+    /* Sum along each line in storage order: */
+    sums.resize(lines);
+    parallel_for(lines, threads, [&L, &sums, n](int begin, int end) {
+      for(int l = begin; l < end; ++l)
+        sums[l] = reduce_sum<accumulator_type, matrix_lines<Sub>::lanes>(
+          [&L, l](int k) { return value_traits::fabs(L.get(l, k)); }, 0, n);
+    });
+  } else {
+    /* Sum across the lines, one slice of elements per thread: */
+    sums.assign(n, accumulator_type(0));
+    parallel_for(n, threads, [&L, &sums, lines](int begin, int end) {
+      for(int l = 0; l < lines; ++l)
+        for(int k = begin; k < end; ++k)
+          sums[k] += accumulator_type(value_traits::fabs(L.get(l, k)));
+    });
+  }
+
+  accumulator_type result = sums[0];
+  for(const auto& s : sums) result = s > result ? s : result;
+  return value_type(result);
+}
+
+} // namespace detail
+
+template<class Sub>
+auto
+sum(const readable_matrix<Sub>& M, thread_count threads)
+  -> value_type_trait_of_t<Sub>
+{
+  using value_type = value_type_trait_of_t<Sub>;
+  const detail::matrix_lines<Sub> L(M.actual());
+  return value_type(detail::matrix_reduce_sum(M,
+    [&L](int l, int k) { return L.get(l, k); }, threads.value));
+}
+
+template<class Sub>
+auto
+min(const readable_matrix<Sub>& M, thread_count threads)
+  -> value_type_trait_of_t<Sub>
+{
+  return detail::matrix_reduce_extreme(M, std::less<>(), threads.value);
+}
+
+template<class Sub>
+auto
+max(const readable_matrix<Sub>& M, thread_count threads)
+  -> value_type_trait_of_t<Sub>
+{
+  return detail::matrix_reduce_extreme(M, std::greater<>(), threads.value);
+}
+
+template<class Sub>
+std::pair<int, int>
+argmin(const readable_matrix<Sub>& M, thread_count threads)
+{
+  return detail::matrix_reduce_best(M, std::less<>(), threads.value).second;
+}
+
+template<class Sub>
+std::pair<int, int>
+argmax(const readable_matrix<Sub>& M, thread_count threads)
+{
+  return detail::matrix_reduce_best(M, std::greater<>(), threads.value).second;
+}
+
+template<class Sub>
+auto
+norm_1(const readable_matrix<Sub>& M, thread_count threads)
+  -> value_type_trait_of_t<Sub>
+{
+  return detail::matrix_max_abs_line_sum(M, false, threads.value);
+}
+
+template<class Sub>
+auto
+norm_inf(const readable_matrix<Sub>& M, thread_count threads)
+  -> value_type_trait_of_t<Sub>
+{
+  return detail::matrix_max_abs_line_sum(M, true, threads.value);
+}
+
+template<class Sub>
+auto
+norm_frobenius(const readable_matrix<Sub>& M, thread_count threads)
+  -> value_type_trait_of_t<Sub>
+{
+  using value_type = value_type_trait_of_t<Sub>;
+  using accumulator_type = accumulator_of_t<value_type>;
+  const detail::matrix_lines<Sub> L(M.actual());
+  return value_type(scalar_traits<accumulator_type>::sqrt(
+    detail::matrix_reduce_sum(M,
+      [&L](int l, int k) {
+        const accumulator_type x(L.get(l, k));
+        return x * x;
+      },
+      threads.value)));
+}
+} // namespace cml
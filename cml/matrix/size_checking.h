@@ -113,7 +113,7 @@ struct non_square_matrix_error : std::runtime_error
  */
 template<class Sub1, class Sub2>
 void check_same_linear_size(const readable_matrix<Sub1>& left,
-  const readable_matrix<Sub2>& right);
+  const readable_matrix<Sub2>& right) CML_SIZE_CHECK_NOEXCEPT;
 
 /** Front-end for both compile-time and run-time matrix binary expression
  * size checking against a fixed-size array.  The first expression must
@@ -136,7 +136,7 @@ void check_same_linear_size(const readable_matrix<Sub1>& left,
  */
 template<class Sub1, class Sub2>
 void check_same_linear_size(const readable_matrix<Sub1>& left,
-  const Sub2& right, enable_if_array_t<Sub2>* = 0);
+  const Sub2& right, enable_if_array_t<Sub2>* = 0) CML_SIZE_CHECK_NOEXCEPT;
 
 /** Front-end for run-time matrix binary expression length checking.  The
  * first expression must derive from readable_matrix, and the second must
@@ -156,7 +156,7 @@ void check_same_linear_size(const readable_matrix<Sub1>& left,
  */
 template<class Sub1, class Sub2>
 auto check_same_linear_size(const readable_matrix<Sub1>& left,
-  const Sub2& right) -> decltype(right.size(), void());
+  const Sub2& right) CML_SIZE_CHECK_NOEXCEPT -> decltype(right.size(), void());
 
 
 /** Front-end for matrix expression size checking against a run-time linear
@@ -171,7 +171,8 @@ auto check_same_linear_size(const readable_matrix<Sub1>& left,
  * CML_NO_RUNTIME_MATRIX_SIZE_CHECKS at compile time.
  */
 template<class Sub>
-void check_linear_size(const readable_matrix<Sub>& left, int N);
+void check_linear_size(const readable_matrix<Sub>& left,
+  int N) CML_SIZE_CHECK_NOEXCEPT;
 
 /** Front-end for compile-time and run-time matrix expression linear size
  * checking against an integer constant via int_c<N>.  The expression
@@ -187,7 +188,8 @@ void check_linear_size(const readable_matrix<Sub>& left, int N);
  * CML_NO_RUNTIME_MATRIX_SIZE_CHECKS at compile time.
  */
 template<class Sub, int N>
-void check_linear_size(const readable_matrix<Sub>& left, int_c<N>);
+void check_linear_size(const readable_matrix<Sub>& left,
+  int_c<N>) CML_SIZE_CHECK_NOEXCEPT;
 
 /** Front-end for both compile-time and run-time matrix binary expression
  * size checking.  Both expressions must derive from readable_matrix.
@@ -208,7 +210,7 @@ void check_linear_size(const readable_matrix<Sub>& left, int_c<N>);
  */
 template<class Sub1, class Sub2>
 void check_same_size(const readable_matrix<Sub1>& left,
-  const readable_matrix<Sub2>& right);
+  const readable_matrix<Sub2>& right) CML_SIZE_CHECK_NOEXCEPT;
 
 /** Front-end for both compile-time and run-time matrix expression size
  * checking against a 2D C-array.  @c left must derive from
@@ -232,7 +234,7 @@ void check_same_size(const readable_matrix<Sub1>& left,
  */
 template<class Sub, class Other, int Rows, int Cols>
 void check_same_size(const readable_matrix<Sub>& left,
-  Other const (&array)[Rows][Cols]);
+  Other const (&array)[Rows][Cols]) CML_SIZE_CHECK_NOEXCEPT;
 
 /** Front-end for both compile-time and run-time matrix row size
  * checking against a vector expression.  @c left must derive from
@@ -254,7 +256,7 @@ void check_same_size(const readable_matrix<Sub>& left,
  */
 template<class Sub1, class Sub2>
 void check_same_row_size(const readable_matrix<Sub1>& left,
-  const readable_vector<Sub2>& right);
+  const readable_vector<Sub2>& right) CML_SIZE_CHECK_NOEXCEPT;
 
 /** Front-end for both compile-time and run-time matrix column size
  * checking against a vector expression.  @c left must derive from
@@ -276,7 +278,7 @@ void check_same_row_size(const readable_matrix<Sub1>& left,
  */
 template<class Sub1, class Sub2>
 void check_same_col_size(const readable_matrix<Sub1>& left,
-  const readable_vector<Sub2>& right);
+  const readable_vector<Sub2>& right) CML_SIZE_CHECK_NOEXCEPT;
 
 
 /** Front-end for both compile-time and run-time compatible inner product
@@ -295,7 +297,7 @@ void check_same_col_size(const readable_matrix<Sub1>& left,
  */
 template<class Sub1, class Sub2>
 void check_same_inner_size(const readable_matrix<Sub1>& left,
-  const readable_matrix<Sub2>& right);
+  const readable_matrix<Sub2>& right) CML_SIZE_CHECK_NOEXCEPT;
 
 /** Front-end for both compile-time and run-time compatible inner product
  * size checking.  @c left must derive from readable_matrix, and @c right
@@ -314,7 +316,7 @@ void check_same_inner_size(const readable_matrix<Sub1>& left,
  */
 template<class Sub1, class Sub2>
 void check_same_inner_size(const readable_matrix<Sub1>& left,
-  const readable_vector<Sub2>& right);
+  const readable_vector<Sub2>& right) CML_SIZE_CHECK_NOEXCEPT;
 
 /** Front-end for both compile-time and run-time compatible inner product
  * size checking.  @c left must derive from readable_vector, and @c right
@@ -333,7 +335,7 @@ void check_same_inner_size(const readable_matrix<Sub1>& left,
  */
 template<class Sub1, class Sub2>
 void check_same_inner_size(const readable_vector<Sub1>& left,
-  const readable_matrix<Sub2>& right);
+  const readable_matrix<Sub2>& right) CML_SIZE_CHECK_NOEXCEPT;
 
 
 /** Front-end for matrix expression size checking against a run-time
@@ -350,7 +352,8 @@ void check_same_inner_size(const readable_vector<Sub1>& left,
  * CML_NO_RUNTIME_MATRIX_SIZE_CHECKS at compile time.
  */
 template<class Sub>
-void check_size(const readable_matrix<Sub>& left, int R, int C);
+void check_size(const readable_matrix<Sub>& left, int R,
+  int C) CML_SIZE_CHECK_NOEXCEPT;
 
 /** Front-end for compile-time and run-time matrix expression size checking
  * against integer constants via int_c<R> and int_c<C>.  The expression
@@ -366,7 +369,8 @@ void check_size(const readable_matrix<Sub>& left, int R, int C);
  * CML_NO_RUNTIME_MATRIX_SIZE_CHECKS at compile time.
  */
 template<class Sub, int R, int C>
-void check_size(const readable_matrix<Sub>& left, cml::int_c<R>, cml::int_c<C>);
+void check_size(const readable_matrix<Sub>& left, cml::int_c<R>,
+  cml::int_c<C>) CML_SIZE_CHECK_NOEXCEPT;
 
 
 /** Front-end for matrix expression minimum size checking against a
@@ -384,7 +388,8 @@ void check_size(const readable_matrix<Sub>& left, cml::int_c<R>, cml::int_c<C>);
  * CML_NO_RUNTIME_MATRIX_SIZE_CHECKS at compile time.
  */
 template<class Sub>
-void check_minimum_size(const readable_matrix<Sub>& left, int R, int C);
+void check_minimum_size(const readable_matrix<Sub>& left, int R,
+  int C) CML_SIZE_CHECK_NOEXCEPT;
 
 /** Front-end for compile-time and run-time matrix expression minimum size
  * checking against integer constants via int_c<R> and int_c<C>.  The
@@ -402,7 +407,7 @@ void check_minimum_size(const readable_matrix<Sub>& left, int R, int C);
  */
 template<class Sub, int R, int C>
 void check_minimum_size(const readable_matrix<Sub>& left, cml::int_c<R>,
-  cml::int_c<C>);
+  cml::int_c<C>) CML_SIZE_CHECK_NOEXCEPT;
 
 
 /** Front-end to check for a square matrix.
@@ -415,7 +420,8 @@ void check_minimum_size(const readable_matrix<Sub>& left, cml::int_c<R>,
  * @note Run-time checking can be disabled by defining
  * CML_NO_RUNTIME_MATRIX_SIZE_CHECKS at compile time.
  */
-template<class Sub> void check_square(const readable_matrix<Sub>& left);
+template<class Sub>
+void check_square(const readable_matrix<Sub>& left) CML_SIZE_CHECK_NOEXCEPT;
 } // namespace cml
 
 #define __CML_MATRIX_SIZE_CHECKING_TPP
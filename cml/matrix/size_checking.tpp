@@ -84,7 +84,8 @@ inner_cols_of(const readable_vector<Sub>& sub)
 /* No-op binary matrix expression linear size checking: */
 template<class Sub1, class Sub2>
 void
-check_same_linear_size(const readable_matrix<Sub1>&, const Sub2&, any_size_tag)
+check_same_linear_size(const readable_matrix<Sub1>&, const Sub2&,
+  any_size_tag) CML_SIZE_CHECK_NOEXCEPT
 {
 }
 
@@ -92,7 +93,7 @@ check_same_linear_size(const readable_matrix<Sub1>&, const Sub2&, any_size_tag)
 template<class Sub1, class Sub2>
 void
 check_same_linear_size(const readable_matrix<Sub1>&, const Sub2&,
-  fixed_size_tag)
+  fixed_size_tag) CML_SIZE_CHECK_NOEXCEPT
 {
   static_assert(array_rows_of_c<Sub1>::value * array_cols_of_c<Sub1>::value
     == array_size_of_c<Sub2>::value,
@@ -103,10 +104,11 @@ check_same_linear_size(const readable_matrix<Sub1>&, const Sub2&,
 template<class Sub1, class Sub2>
 void
 check_same_linear_size(const readable_matrix<Sub1>& left, const Sub2& right,
-  dynamic_size_tag)
+  dynamic_size_tag) CML_SIZE_CHECK_NOEXCEPT
 {
 #ifndef CML_NO_RUNTIME_MATRIX_SIZE_CHECKS
-  cml_require(array_rows_of(left) * array_cols_of(left) == array_size_of(right),
+  cml_size_require(
+    array_rows_of(left) * array_cols_of(left) == array_size_of(right),
     incompatible_matrix_size_error,
     /**/);
 #endif
@@ -115,14 +117,16 @@ check_same_linear_size(const readable_matrix<Sub1>& left, const Sub2& right,
 /* No-op matrix linear size checking. */
 template<class Sub>
 void
-check_linear_size(const readable_matrix<Sub>&, int, any_size_tag)
+check_linear_size(const readable_matrix<Sub>&, int,
+  any_size_tag) CML_SIZE_CHECK_NOEXCEPT
 {
 }
 
 /* Compile-time matrix linear size checking. */
 template<class Sub, int N>
 void
-check_linear_size(const readable_matrix<Sub>&, cml::int_c<N>, fixed_size_tag)
+check_linear_size(const readable_matrix<Sub>&, cml::int_c<N>,
+  fixed_size_tag) CML_SIZE_CHECK_NOEXCEPT
 {
   static_assert(array_rows_of_c<Sub>::value * array_cols_of_c<Sub>::value == N,
     "incorrect matrix expression size");
@@ -131,25 +135,28 @@ check_linear_size(const readable_matrix<Sub>&, cml::int_c<N>, fixed_size_tag)
 /* Run-time matrix linear size checking. */
 template<class Sub, class SizeTag>
 void
-check_linear_size(const readable_matrix<Sub>& sub, int N, SizeTag)
+check_linear_size(const readable_matrix<Sub>& sub, int N,
+  SizeTag) CML_SIZE_CHECK_NOEXCEPT
 {
 #ifndef CML_NO_RUNTIME_MATRIX_SIZE_CHECKS
-  cml_require(array_rows_of(sub) * array_cols_of(sub) == N, matrix_size_error,
-    /**/);
+  cml_size_require(array_rows_of(sub) * array_cols_of(sub) == N,
+    matrix_size_error, /**/);
 #endif
 }
 
 /* No-op binary matrix expression size checking: */
 template<class Sub1, class Sub2>
 void
-check_same_size(const readable_matrix<Sub1>&, const Sub2&, any_size_tag)
+check_same_size(const readable_matrix<Sub1>&, const Sub2&,
+  any_size_tag) CML_SIZE_CHECK_NOEXCEPT
 {
 }
 
 /* Compile-time binary matrix expression size checking: */
 template<class Sub1, class Sub2>
 void
-check_same_size(const readable_matrix<Sub1>&, const Sub2&, fixed_size_tag)
+check_same_size(const readable_matrix<Sub1>&, const Sub2&,
+  fixed_size_tag) CML_SIZE_CHECK_NOEXCEPT
 {
   static_assert((array_rows_of_c<Sub1>::value == array_rows_of_c<Sub2>::value)
     && (array_cols_of_c<Sub1>::value == array_cols_of_c<Sub2>::value),
@@ -160,10 +167,10 @@ check_same_size(const readable_matrix<Sub1>&, const Sub2&, fixed_size_tag)
 template<class Sub1, class Sub2>
 void
 check_same_size(const readable_matrix<Sub1>& left, const Sub2& right,
-  dynamic_size_tag)
+  dynamic_size_tag) CML_SIZE_CHECK_NOEXCEPT
 {
 #ifndef CML_NO_RUNTIME_MATRIX_SIZE_CHECKS
-  cml_require(array_size_of(left) == array_size_of(right),
+  cml_size_require(array_size_of(left) == array_size_of(right),
     incompatible_matrix_size_error,
     /**/);
 #endif
@@ -173,7 +180,7 @@ check_same_size(const readable_matrix<Sub1>& left, const Sub2& right,
 template<class Sub, class Other, int R, int C>
 void
 check_same_size(const readable_matrix<Sub>&, Other const (&)[R][C],
-  fixed_size_tag)
+  fixed_size_tag) CML_SIZE_CHECK_NOEXCEPT
 {
   static_assert(
     (array_rows_of_c<Sub>::value == R) && (array_cols_of_c<Sub>::value == C),
@@ -184,10 +191,10 @@ check_same_size(const readable_matrix<Sub>&, Other const (&)[R][C],
 template<class Sub, class Other, int R, int C>
 void
 check_same_size(const readable_matrix<Sub>& left, Other const (&)[R][C],
-  dynamic_size_tag)
+  dynamic_size_tag) CML_SIZE_CHECK_NOEXCEPT
 {
 #ifndef CML_NO_RUNTIME_MATRIX_SIZE_CHECKS
-  cml_require((array_rows_of(left) == R && array_cols_of(left) == C),
+  cml_size_require((array_rows_of(left) == R && array_cols_of(left) == C),
     incompatible_matrix_size_error,
     /**/);
 #endif
@@ -196,7 +203,8 @@ check_same_size(const readable_matrix<Sub>& left, Other const (&)[R][C],
 /* No-op binary matrix expression row size checking: */
 template<class Sub1, class Sub2>
 void
-check_same_row_size(const readable_matrix<Sub1>&, const Sub2&, any_size_tag)
+check_same_row_size(const readable_matrix<Sub1>&, const Sub2&,
+  any_size_tag) CML_SIZE_CHECK_NOEXCEPT
 {
 }
 
@@ -206,7 +214,7 @@ check_same_row_size(const readable_matrix<Sub1>&, const Sub2&, any_size_tag)
 template<class Sub1, class Sub2>
 void
 check_same_row_size(const readable_matrix<Sub1>&, const readable_vector<Sub2>&,
-  fixed_size_tag)
+  fixed_size_tag) CML_SIZE_CHECK_NOEXCEPT
 {
   static_assert(array_rows_of_c<Sub1>::value == array_size_of_c<Sub2>::value,
     "incompatible matrix row sizes");
@@ -218,10 +226,10 @@ check_same_row_size(const readable_matrix<Sub1>&, const readable_vector<Sub2>&,
 template<class Sub1, class Sub2>
 void
 check_same_row_size(const readable_matrix<Sub1>& left,
-  const readable_vector<Sub2>& right, dynamic_size_tag)
+  const readable_vector<Sub2>& right, dynamic_size_tag) CML_SIZE_CHECK_NOEXCEPT
 {
 #ifndef CML_NO_RUNTIME_MATRIX_SIZE_CHECKS
-  cml_require(array_rows_of(left) == array_size_of(right),
+  cml_size_require(array_rows_of(left) == array_size_of(right),
     incompatible_matrix_row_size_error,
     /**/);
 #endif
@@ -230,7 +238,8 @@ check_same_row_size(const readable_matrix<Sub1>& left,
 /* No-op binary matrix expression column size checking: */
 template<class Sub1, class Sub2>
 void
-check_same_col_size(const readable_matrix<Sub1>&, const Sub2&, any_size_tag)
+check_same_col_size(const readable_matrix<Sub1>&, const Sub2&,
+  any_size_tag) CML_SIZE_CHECK_NOEXCEPT
 {
 }
 
@@ -240,7 +249,7 @@ check_same_col_size(const readable_matrix<Sub1>&, const Sub2&, any_size_tag)
 template<class Sub1, class Sub2>
 void
 check_same_col_size(const readable_matrix<Sub1>&, const readable_vector<Sub2>&,
-  fixed_size_tag)
+  fixed_size_tag) CML_SIZE_CHECK_NOEXCEPT
 {
   static_assert(array_cols_of_c<Sub1>::value == array_size_of_c<Sub2>::value,
     "incompatible matrix row sizes");
@@ -252,10 +261,10 @@ check_same_col_size(const readable_matrix<Sub1>&, const readable_vector<Sub2>&,
 template<class Sub1, class Sub2>
 void
 check_same_col_size(const readable_matrix<Sub1>& left,
-  const readable_vector<Sub2>& right, dynamic_size_tag)
+  const readable_vector<Sub2>& right, dynamic_size_tag) CML_SIZE_CHECK_NOEXCEPT
 {
 #ifndef CML_NO_RUNTIME_MATRIX_SIZE_CHECKS
-  cml_require(array_cols_of(left) == array_size_of(right),
+  cml_size_require(array_cols_of(left) == array_size_of(right),
     incompatible_matrix_col_size_error,
     /**/);
 #endif
@@ -264,14 +273,16 @@ check_same_col_size(const readable_matrix<Sub1>& left,
 /* No-op matrix inner product size checking: */
 template<class Sub1, class Sub2>
 void
-check_same_inner_size(const Sub1&, const Sub2&, any_size_tag)
+check_same_inner_size(const Sub1&, const Sub2&,
+  any_size_tag) CML_SIZE_CHECK_NOEXCEPT
 {
 }
 
 /* Compile-time matrix inner product size checking: */
 template<class Sub1, class Sub2>
 void
-check_same_inner_size(const Sub1&, const Sub2&, fixed_size_tag)
+check_same_inner_size(const Sub1&, const Sub2&,
+  fixed_size_tag) CML_SIZE_CHECK_NOEXCEPT
 {
   using left_traits = traits_of_t<Sub1>;
   using right_traits = traits_of_t<Sub2>;
@@ -284,10 +295,11 @@ check_same_inner_size(const Sub1&, const Sub2&, fixed_size_tag)
 /* Run-time matrix inner product size checking: */
 template<class Sub1, class Sub2>
 void
-check_same_inner_size(const Sub1& left, const Sub2& right, dynamic_size_tag)
+check_same_inner_size(const Sub1& left, const Sub2& right,
+  dynamic_size_tag) CML_SIZE_CHECK_NOEXCEPT
 {
 #ifndef CML_NO_RUNTIME_MATRIX_SIZE_CHECKS
-  cml_require(inner_cols_of(left) == inner_rows_of(right),
+  cml_size_require(inner_cols_of(left) == inner_rows_of(right),
     incompatible_matrix_inner_size_error,
     /**/);
 #endif
@@ -296,7 +308,8 @@ check_same_inner_size(const Sub1& left, const Sub2& right, dynamic_size_tag)
 /* No-op matrix size checking. */
 template<class Sub>
 void
-check_size(const readable_matrix<Sub>&, int, int, any_size_tag)
+check_size(const readable_matrix<Sub>&, int, int,
+  any_size_tag) CML_SIZE_CHECK_NOEXCEPT
 {
 }
 
@@ -304,7 +317,7 @@ check_size(const readable_matrix<Sub>&, int, int, any_size_tag)
 template<class Sub, int R, int C>
 void
 check_size(const readable_matrix<Sub>&, cml::int_c<R>, cml::int_c<C>,
-  fixed_size_tag)
+  fixed_size_tag) CML_SIZE_CHECK_NOEXCEPT
 {
   static_assert(
     (array_rows_of_c<Sub>::value == R) && (array_cols_of_c<Sub>::value == C),
@@ -314,10 +327,11 @@ check_size(const readable_matrix<Sub>&, cml::int_c<R>, cml::int_c<C>,
 /* Run-time matrix size checking. */
 template<class Sub, class SizeTag>
 void
-check_size(const readable_matrix<Sub>& sub, int R, int C, SizeTag)
+check_size(const readable_matrix<Sub>& sub, int R, int C,
+  SizeTag) CML_SIZE_CHECK_NOEXCEPT
 {
 #ifndef CML_NO_RUNTIME_MATRIX_SIZE_CHECKS
-  cml_require((array_rows_of(sub) == R) && (array_cols_of(sub) == C),
+  cml_size_require((array_rows_of(sub) == R) && (array_cols_of(sub) == C),
     matrix_size_error,
     /**/);
 #endif
@@ -326,7 +340,8 @@ check_size(const readable_matrix<Sub>& sub, int R, int C, SizeTag)
 /* No-op minimum matrix size checking. */
 template<class Sub>
 void
-check_minimum_size(const readable_matrix<Sub>&, int, int, any_size_tag)
+check_minimum_size(const readable_matrix<Sub>&, int, int,
+  any_size_tag) CML_SIZE_CHECK_NOEXCEPT
 {
 }
 
@@ -336,7 +351,7 @@ check_minimum_size(const readable_matrix<Sub>&, int, int, any_size_tag)
 template<class Sub, int R, int C>
 void
 check_minimum_size(const readable_matrix<Sub>&, cml::int_c<R>, cml::int_c<C>,
-  fixed_size_tag)
+  fixed_size_tag) CML_SIZE_CHECK_NOEXCEPT
 {
   static_assert(
     (array_rows_of_c<Sub>::value >= R) && (array_cols_of_c<Sub>::value >= C),
@@ -346,10 +361,11 @@ check_minimum_size(const readable_matrix<Sub>&, cml::int_c<R>, cml::int_c<C>,
 /* Run-time minimum matrix size checking. */
 template<class Sub, class SizeTag>
 void
-check_minimum_size(const readable_matrix<Sub>& sub, int R, int C, SizeTag)
+check_minimum_size(const readable_matrix<Sub>& sub, int R, int C,
+  SizeTag) CML_SIZE_CHECK_NOEXCEPT
 {
 #ifndef CML_NO_RUNTIME_MATRIX_SIZE_CHECKS
-  cml_require((array_rows_of(sub) >= R) && (array_cols_of(sub) >= C),
+  cml_size_require((array_rows_of(sub) >= R) && (array_cols_of(sub) >= C),
     minimum_matrix_size_error,
     /**/);
 #endif
@@ -358,14 +374,15 @@ check_minimum_size(const readable_matrix<Sub>& sub, int R, int C, SizeTag)
 /* No-op square matrix checking. */
 template<class Sub>
 void
-check_square(const readable_matrix<Sub>&, any_size_tag)
+check_square(const readable_matrix<Sub>&, any_size_tag) CML_SIZE_CHECK_NOEXCEPT
 {
 }
 
 /* Compile-time square matrix checking. */
 template<class Sub>
 void
-check_square(const readable_matrix<Sub>&, fixed_size_tag)
+check_square(const readable_matrix<Sub>&,
+  fixed_size_tag) CML_SIZE_CHECK_NOEXCEPT
 {
   static_assert((array_rows_of_c<Sub>::value == array_cols_of_c<Sub>::value),
     "non-square matrix");
@@ -374,10 +391,10 @@ check_square(const readable_matrix<Sub>&, fixed_size_tag)
 /* Run-time square matrix checking. */
 template<class Sub, class SizeTag>
 void
-check_square(const readable_matrix<Sub>& sub, SizeTag)
+check_square(const readable_matrix<Sub>& sub, SizeTag) CML_SIZE_CHECK_NOEXCEPT
 {
 #ifndef CML_NO_RUNTIME_MATRIX_SIZE_CHECKS
-  cml_require(
+  cml_size_require(
     (array_rows_of(sub) == array_cols_of(sub)), non_square_matrix_error, /**/);
 #endif
 }
@@ -388,7 +405,7 @@ check_square(const readable_matrix<Sub>& sub, SizeTag)
 template<class Sub1, class Sub2>
 void
 check_same_linear_size(const readable_matrix<Sub1>& left,
-  const readable_matrix<Sub1>& right)
+  const readable_matrix<Sub1>& right) CML_SIZE_CHECK_NOEXCEPT
 {
   using tag1 = size_tag_of_t<Sub1>;
   using tag2 = size_tag_of_t<Sub2>;
@@ -399,7 +416,7 @@ check_same_linear_size(const readable_matrix<Sub1>& left,
 template<class Sub1, class Sub2>
 void
 check_same_linear_size(const readable_matrix<Sub1>& left, const Sub2& right,
-  enable_if_array_t<Sub2>*)
+  enable_if_array_t<Sub2>*) CML_SIZE_CHECK_NOEXCEPT
 {
   using tag1 = size_tag_of_t<Sub1>;
   using tag2 = tag1; // dynamic/dynamic or fixed/fixed.
@@ -409,7 +426,8 @@ check_same_linear_size(const readable_matrix<Sub1>& left, const Sub2& right,
 
 template<class Sub1, class Sub2>
 auto
-check_same_linear_size(const readable_matrix<Sub1>& left, const Sub2& right)
+check_same_linear_size(const readable_matrix<Sub1>& left,
+  const Sub2& right) CML_SIZE_CHECK_NOEXCEPT
   -> decltype(right.size(), void())
 {
   using tag1 = size_tag_of_t<Sub1>;
@@ -422,7 +440,8 @@ check_same_linear_size(const readable_matrix<Sub1>& left, const Sub2& right)
 
 template<class Sub>
 void
-check_linear_size(const readable_matrix<Sub>& left, int n)
+check_linear_size(const readable_matrix<Sub>& left,
+  int n) CML_SIZE_CHECK_NOEXCEPT
 {
   using tag = size_tag_of_t<Sub>;
   detail::check_linear_size(left, n, tag());
@@ -430,7 +449,8 @@ check_linear_size(const readable_matrix<Sub>& left, int n)
 
 template<class Sub, int N>
 void
-check_linear_size(const readable_matrix<Sub>& left, cml::int_c<N>)
+check_linear_size(const readable_matrix<Sub>& left,
+  cml::int_c<N>) CML_SIZE_CHECK_NOEXCEPT
 {
   using tag = size_tag_of_t<Sub>;
   detail::check_linear_size(left, cml::int_c<N>(), tag());
@@ -441,7 +461,7 @@ check_linear_size(const readable_matrix<Sub>& left, cml::int_c<N>)
 template<class Sub1, class Sub2>
 void
 check_same_size(const readable_matrix<Sub1>& left,
-  const readable_matrix<Sub2>& right)
+  const readable_matrix<Sub2>& right) CML_SIZE_CHECK_NOEXCEPT
 {
   using tag1 = size_tag_of_t<Sub1>;
   using tag2 = size_tag_of_t<Sub2>;
@@ -451,7 +471,8 @@ check_same_size(const readable_matrix<Sub1>& left,
 
 template<class Sub, class Other, int R, int C>
 void
-check_same_size(const readable_matrix<Sub>& left, Other const (&array)[R][C])
+check_same_size(const readable_matrix<Sub>& left,
+  Other const (&array)[R][C]) CML_SIZE_CHECK_NOEXCEPT
 {
   using tag1 = size_tag_of_t<Sub>;
   using tag2 = fixed_size_tag;
@@ -463,7 +484,7 @@ check_same_size(const readable_matrix<Sub>& left, Other const (&array)[R][C])
 template<class Sub1, class Sub2>
 void
 check_same_row_size(const readable_matrix<Sub1>& left,
-  const readable_vector<Sub2>& right)
+  const readable_vector<Sub2>& right) CML_SIZE_CHECK_NOEXCEPT
 {
   using tag1 = size_tag_of_t<Sub1>;
   using tag2 = size_tag_of_t<Sub2>;
@@ -476,7 +497,7 @@ check_same_row_size(const readable_matrix<Sub1>& left,
 template<class Sub1, class Sub2>
 void
 check_same_col_size(const readable_matrix<Sub1>& left,
-  const readable_vector<Sub2>& right)
+  const readable_vector<Sub2>& right) CML_SIZE_CHECK_NOEXCEPT
 {
   using tag1 = size_tag_of_t<Sub1>;
   using tag2 = size_tag_of_t<Sub2>;
@@ -489,7 +510,7 @@ check_same_col_size(const readable_matrix<Sub1>& left,
 template<class Sub1, class Sub2>
 void
 check_same_inner_size(const readable_matrix<Sub1>& left,
-  const readable_matrix<Sub2>& right)
+  const readable_matrix<Sub2>& right) CML_SIZE_CHECK_NOEXCEPT
 {
   using tag1 = size_tag_of_t<Sub1>;
   using tag2 = size_tag_of_t<Sub2>;
@@ -500,7 +521,7 @@ check_same_inner_size(const readable_matrix<Sub1>& left,
 template<class Sub1, class Sub2>
 void
 check_same_inner_size(const readable_matrix<Sub1>& left,
-  const readable_vector<Sub2>& right)
+  const readable_vector<Sub2>& right) CML_SIZE_CHECK_NOEXCEPT
 {
   using tag1 = size_tag_of_t<Sub1>;
   using tag2 = size_tag_of_t<Sub2>;
@@ -511,7 +532,7 @@ check_same_inner_size(const readable_matrix<Sub1>& left,
 template<class Sub1, class Sub2>
 void
 check_same_inner_size(const readable_vector<Sub1>& left,
-  const readable_matrix<Sub2>& right)
+  const readable_matrix<Sub2>& right) CML_SIZE_CHECK_NOEXCEPT
 {
   using tag1 = size_tag_of_t<Sub1>;
   using tag2 = size_tag_of_t<Sub2>;
@@ -523,7 +544,8 @@ check_same_inner_size(const readable_vector<Sub1>& left,
 
 template<class Sub>
 void
-check_size(const readable_matrix<Sub>& left, int R, int C)
+check_size(const readable_matrix<Sub>& left, int R,
+  int C) CML_SIZE_CHECK_NOEXCEPT
 {
   using tag = size_tag_of_t<Sub>;
   detail::check_size(left, R, C, tag());
@@ -531,7 +553,8 @@ check_size(const readable_matrix<Sub>& left, int R, int C)
 
 template<class Sub, int R, int C>
 void
-check_size(const readable_matrix<Sub>& left, cml::int_c<R>, cml::int_c<C>)
+check_size(const readable_matrix<Sub>& left, cml::int_c<R>,
+  cml::int_c<C>) CML_SIZE_CHECK_NOEXCEPT
 {
   using tag = size_tag_of_t<Sub>;
   detail::check_size(left, cml::int_c<R>(), cml::int_c<C>(), tag());
@@ -541,7 +564,8 @@ check_size(const readable_matrix<Sub>& left, cml::int_c<R>, cml::int_c<C>)
 
 template<class Sub>
 void
-check_minimum_size(const readable_matrix<Sub>& left, int R, int C)
+check_minimum_size(const readable_matrix<Sub>& left, int R,
+  int C) CML_SIZE_CHECK_NOEXCEPT
 {
   using tag = size_tag_of_t<Sub>;
   detail::check_minimum_size(left, R, C, tag());
@@ -550,7 +574,7 @@ check_minimum_size(const readable_matrix<Sub>& left, int R, int C)
 template<class Sub, int R, int C>
 void
 check_minimum_size(const readable_matrix<Sub>& left, cml::int_c<R>,
-  cml::int_c<C>)
+  cml::int_c<C>) CML_SIZE_CHECK_NOEXCEPT
 {
   using tag = size_tag_of_t<Sub>;
   detail::check_minimum_size(left, cml::int_c<R>(), cml::int_c<C>(), tag());
@@ -560,7 +584,7 @@ check_minimum_size(const readable_matrix<Sub>& left, cml::int_c<R>,
 
 template<class Sub>
 void
-check_square(const readable_matrix<Sub>& left)
+check_square(const readable_matrix<Sub>& left) CML_SIZE_CHECK_NOEXCEPT
 {
   using tag = size_tag_of_t<Sub>;
   detail::check_square(left, tag());
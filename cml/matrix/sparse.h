@@ -0,0 +1,323 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <vector>
+#include <cml/scalar/promotion.h>
+#include <cml/storage/allocated_selector.h>
+#include <cml/vector/dynamic.h>
+#include <cml/matrix/readable_matrix.h>
+#include <cml/matrix/dynamic.h>
+#include <cml/matrix/workspace.h>
+
+namespace cml {
+
+/** A (row, column, value) entry used to assemble a sparse_matrix. */
+template<class Element> struct sparse_triplet
+{
+  int row;
+  int col;
+  Element value;
+};
+
+template<class Element, class Layout = row_major> class sparse_matrix;
+
+/** matrix_traits for sparse_matrix<>. */
+template<class Element, class Layout>
+struct matrix_traits<sparse_matrix<Element, Layout>>
+{
+  using element_traits = scalar_traits<Element>;
+  using value_type = typename element_traits::value_type;
+
+  /* Implicit zeros are returned by value: */
+  using immutable_value = value_type;
+
+  /* Temporaries are dense and dynamically-allocated: */
+  using storage_type = rebind_t<allocated<>, matrix_storage_tag>;
+  using size_tag = typename storage_type::size_tag;
+  using basis_tag = col_basis;
+  using layout_tag = Layout;
+
+  /* Unspecified rows and columns: */
+  static const int array_rows = -1;
+  static const int array_cols = -1;
+
+  /** Constant containing the matrix basis enumeration value. */
+  static const basis_kind matrix_basis = basis_tag::value;
+
+  /** Constant containing the array layout enumeration value. */
+  static const layout_kind array_layout = layout_tag::value;
+};
+
+/** Compressed sparse matrix.  With @c Layout = row_major, the matrix is
+ * stored in compressed sparse row (CSR) format, and with @c Layout =
+ * col_major, in compressed sparse column (CSC) format.
+ *
+ * The non-zeros of major index @c k (a row for CSR, a column for CSC) are
+ * at positions [offsets()[k], offsets()[k+1]) of indices() and values(),
+ * sorted by minor index.
+ *
+ * sparse_matrix is a readable_matrix, so it can be used anywhere a
+ * matrix expression is accepted; element access is a binary search over
+ * the non-zeros of the major index, and implicit zeros are returned by
+ * value.  The sparse_product() and sparse_transpose_product() kernels
+ * should be used for products.
+ *
+ * @tparam Element The scalar type of the non-zero elements.
+ *
+ * @tparam Layout row_major for CSR, or col_major for CSC.
+ */
+template<class Element, class Layout>
+class sparse_matrix : public readable_matrix<sparse_matrix<Element, Layout>>
+{
+  static_assert(std::is_same<Layout, row_major>::value
+      || std::is_same<Layout, col_major>::value,
+    "invalid sparse matrix layout");
+
+  public:
+  using matrix_type = sparse_matrix<Element, Layout>;
+  using readable_type = readable_matrix<matrix_type>;
+  using traits_type = matrix_traits<matrix_type>;
+  using element_traits = typename traits_type::element_traits;
+  using value_type = typename traits_type::value_type;
+  using immutable_value = typename traits_type::immutable_value;
+  using storage_type = typename traits_type::storage_type;
+  using size_tag = typename traits_type::size_tag;
+  using basis_tag = typename traits_type::basis_tag;
+  using layout_tag = typename traits_type::layout_tag;
+  using triplet_type = sparse_triplet<value_type>;
+
+
+  public:
+  /** Constant containing the number of rows. */
+  static const int array_rows = traits_type::array_rows;
+
+  /** Constant containing the number of columns. */
+  static const int array_cols = traits_type::array_cols;
+
+  /** Constant containing the matrix basis enumeration value. */
+  static const basis_kind matrix_basis = traits_type::matrix_basis;
+
+  /** Constant containing the array layout enumeration value. */
+  static const layout_kind array_layout = traits_type::array_layout;
+
+
+  public:
+  /** Construct an empty 0x0 matrix. */
+  sparse_matrix();
+
+  /** Construct an all-zero @c rows x @c cols matrix.
+   *
+   * @throws std::invalid_argument if @c rows < 0 or @c cols < 0.
+   */
+  sparse_matrix(int rows, int cols);
+
+  /** Construct a @c rows x @c cols matrix from the triplets in [first,
+   * last).  See assign_triplets().
+   */
+  template<class Iterator>
+  sparse_matrix(int rows, int cols, Iterator first, Iterator last);
+
+  /** Construct a @c rows x @c cols matrix directly from compressed
+   * arrays.  @c offsets must have one more element than the major
+   * dimension, and the minor indices of each major index must be sorted
+   * and unique.
+   *
+   * @throws std::invalid_argument if the array sizes are inconsistent,
+   * the offsets decrease, or the indices of a major index are out of
+   * range, unsorted or repeated.
+   */
+  sparse_matrix(int rows, int cols, std::vector<int> offsets,
+    std::vector<int> indices, std::vector<value_type> values);
+
+
+  public:
+  /** Replace the matrix with a @c rows x @c cols matrix assembled from
+   * the triplets in [first, last).  Triplets may appear in any order, and
+   * duplicate (row, column) entries are summed.  Iterator must
+   * dereference to a type with @c row, @c col and @c value members.
+   *
+   * @note Assembly is a counting sort on the major index followed by a
+   * sort of each major index by minor index, so its cost is O(nnz + major
+   * + nnz*log(nnz per major index)).
+   *
+   * @throws std::invalid_argument if @c rows < 0, @c cols < 0, or any
+   * triplet is out of range.
+   */
+  template<class Iterator>
+  matrix_type& assign_triplets(int rows, int cols, Iterator first,
+    Iterator last);
+
+  /** Return the number of stored non-zeros. */
+  int nonzeros() const;
+
+  /** Return the size of the major dimension (rows for CSR, columns for
+   * CSC).
+   */
+  int major_size() const;
+
+  /** Return the size of the minor dimension. */
+  int minor_size() const;
+
+  /** Return the major index offsets into indices() and values(). */
+  const std::vector<int>& offsets() const;
+
+  /** Return the minor index of each non-zero. */
+  const std::vector<int>& indices() const;
+
+  /** Return the value of each non-zero. */
+  const std::vector<value_type>& values() const;
+
+  /** Return the value of each non-zero for in-place update.  The sparsity
+   * pattern cannot be changed through this interface.
+   */
+  std::vector<value_type>& values();
+
+
+  protected:
+  /** @name readable_matrix Interface */
+  /*@{*/
+
+  friend readable_type;
+
+  /** Return the number of rows. */
+  int i_rows() const;
+
+  /** Return the number of columns. */
+  int i_cols() const;
+
+  /** Return element @c (i,j), or 0 if it is not stored. */
+  immutable_value i_get(int i, int j) const;
+
+  /*@}*/
+
+
+  protected:
+  /** Number of rows. */
+  int m_rows;
+
+  /** Number of columns. */
+  int m_cols;
+
+  /** Major index offsets (major_size() + 1 elements). */
+  std::vector<int> m_offsets;
+
+  /** Minor index of each non-zero. */
+  std::vector<int> m_indices;
+
+  /** Value of each non-zero. */
+  std::vector<value_type> m_values;
+};
+
+
+/** @defgroup sparse_matrix_types Predefined Sparse Matrix Types */
+/*@{*/
+
+using csr_matrixf = sparse_matrix<float, row_major>;
+using csc_matrixf = sparse_matrix<float, col_major>;
+using csr_matrixd = sparse_matrix<double, row_major>;
+using csc_matrixd = sparse_matrix<double, col_major>;
+
+/*@}*/
+
+
+/** @defgroup sparse_matrix_products Sparse Matrix Products
+ *
+ * The product kernels accept a thread count: 1 (the default) runs on the
+ * calling thread, and 0 uses std::thread::hardware_concurrency() threads.
+ * Work is split so that each thread handles roughly the same number of
+ * non-zeros.  Gather-style products (CSR*x, CSC^T*x) write disjoint
+ * output ranges; scatter-style products (CSC*x, CSR^T*x) with more than
+ * one thread accumulate into one private buffer per additional thread,
+ * which are summed at the end.  The buffers are taken from a
+ * matrix_workspace, so an iterative solver that reuses the workspace does
+ * not allocate after the first call.
+ */
+/*@{*/
+
+/** Compute y = A*x, resizing @c y if it is resizable.
+ *
+ * @throws incompatible_matrix_inner_size_error if A.cols() != x.size().
+ *
+ * @throws vector_size_error if @c y is fixed-size or external, and
+ * y.size() != A.rows().
+ */
+template<class E, class L, class Sub, class YSub>
+void sparse_product(const sparse_matrix<E, L>& A,
+  const readable_vector<Sub>& x, writable_vector<YSub>& y, int threads = 1);
+
+/** Compute y = A*x as sparse_product(A, x, y, threads), taking the
+ * per-thread buffers of a threaded CSC product from @c workspace.
+ */
+template<class E, class L, class Sub, class YSub>
+void sparse_product(const sparse_matrix<E, L>& A,
+  const readable_vector<Sub>& x, writable_vector<YSub>& y,
+  matrix_workspace<value_type_trait_of_t<YSub>>& workspace, int threads = 1);
+
+/** Return A*x as a dynamic vector.
+ *
+ * @throws incompatible_matrix_inner_size_error if A.cols() != x.size().
+ */
+template<class E, class L, class Sub>
+auto sparse_product(const sparse_matrix<E, L>& A,
+  const readable_vector<Sub>& x, int threads = 1)
+  -> vector<scalar_promote_t<E, value_type_trait_of_t<Sub>>, dynamic<>>;
+
+/** Compute y = A^T*x, resizing @c y if it is resizable.
+ *
+ * @throws incompatible_matrix_inner_size_error if A.rows() != x.size().
+ *
+ * @throws vector_size_error if @c y is fixed-size or external, and
+ * y.size() != A.cols().
+ */
+template<class E, class L, class Sub, class YSub>
+void sparse_transpose_product(const sparse_matrix<E, L>& A,
+  const readable_vector<Sub>& x, writable_vector<YSub>& y, int threads = 1);
+
+/** Compute y = A^T*x as sparse_transpose_product(A, x, y, threads),
+ * taking the per-thread buffers of a threaded CSR product from
+ * @c workspace.
+ */
+template<class E, class L, class Sub, class YSub>
+void sparse_transpose_product(const sparse_matrix<E, L>& A,
+  const readable_vector<Sub>& x, writable_vector<YSub>& y,
+  matrix_workspace<value_type_trait_of_t<YSub>>& workspace, int threads = 1);
+
+/** Return A^T*x as a dynamic vector.
+ *
+ * @throws incompatible_matrix_inner_size_error if A.rows() != x.size().
+ */
+template<class E, class L, class Sub>
+auto sparse_transpose_product(const sparse_matrix<E, L>& A,
+  const readable_vector<Sub>& x, int threads = 1)
+  -> vector<scalar_promote_t<E, value_type_trait_of_t<Sub>>, dynamic<>>;
+
+/** Return the sparse*dense product A*B as a dynamic matrix.
+ *
+ * @throws incompatible_matrix_inner_size_error if A.cols() != B.rows().
+ */
+template<class E, class L, class Sub>
+auto sparse_product(const sparse_matrix<E, L>& A,
+  const readable_matrix<Sub>& B, int threads = 1)
+  -> matrix<scalar_promote_t<E, value_type_trait_of_t<Sub>>, dynamic<>,
+    basis_tag_of_t<Sub>, row_major>;
+
+/** Return the sparse*dense product A^T*B as a dynamic matrix.
+ *
+ * @throws incompatible_matrix_inner_size_error if A.rows() != B.rows().
+ */
+template<class E, class L, class Sub>
+auto sparse_transpose_product(const sparse_matrix<E, L>& A,
+  const readable_matrix<Sub>& B, int threads = 1)
+  -> matrix<scalar_promote_t<E, value_type_trait_of_t<Sub>>, dynamic<>,
+    basis_tag_of_t<Sub>, row_major>;
+
+/*@}*/
+
+} // namespace cml
+
+#define __CML_MATRIX_SPARSE_TPP
+#include <cml/matrix/sparse.tpp>
+#undef __CML_MATRIX_SPARSE_TPP
@@ -0,0 +1,495 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#ifndef __CML_MATRIX_SPARSE_TPP
+#  error "matrix/sparse.tpp not included correctly"
+#endif
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <cml/common/exception.h>
+#include <cml/common/parallel.h>
+#include <cml/vector/detail/check_or_resize.h>
+#include <cml/matrix/size_checking.h>
+#include <cml/matrix/transpose.h>
+
+namespace cml {
+namespace detail {
+
+/* Return the first major index of partition @c t of @c threads, chosen so
+ * that each partition holds roughly the same number of non-zeros.
+ */
+inline int
+sparse_partition_begin(const std::vector<int>& offsets, int t, int threads)
+{
+  const int major = int(offsets.size()) - 1;
+  if(t <= 0) return 0;
+  if(t >= threads) return major;
+  const long long target = (long long) offsets.back() * t / threads;
+  auto it = std::lower_bound(offsets.begin(), offsets.end(), target);
+  return std::min(int(std::distance(offsets.begin(), it)), major);
+}
+
+/* y[k] = sum(values[p]*x[indices[p]]) over the non-zeros of each major
+ * index k.  Each thread writes a disjoint range of y.
+ */
+template<class E, class X, class Y>
+void
+sparse_gather(const std::vector<int>& offsets, const std::vector<int>& indices,
+  const std::vector<E>& values, const X& x, Y& y, int threads)
+{
+  using value_type = typename Y::value_type;
+  const int major = int(offsets.size()) - 1;
+  threads = parallel_thread_count(threads, major);
+  parallel_invoke(threads, [&](int t) {
+    const int begin = sparse_partition_begin(offsets, t, threads);
+    const int end = sparse_partition_begin(offsets, t + 1, threads);
+    for(int k = begin; k < end; ++k) {
+      value_type sum(0);
+      for(int p = offsets[k]; p < offsets[k + 1]; ++p)
+        sum += values[p] * x[indices[p]];
+      y[k] = sum;
+    }
+  });
+}
+
+/* y[indices[p]] += values[p]*x[k] over the non-zeros of each major index
+ * k.  With more than one thread, the first thread accumulates into y and
+ * each other thread into a private buffer taken from @c workspace, and
+ * the buffers are summed into y; a single thread needs no buffers.
+ */
+template<class E, class X, class Y, class Workspace>
+void
+sparse_scatter(const std::vector<int>& offsets,
+  const std::vector<int>& indices, const std::vector<E>& values, const X& x,
+  Y& y, int threads, Workspace& workspace)
+{
+  using value_type = typename Y::value_type;
+  const int major = int(offsets.size()) - 1;
+  const int minor = y.size();
+  threads = parallel_thread_count(threads, major);
+
+  for(int i = 0; i < minor; ++i) y[i] = value_type(0);
+  if(threads == 1) {
+    for(int k = 0; k < major; ++k) {
+      const value_type xk = x[k];
+      for(int p = offsets[k]; p < offsets[k + 1]; ++p)
+        y[indices[p]] += values[p] * xk;
+    }
+    return;
+  }
+
+  value_type* partial = workspace.values((threads - 1) * minor);
+  std::fill(partial, partial + (threads - 1) * minor, value_type(0));
+  parallel_invoke(threads, [&](int t) {
+    const int begin = sparse_partition_begin(offsets, t, threads);
+    const int end = sparse_partition_begin(offsets, t + 1, threads);
+    if(t == 0) {
+      for(int k = begin; k < end; ++k) {
+        const value_type xk = x[k];
+        for(int p = offsets[k]; p < offsets[k + 1]; ++p)
+          y[indices[p]] += values[p] * xk;
+      }
+    } else {
+      value_type* out = partial + (t - 1) * minor;
+      for(int k = begin; k < end; ++k) {
+        const value_type xk = x[k];
+        for(int p = offsets[k]; p < offsets[k + 1]; ++p)
+          out[indices[p]] += values[p] * xk;
+      }
+    }
+  });
+
+  for(int i = 0; i < minor; ++i) {
+    value_type sum = y[i];
+    for(int t = 1; t < threads; ++t) sum += partial[(t - 1) * minor + i];
+    y[i] = sum;
+  }
+}
+
+/* Row i of C = sum(values[p]*row(B, indices[p])) over the non-zeros of
+ * major index i.  Each thread writes a disjoint set of rows of C.
+ */
+template<class E, class Sub, class C>
+void
+sparse_gather(const std::vector<int>& offsets, const std::vector<int>& indices,
+  const std::vector<E>& values, const readable_matrix<Sub>& B, C& c,
+  int threads)
+{
+  const int major = int(offsets.size()) - 1;
+  const int cols = B.cols();
+  threads = parallel_thread_count(threads, major);
+  parallel_invoke(threads, [&](int t) {
+    const int begin = sparse_partition_begin(offsets, t, threads);
+    const int end = sparse_partition_begin(offsets, t + 1, threads);
+    for(int i = begin; i < end; ++i) {
+      for(int j = 0; j < cols; ++j) c(i, j) = 0;
+      for(int p = offsets[i]; p < offsets[i + 1]; ++p) {
+        const auto v = values[p];
+        const int k = indices[p];
+        for(int j = 0; j < cols; ++j) c(i, j) += v * B(k, j);
+      }
+    }
+  });
+}
+
+/* Row indices[p] of C += values[p]*row(B, k) over the non-zeros of each
+ * major index k.  Each thread handles a disjoint range of the columns of
+ * B and C, so no private buffers are needed.
+ */
+template<class E, class Sub, class C>
+void
+sparse_scatter(const std::vector<int>& offsets,
+  const std::vector<int>& indices, const std::vector<E>& values,
+  const readable_matrix<Sub>& B, C& c, int threads)
+{
+  const int major = int(offsets.size()) - 1;
+  c.zero();
+  parallel_for(B.cols(), threads, [&](int j0, int j1) {
+    for(int k = 0; k < major; ++k) {
+      for(int p = offsets[k]; p < offsets[k + 1]; ++p) {
+        const auto v = values[p];
+        const int i = indices[p];
+        for(int j = j0; j < j1; ++j) c(i, j) += v * B(k, j);
+      }
+    }
+  });
+}
+
+} // namespace detail
+
+
+/* sparse_matrix 'structors: */
+
+template<class E, class L>
+sparse_matrix<E, L>::sparse_matrix()
+  : m_rows(0)
+    , m_cols(0)
+    , m_offsets(1, 0)
+{
+}
+
+template<class E, class L>
+sparse_matrix<E, L>::sparse_matrix(int rows, int cols)
+  : m_rows(rows)
+    , m_cols(cols)
+{
+  cml_require(rows >= 0, std::invalid_argument, "rows < 0");
+  cml_require(cols >= 0, std::invalid_argument, "cols < 0");
+  this->m_offsets.assign(this->major_size() + 1, 0);
+}
+
+template<class E, class L>
+template<class Iterator>
+sparse_matrix<E, L>::sparse_matrix(int rows, int cols, Iterator first,
+  Iterator last)
+{
+  this->assign_triplets(rows, cols, first, last);
+}
+
+template<class E, class L>
+sparse_matrix<E, L>::sparse_matrix(int rows, int cols,
+  std::vector<int> offsets, std::vector<int> indices,
+  std::vector<value_type> values)
+  : m_rows(rows)
+    , m_cols(cols)
+    , m_offsets(std::move(offsets))
+    , m_indices(std::move(indices))
+    , m_values(std::move(values))
+{
+  cml_require(rows >= 0, std::invalid_argument, "rows < 0");
+  cml_require(cols >= 0, std::invalid_argument, "cols < 0");
+  cml_require(int(this->m_offsets.size()) == this->major_size() + 1,
+    std::invalid_argument, "offsets size must be major size + 1");
+  cml_require(this->m_indices.size() == this->m_values.size(),
+    std::invalid_argument, "indices and values sizes differ");
+  cml_require(this->m_offsets.front() == 0
+      && this->m_offsets.back() == int(this->m_indices.size()),
+    std::invalid_argument, "offsets do not span the non-zeros");
+
+  /* i_get() and the product kernels rely on the indices of each major
+   * index being in range, sorted and unique:
+   */
+  const int minor = this->minor_size();
+  for(int k = 0; k < this->major_size(); ++k) {
+    const int first = this->m_offsets[k], last = this->m_offsets[k + 1];
+    cml_require(first <= last, std::invalid_argument,
+      "offsets must be non-decreasing");
+    for(int p = first; p < last; ++p) {
+      const int m = this->m_indices[p];
+      cml_require(0 <= m && m < minor, std::invalid_argument,
+        "index out of range");
+      cml_require(p == first || this->m_indices[p - 1] < m,
+        std::invalid_argument, "indices must be sorted and unique");
+    }
+  }
+}
+
+
+/* Public methods: */
+
+template<class E, class L>
+template<class Iterator>
+auto
+sparse_matrix<E, L>::assign_triplets(int rows, int cols, Iterator first,
+  Iterator last) -> matrix_type&
+{
+  cml_require(rows >= 0, std::invalid_argument, "rows < 0");
+  cml_require(cols >= 0, std::invalid_argument, "cols < 0");
+
+  const bool by_row = std::is_same<L, row_major>::value;
+  const int major = by_row ? rows : cols;
+
+  /* Count the entries of each major index: */
+  std::vector<int> offsets(major + 1, 0);
+  int count = 0;
+  for(Iterator it = first; it != last; ++it, ++count) {
+    const int i = (*it).row, j = (*it).col;
+    cml_require(0 <= i && i < rows && 0 <= j && j < cols,
+      std::invalid_argument, "triplet index out of range");
+    ++offsets[(by_row ? i : j) + 1];
+  }
+  for(int k = 0; k < major; ++k) offsets[k + 1] += offsets[k];
+
+  /* Scatter the entries into major order: */
+  std::vector<std::pair<int, value_type>> entries(count);
+  std::vector<int> next(offsets.begin(), offsets.end() - 1);
+  for(Iterator it = first; it != last; ++it) {
+    const int i = (*it).row, j = (*it).col;
+    const int k = by_row ? i : j;
+    entries[next[k]++] = std::make_pair(by_row ? j : i,
+      value_type((*it).value));
+  }
+
+  /* Sort each major index by minor index, summing duplicates: */
+  std::vector<int> indices;
+  std::vector<value_type> values;
+  indices.reserve(count);
+  values.reserve(count);
+  int begin = 0;
+  for(int k = 0; k < major; ++k) {
+    const int end = offsets[k + 1];
+    std::sort(entries.begin() + begin, entries.begin() + end,
+      [](const auto& a, const auto& b) { return a.first < b.first; });
+    offsets[k] = int(indices.size());
+    for(int p = begin; p < end; ++p) {
+      if(indices.size() > std::size_t(offsets[k])
+        && indices.back() == entries[p].first)
+        values.back() += entries[p].second;
+      else {
+        indices.push_back(entries[p].first);
+        values.push_back(entries[p].second);
+      }
+    }
+    begin = end;
+  }
+  offsets[major] = int(indices.size());
+
+  this->m_rows = rows;
+  this->m_cols = cols;
+  this->m_offsets = std::move(offsets);
+  this->m_indices = std::move(indices);
+  this->m_values = std::move(values);
+  return *this;
+}
+
+template<class E, class L>
+int
+sparse_matrix<E, L>::nonzeros() const
+{
+  return int(this->m_values.size());
+}
+
+template<class E, class L>
+int
+sparse_matrix<E, L>::major_size() const
+{
+  return std::is_same<L, row_major>::value ? this->m_rows : this->m_cols;
+}
+
+template<class E, class L>
+int
+sparse_matrix<E, L>::minor_size() const
+{
+  return std::is_same<L, row_major>::value ? this->m_cols : this->m_rows;
+}
+
+template<class E, class L>
+const std::vector<int>&
+sparse_matrix<E, L>::offsets() const
+{
+  return this->m_offsets;
+}
+
+template<class E, class L>
+const std::vector<int>&
+sparse_matrix<E, L>::indices() const
+{
+  return this->m_indices;
+}
+
+template<class E, class L>
+auto
+sparse_matrix<E, L>::values() const -> const std::vector<value_type>&
+{
+  return this->m_values;
+}
+
+template<class E, class L>
+auto
+sparse_matrix<E, L>::values() -> std::vector<value_type>&
+{
+  return this->m_values;
+}
+
+
+/* Internal methods: */
+
+/* readable_matrix interface: */
+
+template<class E, class L>
+int
+sparse_matrix<E, L>::i_rows() const
+{
+  return this->m_rows;
+}
+
+template<class E, class L>
+int
+sparse_matrix<E, L>::i_cols() const
+{
+  return this->m_cols;
+}
+
+template<class E, class L>
+auto
+sparse_matrix<E, L>::i_get(int i, int j) const -> immutable_value
+{
+  const bool by_row = std::is_same<L, row_major>::value;
+  const int k = by_row ? i : j;
+  const int m = by_row ? j : i;
+  auto first = this->m_indices.begin() + this->m_offsets[k];
+  auto last = this->m_indices.begin() + this->m_offsets[k + 1];
+  auto it = std::lower_bound(first, last, m);
+  if(it == last || *it != m) return value_type(0);
+  return this->m_values[std::distance(this->m_indices.begin(), it)];
+}
+
+
+/* Products: */
+
+template<class E, class L, class Sub, class YSub>
+void
+sparse_product(const sparse_matrix<E, L>& A, const readable_vector<Sub>& x,
+  writable_vector<YSub>& y,
+  matrix_workspace<value_type_trait_of_t<YSub>>& workspace, int threads)
+{
+  cml::check_same_inner_size(A, x);
+  detail::check_or_resize(y, A.rows());
+  if(std::is_same<L, row_major>::value)
+    detail::sparse_gather(A.offsets(), A.indices(), A.values(), x, y,
+      threads);
+  else
+    detail::sparse_scatter(A.offsets(), A.indices(), A.values(), x, y,
+      threads, workspace);
+}
+
+template<class E, class L, class Sub, class YSub>
+void
+sparse_product(const sparse_matrix<E, L>& A, const readable_vector<Sub>& x,
+  writable_vector<YSub>& y, int threads)
+{
+  matrix_workspace<value_type_trait_of_t<YSub>> workspace;
+  sparse_product(A, x, y, workspace, threads);
+}
+
+template<class E, class L, class Sub>
+auto
+sparse_product(const sparse_matrix<E, L>& A, const readable_vector<Sub>& x,
+  int threads)
+  -> vector<scalar_promote_t<E, value_type_trait_of_t<Sub>>, dynamic<>>
+{
+  vector<scalar_promote_t<E, value_type_trait_of_t<Sub>>, dynamic<>> y;
+  sparse_product(A, x, y, threads);
+  return y;
+}
+
+template<class E, class L, class Sub, class YSub>
+void
+sparse_transpose_product(const sparse_matrix<E, L>& A,
+  const readable_vector<Sub>& x, writable_vector<YSub>& y,
+  matrix_workspace<value_type_trait_of_t<YSub>>& workspace, int threads)
+{
+  cml::check_same_inner_size(x, A);
+  detail::check_or_resize(y, A.cols());
+  if(std::is_same<L, col_major>::value)
+    detail::sparse_gather(A.offsets(), A.indices(), A.values(), x, y,
+      threads);
+  else
+    detail::sparse_scatter(A.offsets(), A.indices(), A.values(), x, y,
+      threads, workspace);
+}
+
+template<class E, class L, class Sub, class YSub>
+void
+sparse_transpose_product(const sparse_matrix<E, L>& A,
+  const readable_vector<Sub>& x, writable_vector<YSub>& y, int threads)
+{
+  matrix_workspace<value_type_trait_of_t<YSub>> workspace;
+  sparse_transpose_product(A, x, y, workspace, threads);
+}
+
+template<class E, class L, class Sub>
+auto
+sparse_transpose_product(const sparse_matrix<E, L>& A,
+  const readable_vector<Sub>& x, int threads)
+  -> vector<scalar_promote_t<E, value_type_trait_of_t<Sub>>, dynamic<>>
+{
+  vector<scalar_promote_t<E, value_type_trait_of_t<Sub>>, dynamic<>> y;
+  sparse_transpose_product(A, x, y, threads);
+  return y;
+}
+
+template<class E, class L, class Sub>
+auto
+sparse_product(const sparse_matrix<E, L>& A, const readable_matrix<Sub>& B,
+  int threads)
+  -> matrix<scalar_promote_t<E, value_type_trait_of_t<Sub>>, dynamic<>,
+    basis_tag_of_t<Sub>, row_major>
+{
+  cml::check_same_inner_size(A, B);
+  matrix<scalar_promote_t<E, value_type_trait_of_t<Sub>>, dynamic<>,
+    basis_tag_of_t<Sub>, row_major>
+    C(A.rows(), B.cols());
+  if(std::is_same<L, row_major>::value)
+    detail::sparse_gather(A.offsets(), A.indices(), A.values(), B, C,
+      threads);
+  else
+    detail::sparse_scatter(A.offsets(), A.indices(), A.values(), B, C,
+      threads);
+  return C;
+}
+
+template<class E, class L, class Sub>
+auto
+sparse_transpose_product(const sparse_matrix<E, L>& A,
+  const readable_matrix<Sub>& B, int threads)
+  -> matrix<scalar_promote_t<E, value_type_trait_of_t<Sub>>, dynamic<>,
+    basis_tag_of_t<Sub>, row_major>
+{
+  cml::check_same_inner_size(cml::transpose(A), B);
+  matrix<scalar_promote_t<E, value_type_trait_of_t<Sub>>, dynamic<>,
+    basis_tag_of_t<Sub>, row_major>
+    C(A.cols(), B.cols());
+  if(std::is_same<L, col_major>::value)
+    detail::sparse_gather(A.offsets(), A.indices(), A.values(), B, C,
+      threads);
+  else
+    detail::sparse_scatter(A.offsets(), A.indices(), A.values(), B, C,
+      threads);
+  return C;
+}
+
+} // namespace cml
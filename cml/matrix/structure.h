@@ -0,0 +1,169 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <type_traits>
+#include <utility>
+#include <cml/matrix/traits.h>
+
+namespace cml {
+/** @defgroup cml_matrix_structure Matrix Structure Tags
+ *
+ * A matrix class can declare a @c structure_tag in its matrix_traits<> to
+ * tell the product kernels which of its elements are known to be zero.
+ * Matrices without one are general.  See structured.h.
+ */
+/*@{*/
+
+/** No known zeros. */
+struct general_structure
+{
+};
+
+/** Zero off the diagonal. */
+struct diagonal_structure
+{
+};
+
+/** Zero above the diagonal. */
+struct lower_structure
+{
+};
+
+/** Zero below the diagonal. */
+struct upper_structure
+{
+};
+
+/** Equal to its transpose.  Symmetric matrices have no known zeros. */
+struct symmetric_structure
+{
+};
+
+/** Zero outside a band around the diagonal.  Matrices with this structure
+ * must have lower_bandwidth() and upper_bandwidth() members.
+ */
+struct banded_structure
+{
+};
+
+/** Deduce the structure tag of matrix type @c Sub: its
+ * matrix_traits<>::structure_tag, or general_structure if there is none.
+ */
+template<class Sub, class Enable = void> struct matrix_structure_of
+{
+  using type = general_structure;
+};
+
+template<class Sub>
+struct matrix_structure_of<Sub,
+  std::void_t<typename matrix_traits<Sub>::structure_tag>>
+{
+  using type = typename matrix_traits<Sub>::structure_tag;
+};
+
+/** Convenience alias for matrix_structure_of. */
+template<class Sub>
+using matrix_structure_of_t =
+typename matrix_structure_of<cml::unqualified_type_t<Sub>>::type;
+
+/*@}*/
+
+namespace detail {
+/** Return the range [first, last) of the columns of row @c i of @c M that
+ * may be non-zero, given the structure of @c M.
+ */
+template<class Sub>
+std::pair<int, int>
+structure_row_range(const Sub& M, int, general_structure)
+{
+  return {0, M.cols()};
+}
+
+template<class Sub>
+std::pair<int, int>
+structure_row_range(const Sub& M, int, symmetric_structure)
+{
+  return {0, M.cols()};
+}
+
+template<class Sub>
+std::pair<int, int>
+structure_row_range(const Sub&, int i, diagonal_structure)
+{
+  return {i, i + 1};
+}
+
+template<class Sub>
+std::pair<int, int>
+structure_row_range(const Sub&, int i, lower_structure)
+{
+  return {0, i + 1};
+}
+
+template<class Sub>
+std::pair<int, int>
+structure_row_range(const Sub& M, int i, upper_structure)
+{
+  return {i, M.cols()};
+}
+
+template<class Sub>
+std::pair<int, int>
+structure_row_range(const Sub& M, int i, banded_structure)
+{
+  const int first = i - M.lower_bandwidth();
+  const int last = i + M.upper_bandwidth() + 1;
+  return {first < 0 ? 0 : first, last > M.cols() ? M.cols() : last};
+}
+
+/** Return the range [first, last) of the rows of column @c j of @c M that
+ * may be non-zero, given the structure of @c M.
+ */
+template<class Sub>
+std::pair<int, int>
+structure_col_range(const Sub& M, int, general_structure)
+{
+  return {0, M.rows()};
+}
+
+template<class Sub>
+std::pair<int, int>
+structure_col_range(const Sub& M, int, symmetric_structure)
+{
+  return {0, M.rows()};
+}
+
+template<class Sub>
+std::pair<int, int>
+structure_col_range(const Sub&, int j, diagonal_structure)
+{
+  return {j, j + 1};
+}
+
+template<class Sub>
+std::pair<int, int>
+structure_col_range(const Sub& M, int j, lower_structure)
+{
+  return {j, M.rows()};
+}
+
+template<class Sub>
+std::pair<int, int>
+structure_col_range(const Sub&, int j, upper_structure)
+{
+  return {0, j + 1};
+}
+
+template<class Sub>
+std::pair<int, int>
+structure_col_range(const Sub& M, int j, banded_structure)
+{
+  const int first = j - M.upper_bandwidth();
+  const int last = j + M.lower_bandwidth() + 1;
+  return {first < 0 ? 0 : first, last > M.rows() ? M.rows() : last};
+}
+} // namespace detail
+} // namespace cml
@@ -0,0 +1,579 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <vector>
+#include <cml/scalar/promotion.h>
+#include <cml/storage/allocated_selector.h>
+#include <cml/vector/dynamic.h>
+#include <cml/matrix/readable_matrix.h>
+#include <cml/matrix/dynamic.h>
+#include <cml/matrix/structure.h>
+
+namespace cml {
+
+template<class Element> class diagonal_matrix;
+template<class Element, class Structure = lower_structure>
+class triangular_matrix;
+template<class Element> class symmetric_matrix;
+template<class Element> class banded_matrix;
+
+namespace detail {
+/* matrix_traits shared by the structured matrix types: */
+template<class Element, class Structure> struct structured_matrix_traits
+{
+  using element_traits = scalar_traits<Element>;
+  using value_type = typename element_traits::value_type;
+
+  /* Implicit zeros are returned by value: */
+  using immutable_value = value_type;
+
+  /* Temporaries are dense and dynamically-allocated: */
+  using storage_type = rebind_t<allocated<>, matrix_storage_tag>;
+  using size_tag = typename storage_type::size_tag;
+  using basis_tag = col_basis;
+  using layout_tag = row_major;
+
+  /* The known zeros, used by the product kernels: */
+  using structure_tag = Structure;
+
+  /* Unspecified rows and columns: */
+  static const int array_rows = -1;
+  static const int array_cols = -1;
+
+  /** Constant containing the matrix basis enumeration value. */
+  static const basis_kind matrix_basis = basis_tag::value;
+
+  /** Constant containing the array layout enumeration value. */
+  static const layout_kind array_layout = layout_tag::value;
+};
+} // namespace detail
+
+/** matrix_traits for diagonal_matrix<>. */
+template<class Element>
+struct matrix_traits<diagonal_matrix<Element>>
+: detail::structured_matrix_traits<Element, diagonal_structure>
+{
+};
+
+/** matrix_traits for triangular_matrix<>. */
+template<class Element, class Structure>
+struct matrix_traits<triangular_matrix<Element, Structure>>
+: detail::structured_matrix_traits<Element, Structure>
+{
+};
+
+/** matrix_traits for symmetric_matrix<>. */
+template<class Element>
+struct matrix_traits<symmetric_matrix<Element>>
+: detail::structured_matrix_traits<Element, symmetric_structure>
+{
+};
+
+/** matrix_traits for banded_matrix<>. */
+template<class Element>
+struct matrix_traits<banded_matrix<Element>>
+: detail::structured_matrix_traits<Element, banded_structure>
+{
+};
+
+
+/** Square matrix that is zero off the diagonal, stored as its n diagonal
+ * elements.
+ *
+ * Like the other structured matrices, diagonal_matrix is a
+ * readable_matrix, so it can be used anywhere a matrix expression is
+ * accepted; implicit zeros are returned by value.  Products with it skip
+ * the known zeros (see structure.h), and solve(), inverse() and
+ * determinant() have O(n) overloads for it.
+ */
+template<class Element>
+class diagonal_matrix : public readable_matrix<diagonal_matrix<Element>>
+{
+  public:
+  using matrix_type = diagonal_matrix<Element>;
+  using readable_type = readable_matrix<matrix_type>;
+  using traits_type = matrix_traits<matrix_type>;
+  using element_traits = typename traits_type::element_traits;
+  using value_type = typename traits_type::value_type;
+  using immutable_value = typename traits_type::immutable_value;
+  using storage_type = typename traits_type::storage_type;
+  using size_tag = typename traits_type::size_tag;
+  using basis_tag = typename traits_type::basis_tag;
+  using layout_tag = typename traits_type::layout_tag;
+  using structure_tag = typename traits_type::structure_tag;
+
+
+  public:
+  /** Constant containing the number of rows. */
+  static const int array_rows = traits_type::array_rows;
+
+  /** Constant containing the number of columns. */
+  static const int array_cols = traits_type::array_cols;
+
+  /** Constant containing the matrix basis enumeration value. */
+  static const basis_kind matrix_basis = traits_type::matrix_basis;
+
+  /** Constant containing the array layout enumeration value. */
+  static const layout_kind array_layout = traits_type::array_layout;
+
+
+  public:
+  /** Construct an empty 0x0 matrix. */
+  diagonal_matrix() = default;
+
+  /** Construct an all-zero @c n x @c n matrix.
+   *
+   * @throws std::invalid_argument if @c n < 0.
+   */
+  explicit diagonal_matrix(int n);
+
+  /** Construct a matrix with diagonal @c d. */
+  template<class Sub> explicit diagonal_matrix(const readable_vector<Sub>& d);
+
+  /** Construct a matrix from the diagonal of @c M, ignoring the other
+   * elements.
+   *
+   * @throws non_square_matrix_error if @c M is not square.
+   */
+  template<class Sub> explicit diagonal_matrix(const readable_matrix<Sub>& M);
+
+
+  public:
+  /** Set element @c (i,j) to @c v.
+   *
+   * @throws std::invalid_argument if @c i != @c j and @c v is not zero.
+   */
+  matrix_type& set(int i, int j, const value_type& v);
+
+  /** Return the diagonal elements. */
+  const std::vector<value_type>& values() const;
+
+  /** Return the diagonal elements for in-place update. */
+  std::vector<value_type>& values();
+
+
+  protected:
+  /** @name readable_matrix Interface */
+  /*@{*/
+
+  friend readable_type;
+
+  /** Return the number of rows. */
+  int i_rows() const;
+
+  /** Return the number of columns. */
+  int i_cols() const;
+
+  /** Return element @c (i,j). */
+  immutable_value i_get(int i, int j) const;
+
+  /*@}*/
+
+
+  protected:
+  /** The diagonal elements. */
+  std::vector<value_type> m_values;
+};
+
+
+/** Square matrix that is zero above (@c Structure = lower_structure) or
+ * below (@c Structure = upper_structure) the diagonal, stored as the
+ * n(n+1)/2 elements of the triangle packed by row.
+ *
+ * solve() and inverse() have O(n^2) and O(n^3/6) substitution overloads
+ * for triangular matrices, and determinant() an O(n) one.
+ */
+template<class Element, class Structure>
+class triangular_matrix
+: public readable_matrix<triangular_matrix<Element, Structure>>
+{
+  static_assert(std::is_same<Structure, lower_structure>::value
+      || std::is_same<Structure, upper_structure>::value,
+    "invalid triangular matrix structure");
+
+  public:
+  using matrix_type = triangular_matrix<Element, Structure>;
+  using readable_type = readable_matrix<matrix_type>;
+  using traits_type = matrix_traits<matrix_type>;
+  using element_traits = typename traits_type::element_traits;
+  using value_type = typename traits_type::value_type;
+  using immutable_value = typename traits_type::immutable_value;
+  using storage_type = typename traits_type::storage_type;
+  using size_tag = typename traits_type::size_tag;
+  using basis_tag = typename traits_type::basis_tag;
+  using layout_tag = typename traits_type::layout_tag;
+  using structure_tag = typename traits_type::structure_tag;
+
+
+  public:
+  /** Constant containing the number of rows. */
+  static const int array_rows = traits_type::array_rows;
+
+  /** Constant containing the number of columns. */
+  static const int array_cols = traits_type::array_cols;
+
+  /** Constant containing the matrix basis enumeration value. */
+  static const basis_kind matrix_basis = traits_type::matrix_basis;
+
+  /** Constant containing the array layout enumeration value. */
+  static const layout_kind array_layout = traits_type::array_layout;
+
+  /** True if the matrix is lower triangular. */
+  static const bool is_lower = std::is_same<Structure, lower_structure>::value;
+
+
+  public:
+  /** Construct an empty 0x0 matrix. */
+  triangular_matrix();
+
+  /** Construct an all-zero @c n x @c n matrix.
+   *
+   * @throws std::invalid_argument if @c n < 0.
+   */
+  explicit triangular_matrix(int n);
+
+  /** Construct a matrix from the triangle of @c M, ignoring the other
+   * elements.  If @c unit_diagonal is true, the diagonal is set to 1, so
+   * the factors of a packed LU decomposition can be extracted directly.
+   *
+   * @throws non_square_matrix_error if @c M is not square.
+   */
+  template<class Sub>
+  explicit triangular_matrix(const readable_matrix<Sub>& M,
+    bool unit_diagonal = false);
+
+
+  public:
+  /** Set element @c (i,j) to @c v.
+   *
+   * @throws std::invalid_argument if @c (i,j) is outside the triangle and
+   * @c v is not zero.
+   */
+  matrix_type& set(int i, int j, const value_type& v);
+
+  /** Return the packed elements of the triangle. */
+  const std::vector<value_type>& values() const;
+
+  /** Return the packed elements of the triangle for in-place update. */
+  std::vector<value_type>& values();
+
+  /** Return the position of element @c (i,j) of the triangle in
+   * values().
+   */
+  int index(int i, int j) const;
+
+
+  protected:
+  /** @name readable_matrix Interface */
+  /*@{*/
+
+  friend readable_type;
+
+  /** Return the number of rows. */
+  int i_rows() const;
+
+  /** Return the number of columns. */
+  int i_cols() const;
+
+  /** Return element @c (i,j). */
+  immutable_value i_get(int i, int j) const;
+
+  /*@}*/
+
+
+  protected:
+  /** Number of rows and columns. */
+  int m_size;
+
+  /** The packed elements of the triangle. */
+  std::vector<value_type> m_values;
+};
+
+
+/** Square symmetric matrix, stored as the n(n+1)/2 elements of its lower
+ * triangle packed by row, half the memory of a dense matrix.  Setting
+ * element (i,j) also sets element (j,i).
+ */
+template<class Element>
+class symmetric_matrix : public readable_matrix<symmetric_matrix<Element>>
+{
+  public:
+  using matrix_type = symmetric_matrix<Element>;
+  using readable_type = readable_matrix<matrix_type>;
+  using traits_type = matrix_traits<matrix_type>;
+  using element_traits = typename traits_type::element_traits;
+  using value_type = typename traits_type::value_type;
+  using immutable_value = typename traits_type::immutable_value;
+  using storage_type = typename traits_type::storage_type;
+  using size_tag = typename traits_type::size_tag;
+  using basis_tag = typename traits_type::basis_tag;
+  using layout_tag = typename traits_type::layout_tag;
+  using structure_tag = typename traits_type::structure_tag;
+
+
+  public:
+  /** Constant containing the number of rows. */
+  static const int array_rows = traits_type::array_rows;
+
+  /** Constant containing the number of columns. */
+  static const int array_cols = traits_type::array_cols;
+
+  /** Constant containing the matrix basis enumeration value. */
+  static const basis_kind matrix_basis = traits_type::matrix_basis;
+
+  /** Constant containing the array layout enumeration value. */
+  static const layout_kind array_layout = traits_type::array_layout;
+
+
+  public:
+  /** Construct an empty 0x0 matrix. */
+  symmetric_matrix();
+
+  /** Construct an all-zero @c n x @c n matrix.
+   *
+   * @throws std::invalid_argument if @c n < 0.
+   */
+  explicit symmetric_matrix(int n);
+
+  /** Construct a matrix from the lower triangle of @c M.  The upper
+   * triangle of @c M is ignored, not checked for symmetry.
+   *
+   * @throws non_square_matrix_error if @c M is not square.
+   */
+  template<class Sub> explicit symmetric_matrix(const readable_matrix<Sub>& M);
+
+
+  public:
+  /** Set elements @c (i,j) and @c (j,i) to @c v. */
+  matrix_type& set(int i, int j, const value_type& v);
+
+  /** Return the packed elements of the lower triangle. */
+  const std::vector<value_type>& values() const;
+
+  /** Return the packed elements of the lower triangle for in-place
+   * update.
+   */
+  std::vector<value_type>& values();
+
+
+  protected:
+  /** @name readable_matrix Interface */
+  /*@{*/
+
+  friend readable_type;
+
+  /** Return the number of rows. */
+  int i_rows() const;
+
+  /** Return the number of columns. */
+  int i_cols() const;
+
+  /** Return element @c (i,j). */
+  immutable_value i_get(int i, int j) const;
+
+  /*@}*/
+
+
+  protected:
+  /** Number of rows and columns. */
+  int m_size;
+
+  /** The packed elements of the lower triangle. */
+  std::vector<value_type> m_values;
+};
+
+
+/** Matrix that is zero outside a band of lower_bandwidth() diagonals below
+ * the main diagonal and upper_bandwidth() diagonals above it, stored by
+ * row with lower_bandwidth() + upper_bandwidth() + 1 elements per row.
+ * Products with a banded matrix cost O(n*bandwidth) per column of the
+ * other operand.
+ */
+template<class Element>
+class banded_matrix : public readable_matrix<banded_matrix<Element>>
+{
+  public:
+  using matrix_type = banded_matrix<Element>;
+  using readable_type = readable_matrix<matrix_type>;
+  using traits_type = matrix_traits<matrix_type>;
+  using element_traits = typename traits_type::element_traits;
+  using value_type = typename traits_type::value_type;
+  using immutable_value = typename traits_type::immutable_value;
+  using storage_type = typename traits_type::storage_type;
+  using size_tag = typename traits_type::size_tag;
+  using basis_tag = typename traits_type::basis_tag;
+  using layout_tag = typename traits_type::layout_tag;
+  using structure_tag = typename traits_type::structure_tag;
+
+
+  public:
+  /** Constant containing the number of rows. */
+  static const int array_rows = traits_type::array_rows;
+
+  /** Constant containing the number of columns. */
+  static const int array_cols = traits_type::array_cols;
+
+  /** Constant containing the matrix basis enumeration value. */
+  static const basis_kind matrix_basis = traits_type::matrix_basis;
+
+  /** Constant containing the array layout enumeration value. */
+  static const layout_kind array_layout = traits_type::array_layout;
+
+
+  public:
+  /** Construct an empty 0x0 matrix. */
+  banded_matrix();
+
+  /** Construct an all-zero @c rows x @c cols matrix with @c lower
+   * diagonals below the main diagonal and @c upper above it.
+   *
+   * @throws std::invalid_argument if any argument is negative.
+   */
+  banded_matrix(int rows, int cols, int lower, int upper);
+
+  /** Construct a matrix from the band of @c M with @c lower diagonals
+   * below the main diagonal and @c upper above it, ignoring the other
+   * elements.
+   *
+   * @throws std::invalid_argument if @c lower or @c upper is negative.
+   */
+  template<class Sub>
+  banded_matrix(const readable_matrix<Sub>& M, int lower, int upper);
+
+
+  public:
+  /** Return the number of diagonals below the main diagonal. */
+  int lower_bandwidth() const;
+
+  /** Return the number of diagonals above the main diagonal. */
+  int upper_bandwidth() const;
+
+  /** Set element @c (i,j) to @c v.
+   *
+   * @throws std::invalid_argument if @c (i,j) is outside the band and @c v
+   * is not zero.
+   */
+  matrix_type& set(int i, int j, const value_type& v);
+
+  /** Return the band elements, row by row.  Element @c (i,j) of the band
+   * is at position i*(lower_bandwidth() + upper_bandwidth() + 1) + j - i +
+   * lower_bandwidth(); positions outside the matrix are zero.
+   */
+  const std::vector<value_type>& values() const;
+
+  /** Return the band elements for in-place update. */
+  std::vector<value_type>& values();
+
+
+  protected:
+  /** @name readable_matrix Interface */
+  /*@{*/
+
+  friend readable_type;
+
+  /** Return the number of rows. */
+  int i_rows() const;
+
+  /** Return the number of columns. */
+  int i_cols() const;
+
+  /** Return element @c (i,j). */
+  immutable_value i_get(int i, int j) const;
+
+  /*@}*/
+
+
+  protected:
+  /** Return true if @c (i,j) is inside the band. */
+  bool in_band(int i, int j) const;
+
+
+  protected:
+  /** Number of rows. */
+  int m_rows;
+
+  /** Number of columns. */
+  int m_cols;
+
+  /** Number of diagonals below the main diagonal. */
+  int m_lower;
+
+  /** Number of diagonals above the main diagonal. */
+  int m_upper;
+
+  /** The band elements, row by row. */
+  std::vector<value_type> m_values;
+};
+
+
+/** @defgroup structured_matrix_types Predefined Structured Matrix Types */
+/*@{*/
+
+using diagonal_matrixf = diagonal_matrix<float>;
+using diagonal_matrixd = diagonal_matrix<double>;
+using lower_matrixf = triangular_matrix<float, lower_structure>;
+using lower_matrixd = triangular_matrix<double, lower_structure>;
+using upper_matrixf = triangular_matrix<float, upper_structure>;
+using upper_matrixd = triangular_matrix<double, upper_structure>;
+using symmetric_matrixf = symmetric_matrix<float>;
+using symmetric_matrixd = symmetric_matrix<double>;
+using banded_matrixf = banded_matrix<float>;
+using banded_matrixd = banded_matrix<double>;
+
+/*@}*/
+
+
+/** @defgroup structured_matrix_kernels Structured Matrix Kernels
+ *
+ * Overloads of solve(), inverse() and determinant() that use the
+ * structure of the matrix instead of a general LU decomposition.  Products
+ * with structured matrices are dispatched by operator*() itself.
+ *
+ * The solvers do not check for singularity; a zero on the diagonal
+ * produces infinities or NaN, as for lu_solve().
+ */
+/*@{*/
+
+/** Return the solution x of D*x = b, in O(n).
+ *
+ * @throws incompatible_matrix_inner_size_error if D.cols() != b.size().
+ */
+template<class E, class Sub>
+auto solve(const diagonal_matrix<E>& D, const readable_vector<Sub>& b)
+  -> vector<scalar_promote_t<E, value_type_trait_of_t<Sub>>, dynamic<>>;
+
+/** Return the solution x of T*x = b by forward (lower) or back (upper)
+ * substitution, in O(n^2).
+ *
+ * @throws incompatible_matrix_inner_size_error if T.cols() != b.size().
+ */
+template<class E, class S, class Sub>
+auto solve(const triangular_matrix<E, S>& T, const readable_vector<Sub>& b)
+  -> vector<scalar_promote_t<E, value_type_trait_of_t<Sub>>, dynamic<>>;
+
+/** Return the inverse of @c D, in O(n). */
+template<class E>
+diagonal_matrix<E> inverse(const diagonal_matrix<E>& D);
+
+/** Return the inverse of @c T, which has the same structure, by
+ * substitution in O(n^3/6).
+ */
+template<class E, class S>
+triangular_matrix<E, S> inverse(const triangular_matrix<E, S>& T);
+
+/** Return the determinant of @c D, the product of its diagonal. */
+template<class E> E determinant(const diagonal_matrix<E>& D);
+
+/** Return the determinant of @c T, the product of its diagonal. */
+template<class E, class S> E determinant(const triangular_matrix<E, S>& T);
+
+/*@}*/
+
+} // namespace cml
+
+#define __CML_MATRIX_STRUCTURED_TPP
+#include <cml/matrix/structured.tpp>
+#undef __CML_MATRIX_STRUCTURED_TPP
@@ -0,0 +1,512 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#ifndef __CML_MATRIX_STRUCTURED_TPP
+#  error "matrix/structured.tpp not included correctly"
+#endif
+
+#include <cml/common/exception.h>
+#include <cml/scalar/accumulator.h>
+#include <cml/matrix/size_checking.h>
+
+namespace cml {
+
+/* diagonal_matrix 'structors: */
+
+template<class E>
+diagonal_matrix<E>::diagonal_matrix(int n)
+{
+  cml_require(n >= 0, std::invalid_argument, "n < 0");
+  this->m_values.assign(n, value_type(0));
+}
+
+template<class E>
+template<class Sub>
+diagonal_matrix<E>::diagonal_matrix(const readable_vector<Sub>& d)
+  : m_values(d.size())
+{
+  for(int i = 0; i < d.size(); ++i) this->m_values[i] = d.get(i);
+}
+
+template<class E>
+template<class Sub>
+diagonal_matrix<E>::diagonal_matrix(const readable_matrix<Sub>& M)
+{
+  cml::check_square(M);
+  this->m_values.resize(M.rows());
+  for(int i = 0; i < M.rows(); ++i) this->m_values[i] = M.get(i, i);
+}
+
+
+/* Public methods: */
+
+template<class E>
+auto
+diagonal_matrix<E>::set(int i, int j, const value_type& v) -> matrix_type&
+{
+  if(i == j) {
+    this->m_values[i] = v;
+  } else {
+    cml_require(v == value_type(0), std::invalid_argument,
+      "element is outside the diagonal");
+  }
+  return *this;
+}
+
+template<class E>
+auto
+diagonal_matrix<E>::values() const -> const std::vector<value_type>&
+{
+  return this->m_values;
+}
+
+template<class E>
+auto
+diagonal_matrix<E>::values() -> std::vector<value_type>&
+{
+  return this->m_values;
+}
+
+
+/* Internal methods: */
+
+/* readable_matrix interface: */
+
+template<class E>
+int
+diagonal_matrix<E>::i_rows() const
+{
+  return int(this->m_values.size());
+}
+
+template<class E>
+int
+diagonal_matrix<E>::i_cols() const
+{
+  return int(this->m_values.size());
+}
+
+template<class E>
+auto
+diagonal_matrix<E>::i_get(int i, int j) const -> immutable_value
+{
+  return i == j ? this->m_values[i] : value_type(0);
+}
+
+
+/* triangular_matrix 'structors: */
+
+template<class E, class S>
+triangular_matrix<E, S>::triangular_matrix()
+  : m_size(0)
+{
+}
+
+template<class E, class S>
+triangular_matrix<E, S>::triangular_matrix(int n)
+  : m_size(n)
+{
+  cml_require(n >= 0, std::invalid_argument, "n < 0");
+  this->m_values.assign(n * (n + 1) / 2, value_type(0));
+}
+
+template<class E, class S>
+template<class Sub>
+triangular_matrix<E, S>::triangular_matrix(const readable_matrix<Sub>& M,
+  bool unit_diagonal)
+  : m_size(M.rows())
+{
+  cml::check_square(M);
+  const int n = this->m_size;
+  this->m_values.resize(n * (n + 1) / 2);
+  for(int i = 0; i < n; ++i) {
+    const int first = is_lower ? 0 : i, last = is_lower ? i + 1 : n;
+    for(int j = first; j < last; ++j)
+      this->m_values[this->index(i, j)] =
+        (unit_diagonal && i == j) ? value_type(1) : value_type(M.get(i, j));
+  }
+}
+
+
+/* Public methods: */
+
+template<class E, class S>
+auto
+triangular_matrix<E, S>::set(int i, int j, const value_type& v)
+  -> matrix_type&
+{
+  if(is_lower ? j <= i : i <= j) {
+    this->m_values[this->index(i, j)] = v;
+  } else {
+    cml_require(v == value_type(0), std::invalid_argument,
+      "element is outside the triangle");
+  }
+  return *this;
+}
+
+template<class E, class S>
+auto
+triangular_matrix<E, S>::values() const -> const std::vector<value_type>&
+{
+  return this->m_values;
+}
+
+template<class E, class S>
+auto
+triangular_matrix<E, S>::values() -> std::vector<value_type>&
+{
+  return this->m_values;
+}
+
+template<class E, class S>
+int
+triangular_matrix<E, S>::index(int i, int j) const
+{
+  /* Row i of an upper triangle starts after n + (n-1) + ... + (n-i+1)
+   * elements:
+   */
+  return is_lower ? i * (i + 1) / 2 + j
+                  : i * this->m_size - i * (i - 1) / 2 + (j - i);
+}
+
+
+/* Internal methods: */
+
+/* readable_matrix interface: */
+
+template<class E, class S>
+int
+triangular_matrix<E, S>::i_rows() const
+{
+  return this->m_size;
+}
+
+template<class E, class S>
+int
+triangular_matrix<E, S>::i_cols() const
+{
+  return this->m_size;
+}
+
+template<class E, class S>
+auto
+triangular_matrix<E, S>::i_get(int i, int j) const -> immutable_value
+{
+  if(is_lower ? j <= i : i <= j) return this->m_values[this->index(i, j)];
+  return value_type(0);
+}
+
+
+/* symmetric_matrix 'structors: */
+
+template<class E>
+symmetric_matrix<E>::symmetric_matrix()
+  : m_size(0)
+{
+}
+
+template<class E>
+symmetric_matrix<E>::symmetric_matrix(int n)
+  : m_size(n)
+{
+  cml_require(n >= 0, std::invalid_argument, "n < 0");
+  this->m_values.assign(n * (n + 1) / 2, value_type(0));
+}
+
+template<class E>
+template<class Sub>
+symmetric_matrix<E>::symmetric_matrix(const readable_matrix<Sub>& M)
+  : m_size(M.rows())
+{
+  cml::check_square(M);
+  const int n = this->m_size;
+  this->m_values.resize(n * (n + 1) / 2);
+  for(int i = 0, k = 0; i < n; ++i)
+    for(int j = 0; j <= i; ++j, ++k) this->m_values[k] = M.get(i, j);
+}
+
+
+/* Public methods: */
+
+template<class E>
+auto
+symmetric_matrix<E>::set(int i, int j, const value_type& v) -> matrix_type&
+{
+  if(i < j) std::swap(i, j);
+  this->m_values[i * (i + 1) / 2 + j] = v;
+  return *this;
+}
+
+template<class E>
+auto
+symmetric_matrix<E>::values() const -> const std::vector<value_type>&
+{
+  return this->m_values;
+}
+
+template<class E>
+auto
+symmetric_matrix<E>::values() -> std::vector<value_type>&
+{
+  return this->m_values;
+}
+
+
+/* Internal methods: */
+
+/* readable_matrix interface: */
+
+template<class E>
+int
+symmetric_matrix<E>::i_rows() const
+{
+  return this->m_size;
+}
+
+template<class E>
+int
+symmetric_matrix<E>::i_cols() const
+{
+  return this->m_size;
+}
+
+template<class E>
+auto
+symmetric_matrix<E>::i_get(int i, int j) const -> immutable_value
+{
+  return i < j ? this->m_values[j * (j + 1) / 2 + i]
+               : this->m_values[i * (i + 1) / 2 + j];
+}
+
+
+/* banded_matrix 'structors: */
+
+template<class E>
+banded_matrix<E>::banded_matrix()
+  : m_rows(0)
+    , m_cols(0)
+    , m_lower(0)
+    , m_upper(0)
+{
+}
+
+template<class E>
+banded_matrix<E>::banded_matrix(int rows, int cols, int lower, int upper)
+  : m_rows(rows)
+    , m_cols(cols)
+    , m_lower(lower)
+    , m_upper(upper)
+{
+  cml_require(rows >= 0, std::invalid_argument, "rows < 0");
+  cml_require(cols >= 0, std::invalid_argument, "cols < 0");
+  cml_require(lower >= 0, std::invalid_argument, "lower < 0");
+  cml_require(upper >= 0, std::invalid_argument, "upper < 0");
+  this->m_values.assign(rows * (lower + upper + 1), value_type(0));
+}
+
+template<class E>
+template<class Sub>
+banded_matrix<E>::banded_matrix(const readable_matrix<Sub>& M, int lower,
+  int upper)
+  : banded_matrix(M.rows(), M.cols(), lower, upper)
+{
+  const int width = lower + upper + 1;
+  for(int i = 0; i < this->m_rows; ++i) {
+    const int first = i - lower < 0 ? 0 : i - lower;
+    const int last = i + upper + 1 > this->m_cols ? this->m_cols
+                                                  : i + upper + 1;
+    for(int j = first; j < last; ++j)
+      this->m_values[i * width + j - i + lower] = M.get(i, j);
+  }
+}
+
+
+/* Public methods: */
+
+template<class E>
+int
+banded_matrix<E>::lower_bandwidth() const
+{
+  return this->m_lower;
+}
+
+template<class E>
+int
+banded_matrix<E>::upper_bandwidth() const
+{
+  return this->m_upper;
+}
+
+template<class E>
+auto
+banded_matrix<E>::set(int i, int j, const value_type& v) -> matrix_type&
+{
+  if(this->in_band(i, j)) {
+    const int width = this->m_lower + this->m_upper + 1;
+    this->m_values[i * width + j - i + this->m_lower] = v;
+  } else {
+    cml_require(v == value_type(0), std::invalid_argument,
+      "element is outside the band");
+  }
+  return *this;
+}
+
+template<class E>
+auto
+banded_matrix<E>::values() const -> const std::vector<value_type>&
+{
+  return this->m_values;
+}
+
+template<class E>
+auto
+banded_matrix<E>::values() -> std::vector<value_type>&
+{
+  return this->m_values;
+}
+
+
+/* Internal methods: */
+
+/* readable_matrix interface: */
+
+template<class E>
+int
+banded_matrix<E>::i_rows() const
+{
+  return this->m_rows;
+}
+
+template<class E>
+int
+banded_matrix<E>::i_cols() const
+{
+  return this->m_cols;
+}
+
+template<class E>
+auto
+banded_matrix<E>::i_get(int i, int j) const -> immutable_value
+{
+  if(!this->in_band(i, j)) return value_type(0);
+  const int width = this->m_lower + this->m_upper + 1;
+  return this->m_values[i * width + j - i + this->m_lower];
+}
+
+template<class E>
+bool
+banded_matrix<E>::in_band(int i, int j) const
+{
+  return i - this->m_lower <= j && j <= i + this->m_upper;
+}
+
+
+/* Kernels: */
+
+template<class E, class Sub>
+auto
+solve(const diagonal_matrix<E>& D, const readable_vector<Sub>& b)
+  -> vector<scalar_promote_t<E, value_type_trait_of_t<Sub>>, dynamic<>>
+{
+  cml::check_same_inner_size(D, b);
+  const auto& d = D.values();
+  vector<scalar_promote_t<E, value_type_trait_of_t<Sub>>, dynamic<>> x(
+    b.size());
+  for(int i = 0; i < b.size(); ++i) x[i] = b.get(i) / d[i];
+  return x;
+}
+
+template<class E, class S, class Sub>
+auto
+solve(const triangular_matrix<E, S>& T, const readable_vector<Sub>& b)
+  -> vector<scalar_promote_t<E, value_type_trait_of_t<Sub>>, dynamic<>>
+{
+  using value_type = scalar_promote_t<E, value_type_trait_of_t<Sub>>;
+  using accumulator_type = accumulator_of_t<value_type>;
+  cml::check_same_inner_size(T, b);
+
+  /* Row i of the triangle is contiguous in T.values(), from column 0
+   * (lower) or column i (upper):
+   */
+  const auto& t = T.values();
+  const int n = b.size();
+  vector<value_type, dynamic<>> x(n);
+  if(T.is_lower) {
+    for(int i = 0; i < n; ++i) {
+      const auto* row = t.data() + T.index(i, 0);
+      accumulator_type m(b.get(i));
+      for(int k = 0; k < i; ++k) m -= accumulator_type(row[k]) * x[k];
+      x[i] = value_type(m / row[i]);
+    }
+  } else {
+    for(int i = n - 1; i >= 0; --i) {
+      const auto* row = t.data() + T.index(i, i) - i;
+      accumulator_type m(b.get(i));
+      for(int k = i + 1; k < n; ++k) m -= accumulator_type(row[k]) * x[k];
+      x[i] = value_type(m / row[i]);
+    }
+  }
+  return x;
+}
+
+template<class E>
+diagonal_matrix<E>
+inverse(const diagonal_matrix<E>& D)
+{
+  diagonal_matrix<E> Dinv(D);
+  for(auto& d : Dinv.values()) d = E(1) / d;
+  return Dinv;
+}
+
+template<class E, class S>
+triangular_matrix<E, S>
+inverse(const triangular_matrix<E, S>& T)
+{
+  using accumulator_type = accumulator_of_t<E>;
+  const int n = T.rows();
+  const auto& t = T.values();
+  triangular_matrix<E, S> Tinv(n);
+  auto& x = Tinv.values();
+
+  /* Solve T*X = I one column at a time, over the rows of the triangle: */
+  for(int j = 0; j < n; ++j) {
+    x[Tinv.index(j, j)] = E(1) / t[T.index(j, j)];
+    if(T.is_lower) {
+      for(int i = j + 1; i < n; ++i) {
+        accumulator_type m(0);
+        for(int k = j; k < i; ++k)
+          m += accumulator_type(t[T.index(i, k)]) * x[Tinv.index(k, j)];
+        x[Tinv.index(i, j)] = E(-m / t[T.index(i, i)]);
+      }
+    } else {
+      for(int i = j - 1; i >= 0; --i) {
+        accumulator_type m(0);
+        for(int k = i + 1; k <= j; ++k)
+          m += accumulator_type(t[T.index(i, k)]) * x[Tinv.index(k, j)];
+        x[Tinv.index(i, j)] = E(-m / t[T.index(i, i)]);
+      }
+    }
+  }
+  return Tinv;
+}
+
+template<class E>
+E
+determinant(const diagonal_matrix<E>& D)
+{
+  E det(1);
+  for(const auto& d : D.values()) det *= d;
+  return det;
+}
+
+template<class E, class S>
+E
+determinant(const triangular_matrix<E, S>& T)
+{
+  E det(1);
+  for(int i = 0; i < T.rows(); ++i) det *= T.values()[T.index(i, i)];
+  return det;
+}
+
+} // namespace cml
@@ -0,0 +1,90 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cml/vector/fixed_compiled.h>
+#include <cml/matrix/fixed_compiled.h>
+
+/** The number of cyclic Jacobi sweeps used by the 3x3 SVD kernel. */
+#ifndef CML_MATRIX_SVD_3X3_SWEEPS
+#  define CML_MATRIX_SVD_3X3_SWEEPS 4
+#endif
+
+namespace cml {
+/** Compute the singular value decomposition A = U*diag(sigma)*V^T of the
+ * 3x3 matrix @c A.  The singular values are returned in descending order
+ * in @c sigma, and the singular vectors in the columns of the orthogonal
+ * matrices @c U and @c V.  @c V is always a rotation; @c U is a reflection
+ * if det(A) < 0.
+ *
+ * The decomposition uses a fixed number (CML_MATRIX_SVD_3X3_SWEEPS) of
+ * cyclic Jacobi sweeps on A^T*A to find @c V, followed by a Givens QR
+ * factorization of A*V to find @c U, without data-dependent branches.
+ */
+template<class E, class BasisOrient, class Layout>
+void svd_3x3(const matrix<E, compiled<3, 3>, BasisOrient, Layout>& A,
+  matrix<E, compiled<3, 3>, BasisOrient, Layout>& U,
+  vector<E, compiled<3>>& sigma,
+  matrix<E, compiled<3, 3>, BasisOrient, Layout>& V);
+
+/** Compute the polar decomposition A = R*S of the 3x3 matrix @c A, where
+ * @c R is the rotation nearest to @c A, and @c S is symmetric.  @c S is
+ * positive semi-definite if det(A) >= 0; otherwise its smallest eigenvalue
+ * is negative, so that @c R is still a rotation (as needed by Kabsch
+ * alignment and deformation gradients).
+ */
+template<class E, class BasisOrient, class Layout>
+void polar_3x3(const matrix<E, compiled<3, 3>, BasisOrient, Layout>& A,
+  matrix<E, compiled<3, 3>, BasisOrient, Layout>& R,
+  matrix<E, compiled<3, 3>, BasisOrient, Layout>& S);
+
+/** Apply svd_3x3() to the @c n matrices starting at @c A, returning the
+ * results in the @c n elements starting at @c U, @c sigma, and @c V.  The
+ * matrices are processed a block at a time in structure-of-arrays form,
+ * so that the branch-free kernel can be vectorized across matrices, and
+ * the blocks are split across @c threads threads (0 selects
+ * std::thread::hardware_concurrency()).
+ *
+ * @note GCC vectorizes the square roots in the kernel only with
+ * -fno-math-errno (implied by -ffast-math).
+ */
+template<class E, class BasisOrient, class Layout>
+void svd_3x3(const matrix<E, compiled<3, 3>, BasisOrient, Layout>* A, int n,
+  matrix<E, compiled<3, 3>, BasisOrient, Layout>* U,
+  vector<E, compiled<3>>* sigma,
+  matrix<E, compiled<3, 3>, BasisOrient, Layout>* V, int threads = 1);
+
+/** Apply polar_3x3() to the @c n matrices starting at @c A, returning the
+ * results in the @c n elements starting at @c R and @c S, as by the
+ * batched svd_3x3().
+ */
+template<class E, class BasisOrient, class Layout>
+void polar_3x3(const matrix<E, compiled<3, 3>, BasisOrient, Layout>* A, int n,
+  matrix<E, compiled<3, 3>, BasisOrient, Layout>* R,
+  matrix<E, compiled<3, 3>, BasisOrient, Layout>* S, int threads = 1);
+
+/** Compute the thin singular value decomposition A = U*diag(sigma)*V^T of
+ * the M x N matrix @c A using one-sided (Hestenes) Jacobi rotations.  With
+ * K = min(M,N), the K singular values are returned in descending order in
+ * @c sigma, and the singular vectors in the orthonormal columns of the M x
+ * K matrix @c U and the N x K matrix @c V.  @c U, @c sigma, and @c V are
+ * resized if they are resizable.  At most @c max_sweeps sweeps over the
+ * column pairs are made.
+ *
+ * @returns true if the columns converged to mutually orthogonal within @c
+ * max_sweeps sweeps.
+ *
+ * @throws vector_size_error or matrix_size_error if @c U, @c sigma, or @c
+ * V is not resizable and does not have the required size.
+ */
+template<class Sub, class USub, class SigmaSub, class VSub>
+bool svd(const readable_matrix<Sub>& A, writable_matrix<USub>& U,
+  writable_vector<SigmaSub>& sigma, writable_matrix<VSub>& V,
+  int max_sweeps = 32);
+} // namespace cml
+
+#define __CML_MATRIX_SVD_TPP
+#include <cml/matrix/svd.tpp>
+#undef __CML_MATRIX_SVD_TPP
@@ -0,0 +1,465 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#ifndef __CML_MATRIX_SVD_TPP
+#  error "matrix/svd.tpp not included correctly"
+#endif
+
+#include <algorithm>
+#include <vector>
+#include <cml/common/parallel.h>
+#include <cml/scalar/traits.h>
+#include <cml/vector/writable_vector.h>
+#include <cml/vector/detail/check_or_resize.h>
+#include <cml/matrix/writable_matrix.h>
+#include <cml/matrix/detail/check_or_resize.h>
+
+namespace cml {
+namespace detail {
+
+/** The number of matrices processed at a time by the batched 3x3 SVD. */
+const int svd_block_size = 64;
+
+/** Apply the Jacobi rotation that zeroes @c spq to the symmetric 3x3
+ * matrix with diagonal elements @c spp and @c sqq, where @c srp and @c srq
+ * are the elements coupling p and q to the remaining index r.  The cosine
+ * and sine of the rotation are returned in @c c and @c s.
+ */
+template<class E>
+inline void
+svd_jacobi_rotate(E& spp, E& sqq, E& spq, E& srp, E& srq, E& c, E& s)
+{
+  using element_traits = scalar_traits<E>;
+
+  /* Branch-free: a zero spq selects the identity rotation. */
+  const bool nonzero = spq != E(0);
+  const E theta = (sqq - spp) / (E(2) * (nonzero ? spq : E(1)));
+  E t = E(1) / (element_traits::fabs(theta)
+          + element_traits::sqrt(theta * theta + E(1)));
+  t = theta < E(0) ? -t : t;
+  t = nonzero ? t : E(0);
+  c = E(1) / element_traits::sqrt(t * t + E(1));
+  s = t * c;
+
+  spp -= t * spq;
+  sqq += t * spq;
+  spq = E(0);
+  const E rp = srp, rq = srq;
+  srp = c * rp - s * rq;
+  srq = s * rp + c * rq;
+}
+
+/** Rotate columns @c p and @c q of the 3x3 matrix b in the
+ * structure-of-arrays @c x by the rotation with cosine @c c and sine @c s.
+ */
+template<int B, class E>
+inline void
+svd_rotate_columns(E* x, int b, int p, int q, E c, E s)
+{
+  for(int k = 0; k < 3; ++k) {
+    E& xp = x[(3 * k + p) * B + b];
+    E& xq = x[(3 * k + q) * B + b];
+    const E tp = xp;
+    xp = c * tp - s * xq;
+    xq = s * tp + c * xq;
+  }
+}
+
+/** Swap columns @c p and @c q of matrix b in the structure-of-arrays @c m
+ * and @c v if column q of @c m is longer than column p, negating one so
+ * that det(v) is unchanged.
+ */
+template<int B, class E>
+inline void
+svd_sort_columns(E* m, E* v, E* n2, int b, int p, int q)
+{
+  const bool swap = n2[p * B + b] < n2[q * B + b];
+  for(int k = 0; k < 3; ++k) {
+    E& mp = m[(3 * k + p) * B + b];
+    E& mq = m[(3 * k + q) * B + b];
+    E& vp = v[(3 * k + p) * B + b];
+    E& vq = v[(3 * k + q) * B + b];
+    const E tm = mp, tv = vp;
+    mp = swap ? mq : tm;
+    mq = swap ? -tm : mq;
+    vp = swap ? vq : tv;
+    vq = swap ? -tv : vq;
+  }
+  const E np = n2[p * B + b];
+  n2[p * B + b] = swap ? n2[q * B + b] : np;
+  n2[q * B + b] = swap ? np : n2[q * B + b];
+}
+
+/** Apply the Givens rotation to rows @c p and @c q of matrix b in the
+ * structure-of-arrays @c m that zeroes element (q,p), and accumulate its
+ * transpose into the columns of @c u.
+ */
+template<int B, class E>
+inline void
+svd_givens(E* m, E* u, int b, int p, int q)
+{
+  using element_traits = scalar_traits<E>;
+
+  const E x = m[(3 * p + p) * B + b], y = m[(3 * q + p) * B + b];
+  const E r2 = x * x + y * y;
+  const bool nonzero = r2 > E(0);
+  const E rinv = E(1) / element_traits::sqrt(nonzero ? r2 : E(1));
+  const E c = nonzero ? x * rinv : E(1);
+  const E s = nonzero ? y * rinv : E(0);
+  for(int j = 0; j < 3; ++j) {
+    E& mp = m[(3 * p + j) * B + b];
+    E& mq = m[(3 * q + j) * B + b];
+    const E tp = mp;
+    mp = c * tp + s * mq;
+    mq = c * mq - s * tp;
+  }
+  svd_rotate_columns<B>(u, b, p, q, c, -s);
+}
+
+/** Signed 3x3 SVD kernel for @c count (at most @c B) matrices stored in
+ * structure-of-arrays form, such that element (i,j) of matrix b
+ * is m[(3*i+j)*B + b], and likewise for the rotations @c u and @c v.
+ * Singular value k of matrix b is returned in sigma[k*B + b]; the last
+ * one is negative if det(A) < 0, so that both @c u and @c v are
+ * rotations.  @c m is overwritten.
+ *
+ * Each step is a separate loop over the matrices, so that the loops can
+ * be vectorized.
+ */
+template<int B, class E>
+inline void
+svd_3x3_kernel(E* M, E* U, E* sigma, E* V, int count)
+{
+  E S[6 * B], n2[3 * B];
+
+  /* S = A^T*A, symmetric, and V = U = I: */
+  for(int b = 0; b < count; ++b) {
+    for(int i = 0; i < 3; ++i)
+      for(int j = i; j < 3; ++j)
+        S[(i == 0 ? j : i + j + 1) * B + b] = M[i * B + b] * M[j * B + b]
+          + M[(3 + i) * B + b] * M[(3 + j) * B + b]
+          + M[(6 + i) * B + b] * M[(6 + j) * B + b];
+    for(int k = 0; k < 9; ++k)
+      V[k * B + b] = U[k * B + b] = (k % 4 == 0) ? E(1) : E(0);
+  }
+
+  /* V from a fixed number of cyclic Jacobi sweeps on S, stored as s00,
+   * s01, s02, s11, s12, s22:
+   */
+  E* s00 = S;
+  E* s01 = S + B;
+  E* s02 = S + 2 * B;
+  E* s11 = S + 3 * B;
+  E* s12 = S + 4 * B;
+  E* s22 = S + 5 * B;
+  for(int sweep = 0; sweep < CML_MATRIX_SVD_3X3_SWEEPS; ++sweep) {
+    for(int b = 0; b < count; ++b) {
+      E c, s;
+      svd_jacobi_rotate(s00[b], s11[b], s01[b], s02[b], s12[b], c, s);
+      svd_rotate_columns<B>(V, b, 0, 1, c, s);
+    }
+    for(int b = 0; b < count; ++b) {
+      E c, s;
+      svd_jacobi_rotate(s00[b], s22[b], s02[b], s01[b], s12[b], c, s);
+      svd_rotate_columns<B>(V, b, 0, 2, c, s);
+    }
+    for(int b = 0; b < count; ++b) {
+      E c, s;
+      svd_jacobi_rotate(s11[b], s22[b], s12[b], s01[b], s02[b], c, s);
+      svd_rotate_columns<B>(V, b, 1, 2, c, s);
+    }
+  }
+
+  /* M = A*V, with its columns sorted by decreasing length: */
+  for(int b = 0; b < count; ++b) {
+    E m[9];
+    for(int k = 0; k < 9; ++k) m[k] = M[k * B + b];
+    for(int i = 0; i < 3; ++i)
+      for(int j = 0; j < 3; ++j)
+        M[(3 * i + j) * B + b] = m[3 * i] * V[j * B + b]
+          + m[3 * i + 1] * V[(3 + j) * B + b]
+          + m[3 * i + 2] * V[(6 + j) * B + b];
+    for(int j = 0; j < 3; ++j)
+      n2[j * B + b] = M[j * B + b] * M[j * B + b]
+        + M[(3 + j) * B + b] * M[(3 + j) * B + b]
+        + M[(6 + j) * B + b] * M[(6 + j) * B + b];
+    svd_sort_columns<B>(M, V, n2, b, 0, 1);
+    svd_sort_columns<B>(M, V, n2, b, 0, 2);
+    svd_sort_columns<B>(M, V, n2, b, 1, 2);
+  }
+
+  /* M = U*R by Givens QR, where R is diagonal up to rounding: */
+  for(int b = 0; b < count; ++b) svd_givens<B>(M, U, b, 0, 1);
+  for(int b = 0; b < count; ++b) svd_givens<B>(M, U, b, 0, 2);
+  for(int b = 0; b < count; ++b) svd_givens<B>(M, U, b, 1, 2);
+
+  for(int b = 0; b < count; ++b)
+    for(int k = 0; k < 3; ++k) sigma[k * B + b] = M[4 * k * B + b];
+}
+
+/** Apply @c f(first, count) to each block of at most svd_block_size of
+ * @c n matrices, splitting the blocks across @c threads threads.
+ */
+template<class F>
+inline void
+svd_for_blocks(int n, int threads, F&& f)
+{
+  const int B = svd_block_size;
+  const int blocks = (n + B - 1) / B;
+  parallel_for(blocks, threads, [n, B, &f](int begin, int end) {
+    for(int k = begin; k < end; ++k) {
+      const int first = k * B;
+      f(first, std::min(B, n - first));
+    }
+  });
+}
+
+} // namespace detail
+
+template<class E, class BasisOrient, class Layout>
+void
+svd_3x3(const matrix<E, compiled<3, 3>, BasisOrient, Layout>& A,
+  matrix<E, compiled<3, 3>, BasisOrient, Layout>& U,
+  vector<E, compiled<3>>& sigma,
+  matrix<E, compiled<3, 3>, BasisOrient, Layout>& V)
+{
+  E a[9], u[9], s[3], v[9];
+  for(int i = 0; i < 3; ++i)
+    for(int j = 0; j < 3; ++j) a[3 * i + j] = A(i, j);
+  detail::svd_3x3_kernel<1>(a, u, s, v, 1);
+
+  /* Make the last singular value non-negative: */
+  const E flip = s[2] < E(0) ? E(-1) : E(1);
+  for(int i = 0; i < 3; ++i) {
+    for(int j = 0; j < 3; ++j) {
+      U(i, j) = j == 2 ? flip * u[3 * i + j] : u[3 * i + j];
+      V(i, j) = v[3 * i + j];
+    }
+  }
+  sigma.set(s[0], s[1], flip * s[2]);
+}
+
+template<class E, class BasisOrient, class Layout>
+void
+polar_3x3(const matrix<E, compiled<3, 3>, BasisOrient, Layout>& A,
+  matrix<E, compiled<3, 3>, BasisOrient, Layout>& R,
+  matrix<E, compiled<3, 3>, BasisOrient, Layout>& S)
+{
+  E a[9], u[9], s[3], v[9];
+  for(int i = 0; i < 3; ++i)
+    for(int j = 0; j < 3; ++j) a[3 * i + j] = A(i, j);
+  detail::svd_3x3_kernel<1>(a, u, s, v, 1);
+
+  /* R = U*V^T, S = V*diag(sigma)*V^T: */
+  for(int i = 0; i < 3; ++i) {
+    for(int j = 0; j < 3; ++j) {
+      E r = E(0), p = E(0);
+      for(int k = 0; k < 3; ++k) {
+        r += u[3 * i + k] * v[3 * j + k];
+        p += v[3 * i + k] * s[k] * v[3 * j + k];
+      }
+      R(i, j) = r;
+      S(i, j) = p;
+    }
+  }
+}
+
+template<class E, class BasisOrient, class Layout>
+void
+svd_3x3(const matrix<E, compiled<3, 3>, BasisOrient, Layout>* A, int n,
+  matrix<E, compiled<3, 3>, BasisOrient, Layout>* U,
+  vector<E, compiled<3>>* sigma,
+  matrix<E, compiled<3, 3>, BasisOrient, Layout>* V, int threads)
+{
+  auto solve = [A, U, sigma, V](int first, int count) {
+    const int B = detail::svd_block_size;
+    E a[9 * B], u[9 * B], s[3 * B], v[9 * B];
+    for(int b = 0; b < count; ++b)
+      for(int i = 0; i < 3; ++i)
+        for(int j = 0; j < 3; ++j) a[(3 * i + j) * B + b] = A[first + b](i, j);
+
+    detail::svd_3x3_kernel<B>(a, u, s, v, count);
+
+    for(int b = 0; b < count; ++b) {
+      const E flip = s[2 * B + b] < E(0) ? E(-1) : E(1);
+      for(int i = 0; i < 3; ++i) {
+        for(int j = 0; j < 3; ++j) {
+          const E uij = u[(3 * i + j) * B + b];
+          U[first + b](i, j) = j == 2 ? flip * uij : uij;
+          V[first + b](i, j) = v[(3 * i + j) * B + b];
+        }
+      }
+      sigma[first + b].set(s[b], s[B + b], flip * s[2 * B + b]);
+    }
+  };
+  detail::svd_for_blocks(n, threads, solve);
+}
+
+template<class E, class BasisOrient, class Layout>
+void
+polar_3x3(const matrix<E, compiled<3, 3>, BasisOrient, Layout>* A, int n,
+  matrix<E, compiled<3, 3>, BasisOrient, Layout>* R,
+  matrix<E, compiled<3, 3>, BasisOrient, Layout>* S, int threads)
+{
+  auto solve = [A, R, S](int first, int count) {
+    const int B = detail::svd_block_size;
+    E a[9 * B], u[9 * B], s[3 * B], v[9 * B];
+    for(int b = 0; b < count; ++b)
+      for(int i = 0; i < 3; ++i)
+        for(int j = 0; j < 3; ++j) a[(3 * i + j) * B + b] = A[first + b](i, j);
+
+    detail::svd_3x3_kernel<B>(a, u, s, v, count);
+
+    /* R = U*V^T, S = V*diag(sigma)*V^T: */
+    for(int b = 0; b < count; ++b) {
+      for(int i = 0; i < 3; ++i) {
+        for(int j = 0; j < 3; ++j) {
+          E r = E(0), p = E(0);
+          for(int k = 0; k < 3; ++k) {
+            const E vjk = v[(3 * j + k) * B + b];
+            r += u[(3 * i + k) * B + b] * vjk;
+            p += v[(3 * i + k) * B + b] * s[k * B + b] * vjk;
+          }
+          R[first + b](i, j) = r;
+          S[first + b](i, j) = p;
+        }
+      }
+    }
+  };
+  detail::svd_for_blocks(n, threads, solve);
+}
+
+template<class Sub, class USub, class SigmaSub, class VSub>
+bool
+svd(const readable_matrix<Sub>& A, writable_matrix<USub>& U,
+  writable_vector<SigmaSub>& sigma, writable_matrix<VSub>& V, int max_sweeps)
+{
+  using value_type = value_type_trait_of_t<USub>;
+  using element_traits = scalar_traits<value_type>;
+
+  /* Factor A, or A^T if A is wide, so that the columns are the short
+   * dimension:
+   */
+  const bool wide = A.rows() < A.cols();
+  const int m = wide ? A.cols() : A.rows();
+  const int n = wide ? A.rows() : A.cols();
+  detail::check_or_resize(U, A.rows(), n);
+  detail::check_or_resize(sigma, n);
+  detail::check_or_resize(V, A.cols(), n);
+
+  /* Column-major copies of the working matrix W and of W's right rotation
+   * Q:
+   */
+  std::vector<value_type> w(m * n), q(n * n);
+  for(int j = 0; j < n; ++j)
+    for(int i = 0; i < m; ++i) w[j * m + i] = wide ? A(j, i) : A(i, j);
+  for(int j = 0; j < n; ++j)
+    for(int i = 0; i < n; ++i) q[j * n + i] = (i == j) ? 1 : 0;
+
+  /* Rotate column pairs until they are all mutually orthogonal: */
+  const value_type eps = element_traits::epsilon();
+  bool converged = false;
+  for(int sweep = 0; sweep < max_sweeps && !converged; ++sweep) {
+    converged = true;
+    for(int p = 0; p < n; ++p) {
+      for(int r = p + 1; r < n; ++r) {
+        value_type* wp = &w[p * m];
+        value_type* wr = &w[r * m];
+        value_type alpha = 0, beta = 0, gamma = 0;
+        for(int i = 0; i < m; ++i) {
+          alpha += wp[i] * wp[i];
+          beta += wr[i] * wr[i];
+          gamma += wp[i] * wr[i];
+        }
+        if(gamma == value_type(0)
+          || element_traits::fabs(gamma)
+            <= eps * element_traits::sqrt(alpha * beta))
+          continue;
+        converged = false;
+
+        const value_type zeta = (beta - alpha) / (2 * gamma);
+        value_type t = 1
+          / (element_traits::fabs(zeta)
+            + element_traits::sqrt(zeta * zeta + 1));
+        if(zeta < value_type(0)) t = -t;
+        const value_type c = 1 / element_traits::sqrt(t * t + 1);
+        const value_type s = t * c;
+        for(int i = 0; i < m; ++i) {
+          const value_type xp = wp[i], xr = wr[i];
+          wp[i] = c * xp - s * xr;
+          wr[i] = s * xp + c * xr;
+        }
+        value_type* qp = &q[p * n];
+        value_type* qr = &q[r * n];
+        for(int i = 0; i < n; ++i) {
+          const value_type xp = qp[i], xr = qr[i];
+          qp[i] = c * xp - s * xr;
+          qr[i] = s * xp + c * xr;
+        }
+      }
+    }
+  }
+
+  /* The singular values are the column lengths, sorted descending: */
+  std::vector<value_type> norms(n);
+  for(int j = 0; j < n; ++j) {
+    value_type n2 = 0;
+    for(int i = 0; i < m; ++i) n2 += w[j * m + i] * w[j * m + i];
+    norms[j] = element_traits::sqrt(n2);
+  }
+  std::vector<int> order(n);
+  for(int j = 0; j < n; ++j) order[j] = j;
+  std::stable_sort(order.begin(), order.end(),
+    [&norms](int i, int j) { return norms[i] > norms[j]; });
+
+  /* Normalize the columns of W in order; a numerically zero column is
+   * replaced by the unit vector e_c with the smallest projection onto the
+   * previous (orthonormal) columns, i.e. the row c of the columns so far
+   * with the smallest norm, orthogonalized against them:
+   */
+  const value_type tiny =
+    eps * std::max(m, 1) * (n > 0 ? norms[order[0]] : value_type(0));
+  std::vector<value_type> left(m * n);
+  std::vector<value_type> row2(m, value_type(0));
+  for(int j = 0; j < n; ++j) {
+    const int k = order[j];
+    value_type* x = &left[j * m];
+    if(norms[k] > tiny) {
+      for(int i = 0; i < m; ++i) x[i] = w[k * m + i] / norms[k];
+    } else {
+      const int c = int(
+        std::min_element(row2.begin(), row2.end()) - row2.begin());
+      x[c] = 1;
+      for(int pass = 0; pass < 2; ++pass) {
+        for(int l = 0; l < j; ++l) {
+          const value_type* y = &left[l * m];
+          value_type d = 0;
+          for(int i = 0; i < m; ++i) d += y[i] * x[i];
+          for(int i = 0; i < m; ++i) x[i] -= d * y[i];
+        }
+      }
+      value_type x2 = 0;
+      for(int i = 0; i < m; ++i) x2 += x[i] * x[i];
+      const value_type s = 1 / element_traits::sqrt(x2);
+      for(int i = 0; i < m; ++i) x[i] *= s;
+    }
+    for(int i = 0; i < m; ++i) row2[i] += x[i] * x[i];
+  }
+
+  /* A = L*diag(sigma)*Q^T, or A^T if A is wide: */
+  for(int j = 0; j < n; ++j) {
+    const int k = order[j];
+    sigma[j] = norms[k];
+    for(int i = 0; i < m; ++i) {
+      if(wide) V(i, j) = left[j * m + i];
+      else U(i, j) = left[j * m + i];
+    }
+    for(int i = 0; i < n; ++i) {
+      if(wide) U(i, j) = q[k * n + i];
+      else V(i, j) = q[k * n + i];
+    }
+  }
+  return converged;
+}
+} // namespace cml
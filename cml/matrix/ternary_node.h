@@ -0,0 +1,174 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cml/matrix/readable_matrix.h>
+#include <cml/matrix/promotion.h>
+
+namespace cml {
+template<class Sub1, class Sub2, class Sub3, class Op>
+class matrix_ternary_node;
+
+/** matrix_ternary_node<> traits. */
+template<class Sub1, class Sub2, class Sub3, class Op>
+struct matrix_traits<matrix_ternary_node<Sub1, Sub2, Sub3, Op>>
+{
+  using matrix_type = matrix_ternary_node<Sub1, Sub2, Sub3, Op>;
+  using first_arg_type = Sub1;
+  using second_arg_type = Sub2;
+  using third_arg_type = Sub3;
+  using first_type = cml::unqualified_type_t<Sub1>;
+  using second_type = cml::unqualified_type_t<Sub2>;
+  using third_type = cml::unqualified_type_t<Sub3>;
+  using first_traits = matrix_traits<first_type>;
+  using second_traits = matrix_traits<second_type>;
+  using third_traits = matrix_traits<third_type>;
+  using element_traits = scalar_traits<typename Op::result_type>;
+  using value_type = typename element_traits::value_type;
+  using immutable_value = value_type;
+
+  /* Determine the common storage type for the node, based on the storage
+   * types of its subexpressions:
+   */
+  using storage_type = matrix_binary_storage_promote_t<
+    matrix_binary_storage_promote_t<storage_type_of_t<first_traits>,
+      storage_type_of_t<second_traits>>,
+    storage_type_of_t<third_traits>>;
+
+  /* Traits and types for the storage: */
+  using size_tag = typename storage_type::size_tag;
+
+  /* Array rows: */
+  static const int array_rows = storage_type::array_rows;
+
+  /* Array cols: */
+  static const int array_cols = storage_type::array_cols;
+
+  /* Determine the common basis type: */
+  using basis_tag = basis_tag_promote_t<
+    basis_tag_promote_t<basis_tag_of_t<first_traits>,
+      basis_tag_of_t<second_traits>>,
+    basis_tag_of_t<third_traits>>;
+
+  /* Determine the common layout type: */
+  using layout_tag = layout_tag_promote_t<
+    layout_tag_promote_t<layout_tag_of_t<first_traits>,
+      layout_tag_of_t<second_traits>>,
+    layout_tag_of_t<third_traits>>;
+
+  /** Constant containing the matrix basis enumeration value. */
+  static const basis_kind matrix_basis = basis_tag::value;
+
+  /** Constant containing the array layout enumeration value. */
+  static const layout_kind array_layout = layout_tag::value;
+};
+
+/** Represents a ternary matrix operation, such as a fused multiply-add, in
+ * an expression tree.
+ */
+template<class Sub1, class Sub2, class Sub3, class Op>
+class matrix_ternary_node
+  : public readable_matrix<matrix_ternary_node<Sub1, Sub2, Sub3, Op>>
+{
+  public:
+  using node_type = matrix_ternary_node<Sub1, Sub2, Sub3, Op>;
+  using readable_type = readable_matrix<node_type>;
+  using traits_type = matrix_traits<node_type>;
+  using first_arg_type = typename traits_type::first_arg_type;
+  using second_arg_type = typename traits_type::second_arg_type;
+  using third_arg_type = typename traits_type::third_arg_type;
+  using first_type = typename traits_type::first_type;
+  using second_type = typename traits_type::second_type;
+  using third_type = typename traits_type::third_type;
+  using element_traits = typename traits_type::element_traits;
+  using value_type = typename traits_type::value_type;
+  using immutable_value = typename traits_type::immutable_value;
+  using storage_type = typename traits_type::storage_type;
+  using size_tag = typename traits_type::size_tag;
+  using basis_tag = typename traits_type::basis_tag;
+  using layout_tag = typename traits_type::layout_tag;
+
+  public:
+  /** Constant containing the number of rows. */
+  static const int array_rows = traits_type::array_rows;
+
+  /** Constant containing the number of columns. */
+  static const int array_cols = traits_type::array_cols;
+
+  /** Constant containing the array layout enumeration value. */
+  static const layout_kind array_layout = traits_type::array_layout;
+
+  /** Constant containing the matrix basis enumeration value. */
+  static const basis_kind matrix_basis = traits_type::matrix_basis;
+
+  public:
+  /** Construct from the wrapped sub-expressions.  Sub1, Sub2 and Sub3
+   * must be lvalue reference or rvalue reference types.
+   *
+   * @throws incompatible_matrix_size_error at run-time if any of the
+   * subexpressions is a dynamically-sized matrix, and the sizes differ.
+   * If all of them are fixed-size expressions, then the sizes are checked
+   * at compile time.
+   */
+  matrix_ternary_node(Sub1 first, Sub2 second,
+    Sub3 third) CML_SIZE_CHECK_NOEXCEPT;
+
+  /** Move constructor. */
+  matrix_ternary_node(node_type&& other);
+
+  /** Copy constructor. */
+  matrix_ternary_node(const node_type& other);
+
+  protected:
+  /** @name readable_matrix Interface */
+  /*@{*/
+
+  friend readable_type;
+
+  /** Return the row size of the matrix expression. */
+  int i_rows() const;
+
+  /** Return the column size of the matrix expression. */
+  int i_cols() const;
+
+  /** Apply the operator to element @c (i,j) of the subexpressions and
+   * return the result.
+   */
+  immutable_value i_get(int i, int j) const;
+
+  /*@}*/
+
+
+  protected:
+  /** The types used to store the subexpressions.  An expression is stored
+   * as a copy if its type is an rvalue reference (temporary), or by const
+   * reference if it is an lvalue reference.
+   */
+  using first_wrap_type = cml::if_t<std::is_lvalue_reference<Sub1>::value,
+    const first_type&, first_type>;
+  using second_wrap_type = cml::if_t<std::is_lvalue_reference<Sub2>::value,
+    const second_type&, second_type>;
+  using third_wrap_type = cml::if_t<std::is_lvalue_reference<Sub3>::value,
+    const third_type&, third_type>;
+
+  protected:
+  /** The wrapped first subexpression. */
+  first_wrap_type m_first;
+
+  /** The wrapped second subexpression. */
+  second_wrap_type m_second;
+
+  /** The wrapped third subexpression. */
+  third_wrap_type m_third;
+
+  private:
+  // Not assignable.
+  node_type& operator=(const node_type&);
+};
+} // namespace cml
+
+#define __CML_MATRIX_TERNARY_NODE_TPP
+#include <cml/matrix/ternary_node.tpp>
+#undef __CML_MATRIX_TERNARY_NODE_TPP
@@ -0,0 +1,70 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#ifndef __CML_MATRIX_TERNARY_NODE_TPP
+#  error "matrix/ternary_node.tpp not included correctly"
+#endif
+
+#include <cml/matrix/size_checking.h>
+
+namespace cml {
+/* matrix_ternary_node 'structors: */
+
+template<class Sub1, class Sub2, class Sub3, class Op>
+matrix_ternary_node<Sub1, Sub2, Sub3, Op>::matrix_ternary_node(Sub1 first,
+  Sub2 second, Sub3 third) CML_SIZE_CHECK_NOEXCEPT
+  : m_first(std::move(first))
+    , m_second(std::move(second))
+    , m_third(std::move(third))
+{
+  cml::check_same_size(this->m_first, this->m_second);
+  cml::check_same_size(this->m_first, this->m_third);
+}
+
+template<class Sub1, class Sub2, class Sub3, class Op>
+matrix_ternary_node<Sub1, Sub2, Sub3, Op>::matrix_ternary_node(
+  node_type&& other)
+  : m_first(std::move(other.m_first))
+    , m_second(std::move(other.m_second))
+    , m_third(std::move(other.m_third))
+{
+}
+
+template<class Sub1, class Sub2, class Sub3, class Op>
+matrix_ternary_node<Sub1, Sub2, Sub3, Op>::matrix_ternary_node(
+  const node_type& other)
+  : m_first(other.m_first)
+    , m_second(other.m_second)
+    , m_third(other.m_third)
+{
+}
+
+
+/* Internal methods: */
+
+/* readable_matrix interface: */
+
+template<class Sub1, class Sub2, class Sub3, class Op>
+int
+matrix_ternary_node<Sub1, Sub2, Sub3, Op>::i_rows() const
+{
+  return this->m_first.rows();
+}
+
+template<class Sub1, class Sub2, class Sub3, class Op>
+int
+matrix_ternary_node<Sub1, Sub2, Sub3, Op>::i_cols() const
+{
+  return this->m_first.cols();
+}
+
+template<class Sub1, class Sub2, class Sub3, class Op>
+auto
+matrix_ternary_node<Sub1, Sub2, Sub3, Op>::i_get(int i, int j) const
+  -> immutable_value
+{
+  return Op().apply(this->m_first.get(i, j), this->m_second.get(i, j),
+    this->m_third.get(i, j));
+}
+} // namespace cml
@@ -6,3 +6,29 @@
 
 #include <cml/matrix/transpose_node.h>
 #include <cml/matrix/transpose_ops.h>
+#include <cml/matrix/writable_matrix.h>
+#include <cml/matrix/detail/check_or_resize.h>
+#include <cml/matrix/detail/transpose_blocked.h>
+
+namespace cml {
+/** Assign the transpose of @c M to @c T, splitting the tiled copy across
+ * @c threads threads (0 selects std::thread::hardware_concurrency()).
+ * Assigning cml::transpose(M) to a matrix performs the same tiled copy
+ * using CML_MATRIX_TRANSPOSE_THREADS threads.
+ *
+ * @throws incompatible_matrix_size_error if @c T is fixed-size or not
+ * resizable, and its size does not match the transpose of @c M.
+ *
+ * @note @c T must not alias @c M.
+ */
+template<class Sub1, class Sub2>
+void
+transpose(const readable_matrix<Sub1>& M, writable_matrix<Sub2>& T,
+  int threads)
+{
+  auto node = cml::transpose(M);
+  const readable_matrix<decltype(node)>& MT = node;
+  detail::check_or_resize(T, MT);
+  detail::copy_blocked(T, MT, threads);
+}
+} // namespace cml
@@ -6,10 +6,81 @@
 #  error "matrix/vector_product.tpp not included correctly"
 #endif
 
+#include <cml/common/instrument.h>
+#include <cml/scalar/accumulator.h>
 #include <cml/vector/detail/resize.h>
 #include <cml/matrix/size_checking.h>
+#include <cml/matrix/structure.h>
 
 namespace cml {
+namespace detail {
+
+/* Compute v = sub1*sub2 for a general matrix sub1: */
+template<class Sub1, class Sub2, class Vector>
+void
+matrix_vector_product(const Sub1& sub1, const Sub2& sub2, Vector& v,
+  general_structure)
+{
+  using accumulator_type = accumulator_of_t<value_type_trait_of_t<Vector>>;
+  for(int i = 0; i < sub1.rows(); ++i) {
+    accumulator_type m = accumulator_type(sub1(i, 0)) * sub2[0];
+    for(int k = 1; k < sub2.size(); ++k)
+      m += accumulator_type(sub1(i, k)) * sub2[k];
+    v[i] = m;
+  }
+}
+
+/* Compute v = sub1*sub2 over the possibly non-zero elements of each row
+ * of sub1:
+ */
+template<class Sub1, class Sub2, class Vector, class Tag>
+void
+matrix_vector_product(const Sub1& sub1, const Sub2& sub2, Vector& v, Tag)
+{
+  using accumulator_type = accumulator_of_t<value_type_trait_of_t<Vector>>;
+  for(int i = 0; i < sub1.rows(); ++i) {
+    const auto r = structure_row_range(sub1, i, Tag());
+    accumulator_type m(0);
+    for(int k = r.first; k < r.second; ++k)
+      m += accumulator_type(sub1(i, k)) * sub2[k];
+    v[i] = m;
+  }
+}
+
+/* Compute v = sub1*sub2 for a general matrix sub2: */
+template<class Sub1, class Sub2, class Vector>
+void
+vector_matrix_product(const Sub1& sub1, const Sub2& sub2, Vector& v,
+  general_structure)
+{
+  using accumulator_type = accumulator_of_t<value_type_trait_of_t<Vector>>;
+  for(int j = 0; j < sub2.cols(); ++j) {
+    accumulator_type m = accumulator_type(sub1[0]) * sub2(0, j);
+    for(int k = 1; k < sub1.size(); ++k)
+      m += accumulator_type(sub1[k]) * sub2(k, j);
+    v[j] = m;
+  }
+}
+
+/* Compute v = sub1*sub2 over the possibly non-zero elements of each
+ * column of sub2:
+ */
+template<class Sub1, class Sub2, class Vector, class Tag>
+void
+vector_matrix_product(const Sub1& sub1, const Sub2& sub2, Vector& v, Tag)
+{
+  using accumulator_type = accumulator_of_t<value_type_trait_of_t<Vector>>;
+  for(int j = 0; j < sub2.cols(); ++j) {
+    const auto c = structure_col_range(sub2, j, Tag());
+    accumulator_type m(0);
+    for(int k = c.first; k < c.second; ++k)
+      m += accumulator_type(sub1[k]) * sub2(k, j);
+    v[j] = m;
+  }
+}
+
+} // namespace detail
+
 template<class Sub1, class Sub2, enable_if_matrix_t<Sub1>*,
   enable_if_vector_t<Sub2>*>
 auto
@@ -23,13 +94,13 @@ operator*(Sub1&& sub1, Sub2&& sub2)
 
   cml::check_same_inner_size(sub1, sub2);
 
+  detail::instrument_scope scope("matrix_vector_product");
+  detail::instrument_temporary("matrix_vector_product");
   result_type v;
   detail::resize(v, array_rows_of(sub1));
-  for(int i = 0; i < sub1.rows(); ++i) {
-    auto m = sub1(i, 0) * sub2[0];
-    for(int k = 1; k < sub2.size(); ++k) m += sub1(i, k) * sub2[k];
-    v[i] = m;
-  }
+  detail::instrument_evaluation("matrix_vector_product", v.size());
+  detail::matrix_vector_product(sub1, sub2, v,
+    matrix_structure_of_t<Sub1>());
   return v;
 }
 
@@ -46,13 +117,13 @@ operator*(Sub1&& sub1, Sub2&& sub2)
 
   cml::check_same_inner_size(sub1, sub2);
 
+  detail::instrument_scope scope("vector_matrix_product");
+  detail::instrument_temporary("vector_matrix_product");
   result_type v;
   detail::resize(v, array_cols_of(sub2));
-  for(int j = 0; j < sub2.cols(); ++j) {
-    auto m = sub1[0] * sub2(0, j);
-    for(int k = 1; k < sub1.size(); ++k) m += sub1[k] * sub2(k, j);
-    v[j] = m;
-  }
+  detail::instrument_evaluation("vector_matrix_product", v.size());
+  detail::vector_matrix_product(sub1, sub2, v,
+    matrix_structure_of_t<Sub2>());
   return v;
 }
 
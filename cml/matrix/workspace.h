@@ -0,0 +1,118 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <vector>
+
+/** The largest dimension of a dynamic-size square matrix that determinant,
+ * inverse, and similar factorizations handle with stack-allocated scratch
+ * storage.  Larger matrices use a matrix_workspace if one is provided, or
+ * allocate scratch storage on each call otherwise.
+ */
+#ifndef CML_MATRIX_SMALL_BUFFER_SIZE
+#  define CML_MATRIX_SMALL_BUFFER_SIZE 12
+#endif
+
+namespace cml {
+
+/** Reusable scratch storage for dynamic-size matrix factorizations.  A
+ * workspace grows as needed and never shrinks, so passing the same
+ * workspace to repeated calls of the same size does not allocate after
+ * the first call.
+ *
+ * @note A workspace must not be shared between threads.
+ */
+template<class Element> class matrix_workspace
+{
+  public:
+  using value_type = Element;
+
+
+  public:
+  /** Construct an empty workspace. */
+  matrix_workspace() = default;
+
+  /** Construct a workspace with storage reserved for @c n x @c n
+   * factorizations.
+   */
+  explicit matrix_workspace(int n);
+
+
+  public:
+  /** Reserve storage for @c n x @c n factorizations. */
+  void reserve(int n);
+
+  /** Return a pointer to at least @c count scratch values. */
+  value_type* values(int count);
+
+  /** Return a pointer to at least @c count scratch indices. */
+  int* indices(int count);
+
+
+  protected:
+  /** Scratch values. */
+  std::vector<value_type> m_values;
+
+  /** Scratch indices. */
+  std::vector<int> m_indices;
+};
+
+namespace detail {
+
+/** Scratch storage for dynamic-size factorizations, using inline arrays
+ * when the request fits in an @c N x @c N matrix, the caller's workspace
+ * if one was provided, and heap storage otherwise.
+ *
+ * @note values() and indices() return the start of the same storage on
+ * every call, so a kernel must request all of its scratch values (or
+ * indices) in one call and partition the result itself.
+ */
+template<class Element, int N = CML_MATRIX_SMALL_BUFFER_SIZE>
+class matrix_scratch
+{
+  public:
+  using value_type = Element;
+  using workspace_type = matrix_workspace<Element>;
+
+
+  public:
+  /** Construct scratch storage that falls back to @c workspace, if
+   * non-null, for large requests.
+   */
+  explicit matrix_scratch(workspace_type* workspace = nullptr);
+
+  // Not copyable, since m_workspace may point to m_local:
+  matrix_scratch(const matrix_scratch&) = delete;
+  matrix_scratch& operator=(const matrix_scratch&) = delete;
+
+  /** Return a pointer to at least @c count scratch values. */
+  value_type* values(int count);
+
+  /** Return a pointer to at least @c count scratch indices. */
+  int* indices(int count);
+
+
+  protected:
+  /** Inline scratch values. */
+  value_type m_values[N * N];
+
+  /** Inline scratch indices. */
+  int m_indices[3 * N];
+
+  /** The caller's workspace, or a local one. */
+  workspace_type* m_workspace;
+
+  /** Local workspace used for large requests when the caller did not
+   * provide one.
+   */
+  workspace_type m_local;
+};
+
+} // namespace detail
+} // namespace cml
+
+#define __CML_MATRIX_WORKSPACE_TPP
+#include <cml/matrix/workspace.tpp>
+#undef __CML_MATRIX_WORKSPACE_TPP
@@ -0,0 +1,85 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#ifndef __CML_MATRIX_WORKSPACE_TPP
+#  error "matrix/workspace.tpp not included correctly"
+#endif
+
+#include <cml/common/instrument.h>
+
+namespace cml {
+
+/* matrix_workspace 'structors: */
+
+template<class E>
+matrix_workspace<E>::matrix_workspace(int n)
+{
+  this->reserve(n);
+}
+
+
+/* Public methods: */
+
+template<class E>
+void
+matrix_workspace<E>::reserve(int n)
+{
+  this->values(n * n);
+  this->indices(3 * n);
+}
+
+template<class E>
+auto
+matrix_workspace<E>::values(int count) -> value_type*
+{
+  if(int(this->m_values.size()) < count) {
+    detail::instrument_allocation(count * sizeof(value_type));
+    this->m_values.resize(count);
+  }
+  return this->m_values.data();
+}
+
+template<class E>
+int*
+matrix_workspace<E>::indices(int count)
+{
+  if(int(this->m_indices.size()) < count) {
+    detail::instrument_allocation(count * sizeof(int));
+    this->m_indices.resize(count);
+  }
+  return this->m_indices.data();
+}
+
+
+namespace detail {
+
+/* matrix_scratch 'structors: */
+
+template<class E, int N>
+matrix_scratch<E, N>::matrix_scratch(workspace_type* workspace)
+  : m_workspace(workspace ? workspace : &m_local)
+{
+}
+
+
+/* Public methods: */
+
+template<class E, int N>
+auto
+matrix_scratch<E, N>::values(int count) -> value_type*
+{
+  if(count <= N * N) return this->m_values;
+  return this->m_workspace->values(count);
+}
+
+template<class E, int N>
+int*
+matrix_scratch<E, N>::indices(int count)
+{
+  if(count <= 3 * N) return this->m_indices;
+  return this->m_workspace->indices(count);
+}
+
+} // namespace detail
+} // namespace cml
@@ -141,6 +141,8 @@ class writable_matrix : public readable_matrix<DerivedT>
    *
    * @throws non_square_matrix_error at run-time if the matrix is
    * dynamically sized and not square.
+   *
+   * @note Singularity is not detected; use try_inverse() to test for it.
    */
   DerivedT& inverse() &;
 
@@ -154,8 +156,9 @@ class writable_matrix : public readable_matrix<DerivedT>
   /** Set the matrix to its transpose.
    *
    * @note This will raise a compile time error if the matrix is
-   * fixed-size and non-square.  Dynamic-size matrices will be assigned
-   * from a temporary.
+   * fixed-size and non-square.  Square dynamic-size matrices are
+   * transposed in place a tile at a time; others are assigned from a
+   * temporary.
    */
   DerivedT& transpose() &;
 
@@ -7,6 +7,7 @@
 #endif
 
 #include <random>
+#include <cml/common/instrument.h>
 #include <cml/scalar/binary_ops.h>
 #include <cml/vector/readable_vector.h>
 #include <cml/matrix/detail/check_or_resize.h>
@@ -415,8 +416,10 @@ template<class ODT>
 DT&
 writable_matrix<DT>::assign(const readable_matrix<ODT>& other)
 {
+  detail::instrument_scope scope("matrix_assign");
   detail::check_or_resize(*this, other);
   detail::copy(*this, other, layout_tag());
+  detail::instrument_evaluation("matrix_assign", this->rows() * this->cols());
   return this->actual();
 }
 
@@ -14,4 +14,5 @@
 #include <cml/quaternion/inverse.h>
 #include <cml/quaternion/functions.h>
 #include <cml/quaternion/types.h>
+#include <cml/quaternion/dual_quaternion.h>
 #include <cml/util/quaternion_print.h>
@@ -4,7 +4,11 @@
 
 #pragma once
 
+#include <cstdint>
+#include <cml/scalar/promotion.h>
+#include <cml/storage/compiled_selector.h>
 #include <cml/quaternion/readable_quaternion.h>
+#include <cml/quaternion/quaternion.h>
 
 namespace cml {
 /** Returns true if @c left is lexicographically less than @c right. */
@@ -44,6 +48,49 @@ bool operator==(const readable_quaternion<Sub1>& left,
 template<class Sub1, class Sub2>
 bool operator!=(const readable_quaternion<Sub1>& left,
   const readable_quaternion<Sub2>& right);
+
+/** Returns true if each pair of elements of @c left and @c right is
+ * approx_equal() with tolerances @c abs_tol and @c rel_tol.  Fixed-size
+ * quaternions of the same type are compared without branches.
+ */
+template<class Sub1, class Sub2>
+bool approx_equal(const readable_quaternion<Sub1>& left,
+  const readable_quaternion<Sub2>& right,
+  value_type_trait_promote_t<Sub1, Sub2> abs_tol,
+  value_type_trait_promote_t<Sub1, Sub2> rel_tol = 0);
+
+/** Returns true if each pair of elements of @c left and @c right is at
+ * most @c max_ulps apart, as measured by ulp_distance().
+ */
+template<class Sub1, class Sub2>
+bool approx_equal_ulps(const readable_quaternion<Sub1>& left,
+  const readable_quaternion<Sub2>& right, std::int64_t max_ulps);
+
+/** Returns true if @c left and @c right represent approximately the same
+ * rotation, that is, if @c left is approx_equal() to either @c right or
+ * -@c right.
+ */
+template<class Sub1, class Sub2>
+bool approx_equal_rotation(const readable_quaternion<Sub1>& left,
+  const readable_quaternion<Sub2>& right,
+  value_type_trait_promote_t<Sub1, Sub2> abs_tol,
+  value_type_trait_promote_t<Sub1, Sub2> rel_tol = 0);
+
+/** Return the index of the first of the @c n quaternions in @c items that
+ * is approx_equal() to @c key, or -1 if there is none.
+ */
+template<class E, class Order, class Cross>
+int find_approx_equal(const quaternion<E, fixed<>, Order, Cross>* items,
+  int n, const quaternion<E, fixed<>, Order, Cross>& key, E abs_tol,
+  E rel_tol = E(0));
+
+/** Returns true if each of the @c n pairs @c left[k] and @c right[k] is
+ * approx_equal(), stopping at the first pair that is not.
+ */
+template<class E, class Order, class Cross>
+bool all_approx_equal(const quaternion<E, fixed<>, Order, Cross>* left,
+  const quaternion<E, fixed<>, Order, Cross>* right, int n, E abs_tol,
+  E rel_tol = E(0));
 } // namespace cml
 
 #define __CML_QUATERNION_COMPARISON_TPP
@@ -7,8 +7,42 @@
 #endif
 
 #include <type_traits>
+#include <cml/scalar/functions.h>
 
 namespace cml {
+namespace detail {
+
+/* Early-exit element-wise comparison of @c left and @c s*right for
+ * arbitrary quaternions:
+ */
+template<class Sub1, class Sub2, class E>
+inline bool
+quaternion_approx_equal(const readable_quaternion<Sub1>& left,
+  const readable_quaternion<Sub2>& right, E abs_tol, E rel_tol, E s)
+{
+  static_assert(
+    std::is_same<order_type_trait_of_t<Sub1>,
+      order_type_trait_of_t<Sub2>>::value,
+    "cannot compare quaternions with different orders");
+  for(int i = 0; i < 4; ++i)
+    if(!cml::approx_equal(E(left[i]), s * E(right[i]), abs_tol, rel_tol))
+      return false;
+  return true;
+}
+
+/* Branch-free comparison of fixed-size quaternions of the same type: */
+template<class E, class Order, class Cross>
+inline bool
+quaternion_approx_equal(const quaternion<E, fixed<>, Order, Cross>& left,
+  const quaternion<E, fixed<>, Order, Cross>& right, E abs_tol, E rel_tol,
+  E s)
+{
+  return detail::approx_equal_n<4>(left.data(), right.data(), abs_tol,
+    rel_tol, s);
+}
+
+} // namespace detail
+
 template<class Sub1, class Sub2>
 bool
 operator<(const readable_quaternion<Sub1>& left,
@@ -89,4 +123,72 @@ operator!=(const readable_quaternion<Sub1>& left,
 {
   return !(left == right);
 }
+
+template<class Sub1, class Sub2>
+bool
+approx_equal(const readable_quaternion<Sub1>& left,
+  const readable_quaternion<Sub2>& right,
+  value_type_trait_promote_t<Sub1, Sub2> abs_tol,
+  value_type_trait_promote_t<Sub1, Sub2> rel_tol)
+{
+  using value_type = value_type_trait_promote_t<Sub1, Sub2>;
+  return detail::quaternion_approx_equal(left.actual(), right.actual(),
+    abs_tol, rel_tol, value_type(1));
+}
+
+template<class Sub1, class Sub2>
+bool
+approx_equal_ulps(const readable_quaternion<Sub1>& left,
+  const readable_quaternion<Sub2>& right, std::int64_t max_ulps)
+{
+  static_assert(
+    std::is_same<order_type_trait_of_t<Sub1>,
+      order_type_trait_of_t<Sub2>>::value,
+    "cannot compare quaternions with different orders");
+  using value_type = value_type_trait_promote_t<Sub1, Sub2>;
+  for(int i = 0; i < 4; ++i)
+    if(cml::ulp_distance(value_type(left[i]), value_type(right[i]))
+      > max_ulps)
+      return false;
+  return true;
+}
+
+template<class Sub1, class Sub2>
+bool
+approx_equal_rotation(const readable_quaternion<Sub1>& left,
+  const readable_quaternion<Sub2>& right,
+  value_type_trait_promote_t<Sub1, Sub2> abs_tol,
+  value_type_trait_promote_t<Sub1, Sub2> rel_tol)
+{
+  using value_type = value_type_trait_promote_t<Sub1, Sub2>;
+  return detail::quaternion_approx_equal(left.actual(), right.actual(),
+           abs_tol, rel_tol, value_type(1))
+    || detail::quaternion_approx_equal(left.actual(), right.actual(), abs_tol,
+      rel_tol, value_type(-1));
+}
+
+template<class E, class Order, class Cross>
+int
+find_approx_equal(const quaternion<E, fixed<>, Order, Cross>* items, int n,
+  const quaternion<E, fixed<>, Order, Cross>& key, E abs_tol, E rel_tol)
+{
+  for(int k = 0; k < n; ++k)
+    if(detail::approx_equal_n<4>(items[k].data(), key.data(), abs_tol,
+         rel_tol))
+      return k;
+  return -1;
+}
+
+template<class E, class Order, class Cross>
+bool
+all_approx_equal(const quaternion<E, fixed<>, Order, Cross>* left,
+  const quaternion<E, fixed<>, Order, Cross>* right, int n, E abs_tol,
+  E rel_tol)
+{
+  for(int k = 0; k < n; ++k)
+    if(!detail::approx_equal_n<4>(left[k].data(), right[k].data(), abs_tol,
+         rel_tol))
+      return false;
+  return true;
+}
 } // namespace cml
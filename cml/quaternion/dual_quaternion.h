@@ -0,0 +1,283 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cml/vector/fixed.h>
+#include <cml/quaternion/fixed.h>
+#include <cml/quaternion/ops.h>
+#include <cml/quaternion/product.h>
+#include <cml/quaternion/dot.h>
+#include <cml/quaternion/conjugate.h>
+#include <cml/quaternion/functions.h>
+
+namespace cml {
+
+/** A dual quaternion, q = r + e*d, representing a rigid (rotation plus
+ * translation) transformation.  The real part, r, is a unit rotation
+ * quaternion, and the dual part is d = (1/2)*t*r, where t is the pure
+ * translation quaternion (0,t).
+ *
+ * The real and dual parts are stored as two quaternions of the same type,
+ * so the product, conjugate, and normalization operations reuse the
+ * quaternion module's order and cross-type conventions.  In particular,
+ * the product of two dual quaternions composes their transformations in
+ * the same order as the product of the underlying rotation quaternions.
+ *
+ * @tparam Element The scalar type for the dual quaternion elements.
+ *
+ * @tparam ArrayType Storage type for the real and dual quaternions.
+ *
+ * @tparam Order Element order of the real and dual quaternions.
+ *
+ * @tparam Cross Cross type of the real and dual quaternions.
+ */
+template<typename Element, class ArrayType = fixed<>,
+  class Order = imaginary_first, class Cross = positive_cross>
+class dual_quaternion
+{
+  public:
+  using dual_quaternion_type = dual_quaternion<Element, ArrayType, Order,
+    Cross>;
+  using quaternion_type = quaternion<Element, ArrayType, Order, Cross>;
+  using value_type = value_type_trait_of_t<quaternion_type>;
+  using vector_type = vector<value_type, compiled<3>>;
+  using order_type = Order;
+  using cross_type = Cross;
+
+
+  public:
+  /** Compiler-default constructor.
+   *
+   * @note The dual quaternion elements are uninitialized.
+   */
+  dual_quaternion() = default;
+
+  /** Construct from the real and dual quaternions. */
+  template<class Sub1, class Sub2>
+  dual_quaternion(const readable_quaternion<Sub1>& real,
+    const readable_quaternion<Sub2>& dual);
+
+  /** Construct the rigid transformation that first rotates by @c
+   * rotation, then translates by @c translation.
+   *
+   * @note @c rotation is assumed to be a unit quaternion.
+   *
+   * @throws vector_size_error at run-time if @c translation is
+   * dynamically-sized, and is not 3D.  If @c translation is fixed-size,
+   * the size is checked at compile-time.
+   */
+  template<class QSub, class VSub>
+  dual_quaternion(const readable_quaternion<QSub>& rotation,
+    const readable_vector<VSub>& translation);
+
+
+  public:
+  /** Return a const reference to the real (rotation) part. */
+  const quaternion_type& real() const;
+
+  /** Return a mutable reference to the real (rotation) part. */
+  quaternion_type& real();
+
+  /** Return a const reference to the dual part. */
+  const quaternion_type& dual() const;
+
+  /** Return a mutable reference to the dual part. */
+  quaternion_type& dual();
+
+  /** Return the translation encoded by the dual quaternion, t =
+   * 2*d*conjugate(r).
+   *
+   * @note The dual quaternion is assumed to be normalized.
+   */
+  vector_type translation() const;
+
+  /** Return the length of the real part. */
+  value_type length() const;
+
+
+  public:
+  /** Set the real and dual parts. */
+  template<class Sub1, class Sub2>
+  dual_quaternion_type& set(const readable_quaternion<Sub1>& real,
+    const readable_quaternion<Sub2>& dual);
+
+  /** Set the dual quaternion to the rigid transformation that first
+   * rotates by @c rotation, then translates by @c translation.
+   *
+   * @note @c rotation is assumed to be a unit quaternion.
+   *
+   * @throws vector_size_error at run-time if @c translation is
+   * dynamically-sized, and is not 3D.  If @c translation is fixed-size,
+   * the size is checked at compile-time.
+   */
+  template<class QSub, class VSub>
+  dual_quaternion_type& set_rigid(const readable_quaternion<QSub>& rotation,
+    const readable_vector<VSub>& translation);
+
+  /** Set the dual quaternion to the identity transformation. */
+  dual_quaternion_type& identity();
+
+  /** Set the dual quaternion to its quaternion conjugate, (r*, d*).  For a
+   * unit dual quaternion, this is the inverse transformation.
+   */
+  dual_quaternion_type& conjugate();
+
+  /** Normalize the dual quaternion so that the real part has unit length
+   * and is orthogonal to the dual part.
+   */
+  dual_quaternion_type& normalize();
+
+
+  public:
+  /** Set the dual quaternion to the product of itself and @c other. */
+  dual_quaternion_type& operator*=(const dual_quaternion_type& other);
+
+  /** Add @c other to the dual quaternion element-wise. */
+  dual_quaternion_type& operator+=(const dual_quaternion_type& other);
+
+  /** Subtract @c other from the dual quaternion element-wise. */
+  dual_quaternion_type& operator-=(const dual_quaternion_type& other);
+
+  /** Scale the real and dual parts by @c s. */
+  dual_quaternion_type& operator*=(const value_type& s);
+
+
+  protected:
+  /** The real (rotation) part. */
+  quaternion_type m_real;
+
+  /** The dual (translation) part. */
+  quaternion_type m_dual;
+};
+
+
+/** @defgroup dual_quaternion_types Predefined Dual Quaternion Types */
+/*@{*/
+
+using dual_quaternionf = dual_quaternion<float>;
+using dual_quaterniond = dual_quaternion<double>;
+
+using dual_quaternionf_rp = dual_quaternion<float, fixed<>, real_first,
+  positive_cross>;
+using dual_quaterniond_rp = dual_quaternion<double, fixed<>, real_first,
+  positive_cross>;
+
+/*@}*/
+
+
+/** @defgroup dual_quaternion_functions Dual Quaternion Functions */
+/*@{*/
+
+/** Return the product of @c left and @c right, composing the
+ * transformations with the same convention as the product of their
+ * rotation quaternions.
+ */
+template<class E, class S, class O, class C>
+auto operator*(const dual_quaternion<E, S, O, C>& left,
+  const dual_quaternion<E, S, O, C>& right) -> dual_quaternion<E, S, O, C>;
+
+/** Return the element-wise sum of @c left and @c right. */
+template<class E, class S, class O, class C>
+auto operator+(const dual_quaternion<E, S, O, C>& left,
+  const dual_quaternion<E, S, O, C>& right) -> dual_quaternion<E, S, O, C>;
+
+/** Return the element-wise difference of @c left and @c right. */
+template<class E, class S, class O, class C>
+auto operator-(const dual_quaternion<E, S, O, C>& left,
+  const dual_quaternion<E, S, O, C>& right) -> dual_quaternion<E, S, O, C>;
+
+/** Return @c dq scaled by @c s. */
+template<class E, class S, class O, class C>
+auto operator*(const dual_quaternion<E, S, O, C>& dq, const E& s)
+  -> dual_quaternion<E, S, O, C>;
+
+/** Return @c dq scaled by @c s. */
+template<class E, class S, class O, class C>
+auto operator*(const E& s, const dual_quaternion<E, S, O, C>& dq)
+  -> dual_quaternion<E, S, O, C>;
+
+/** Return the quaternion conjugate (r*, d*) of @c dq. */
+template<class E, class S, class O, class C>
+auto conjugate(const dual_quaternion<E, S, O, C>& dq)
+  -> dual_quaternion<E, S, O, C>;
+
+/** Return a normalized copy of @c dq. */
+template<class E, class S, class O, class C>
+auto normalize(const dual_quaternion<E, S, O, C>& dq)
+  -> dual_quaternion<E, S, O, C>;
+
+/** Return the dot product of the real parts of @c left and @c right. */
+template<class E, class S, class O, class C>
+auto dot(const dual_quaternion<E, S, O, C>& left,
+  const dual_quaternion<E, S, O, C>& right) -> E;
+
+/** Transform the 3D point @c p by the unit dual quaternion @c dq.
+ *
+ * @throws vector_size_error at run-time if @c p is dynamically-sized, and
+ * is not 3D.  If @c p is fixed-size, the size is checked at compile-time.
+ */
+template<class E, class S, class O, class C, class Sub>
+auto transform_point(const dual_quaternion<E, S, O, C>& dq,
+  const readable_vector<Sub>& p) -> vector<E, compiled<3>>;
+
+/** Rotate the 3D vector @c v by the unit dual quaternion @c dq, ignoring
+ * the translation.
+ *
+ * @throws vector_size_error at run-time if @c v is dynamically-sized, and
+ * is not 3D.  If @c v is fixed-size, the size is checked at compile-time.
+ */
+template<class E, class S, class O, class C, class Sub>
+auto transform_vector(const dual_quaternion<E, S, O, C>& dq,
+  const readable_vector<Sub>& v) -> vector<E, compiled<3>>;
+
+/** Screw linear interpolation between the unit dual quaternions @c dq0
+ * and @c dq1 by @c t in [0,1].  The shortest path is taken.
+ *
+ * @note A pure translation (or a rotation angle below the square root of
+ * the scalar epsilon) is interpolated linearly.
+ */
+template<class E, class S, class O, class C, class Scalar>
+auto sclerp(const dual_quaternion<E, S, O, C>& dq0,
+  const dual_quaternion<E, S, O, C>& dq1, const Scalar& t)
+  -> dual_quaternion<E, S, O, C>;
+
+/** Dual quaternion linear blending (DLB) of @c n unit dual quaternions
+ * @c dqs with weights @c weights.  Each dual quaternion is sign-aligned
+ * with the first before blending, and the result is normalized.
+ */
+template<class E, class S, class O, class C, class Scalar>
+auto dual_quaternion_blend(const dual_quaternion<E, S, O, C>* dqs,
+  const Scalar* weights, int n) -> dual_quaternion<E, S, O, C>;
+
+/** Transform @c count points from @c in to @c out by the unit dual
+ * quaternion @c dq.  @c in and @c out may alias.  Point types must
+ * provide operator[] for indices 0, 1 and 2.
+ *
+ * @note The rotation is expanded once into a 3x3 matrix, so the
+ * per-point loop is a straight-line sequence of multiply-adds that the
+ * compiler can vectorize.
+ */
+template<class E, class S, class O, class C, class PointIn, class PointOut>
+void dual_quaternion_transform_points(const dual_quaternion<E, S, O, C>& dq,
+  const PointIn* in, PointOut* out, int count);
+
+/** Skin @c count points from @c in to @c out using dual quaternion linear
+ * blending of @c bones.  For point @c k, the bone indices and weights are
+ * @c indices[k*influences + i] and @c weights[k*influences + i], for @c i
+ * in [0,influences).  @c in and @c out may alias.
+ */
+template<class E, class S, class O, class C, class Scalar, class PointIn,
+  class PointOut>
+void dual_quaternion_blend_points(const dual_quaternion<E, S, O, C>* bones,
+  const int* indices, const Scalar* weights, int influences,
+  const PointIn* in, PointOut* out, int count);
+
+/*@}*/
+
+} // namespace cml
+
+#define __CML_QUATERNION_DUAL_QUATERNION_TPP
+#include <cml/quaternion/dual_quaternion.tpp>
+#undef __CML_QUATERNION_DUAL_QUATERNION_TPP
@@ -0,0 +1,522 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#ifndef __CML_QUATERNION_DUAL_QUATERNION_TPP
+#  error "quaternion/dual_quaternion.tpp not included correctly"
+#endif
+
+#include <cml/common/exception.h>
+#include <cml/scalar/functions.h>
+#include <cml/vector/size_checking.h>
+
+namespace cml {
+namespace detail {
+
+/* Set the dual part of @c dq to (1/2)*t*r for translation (t0,t1,t2),
+ * using the Hamilton product so the encoding does not depend on the
+ * quaternion cross type.
+ */
+template<class DQ, class T>
+inline void
+dual_quaternion_encode_translation(DQ& dq, const T& t0, const T& t1,
+  const T& t2)
+{
+  using value_type = typename DQ::value_type;
+  using order_type = typename DQ::order_type;
+  enum
+  {
+    W = order_type::W,
+    X = order_type::X,
+    Y = order_type::Y,
+    Z = order_type::Z
+  };
+
+  const auto& r = dq.real();
+  auto& d = dq.dual();
+  const value_type half(value_type(1) / value_type(2));
+  const value_type tx = half * value_type(t0);
+  const value_type ty = half * value_type(t1);
+  const value_type tz = half * value_type(t2);
+  d[W] = -(tx * r[X] + ty * r[Y] + tz * r[Z]);
+  d[X] = tx * r[W] + ty * r[Z] - tz * r[Y];
+  d[Y] = ty * r[W] + tz * r[X] - tx * r[Z];
+  d[Z] = tz * r[W] + tx * r[Y] - ty * r[X];
+}
+
+/* Compute the translation t = 2*d*conjugate(r) of @c dq into t[0..2]. */
+template<class DQ, class T>
+inline void
+dual_quaternion_decode_translation(const DQ& dq, T& t0, T& t1, T& t2)
+{
+  using value_type = typename DQ::value_type;
+  using order_type = typename DQ::order_type;
+  enum
+  {
+    W = order_type::W,
+    X = order_type::X,
+    Y = order_type::Y,
+    Z = order_type::Z
+  };
+
+  const auto& r = dq.real();
+  const auto& d = dq.dual();
+  const value_type two(2);
+  t0 = T(two * (r[W] * d[X] - d[W] * r[X] + r[Y] * d[Z] - r[Z] * d[Y]));
+  t1 = T(two * (r[W] * d[Y] - d[W] * r[Y] + r[Z] * d[X] - r[X] * d[Z]));
+  t2 = T(two * (r[W] * d[Z] - d[W] * r[Z] + r[X] * d[Y] - r[Y] * d[X]));
+}
+
+/* Expand the unit rotation and translation of @c dq into the row-major
+ * 3x3 rotation @c R and translation @c t, such that p' = R*p + t.
+ */
+template<class DQ, class T>
+inline void
+dual_quaternion_expand(const DQ& dq, T (&R)[9], T (&t)[3])
+{
+  using order_type = typename DQ::order_type;
+  enum
+  {
+    W = order_type::W,
+    X = order_type::X,
+    Y = order_type::Y,
+    Z = order_type::Z
+  };
+
+  const auto& r = dq.real();
+  const T x2 = T(r[X] + r[X]), y2 = T(r[Y] + r[Y]), z2 = T(r[Z] + r[Z]);
+  const T xx2 = T(r[X]) * x2, yy2 = T(r[Y]) * y2, zz2 = T(r[Z]) * z2;
+  const T xy2 = T(r[X]) * y2, yz2 = T(r[Y]) * z2, zx2 = T(r[Z]) * x2;
+  const T xw2 = T(r[W]) * x2, yw2 = T(r[W]) * y2, zw2 = T(r[W]) * z2;
+
+  R[0] = T(1) - yy2 - zz2;
+  R[1] = xy2 - zw2;
+  R[2] = zx2 + yw2;
+  R[3] = xy2 + zw2;
+  R[4] = T(1) - zz2 - xx2;
+  R[5] = yz2 - xw2;
+  R[6] = zx2 - yw2;
+  R[7] = yz2 + xw2;
+  R[8] = T(1) - xx2 - yy2;
+
+  dual_quaternion_decode_translation(dq, t[0], t[1], t[2]);
+}
+
+/* Apply the expanded transformation (R,t) to the points in [in,in+count). */
+template<class T, class PointIn, class PointOut>
+inline void
+dual_quaternion_apply(const T (&R)[9], const T (&t)[3], const PointIn* in,
+  PointOut* out, int count)
+{
+  for(int k = 0; k < count; ++k) {
+    const T x = T(in[k][0]), y = T(in[k][1]), z = T(in[k][2]);
+    out[k][0] = R[0] * x + R[1] * y + R[2] * z + t[0];
+    out[k][1] = R[3] * x + R[4] * y + R[5] * z + t[1];
+    out[k][2] = R[6] * x + R[7] * y + R[8] * z + t[2];
+  }
+}
+
+} // namespace detail
+
+
+/* dual_quaternion: */
+
+template<class E, class S, class O, class C>
+template<class Sub1, class Sub2>
+dual_quaternion<E, S, O, C>::dual_quaternion(
+  const readable_quaternion<Sub1>& real, const readable_quaternion<Sub2>& dual)
+  : m_real(real)
+    , m_dual(dual)
+{
+}
+
+template<class E, class S, class O, class C>
+template<class QSub, class VSub>
+dual_quaternion<E, S, O, C>::dual_quaternion(
+  const readable_quaternion<QSub>& rotation,
+  const readable_vector<VSub>& translation)
+{
+  this->set_rigid(rotation, translation);
+}
+
+template<class E, class S, class O, class C>
+auto
+dual_quaternion<E, S, O, C>::real() const -> const quaternion_type&
+{
+  return this->m_real;
+}
+
+template<class E, class S, class O, class C>
+auto
+dual_quaternion<E, S, O, C>::real() -> quaternion_type&
+{
+  return this->m_real;
+}
+
+template<class E, class S, class O, class C>
+auto
+dual_quaternion<E, S, O, C>::dual() const -> const quaternion_type&
+{
+  return this->m_dual;
+}
+
+template<class E, class S, class O, class C>
+auto
+dual_quaternion<E, S, O, C>::dual() -> quaternion_type&
+{
+  return this->m_dual;
+}
+
+template<class E, class S, class O, class C>
+auto
+dual_quaternion<E, S, O, C>::translation() const -> vector_type
+{
+  vector_type t;
+  detail::dual_quaternion_decode_translation(*this, t[0], t[1], t[2]);
+  return t;
+}
+
+template<class E, class S, class O, class C>
+auto
+dual_quaternion<E, S, O, C>::length() const -> value_type
+{
+  return this->m_real.length();
+}
+
+template<class E, class S, class O, class C>
+template<class Sub1, class Sub2>
+auto
+dual_quaternion<E, S, O, C>::set(const readable_quaternion<Sub1>& real,
+  const readable_quaternion<Sub2>& dual) -> dual_quaternion_type&
+{
+  this->m_real = real;
+  this->m_dual = dual;
+  return *this;
+}
+
+template<class E, class S, class O, class C>
+template<class QSub, class VSub>
+auto
+dual_quaternion<E, S, O, C>::set_rigid(
+  const readable_quaternion<QSub>& rotation,
+  const readable_vector<VSub>& translation) -> dual_quaternion_type&
+{
+  cml::check_size(translation, int_c<3>());
+  this->m_real = rotation;
+  detail::dual_quaternion_encode_translation(*this, translation[0],
+    translation[1], translation[2]);
+  return *this;
+}
+
+template<class E, class S, class O, class C>
+auto
+dual_quaternion<E, S, O, C>::identity() -> dual_quaternion_type&
+{
+  this->m_real.identity();
+  this->m_dual.zero();
+  return *this;
+}
+
+template<class E, class S, class O, class C>
+auto
+dual_quaternion<E, S, O, C>::conjugate() -> dual_quaternion_type&
+{
+  this->m_real.conjugate();
+  this->m_dual.conjugate();
+  return *this;
+}
+
+template<class E, class S, class O, class C>
+auto
+dual_quaternion<E, S, O, C>::normalize() -> dual_quaternion_type&
+{
+  const value_type inv_length = value_type(1) / this->m_real.length();
+  this->m_real *= inv_length;
+  this->m_dual *= inv_length;
+
+  /* Remove the component of the dual part along the real part: */
+  const value_type rd = cml::dot(this->m_real, this->m_dual);
+  this->m_dual -= rd * this->m_real;
+  return *this;
+}
+
+template<class E, class S, class O, class C>
+auto
+dual_quaternion<E, S, O, C>::operator*=(const dual_quaternion_type& other)
+  -> dual_quaternion_type&
+{
+  quaternion_type dual = this->m_real * other.m_dual
+    + this->m_dual * other.m_real;
+  this->m_real *= other.m_real;
+  this->m_dual = dual;
+  return *this;
+}
+
+template<class E, class S, class O, class C>
+auto
+dual_quaternion<E, S, O, C>::operator+=(const dual_quaternion_type& other)
+  -> dual_quaternion_type&
+{
+  this->m_real += other.m_real;
+  this->m_dual += other.m_dual;
+  return *this;
+}
+
+template<class E, class S, class O, class C>
+auto
+dual_quaternion<E, S, O, C>::operator-=(const dual_quaternion_type& other)
+  -> dual_quaternion_type&
+{
+  this->m_real -= other.m_real;
+  this->m_dual -= other.m_dual;
+  return *this;
+}
+
+template<class E, class S, class O, class C>
+auto
+dual_quaternion<E, S, O, C>::operator*=(const value_type& s)
+  -> dual_quaternion_type&
+{
+  this->m_real *= s;
+  this->m_dual *= s;
+  return *this;
+}
+
+
+/* Functions: */
+
+template<class E, class S, class O, class C>
+auto
+operator*(const dual_quaternion<E, S, O, C>& left,
+  const dual_quaternion<E, S, O, C>& right) -> dual_quaternion<E, S, O, C>
+{
+  dual_quaternion<E, S, O, C> result(left);
+  result *= right;
+  return result;
+}
+
+template<class E, class S, class O, class C>
+auto
+operator+(const dual_quaternion<E, S, O, C>& left,
+  const dual_quaternion<E, S, O, C>& right) -> dual_quaternion<E, S, O, C>
+{
+  dual_quaternion<E, S, O, C> result(left);
+  result += right;
+  return result;
+}
+
+template<class E, class S, class O, class C>
+auto
+operator-(const dual_quaternion<E, S, O, C>& left,
+  const dual_quaternion<E, S, O, C>& right) -> dual_quaternion<E, S, O, C>
+{
+  dual_quaternion<E, S, O, C> result(left);
+  result -= right;
+  return result;
+}
+
+template<class E, class S, class O, class C>
+auto
+operator*(const dual_quaternion<E, S, O, C>& dq, const E& s)
+  -> dual_quaternion<E, S, O, C>
+{
+  dual_quaternion<E, S, O, C> result(dq);
+  result *= s;
+  return result;
+}
+
+template<class E, class S, class O, class C>
+auto
+operator*(const E& s, const dual_quaternion<E, S, O, C>& dq)
+  -> dual_quaternion<E, S, O, C>
+{
+  return dq * s;
+}
+
+template<class E, class S, class O, class C>
+auto
+conjugate(const dual_quaternion<E, S, O, C>& dq)
+  -> dual_quaternion<E, S, O, C>
+{
+  dual_quaternion<E, S, O, C> result(dq);
+  result.conjugate();
+  return result;
+}
+
+template<class E, class S, class O, class C>
+auto
+normalize(const dual_quaternion<E, S, O, C>& dq)
+  -> dual_quaternion<E, S, O, C>
+{
+  dual_quaternion<E, S, O, C> result(dq);
+  result.normalize();
+  return result;
+}
+
+template<class E, class S, class O, class C>
+auto
+dot(const dual_quaternion<E, S, O, C>& left,
+  const dual_quaternion<E, S, O, C>& right) -> E
+{
+  return cml::dot(left.real(), right.real());
+}
+
+template<class E, class S, class O, class C, class Sub>
+auto
+transform_point(const dual_quaternion<E, S, O, C>& dq,
+  const readable_vector<Sub>& p) -> vector<E, compiled<3>>
+{
+  cml::check_size(p, int_c<3>());
+  vector<E, compiled<3>> result = transform_vector(dq, p);
+  return result + dq.translation();
+}
+
+template<class E, class S, class O, class C, class Sub>
+auto
+transform_vector(const dual_quaternion<E, S, O, C>& dq,
+  const readable_vector<Sub>& v) -> vector<E, compiled<3>>
+{
+  using order_type = O;
+  enum
+  {
+    W = order_type::W,
+    X = order_type::X,
+    Y = order_type::Y,
+    Z = order_type::Z
+  };
+
+  cml::check_size(v, int_c<3>());
+
+  /* v' = v + 2*w*(q x v) + 2*q x (q x v), for the imaginary part q: */
+  const auto& r = dq.real();
+  const E w = r[W], x = r[X], y = r[Y], z = r[Z];
+  const E u0 = E(2) * (y * v[2] - z * v[1]);
+  const E u1 = E(2) * (z * v[0] - x * v[2]);
+  const E u2 = E(2) * (x * v[1] - y * v[0]);
+  return vector<E, compiled<3>>(v[0] + w * u0 + (y * u2 - z * u1),
+    v[1] + w * u1 + (z * u0 - x * u2), v[2] + w * u2 + (x * u1 - y * u0));
+}
+
+template<class E, class S, class O, class C, class Scalar>
+auto
+sclerp(const dual_quaternion<E, S, O, C>& dq0,
+  const dual_quaternion<E, S, O, C>& dq1, const Scalar& t)
+  -> dual_quaternion<E, S, O, C>
+{
+  using dual_quaternion_type = dual_quaternion<E, S, O, C>;
+  using quaternion_type = typename dual_quaternion_type::quaternion_type;
+  using element_traits = scalar_traits<E>;
+  using order_type = O;
+  enum
+  {
+    W = order_type::W,
+    X = order_type::X,
+    Y = order_type::Y,
+    Z = order_type::Z
+  };
+
+  /* Take the shortest path: */
+  dual_quaternion_type target(dq1);
+  if(cml::dot(dq0, dq1) < E(0)) target *= E(-1);
+
+  /* The relative transformation, dq0^-1 * dq1: */
+  dual_quaternion_type delta = cml::conjugate(dq0) * target;
+  const quaternion_type& r = delta.real();
+  const quaternion_type& d = delta.dual();
+
+  const E s = element_traits::sqrt(r[X] * r[X] + r[Y] * r[Y] + r[Z] * r[Z]);
+  dual_quaternion_type power;
+  if(s < element_traits::sqrt_epsilon()) {
+    /* Pure translation, so scale the dual part linearly: */
+    power.real().identity();
+    power.dual() = E(t) * d;
+  } else {
+    /* Screw parameters: angle theta, pitch p, axis l, and moment m: */
+    const E inv_s = E(1) / s;
+    const E theta = E(2) * element_traits::atan2(s, r[W]);
+    const E pitch = E(-2) * d[W] * inv_s;
+    const E l[3] = {r[X] * inv_s, r[Y] * inv_s, r[Z] * inv_s};
+    const E half_pitch_cos = E(.5) * pitch * r[W];
+    const E m[3] = {(d[X] - l[0] * half_pitch_cos) * inv_s,
+      (d[Y] - l[1] * half_pitch_cos) * inv_s,
+      (d[Z] - l[2] * half_pitch_cos) * inv_s};
+
+    /* Scale the angle and pitch by t: */
+    const E half_theta = E(.5) * E(t) * theta;
+    const E half_pitch = E(.5) * E(t) * pitch;
+    const E sin_t = element_traits::sin(half_theta);
+    const E cos_t = element_traits::cos(half_theta);
+
+    quaternion_type& pr = power.real();
+    quaternion_type& pd = power.dual();
+    pr[W] = cos_t;
+    pr[X] = sin_t * l[0];
+    pr[Y] = sin_t * l[1];
+    pr[Z] = sin_t * l[2];
+    pd[W] = -half_pitch * sin_t;
+    pd[X] = sin_t * m[0] + half_pitch * cos_t * l[0];
+    pd[Y] = sin_t * m[1] + half_pitch * cos_t * l[1];
+    pd[Z] = sin_t * m[2] + half_pitch * cos_t * l[2];
+  }
+
+  return dq0 * power;
+}
+
+template<class E, class S, class O, class C, class Scalar>
+auto
+dual_quaternion_blend(const dual_quaternion<E, S, O, C>* dqs,
+  const Scalar* weights, int n) -> dual_quaternion<E, S, O, C>
+{
+  cml_require(n > 0, std::invalid_argument, "n must be positive");
+  dual_quaternion<E, S, O, C> result = E(weights[0]) * dqs[0];
+  for(int i = 1; i < n; ++i) {
+    const E w = (cml::dot(dqs[0], dqs[i]) < E(0)) ? -E(weights[i])
+                                                   : E(weights[i]);
+    result += w * dqs[i];
+  }
+  return result.normalize();
+}
+
+template<class E, class S, class O, class C, class PointIn, class PointOut>
+void
+dual_quaternion_transform_points(const dual_quaternion<E, S, O, C>& dq,
+  const PointIn* in, PointOut* out, int count)
+{
+  E R[9], t[3];
+  detail::dual_quaternion_expand(dq, R, t);
+  detail::dual_quaternion_apply(R, t, in, out, count);
+}
+
+template<class E, class S, class O, class C, class Scalar, class PointIn,
+  class PointOut>
+void
+dual_quaternion_blend_points(const dual_quaternion<E, S, O, C>* bones,
+  const int* indices, const Scalar* weights, int influences,
+  const PointIn* in, PointOut* out, int count)
+{
+  using dual_quaternion_type = dual_quaternion<E, S, O, C>;
+  cml_require(influences > 0, std::invalid_argument,
+    "influences must be positive");
+
+  for(int k = 0; k < count; ++k) {
+    const int* index = indices + k * influences;
+    const Scalar* weight = weights + k * influences;
+
+    /* Blend the bones influencing this point, sign-aligned to the first: */
+    const dual_quaternion_type& pivot = bones[index[0]];
+    dual_quaternion_type blend = E(weight[0]) * pivot;
+    for(int i = 1; i < influences; ++i) {
+      const dual_quaternion_type& bone = bones[index[i]];
+      const E w = (cml::dot(pivot, bone) < E(0)) ? -E(weight[i])
+                                                  : E(weight[i]);
+      blend += w * bone;
+    }
+    blend.normalize();
+
+    E R[9], t[3];
+    detail::dual_quaternion_expand(blend, R, t);
+    detail::dual_quaternion_apply(R, t, in + k, out + k, 1);
+  }
+}
+
+} // namespace cml
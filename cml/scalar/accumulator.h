@@ -0,0 +1,36 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+/** The type used to accumulate sums of float products in dot(), length(),
+ * the matrix products, and LU.  Define as double before including any CML
+ * header to keep float storage while summing in double precision.
+ */
+#ifndef CML_FLOAT_ACCUMULATOR
+#  define CML_FLOAT_ACCUMULATOR float
+#endif
+
+namespace cml {
+/** Specializable class determining the type used to accumulate sums of
+ * products of @c Scalar values.  The result of the sum is converted back
+ * to @c Scalar.  By default, this is @c Scalar itself.
+ */
+template<class Scalar, class Enable = void> struct accumulator_of
+{
+  using type = Scalar;
+};
+
+/** Specialization of accumulator_of for float, using CML_FLOAT_ACCUMULATOR
+ * (float by default).
+ */
+template<> struct accumulator_of<float>
+{
+  using type = CML_FLOAT_ACCUMULATOR;
+};
+
+/** Convenience alias for accumulator_of. */
+template<class Scalar>
+using accumulator_of_t = typename accumulator_of<Scalar>::type;
+} // namespace cml
@@ -32,6 +32,30 @@ __cml_binary_op(binary_multiply, *);
 __cml_binary_op(binary_divide, /);
 
 #undef __cml_binary_op
+
+/** Binary minimum, returning @c a if neither argument is less than the
+ * other, as for std::min.
+ */
+template<class Scalar1, class Scalar2> struct binary_min
+{
+  typedef value_type_trait_promote_t<Scalar1, Scalar2> result_type;
+  result_type apply(const Scalar1& a, const Scalar2& b) const
+  {
+    return b < a ? result_type(b) : result_type(a);
+  }
+};
+
+/** Binary maximum, returning @c a if neither argument is less than the
+ * other, as for std::max.
+ */
+template<class Scalar1, class Scalar2> struct binary_max
+{
+  typedef value_type_trait_promote_t<Scalar1, Scalar2> result_type;
+  result_type apply(const Scalar1& a, const Scalar2& b) const
+  {
+    return a < b ? result_type(b) : result_type(a);
+  }
+};
 } // namespace op
 
 #define __cml_binary_op_alias(_name_)                                          \
@@ -59,5 +83,15 @@ __cml_binary_op_alias(binary_multiply);
  */
 __cml_binary_op_alias(binary_divide);
 
+/** Convenience alias to create binary_min from the value_type traits of
+ * @c Sub1 and @c Sub2 as unqualified types.
+ */
+__cml_binary_op_alias(binary_min);
+
+/** Convenience alias to create binary_max from the value_type traits of
+ * @c Sub1 and @c Sub2 as unqualified types.
+ */
+__cml_binary_op_alias(binary_max);
+
 #undef __cml_binary_op_alias
 } // namespace cml
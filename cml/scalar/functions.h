@@ -5,7 +5,12 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <random>
+#include <type_traits>
+#include <cml/common/mpl/is_statically_polymorphic.h>
 #include <cml/scalar/constants.h>
 #include <cml/scalar/traits.h>
 
@@ -19,8 +24,12 @@ sign(T value)
   return value < T(0) ? (-T(1)) : (value > T(0) ? T(1) : T(0));
 }
 
-/** Clamp input value to the range [min, max]. */
-template<typename T>
+/** Clamp input value to the range [min, max].  Vectors and matrices are
+ * clamped element-wise by the overloads in vector/elementwise.h and
+ * matrix/elementwise.h.
+ */
+template<typename T,
+  std::enable_if_t<!is_statically_polymorphic<T>::value>* = nullptr>
 constexpr T
 clamp(T value, T min, T max)
 {
@@ -193,6 +202,74 @@ length(T x, T y, T z)
   return scalar_traits<T>::sqrt(length_squared(x, y, z));
 }
 
+/** Return true if @c a and @c b are within @c abs_tol of each other, or
+ * within @c rel_tol times the larger of their magnitudes.  NaN is not
+ * approximately equal to anything.
+ */
+template<typename T, std::enable_if_t<std::is_arithmetic_v<T>>* = nullptr>
+inline bool
+approx_equal(T a, T b, T abs_tol, T rel_tol = T(0))
+{
+  const T d = std::fabs(a - b);
+  return d <= abs_tol || d <= rel_tol * std::max(std::fabs(a), std::fabs(b));
+}
+
+/** Return the number of representable floating-point values from @c a to
+ * @c b, so that adjacent values are 1 apart and +0 and -0 are 0 apart.  If
+ * either is NaN, the maximum std::int64_t is returned.
+ */
+template<typename T>
+inline std::int64_t
+ulp_distance(T a, T b)
+{
+  static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>,
+    "ulp_distance requires float or double");
+  using bits_type =
+    std::conditional_t<sizeof(T) == 4, std::int32_t, std::int64_t>;
+  if(a != a || b != b) return std::numeric_limits<std::int64_t>::max();
+
+  /* Map the sign-magnitude bit patterns to a monotonic integer scale: */
+  bits_type ia, ib;
+  std::memcpy(&ia, &a, sizeof(T));
+  std::memcpy(&ib, &b, sizeof(T));
+  constexpr bits_type lowest = std::numeric_limits<bits_type>::min();
+  if(ia < 0) ia = bits_type(lowest - ia);
+  if(ib < 0) ib = bits_type(lowest - ib);
+
+  /* Differences of doubles near opposite infinities saturate: */
+  if(sizeof(T) == 8 && (ia < 0) != (ib < 0)) {
+    const std::uint64_t d = ia < ib
+      ? std::uint64_t(ib) - std::uint64_t(ia)
+      : std::uint64_t(ia) - std::uint64_t(ib);
+    return d > std::uint64_t(std::numeric_limits<std::int64_t>::max())
+      ? std::numeric_limits<std::int64_t>::max()
+      : std::int64_t(d);
+  }
+  return ia < ib ? std::int64_t(ib) - ia : std::int64_t(ia) - ib;
+}
+
+namespace detail {
+
+/** Return true if the @c N elements of @c a and @c s*b are pairwise
+ * approx_equal().  There is no early exit, so that the loop vectorizes for
+ * small fixed @c N.
+ */
+template<int N, typename T>
+inline bool
+approx_equal_n(const T* a, const T* b, T abs_tol, T rel_tol, T s = T(1))
+{
+  bool equal = true;
+  for(int i = 0; i < N; ++i) {
+    const T x = a[i], y = s * b[i];
+    const T d = std::fabs(x - y);
+    const T m = std::max(std::fabs(x), std::fabs(y));
+    equal &= (d <= abs_tol) | (d <= rel_tol * m);
+  }
+  return equal;
+}
+
+} // namespace detail
+
 /** @defgroup cml_scalar_indexing Indexing Functions
  *
  * The next few functions deal with indexing. next() and prev() are useful
@@ -277,7 +354,7 @@ index_of_helper(Op f, std::integer_sequence<int, I0, I1, Is...>, T x0, T x1,
     : index_of_helper(f, std::integer_sequence<int, I1, Is...>{}, x1, x...);
 }
 
-}  // namespace detail
+} // namespace detail
 
 /** Index of the minimum of N values. */
 template<typename... Ts>
@@ -0,0 +1,73 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <type_traits>
+#include <cml/common/mpl/int_c.h>
+#include <cml/scalar/traits.h>
+
+namespace cml {
+namespace op {
+/** Generate the same value for every element. */
+template<class Scalar> struct generate_constant
+{
+  using value_type = value_type_trait_of_t<Scalar>;
+
+  explicit generate_constant(const value_type& v)
+    : m_value(v)
+  {
+  }
+
+  value_type apply(int) const { return this->m_value; }
+  value_type apply(int, int) const { return this->m_value; }
+
+  value_type m_value;
+};
+
+/** Generate 1 for element @c i of a vector, and 0 otherwise. */
+template<class Scalar> struct generate_unit
+{
+  using value_type = value_type_trait_of_t<Scalar>;
+
+  explicit generate_unit(int i)
+    : m_index(i)
+  {
+  }
+
+  value_type apply(int i) const { return value_type(i == this->m_index); }
+
+  int m_index;
+};
+
+/** Generate 1 for the diagonal elements of a matrix, and 0 otherwise. */
+template<class Scalar> struct generate_identity
+{
+  using value_type = value_type_trait_of_t<Scalar>;
+
+  value_type apply(int i, int j) const { return value_type(i == j); }
+};
+} // namespace op
+
+namespace detail {
+/** The compile-time size of a generator given a size argument of type @c
+ * Size: -1 for an integral type, or N for int_c<N>.  Undefined for other
+ * types, so that the generator functions do not participate in overload
+ * resolution.
+ */
+template<class Size, class Enable = void> struct generator_size;
+
+template<class Size>
+struct generator_size<Size,
+  typename std::enable_if<std::is_integral<Size>::value>::type>
+{
+  static const int value = -1;
+};
+
+template<int N> struct generator_size<int_c<N>>
+{
+  static const int value = N;
+};
+} // namespace detail
+} // namespace cml
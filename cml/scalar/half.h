@@ -0,0 +1,373 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <cml/scalar/traits.h>
+#include <cml/scalar/accumulator.h>
+
+namespace cml {
+namespace detail {
+
+/** Return the bits of @c f as an unsigned integer. */
+inline std::uint32_t
+float_bits(float f)
+{
+  std::uint32_t x;
+  std::memcpy(&x, &f, sizeof(x));
+  return x;
+}
+
+/** Return the float with bits @c x. */
+inline float
+float_from_bits(std::uint32_t x)
+{
+  float f;
+  std::memcpy(&f, &x, sizeof(f));
+  return f;
+}
+
+/** IEEE-754 binary16: 1 sign bit, 5 exponent bits, and 10 mantissa bits. */
+struct binary16_format
+{
+  /** Round @c f to the nearest binary16 value (ties to even). */
+  static std::uint16_t encode(float f)
+  {
+    std::uint32_t x = float_bits(f);
+    const std::uint32_t sign = (x >> 16) & 0x8000u;
+    x &= 0x7fffffffu;
+
+    /* Infinity and NaN, keeping NaNs quiet: */
+    if(x >= 0x7f800000u)
+      return std::uint16_t(sign | 0x7c00u
+        | (x > 0x7f800000u ? 0x200u | ((x >> 13) & 0x3ffu) : 0u));
+
+    /* At least 65520 rounds to infinity: */
+    if(x >= 0x477ff000u) return std::uint16_t(sign | 0x7c00u);
+
+    /* Below 2^-14, the result is subnormal in units of 2^-24: */
+    if(x < 0x38800000u) {
+      if(x <= 0x33000000u) return std::uint16_t(sign);
+      const std::uint32_t mantissa = (x & 0x7fffffu) | 0x800000u;
+      const int shift = 126 - int(x >> 23);
+      std::uint32_t r = mantissa >> shift;
+      const std::uint32_t rem = mantissa & ((1u << shift) - 1u);
+      const std::uint32_t halfway = 1u << (shift - 1);
+      if(rem > halfway || (rem == halfway && (r & 1u))) ++r;
+      return std::uint16_t(sign | r);
+    }
+
+    /* Rebias the exponent, and round away the low 13 mantissa bits: */
+    std::uint32_t r = (x - 0x38000000u) >> 13;
+    const std::uint32_t rem = x & 0x1fffu;
+    if(rem > 0x1000u || (rem == 0x1000u && (r & 1u))) ++r;
+    return std::uint16_t(sign | r);
+  }
+
+  /** Return the float equal to the binary16 value @c h. */
+  static float decode(std::uint16_t h)
+  {
+    const std::uint32_t sign = std::uint32_t(h & 0x8000u) << 16;
+    const std::uint32_t e = (h >> 10) & 0x1fu;
+    std::uint32_t m = h & 0x3ffu;
+    if(e == 0x1fu) return float_from_bits(sign | 0x7f800000u | (m << 13));
+    if(e != 0) return float_from_bits(sign | ((e + 112) << 23) | (m << 13));
+    if(m == 0) return float_from_bits(sign);
+
+    /* Normalize subnormals: */
+    std::uint32_t exponent = 113;
+    while(!(m & 0x400u)) {
+      m <<= 1;
+      --exponent;
+    }
+    return float_from_bits(sign | (exponent << 23) | ((m & 0x3ffu) << 13));
+  }
+};
+
+/** bfloat16: the high 16 bits of an IEEE-754 binary32 (1 sign bit, 8
+ * exponent bits, and 7 mantissa bits).
+ */
+struct bfloat16_format
+{
+  /** Round @c f to the nearest bfloat16 value (ties to even). */
+  static std::uint16_t encode(float f)
+  {
+    std::uint32_t x = float_bits(f);
+    if((x & 0x7fffffffu) > 0x7f800000u)
+      return std::uint16_t((x >> 16) | 0x40u);
+    x += 0x7fffu + ((x >> 16) & 1u);
+    return std::uint16_t(x >> 16);
+  }
+
+  /** Return the float equal to the bfloat16 value @c b. */
+  static float decode(std::uint16_t b)
+  {
+    return float_from_bits(std::uint32_t(b) << 16);
+  }
+};
+
+} // namespace detail
+
+/** A 16-bit floating-point storage type with the encoding given by @c
+ * Format.  Values convert implicitly to and from float (rounding to
+ * nearest), and arithmetic is carried out in float, so vectors and
+ * matrices of half or bfloat16 elements halve the memory of float storage
+ * while computing in float.  The accumulator type is float.
+ */
+template<class Format> class basic_float16
+{
+  public:
+  /** Default construct an uninitialized value (zero when
+   * value-initialized).
+   */
+  basic_float16() = default;
+
+  /** Construct from @c f, rounded to the nearest representable value. */
+  basic_float16(float f)
+    : m_bits(Format::encode(f))
+  {
+  }
+
+  /** Construct from any other arithmetic value via float. */
+  template<class Scalar, enable_if_arithmetic_t<Scalar>* = nullptr>
+  basic_float16(Scalar v)
+    : m_bits(Format::encode(static_cast<float>(v)))
+  {
+  }
+
+  /** Return the value as float. */
+  operator float() const { return Format::decode(this->m_bits); }
+
+  /** Return a value with the bit pattern @c bits. */
+  static basic_float16 from_bits(std::uint16_t bits)
+  {
+    basic_float16 v;
+    v.m_bits = bits;
+    return v;
+  }
+
+  /** Return the bit pattern of the value. */
+  std::uint16_t bits() const { return this->m_bits; }
+
+  /** @name Compound assignment, in float */
+  /*@{*/
+
+  template<class Other> basic_float16& operator+=(const Other& v)
+  {
+    return *this = basic_float16(float(*this) + v);
+  }
+
+  template<class Other> basic_float16& operator-=(const Other& v)
+  {
+    return *this = basic_float16(float(*this) - v);
+  }
+
+  template<class Other> basic_float16& operator*=(const Other& v)
+  {
+    return *this = basic_float16(float(*this) * v);
+  }
+
+  template<class Other> basic_float16& operator/=(const Other& v)
+  {
+    return *this = basic_float16(float(*this) / v);
+  }
+
+  /*@}*/
+
+  private:
+  std::uint16_t m_bits;
+};
+
+/** IEEE-754 half precision (binary16) storage. */
+using half = basic_float16<detail::binary16_format>;
+
+/** bfloat16 storage: float range with 8 bits of precision. */
+using bfloat16 = basic_float16<detail::bfloat16_format>;
+
+} // namespace cml
+
+namespace std {
+/** numeric_limits for cml::half. */
+template<> class numeric_limits<cml::half>
+{
+  public:
+  static constexpr bool is_specialized = true;
+  static constexpr bool is_signed = true;
+  static constexpr bool is_integer = false;
+  static constexpr bool is_exact = false;
+  static constexpr bool has_infinity = true;
+  static constexpr bool has_quiet_NaN = true;
+  static constexpr bool has_signaling_NaN = false;
+  static constexpr bool is_iec559 = false;
+  static constexpr bool is_bounded = true;
+  static constexpr bool is_modulo = false;
+  static constexpr int digits = 11;
+  static constexpr int digits10 = 3;
+  static constexpr int max_digits10 = 5;
+  static constexpr int radix = 2;
+  static constexpr int min_exponent = -13;
+  static constexpr int min_exponent10 = -4;
+  static constexpr int max_exponent = 16;
+  static constexpr int max_exponent10 = 4;
+  static constexpr float_round_style round_style = round_to_nearest;
+
+  static cml::half min() { return cml::half::from_bits(0x0400); }
+  static cml::half max() { return cml::half::from_bits(0x7bff); }
+  static cml::half lowest() { return cml::half::from_bits(0xfbff); }
+  static cml::half epsilon() { return cml::half::from_bits(0x1400); }
+  static cml::half round_error() { return cml::half::from_bits(0x3800); }
+  static cml::half infinity() { return cml::half::from_bits(0x7c00); }
+  static cml::half quiet_NaN() { return cml::half::from_bits(0x7e00); }
+  static cml::half denorm_min() { return cml::half::from_bits(0x0001); }
+};
+
+/** numeric_limits for cml::bfloat16. */
+template<> class numeric_limits<cml::bfloat16>
+{
+  public:
+  static constexpr bool is_specialized = true;
+  static constexpr bool is_signed = true;
+  static constexpr bool is_integer = false;
+  static constexpr bool is_exact = false;
+  static constexpr bool has_infinity = true;
+  static constexpr bool has_quiet_NaN = true;
+  static constexpr bool has_signaling_NaN = false;
+  static constexpr bool is_iec559 = false;
+  static constexpr bool is_bounded = true;
+  static constexpr bool is_modulo = false;
+  static constexpr int digits = 8;
+  static constexpr int digits10 = 2;
+  static constexpr int max_digits10 = 4;
+  static constexpr int radix = 2;
+  static constexpr int min_exponent = -125;
+  static constexpr int min_exponent10 = -37;
+  static constexpr int max_exponent = 128;
+  static constexpr int max_exponent10 = 38;
+  static constexpr float_round_style round_style = round_to_nearest;
+
+  static cml::bfloat16 min() { return cml::bfloat16::from_bits(0x0080); }
+  static cml::bfloat16 max() { return cml::bfloat16::from_bits(0x7f7f); }
+  static cml::bfloat16 lowest() { return cml::bfloat16::from_bits(0xff7f); }
+  static cml::bfloat16 epsilon() { return cml::bfloat16::from_bits(0x3c00); }
+  static cml::bfloat16 round_error()
+  {
+    return cml::bfloat16::from_bits(0x3f00);
+  }
+  static cml::bfloat16 infinity() { return cml::bfloat16::from_bits(0x7f80); }
+  static cml::bfloat16 quiet_NaN() { return cml::bfloat16::from_bits(0x7fc0); }
+  static cml::bfloat16 denorm_min() { return cml::bfloat16::from_bits(0x0001); }
+};
+
+/* Mixing a 16-bit type with another type computes in float (or wider): */
+template<class Format1, class Format2>
+struct common_type<cml::basic_float16<Format1>, cml::basic_float16<Format2>>
+{
+  using type = conditional_t<is_same_v<Format1, Format2>,
+    cml::basic_float16<Format1>, float>;
+};
+
+template<class Format, class T>
+struct common_type<cml::basic_float16<Format>, T> : common_type<float, T>
+{
+};
+
+template<class T, class Format>
+struct common_type<T, cml::basic_float16<Format>> : common_type<T, float>
+{
+};
+} // namespace std
+
+namespace cml {
+namespace detail {
+
+/** Inheritable scalar traits for 16-bit storage types, computing the
+ * numeric functions in float.
+ */
+template<typename Scalar>
+struct default_float16_traits : std::numeric_limits<Scalar>
+{
+  using value_type = Scalar;
+  using pointer = value_type*;
+  using reference = value_type&;
+  using const_pointer = value_type const*;
+  using const_reference = value_type const&;
+  using mutable_value = reference&;
+  using immutable_value = const_reference;
+  using std::numeric_limits<Scalar>::epsilon;
+
+  /** @name Basic Functions */
+  /*@{*/
+
+  static value_type abs(const value_type& v) { return std::fabs(float(v)); }
+
+  static value_type mod(const value_type& v, const value_type& w)
+  {
+    return std::fmod(float(v), float(w));
+  }
+
+  static value_type fabs(const value_type& v) { return std::fabs(float(v)); }
+
+  static value_type fmod(const value_type& v, const value_type& w)
+  {
+    return std::fmod(float(v), float(w));
+  }
+
+  static value_type sqrt(const value_type& v) { return std::sqrt(float(v)); }
+
+  static value_type cos(const value_type& v) { return std::cos(float(v)); }
+
+  static value_type sin(const value_type& v) { return std::sin(float(v)); }
+
+  static value_type tan(const value_type& v) { return std::tan(float(v)); }
+
+  static value_type acos(const value_type& v) { return std::acos(float(v)); }
+
+  static value_type asin(const value_type& v) { return std::asin(float(v)); }
+
+  static value_type atan(const value_type& v) { return std::atan(float(v)); }
+
+  static value_type atan2(const value_type& x, const value_type& y)
+  {
+    return std::atan2(float(x), float(y));
+  }
+
+  static value_type log(const value_type& v) { return std::log(float(v)); }
+
+  static value_type exp(const value_type& v) { return std::exp(float(v)); }
+
+  /** Returns sqrt(epsilon()). */
+  static value_type sqrt_epsilon() { return std::sqrt(float(epsilon())); }
+
+  /*@}*/
+};
+
+} // namespace detail
+
+/** Specialization of scalar_traits<> for 16-bit storage types. */
+template<class Format>
+struct scalar_traits<basic_float16<Format>>
+: detail::default_float16_traits<basic_float16<Format>>
+{};
+
+/** traits_of for 16-bit storage types. */
+template<class Format> struct traits_of<basic_float16<Format>>
+{
+  using type = scalar_traits<basic_float16<Format>>;
+};
+
+/** temporary_of for 16-bit storage types. */
+template<class Format> struct temporary_of<basic_float16<Format>>
+{
+  using type = basic_float16<Format>;
+};
+
+/** 16-bit storage types accumulate in float. */
+template<class Format> struct accumulator_of<basic_float16<Format>>
+{
+  using type = float;
+};
+} // namespace cml
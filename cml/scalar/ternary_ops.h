@@ -0,0 +1,56 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cmath>
+#include <cml/common/type_util.h>
+#include <cml/scalar/traits.h>
+#include <cml/scalar/promotion.h>
+
+namespace cml {
+namespace op {
+/** Fused multiply-add, a*b + c rounded once. */
+template<class Scalar1, class Scalar2, class Scalar3> struct ternary_fma
+{
+  typedef value_type_trait_promote_t<Scalar1, Scalar2, Scalar3> result_type;
+  result_type apply(const Scalar1& a, const Scalar2& b, const Scalar3& c) const
+  {
+    return result_type(
+      std::fma(result_type(a), result_type(b), result_type(c)));
+  }
+};
+
+/** Clamp @c a to the range [lo, hi], as for cml::clamp(). */
+template<class Scalar1, class Scalar2, class Scalar3> struct ternary_clamp
+{
+  typedef value_type_trait_promote_t<Scalar1, Scalar2, Scalar3> result_type;
+  result_type apply(
+    const Scalar1& a, const Scalar2& lo, const Scalar3& hi) const
+  {
+    const result_type x(a), l(lo), h(hi);
+    const result_type y = h < x ? h : x;
+    return y < l ? l : y;
+  }
+};
+} // namespace op
+
+#define __cml_ternary_op_alias(_name_)                                         \
+  template<class Sub1, class Sub2, class Sub3>                                 \
+  using _name_##_t = op::_name_<value_type_trait_of_t<actual_type_of_t<Sub1>>, \
+    value_type_trait_of_t<actual_type_of_t<Sub2>>,                             \
+    value_type_trait_of_t<actual_type_of_t<Sub3>>>
+
+/** Convenience alias to create ternary_fma from the value_type traits of
+ * @c Sub1, @c Sub2 and @c Sub3 as unqualified types.
+ */
+__cml_ternary_op_alias(ternary_fma);
+
+/** Convenience alias to create ternary_clamp from the value_type traits of
+ * @c Sub1, @c Sub2 and @c Sub3 as unqualified types.
+ */
+__cml_ternary_op_alias(ternary_clamp);
+
+#undef __cml_ternary_op_alias
+} // namespace cml
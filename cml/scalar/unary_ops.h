@@ -26,6 +26,42 @@ template<class Scalar> struct unary_plus
 
   result_type apply(const value_type& v) const { return +v; }
 };
+
+/** Absolute value. */
+template<class Scalar> struct unary_abs
+{
+  using value_type = value_type_trait_of_t<Scalar>;
+  using result_type = value_type;
+
+  result_type apply(const value_type& v) const
+  {
+    return scalar_traits<value_type>::fabs(v);
+  }
+};
+
+/** Square root. */
+template<class Scalar> struct unary_sqrt
+{
+  using value_type = value_type_trait_of_t<Scalar>;
+  using result_type = value_type;
+
+  result_type apply(const value_type& v) const
+  {
+    return scalar_traits<value_type>::sqrt(v);
+  }
+};
+
+/** Exponential. */
+template<class Scalar> struct unary_exp
+{
+  using value_type = value_type_trait_of_t<Scalar>;
+  using result_type = value_type;
+
+  result_type apply(const value_type& v) const
+  {
+    return scalar_traits<value_type>::exp(v);
+  }
+};
 } // namespace op
 
 /** Convenience alias to create unary_minus from the value_type trait of
@@ -41,4 +77,23 @@ op::unary_minus<value_type_trait_of_t<actual_type_of_t<Sub>>>;
 template<class Sub>
 using unary_plus_t =
 op::unary_plus<value_type_trait_of_t<actual_type_of_t<Sub>>>;
+
+/** Convenience alias to create unary_abs from the value_type trait of @c
+ * Sub as an unqualified type.
+ */
+template<class Sub>
+using unary_abs_t = op::unary_abs<value_type_trait_of_t<actual_type_of_t<Sub>>>;
+
+/** Convenience alias to create unary_sqrt from the value_type trait of @c
+ * Sub as an unqualified type.
+ */
+template<class Sub>
+using unary_sqrt_t =
+op::unary_sqrt<value_type_trait_of_t<actual_type_of_t<Sub>>>;
+
+/** Convenience alias to create unary_exp from the value_type trait of @c
+ * Sub as an unqualified type.
+ */
+template<class Sub>
+using unary_exp_t = op::unary_exp<value_type_trait_of_t<actual_type_of_t<Sub>>>;
 } // namespace cml
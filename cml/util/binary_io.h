@@ -0,0 +1,268 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <cml/vector/fixed_compiled.h>
+#include <cml/vector/fixed_external.h>
+#include <cml/matrix/fixed_compiled.h>
+#include <cml/matrix/fixed_external.h>
+
+namespace cml {
+
+/** Exception thrown when a binary array cannot be read, written, or
+ * mapped, or does not match the requested type.
+ */
+struct binary_io_error : std::runtime_error
+{
+  explicit binary_io_error(const std::string& msg)
+    : std::runtime_error(msg)
+  {
+  }
+};
+
+/** Element type codes stored in a binary array header. */
+enum binary_element_kind : std::uint8_t
+{
+  binary_float32_c = 1,
+  binary_float64_c = 2,
+  binary_int32_c = 3,
+  binary_int64_c = 4
+};
+
+/** Object type codes stored in a binary array header. */
+enum binary_object_kind : std::uint8_t
+{
+  binary_vector_c = 1,
+  binary_matrix_c = 2
+};
+
+/** Header of a binary array file.  The header is followed, at byte
+ * data_offset, by @c count objects of @c rows x @c cols elements each,
+ * stored contiguously in native byte order.  Matrix elements are stored
+ * in the matrix layout, and the layout and basis are recorded so that
+ * they can be checked when the array is read back.
+ */
+struct binary_array_header
+{
+  /** File signature, "CMLB". */
+  char magic[4];
+
+  /** binary_byte_order as written, to detect byte-order mismatches. */
+  std::uint32_t byte_order;
+
+  /** Format version. */
+  std::uint16_t version;
+
+  /** binary_element_kind of the elements. */
+  std::uint8_t element_type;
+
+  /** binary_object_kind of the objects. */
+  std::uint8_t object_type;
+
+  /** layout_kind of matrix objects, or any_major_c for vectors. */
+  std::uint8_t layout;
+
+  /** basis_kind of matrix objects, or any_basis_c for vectors. */
+  std::uint8_t basis;
+
+  /** Reserved, must be 0. */
+  std::uint16_t reserved;
+
+  /** Rows per object (the size, for vectors). */
+  std::uint32_t rows;
+
+  /** Columns per object (1, for vectors). */
+  std::uint32_t cols;
+
+  /** Number of objects. */
+  std::uint64_t count;
+
+  /** Offset in bytes from the start of the file to the first element. */
+  std::uint64_t data_offset;
+};
+
+/** The byte-order mark written to binary array headers. */
+const std::uint32_t binary_byte_order = 0x01020304;
+
+/** The binary array format version. */
+const std::uint16_t binary_version = 1;
+
+/** The offset of the data from the start of a binary array file.  The data
+ * is aligned to this many bytes in memory-mapped arrays.
+ */
+const std::uint64_t binary_data_offset = 64;
+
+/** The number of bytes read_binary_array(std::istream&) reads before
+ * growing its result, bounding the allocation made for a corrupt count.
+ */
+const std::size_t binary_read_chunk_bytes = std::size_t(1) << 20;
+
+/** Specializable class describing how a fixed-size CML type is stored in
+ * a binary array.  Specializations are provided for fixed-size vectors and
+ * matrices with float, double, std::int32_t, or std::int64_t elements, and
+ * define:
+ *
+ * - value_type: the element type.
+ * - view_type: the external<> type used to view mapped objects.
+ * - element_type, object_type, layout, basis, rows, cols: the header
+ *   fields describing the type.
+ */
+template<class T> struct binary_array_traits;
+
+/** binary_array_traits for fixed-size vectors. */
+template<class Element, int Size>
+struct binary_array_traits<vector<Element, compiled<Size>>>;
+
+/** binary_array_traits for fixed-size matrices. */
+template<class Element, int Rows, int Cols, class BasisOrient, class Layout>
+struct binary_array_traits<
+  matrix<Element, compiled<Rows, Cols>, BasisOrient, Layout>>;
+
+
+/** Write @c count fixed-size vectors or matrices from @c data to @c out as
+ * a binary array.
+ *
+ * @throws binary_io_error if writing fails.
+ */
+template<class T>
+void write_binary_array(std::ostream& out, const T* data, std::size_t count);
+
+/** Write the fixed-size vectors or matrices in @c values to @c out as a
+ * binary array.
+ *
+ * @throws binary_io_error if writing fails.
+ */
+template<class T>
+void write_binary_array(std::ostream& out, const std::vector<T>& values);
+
+/** Write the fixed-size vectors or matrices in @c values to the file @c
+ * path as a binary array.
+ *
+ * @throws binary_io_error if the file cannot be opened or written.
+ */
+template<class T>
+void write_binary_array(const std::string& path, const std::vector<T>& values);
+
+/** Read a binary array of @c T from @c in.
+ *
+ * @throws binary_io_error if reading fails, or if the array does not hold
+ * objects of type @c T.  A count larger than the stream is detected when
+ * the stream ends, after at most binary_read_chunk_bytes of extra storage
+ * has been allocated.
+ */
+template<class T> std::vector<T> read_binary_array(std::istream& in);
+
+/** Read a binary array of @c T from the file @c path.
+ *
+ * @throws binary_io_error if the file cannot be opened or read, or if the
+ * array does not hold objects of type @c T.
+ */
+template<class T> std::vector<T> read_binary_array(const std::string& path);
+
+
+namespace detail {
+
+/** A read-only file mapped privately (copy-on-write) into memory.  Pages
+ * are shared with other processes mapping the same file until they are
+ * written, and writes are never carried through to the file.
+ */
+class mapped_file
+{
+  public:
+  /** Map the file at @c path.
+   *
+   * @throws binary_io_error if the file cannot be opened or mapped.
+   */
+  explicit mapped_file(const std::string& path);
+
+  /** Unmap the file. */
+  ~mapped_file();
+
+  // Not copyable, since the mapping is owned:
+  mapped_file(const mapped_file&) = delete;
+  mapped_file& operator=(const mapped_file&) = delete;
+
+  /** Return the mapped bytes. */
+  unsigned char* data() const;
+
+  /** Return the number of mapped bytes. */
+  std::size_t size() const;
+
+
+  private:
+  /** Start of the mapping, or null for an empty file. */
+  unsigned char* m_data;
+
+  /** Size of the mapping. */
+  std::size_t m_size;
+
+#ifdef _WIN32
+  /** File mapping handle. */
+  void* m_mapping;
+#endif
+};
+
+} // namespace detail
+
+
+/** A binary array of fixed-size vectors or matrices, memory-mapped from a
+ * file.  Objects are accessed through external<> views of the mapped
+ * bytes, without copying.  The file is mapped copy-on-write: views may be
+ * modified, but changes are private to the mapping and are not written
+ * back to the file.
+ *
+ * @tparam T The fixed-size vector or matrix type stored in the file, e.g.
+ * vector3f or matrix44f.
+ */
+template<class T> class mapped_binary_array
+{
+  public:
+  using traits_type = binary_array_traits<T>;
+  using value_type = typename traits_type::value_type;
+  using view_type = typename traits_type::view_type;
+
+
+  public:
+  /** Map the binary array in the file @c path.
+   *
+   * @throws binary_io_error if the file cannot be mapped, or if the array
+   * does not hold objects of type @c T.
+   */
+  explicit mapped_binary_array(const std::string& path);
+
+
+  public:
+  /** Return the array header. */
+  const binary_array_header& header() const;
+
+  /** Return the number of objects. */
+  int size() const;
+
+  /** Return an external view of object @c i. */
+  view_type operator[](int i) const;
+
+  /** Return a pointer to the first element of the first object. */
+  value_type* data() const;
+
+
+  protected:
+  /** The mapped file. */
+  detail::mapped_file m_file;
+
+  /** Number of objects. */
+  int m_size;
+};
+
+} // namespace cml
+
+#define __CML_UTIL_BINARY_IO_TPP
+#include <cml/util/binary_io.tpp>
+#undef __CML_UTIL_BINARY_IO_TPP
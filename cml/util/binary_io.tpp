@@ -0,0 +1,401 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#ifndef __CML_UTIL_BINARY_IO_TPP
+#  error "util/binary_io.tpp not included correctly"
+#endif
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <cml/common/exception.h>
+
+#ifdef _WIN32
+/* Keep the min/max macros and the rarely-used APIs out of user code: */
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#    define __CML_UNDEF_NOMINMAX
+#  endif
+#  ifndef WIN32_LEAN_AND_MEAN
+#    define WIN32_LEAN_AND_MEAN
+#    define __CML_UNDEF_WIN32_LEAN_AND_MEAN
+#  endif
+#  include <windows.h>
+#  ifdef __CML_UNDEF_NOMINMAX
+#    undef NOMINMAX
+#    undef __CML_UNDEF_NOMINMAX
+#  endif
+#  ifdef __CML_UNDEF_WIN32_LEAN_AND_MEAN
+#    undef WIN32_LEAN_AND_MEAN
+#    undef __CML_UNDEF_WIN32_LEAN_AND_MEAN
+#  endif
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+namespace cml {
+namespace detail {
+
+/** Map element types to binary_element_kind codes. */
+template<class Element> struct binary_element_code;
+
+template<> struct binary_element_code<float>
+{
+  static const std::uint8_t value = binary_float32_c;
+};
+
+template<> struct binary_element_code<double>
+{
+  static const std::uint8_t value = binary_float64_c;
+};
+
+template<> struct binary_element_code<std::int32_t>
+{
+  static const std::uint8_t value = binary_int32_c;
+};
+
+template<> struct binary_element_code<std::int64_t>
+{
+  static const std::uint8_t value = binary_int64_c;
+};
+
+/** Return the header describing @c count objects of type @c T. */
+template<class T>
+inline binary_array_header
+binary_header_for(std::size_t count)
+{
+  using traits_type = binary_array_traits<T>;
+  binary_array_header header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, "CMLB", 4);
+  header.byte_order = binary_byte_order;
+  header.version = binary_version;
+  header.element_type = traits_type::element_type;
+  header.object_type = traits_type::object_type;
+  header.layout = traits_type::layout;
+  header.basis = traits_type::basis;
+  header.rows = traits_type::rows;
+  header.cols = traits_type::cols;
+  header.count = count;
+  header.data_offset = binary_data_offset;
+  return header;
+}
+
+/** Check that @c header describes an array of @c T, and that the data
+ * fits in @c available bytes.
+ *
+ * @throws binary_io_error if the header does not match.
+ */
+template<class T>
+inline void
+check_binary_header(const binary_array_header& header, std::size_t available)
+{
+  using traits_type = binary_array_traits<T>;
+  using value_type = typename traits_type::value_type;
+
+  cml_require(std::memcmp(header.magic, "CMLB", 4) == 0, binary_io_error,
+    "not a CML binary array");
+  cml_require(header.byte_order == binary_byte_order, binary_io_error,
+    "binary array byte order mismatch");
+  cml_require(header.version == binary_version, binary_io_error,
+    "unsupported binary array version");
+  cml_require(header.element_type == traits_type::element_type,
+    binary_io_error, "binary array element type mismatch");
+  cml_require(header.object_type == traits_type::object_type
+      && header.rows == std::uint32_t(traits_type::rows)
+      && header.cols == std::uint32_t(traits_type::cols),
+    binary_io_error, "binary array shape mismatch");
+  cml_require(header.layout == traits_type::layout
+      && header.basis == traits_type::basis,
+    binary_io_error, "binary array layout or basis mismatch");
+  cml_require(header.data_offset >= sizeof(binary_array_header)
+      && header.data_offset % alignof(value_type) == 0,
+    binary_io_error, "invalid binary array data offset");
+
+  /* Divide rather than multiply, so a corrupt count cannot overflow: */
+  const std::uint64_t object_bytes =
+    sizeof(value_type) * traits_type::rows * traits_type::cols;
+  cml_require(header.data_offset <= available
+      && header.count <= (available - header.data_offset) / object_bytes,
+    binary_io_error, "binary array is truncated");
+  cml_require(header.count <= std::uint64_t(INT_MAX), binary_io_error,
+    "binary array is too large");
+}
+
+} // namespace detail
+
+
+/* binary_array_traits specializations: */
+
+template<class Element, int Size>
+struct binary_array_traits<vector<Element, compiled<Size>>>
+{
+  using value_type = Element;
+  using view_type = vector<Element, external<Size>>;
+  static const std::uint8_t element_type =
+    detail::binary_element_code<Element>::value;
+  static const std::uint8_t object_type = binary_vector_c;
+  static const std::uint8_t layout = any_major_c;
+  static const std::uint8_t basis = any_basis_c;
+  static const int rows = Size;
+  static const int cols = 1;
+};
+
+template<class Element, int Rows, int Cols, class BasisOrient, class Layout>
+struct binary_array_traits<
+  matrix<Element, compiled<Rows, Cols>, BasisOrient, Layout>>
+{
+  using value_type = Element;
+  using view_type =
+    matrix<Element, external<Rows, Cols>, BasisOrient, Layout>;
+  static const std::uint8_t element_type =
+    detail::binary_element_code<Element>::value;
+  static const std::uint8_t object_type = binary_matrix_c;
+  static const std::uint8_t layout = Layout::value;
+  static const std::uint8_t basis = BasisOrient::value;
+  static const int rows = Rows;
+  static const int cols = Cols;
+};
+
+
+/* Stream functions: */
+
+template<class T>
+void
+write_binary_array(std::ostream& out, const T* data, std::size_t count)
+{
+  using traits_type = binary_array_traits<T>;
+  using value_type = typename traits_type::value_type;
+  const std::size_t object_bytes =
+    sizeof(value_type) * traits_type::rows * traits_type::cols;
+
+  binary_array_header header = detail::binary_header_for<T>(count);
+  char padding[binary_data_offset - sizeof(binary_array_header)] = {};
+  out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  out.write(padding, sizeof(padding));
+  for(std::size_t i = 0; i < count; ++i)
+    out.write(reinterpret_cast<const char*>(data[i].data()), object_bytes);
+  cml_require(bool(out), binary_io_error, "binary array write failed");
+}
+
+template<class T>
+void
+write_binary_array(std::ostream& out, const std::vector<T>& values)
+{
+  write_binary_array(out, values.data(), values.size());
+}
+
+template<class T>
+void
+write_binary_array(const std::string& path, const std::vector<T>& values)
+{
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  cml_require(bool(out), binary_io_error, "cannot open " + path);
+  write_binary_array(out, values);
+  out.close();
+  cml_require(bool(out), binary_io_error, "cannot write " + path);
+}
+
+template<class T>
+std::vector<T>
+read_binary_array(std::istream& in)
+{
+  using traits_type = binary_array_traits<T>;
+  using value_type = typename traits_type::value_type;
+  const std::size_t object_bytes =
+    sizeof(value_type) * traits_type::rows * traits_type::cols;
+
+  binary_array_header header;
+  in.read(reinterpret_cast<char*>(&header), sizeof(header));
+  cml_require(bool(in), binary_io_error, "binary array header read failed");
+
+  /* The stream size is not known, so check only that the array is
+   * addressable:
+   */
+  detail::check_binary_header<T>(header, SIZE_MAX);
+  in.ignore(std::streamsize(header.data_offset - sizeof(header)));
+
+  /* Grow the result in bounded chunks, so that a corrupt count fails at
+   * the end of the stream instead of allocating up front:
+   */
+  const std::size_t count = std::size_t(header.count);
+  const std::size_t chunk = std::max(std::size_t(1),
+    binary_read_chunk_bytes / object_bytes);
+  std::vector<T> values;
+  while(values.size() < count) {
+    const std::size_t first = values.size();
+    values.resize(first + std::min(chunk, count - first));
+    for(std::size_t i = first; i < values.size(); ++i)
+      in.read(reinterpret_cast<char*>(values[i].data()), object_bytes);
+    cml_require(bool(in), binary_io_error, "binary array is truncated");
+  }
+  return values;
+}
+
+template<class T>
+std::vector<T>
+read_binary_array(const std::string& path)
+{
+  std::ifstream in(path, std::ios::binary);
+  cml_require(bool(in), binary_io_error, "cannot open " + path);
+  return read_binary_array<T>(in);
+}
+
+
+namespace detail {
+
+/* mapped_file 'structors: */
+
+#ifdef _WIN32
+
+inline
+mapped_file::mapped_file(const std::string& path)
+  : m_data(nullptr)
+    , m_size(0)
+    , m_mapping(nullptr)
+{
+  HANDLE file = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+    nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  cml_require(file != INVALID_HANDLE_VALUE, binary_io_error,
+    "cannot open " + path);
+
+  LARGE_INTEGER size;
+  if(!::GetFileSizeEx(file, &size)) {
+    ::CloseHandle(file);
+    throw binary_io_error("cannot stat " + path);
+  }
+  this->m_size = std::size_t(size.QuadPart);
+  if(this->m_size == 0) {
+    ::CloseHandle(file);
+    return;
+  }
+
+  this->m_mapping =
+    ::CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+  ::CloseHandle(file);
+  cml_require(this->m_mapping != nullptr, binary_io_error,
+    "cannot map " + path);
+
+  this->m_data = static_cast<unsigned char*>(
+    ::MapViewOfFile(this->m_mapping, FILE_MAP_COPY, 0, 0, 0));
+  if(this->m_data == nullptr) {
+    ::CloseHandle(this->m_mapping);
+    throw binary_io_error("cannot map " + path);
+  }
+}
+
+inline mapped_file::~mapped_file()
+{
+  if(this->m_data) ::UnmapViewOfFile(this->m_data);
+  if(this->m_mapping) ::CloseHandle(this->m_mapping);
+}
+
+#else
+
+inline
+mapped_file::mapped_file(const std::string& path)
+  : m_data(nullptr)
+    , m_size(0)
+{
+  int fd = ::open(path.c_str(), O_RDONLY);
+  cml_require(fd != -1, binary_io_error, "cannot open " + path);
+
+  struct stat st;
+  if(::fstat(fd, &st) != 0) {
+    ::close(fd);
+    throw binary_io_error("cannot stat " + path);
+  }
+  this->m_size = std::size_t(st.st_size);
+  if(this->m_size == 0) {
+    ::close(fd);
+    return;
+  }
+
+  void* data = ::mmap(nullptr, this->m_size, PROT_READ | PROT_WRITE,
+    MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  cml_require(data != MAP_FAILED, binary_io_error, "cannot map " + path);
+  this->m_data = static_cast<unsigned char*>(data);
+}
+
+inline mapped_file::~mapped_file()
+{
+  if(this->m_data) ::munmap(this->m_data, this->m_size);
+}
+
+#endif
+
+
+/* mapped_file public methods: */
+
+inline unsigned char*
+mapped_file::data() const
+{
+  return this->m_data;
+}
+
+inline std::size_t
+mapped_file::size() const
+{
+  return this->m_size;
+}
+
+} // namespace detail
+
+
+/* mapped_binary_array 'structors: */
+
+template<class T>
+mapped_binary_array<T>::mapped_binary_array(const std::string& path)
+  : m_file(path)
+    , m_size(0)
+{
+  cml_require(this->m_file.size() >= sizeof(binary_array_header),
+    binary_io_error, "binary array header is truncated");
+  const binary_array_header& h = this->header();
+  detail::check_binary_header<T>(h, this->m_file.size());
+  this->m_size = int(h.count);
+}
+
+
+/* mapped_binary_array public methods: */
+
+template<class T>
+const binary_array_header&
+mapped_binary_array<T>::header() const
+{
+  return *reinterpret_cast<const binary_array_header*>(this->m_file.data());
+}
+
+template<class T>
+int
+mapped_binary_array<T>::size() const
+{
+  return this->m_size;
+}
+
+template<class T>
+auto
+mapped_binary_array<T>::operator[](int i) const -> view_type
+{
+  return view_type(
+    this->data() + std::size_t(i) * traits_type::rows * traits_type::cols);
+}
+
+template<class T>
+auto
+mapped_binary_array<T>::data() const -> value_type*
+{
+  return reinterpret_cast<value_type*>(
+    this->m_file.data() + this->header().data_offset);
+}
+
+} // namespace cml
@@ -0,0 +1,28 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cml/common/hash.h>
+#include <cml/matrix/matrix.h>
+#include <cml/matrix/traits.h>
+
+/* Need specialization in std: */
+namespace std {
+template<class Element, class StorageType, class BasisOrient, class Layout>
+struct hash<cml::matrix<Element, StorageType, BasisOrient, Layout>>
+{
+  using matrix_type = cml::matrix<Element, StorageType, BasisOrient, Layout>;
+
+  std::size_t operator()(const matrix_type& M) const
+  {
+    std::size_t seed = 0;
+    std::hash<cml::value_type_of_t<matrix_type>> hasher;
+    for(int i = 0; i < M.rows(); ++i)
+      for(int j = 0; j < M.cols(); ++j)
+        cml::detail::hash_combine(seed, hasher(M.get(i, j)));
+    return seed;
+  }
+};
+} // namespace std
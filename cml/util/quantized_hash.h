@@ -0,0 +1,77 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cml/common/traits.h>
+#include <cml/vector/fwd.h>
+#include <cml/matrix/fwd.h>
+#include <cml/quaternion/fwd.h>
+
+namespace cml {
+
+/** Hash functor for vectors, matrices, and quaternions that hashes the
+ * index of the grid cell of spacing @c cell containing each element,
+ * rather than the exact element values.  Use with quantized_equal to key
+ * an unordered container on approximate values.
+ *
+ * @note Values that are arbitrarily close but fall on opposite sides of a
+ * cell boundary hash differently.  Use spatial_hash_grid to find all
+ * points within a distance of each other.
+ */
+template<class T> class quantized_hash
+{
+  public:
+  using value_type = value_type_of_t<T>;
+
+
+  public:
+  /** Construct a hash functor for cells of size @c cell.
+   *
+   * @throws std::invalid_argument if @c cell <= 0.
+   */
+  explicit quantized_hash(value_type cell);
+
+  /** Return the hash of the cell indices of the elements of @c v. */
+  std::size_t operator()(const T& v) const;
+
+  /** Return the cell size. */
+  value_type cell_size() const;
+
+
+  protected:
+  /** Reciprocal of the cell size. */
+  value_type m_inv_cell;
+};
+
+/** Equality functor consistent with quantized_hash: two objects compare
+ * equal if each pair of corresponding elements falls in the same cell.
+ */
+template<class T> class quantized_equal
+{
+  public:
+  using value_type = value_type_of_t<T>;
+
+
+  public:
+  /** Construct an equality functor for cells of size @c cell.
+   *
+   * @throws std::invalid_argument if @c cell <= 0.
+   */
+  explicit quantized_equal(value_type cell);
+
+  /** Return true if @c a and @c b quantize to the same cells. */
+  bool operator()(const T& a, const T& b) const;
+
+
+  protected:
+  /** Reciprocal of the cell size. */
+  value_type m_inv_cell;
+};
+
+} // namespace cml
+
+#define __CML_UTIL_QUANTIZED_HASH_TPP
+#include <cml/util/quantized_hash.tpp>
+#undef __CML_UTIL_QUANTIZED_HASH_TPP
@@ -0,0 +1,141 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#ifndef __CML_UTIL_QUANTIZED_HASH_TPP
+#  error "util/quantized_hash.tpp not included correctly"
+#endif
+
+#include <cmath>
+#include <stdexcept>
+#include <cml/common/exception.h>
+#include <cml/common/hash.h>
+#include <cml/common/traits.h>
+
+namespace cml {
+namespace detail {
+
+/** Return the index of the cell containing @c x. */
+template<class Element>
+inline long long
+quantize(Element x, Element inv_cell)
+{
+  return (long long) std::floor(x * inv_cell);
+}
+
+/** Return element @c k of @c v. */
+template<class Sub>
+inline auto
+quantized_get(const readable_vector<Sub>& v, int k)
+  -> value_type_trait_of_t<Sub>
+{
+  return v.get(k);
+}
+
+/** Return element @c k of @c M in row-major order. */
+template<class Sub>
+inline auto
+quantized_get(const readable_matrix<Sub>& M, int k)
+  -> value_type_trait_of_t<Sub>
+{
+  return M.get(k / M.cols(), k % M.cols());
+}
+
+/** Return element @c k of @c q. */
+template<class Sub>
+inline auto
+quantized_get(const readable_quaternion<Sub>& q, int k)
+  -> value_type_trait_of_t<Sub>
+{
+  return q.get(k);
+}
+
+/** Return the number of elements of @c v. */
+template<class Sub>
+inline int
+quantized_size(const readable_vector<Sub>& v)
+{
+  return v.size();
+}
+
+/** Return the number of elements of @c M. */
+template<class Sub>
+inline int
+quantized_size(const readable_matrix<Sub>& M)
+{
+  return M.rows() * M.cols();
+}
+
+/** Return the number of elements of @c q. */
+template<class Sub>
+inline int
+quantized_size(const readable_quaternion<Sub>&)
+{
+  return 4;
+}
+
+} // namespace detail
+
+
+/* quantized_hash 'structors: */
+
+template<class T>
+quantized_hash<T>::quantized_hash(value_type cell)
+{
+  cml_require(cell > value_type(0), std::invalid_argument, "cell <= 0");
+  this->m_inv_cell = value_type(1) / cell;
+}
+
+
+/* quantized_hash public methods: */
+
+template<class T>
+std::size_t
+quantized_hash<T>::operator()(const T& v) const
+{
+  std::size_t seed = 0;
+  std::hash<long long> hasher;
+  const int n = detail::quantized_size(v);
+  for(int k = 0; k < n; ++k) {
+    auto x = detail::quantized_get(v, k);
+    detail::hash_combine(seed, hasher(detail::quantize(x, this->m_inv_cell)));
+  }
+  return seed;
+}
+
+template<class T>
+auto
+quantized_hash<T>::cell_size() const -> value_type
+{
+  return value_type(1) / this->m_inv_cell;
+}
+
+
+/* quantized_equal 'structors: */
+
+template<class T>
+quantized_equal<T>::quantized_equal(value_type cell)
+{
+  cml_require(cell > value_type(0), std::invalid_argument, "cell <= 0");
+  this->m_inv_cell = value_type(1) / cell;
+}
+
+
+/* quantized_equal public methods: */
+
+template<class T>
+bool
+quantized_equal<T>::operator()(const T& a, const T& b) const
+{
+  const int n = detail::quantized_size(a);
+  if(n != detail::quantized_size(b)) return false;
+
+  for(int k = 0; k < n; ++k) {
+    auto ka = detail::quantize(detail::quantized_get(a, k), this->m_inv_cell);
+    auto kb = detail::quantize(detail::quantized_get(b, k), this->m_inv_cell);
+    if(ka != kb) return false;
+  }
+  return true;
+}
+
+} // namespace cml
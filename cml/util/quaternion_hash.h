@@ -0,0 +1,27 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cml/common/hash.h>
+#include <cml/quaternion/quaternion.h>
+#include <cml/quaternion/traits.h>
+
+/* Need specialization in std: */
+namespace std {
+template<class Element, class StorageType, class Order, class Cross>
+struct hash<cml::quaternion<Element, StorageType, Order, Cross>>
+{
+  using quaternion_type = cml::quaternion<Element, StorageType, Order, Cross>;
+
+  std::size_t operator()(const quaternion_type& q) const
+  {
+    std::size_t seed = 0;
+    std::hash<cml::value_type_of_t<quaternion_type>> hasher;
+    for(int i = 0; i < 4; ++i)
+      cml::detail::hash_combine(seed, hasher(q.get(i)));
+    return seed;
+  }
+};
+} // namespace std
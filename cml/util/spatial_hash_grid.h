@@ -0,0 +1,142 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+#include <cml/vector/fixed_compiled.h>
+#include <cml/vector/comparison.h>
+#include <cml/vector/binary_ops.h>
+#include <cml/util/vector_hash.h>
+
+namespace cml {
+
+/** Uniform hash grid over 3D points, for neighbour queries and vertex
+ * welding in O(1) expected time per point.  Space is divided into cubic
+ * cells of side cell_size(), each keyed by its integer cell coordinates
+ * in an unordered_map.  The points in each cell are kept in a singly
+ * linked list threaded through a flat array, so inserting a point
+ * allocates only when the point or cell arrays grow.
+ *
+ * Queries are most efficient when the query radius is no more than the
+ * cell size, so that at most 27 cells are visited.
+ *
+ * @note Cell coordinates are ints, so points must satisfy |x|/cell_size()
+ * < INT_MAX.
+ */
+template<class Element> class spatial_hash_grid
+{
+  public:
+  using value_type = Element;
+  using point_type = vector<Element, fixed<3>>;
+  using cell_type = vector<int, fixed<3>>;
+
+
+  public:
+  /** Construct an empty grid with cells of side @c cell_size.
+   *
+   * @throws std::invalid_argument if @c cell_size <= 0.
+   */
+  explicit spatial_hash_grid(value_type cell_size);
+
+
+  public:
+  /** Return the cell side length. */
+  value_type cell_size() const;
+
+  /** Return the number of points in the grid. */
+  int size() const;
+
+  /** Return point @c i, where @c i is the index returned by insert(). */
+  const point_type& point(int i) const;
+
+  /** Return all points in insertion order. */
+  const std::vector<point_type>& points() const;
+
+  /** Reserve storage for @c n points. */
+  void reserve(int n);
+
+  /** Remove all points. */
+  void clear();
+
+  /** Return the coordinates of the cell containing @c p.
+   *
+   * @throws vector_size_error at run-time if @c p is dynamically-sized,
+   * and is not a 3D vector.  The size is checked at compile-time if @c p
+   * is fixed-size.
+   */
+  template<class Sub> cell_type cell_of(const readable_vector<Sub>& p) const;
+
+  /** Insert @c p, and return its index.  Indices are assigned
+   * consecutively from 0.
+   *
+   * @throws vector_size_error if @c p is not a 3D vector.
+   */
+  template<class Sub> int insert(const readable_vector<Sub>& p);
+
+  /** Call @c f(i) for the index @c i of each point within distance @c
+   * radius of @c p.  Points are visited in no particular order.
+   *
+   * @throws vector_size_error if @c p is not a 3D vector.
+   */
+  template<class Sub, class F>
+  void for_each_near(const readable_vector<Sub>& p, value_type radius,
+    F&& f) const;
+
+  /** Return the index of the point nearest to @c p within distance @c
+   * radius, or -1 if there is none.
+   *
+   * @throws vector_size_error if @c p is not a 3D vector.
+   */
+  template<class Sub>
+  int find_nearest(const readable_vector<Sub>& p, value_type radius) const;
+
+  /** Return the index of the point nearest to @c p within distance @c
+   * tolerance if there is one, otherwise insert @c p and return its index.
+   *
+   * @throws vector_size_error if @c p is not a 3D vector.
+   */
+  template<class Sub>
+  int insert_unique(const readable_vector<Sub>& p, value_type tolerance);
+
+
+  protected:
+  /** Side length of a cell. */
+  value_type m_cell_size;
+
+  /** Reciprocal of the cell side length. */
+  value_type m_inv_cell;
+
+  /** Index of the most recently inserted point in each occupied cell. */
+  std::unordered_map<cell_type, int> m_heads;
+
+  /** Index of the next point in the same cell, or -1. */
+  std::vector<int> m_next;
+
+  /** The points, in insertion order. */
+  std::vector<point_type> m_points;
+};
+
+/** Weld the points in @c points that lie within @c tolerance of each
+ * other.  The unique points are returned in @c welded, in order of first
+ * occurrence, and the returned vector maps each input point to its index
+ * in @c welded.
+ *
+ * @note Welding is greedy: each point is merged into the nearest
+ * previously kept point within @c tolerance, so chains of points spaced
+ * just under @c tolerance apart are not merged transitively.
+ *
+ * @throws std::invalid_argument if @c tolerance <= 0.
+ */
+template<class Element>
+std::vector<int> weld_points(
+  const std::vector<vector<Element, fixed<3>>>& points, Element tolerance,
+  std::vector<vector<Element, fixed<3>>>& welded);
+
+} // namespace cml
+
+#define __CML_UTIL_SPATIAL_HASH_GRID_TPP
+#include <cml/util/spatial_hash_grid.tpp>
+#undef __CML_UTIL_SPATIAL_HASH_GRID_TPP
@@ -0,0 +1,176 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#ifndef __CML_UTIL_SPATIAL_HASH_GRID_TPP
+#  error "util/spatial_hash_grid.tpp not included correctly"
+#endif
+
+#include <cmath>
+#include <stdexcept>
+#include <cml/common/exception.h>
+#include <cml/vector/size_checking.h>
+
+namespace cml {
+
+/* spatial_hash_grid 'structors: */
+
+template<class E>
+spatial_hash_grid<E>::spatial_hash_grid(value_type cell_size)
+  : m_cell_size(cell_size)
+{
+  cml_require(cell_size > value_type(0), std::invalid_argument,
+    "cell_size <= 0");
+  this->m_inv_cell = value_type(1) / cell_size;
+}
+
+
+/* Public methods: */
+
+template<class E>
+auto
+spatial_hash_grid<E>::cell_size() const -> value_type
+{
+  return this->m_cell_size;
+}
+
+template<class E>
+int
+spatial_hash_grid<E>::size() const
+{
+  return int(this->m_points.size());
+}
+
+template<class E>
+auto
+spatial_hash_grid<E>::point(int i) const -> const point_type&
+{
+  return this->m_points[i];
+}
+
+template<class E>
+auto
+spatial_hash_grid<E>::points() const -> const std::vector<point_type>&
+{
+  return this->m_points;
+}
+
+template<class E>
+void
+spatial_hash_grid<E>::reserve(int n)
+{
+  this->m_points.reserve(n);
+  this->m_next.reserve(n);
+  this->m_heads.reserve(n);
+}
+
+template<class E>
+void
+spatial_hash_grid<E>::clear()
+{
+  this->m_points.clear();
+  this->m_next.clear();
+  this->m_heads.clear();
+}
+
+template<class E>
+template<class Sub>
+auto
+spatial_hash_grid<E>::cell_of(const readable_vector<Sub>& p) const
+  -> cell_type
+{
+  cml::check_size(p, cml::int_c<3>());
+  return cell_type(int(std::floor(p.get(0) * this->m_inv_cell)),
+    int(std::floor(p.get(1) * this->m_inv_cell)),
+    int(std::floor(p.get(2) * this->m_inv_cell)));
+}
+
+template<class E>
+template<class Sub>
+int
+spatial_hash_grid<E>::insert(const readable_vector<Sub>& p)
+{
+  const int index = this->size();
+  auto head = this->m_heads.emplace(this->cell_of(p), index);
+  this->m_next.push_back(head.second ? -1 : head.first->second);
+  head.first->second = index;
+  this->m_points.push_back(point_type(p.get(0), p.get(1), p.get(2)));
+  return index;
+}
+
+template<class E>
+template<class Sub, class F>
+void
+spatial_hash_grid<E>::for_each_near(const readable_vector<Sub>& p,
+  value_type radius, F&& f) const
+{
+  cml::check_size(p, cml::int_c<3>());
+  const point_type q(p.get(0), p.get(1), p.get(2));
+  const point_type r(radius, radius, radius);
+  const cell_type lo = this->cell_of(q - r);
+  const cell_type hi = this->cell_of(q + r);
+  const value_type radius2 = radius * radius;
+
+  for(int i = lo[0]; i <= hi[0]; ++i) {
+    for(int j = lo[1]; j <= hi[1]; ++j) {
+      for(int k = lo[2]; k <= hi[2]; ++k) {
+        auto head = this->m_heads.find(cell_type(i, j, k));
+        if(head == this->m_heads.end()) continue;
+        for(int n = head->second; n != -1; n = this->m_next[n]) {
+          if((this->m_points[n] - q).length_squared() <= radius2) f(n);
+        }
+      }
+    }
+  }
+}
+
+template<class E>
+template<class Sub>
+int
+spatial_hash_grid<E>::find_nearest(const readable_vector<Sub>& p,
+  value_type radius) const
+{
+  cml::check_size(p, cml::int_c<3>());
+  const point_type q(p.get(0), p.get(1), p.get(2));
+  int nearest = -1;
+  value_type nearest_d2 = value_type(0);
+  this->for_each_near(q, radius, [this, &q, &nearest, &nearest_d2](int n) {
+    value_type d2 = (this->m_points[n] - q).length_squared();
+    if(nearest == -1 || d2 < nearest_d2) {
+      nearest = n;
+      nearest_d2 = d2;
+    }
+  });
+  return nearest;
+}
+
+template<class E>
+template<class Sub>
+int
+spatial_hash_grid<E>::insert_unique(const readable_vector<Sub>& p,
+  value_type tolerance)
+{
+  int index = this->find_nearest(p, tolerance);
+  return (index != -1) ? index : this->insert(p);
+}
+
+
+/* Free functions: */
+
+template<class E>
+std::vector<int>
+weld_points(const std::vector<vector<E, fixed<3>>>& points, E tolerance,
+  std::vector<vector<E, fixed<3>>>& welded)
+{
+  spatial_hash_grid<E> grid(tolerance);
+  grid.reserve(int(points.size()));
+
+  std::vector<int> remap(points.size());
+  for(std::size_t i = 0; i < points.size(); ++i)
+    remap[i] = grid.insert_unique(points[i], tolerance);
+
+  welded = grid.points();
+  return remap;
+}
+
+} // namespace cml
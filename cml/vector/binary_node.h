@@ -71,7 +71,7 @@ class vector_binary_node
    * If both Sub1 and Sub2 are fixed-size expressions, then the sizes are
    * checked at compile time.
    */
-  vector_binary_node(Sub1 left, Sub2 right);
+  vector_binary_node(Sub1 left, Sub2 right) CML_SIZE_CHECK_NOEXCEPT;
 
   /** Move constructor. */
   vector_binary_node(node_type&& other);
@@ -4,7 +4,10 @@
 
 #pragma once
 
+#include <cstdint>
+#include <cml/storage/compiled_selector.h>
 #include <cml/vector/readable_vector.h>
+#include <cml/vector/vector.h>
 
 namespace cml {
 /** Returns true if @c left is lexicographically less than @c right. */
@@ -44,6 +47,39 @@ bool operator==(const readable_vector<Sub1>& left,
 template<class Sub1, class Sub2>
 bool operator!=(const readable_vector<Sub1>& left,
   const readable_vector<Sub2>& right);
+
+/** Returns true if @c left and @c right have the same size, and each pair
+ * of elements is approx_equal() with tolerances @c abs_tol and @c rel_tol.
+ * Fixed-size vectors of the same type are compared in a single pass
+ * without branches; otherwise, the comparison stops at the first pair of
+ * elements that differ.
+ */
+template<class Sub1, class Sub2>
+bool approx_equal(const readable_vector<Sub1>& left,
+  const readable_vector<Sub2>& right,
+  value_type_trait_promote_t<Sub1, Sub2> abs_tol,
+  value_type_trait_promote_t<Sub1, Sub2> rel_tol = 0);
+
+/** Returns true if @c left and @c right have the same size, and each pair
+ * of elements is at most @c max_ulps apart, as measured by ulp_distance().
+ */
+template<class Sub1, class Sub2>
+bool approx_equal_ulps(const readable_vector<Sub1>& left,
+  const readable_vector<Sub2>& right, std::int64_t max_ulps);
+
+/** Return the index of the first of the @c n vectors in @c items that is
+ * approx_equal() to @c key, or -1 if there is none.
+ */
+template<class E, int N>
+int find_approx_equal(const vector<E, compiled<N>>* items, int n,
+  const vector<E, compiled<N>>& key, E abs_tol, E rel_tol = E(0));
+
+/** Returns true if each of the @c n pairs @c left[k] and @c right[k] is
+ * approx_equal(), stopping at the first pair that is not.
+ */
+template<class E, int N>
+bool all_approx_equal(const vector<E, compiled<N>>* left,
+  const vector<E, compiled<N>>* right, int n, E abs_tol, E rel_tol = E(0));
 } // namespace cml
 
 #define __CML_VECTOR_COMPARISON_TPP
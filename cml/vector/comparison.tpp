@@ -6,9 +6,37 @@
 #  error "vector/comparison.tpp not included correctly"
 #endif
 
+#include <cml/scalar/functions.h>
 #include <cml/vector/size_checking.h>
 
 namespace cml {
+namespace detail {
+
+/* Early-exit element-wise comparison of arbitrary vectors: */
+template<class Sub1, class Sub2, class E>
+inline bool
+vector_approx_equal(const readable_vector<Sub1>& left,
+  const readable_vector<Sub2>& right, E abs_tol, E rel_tol)
+{
+  if(left.size() != right.size()) return false;
+  for(int i = 0; i < left.size(); ++i)
+    if(!cml::approx_equal(E(left[i]), E(right[i]), abs_tol, rel_tol))
+      return false;
+  return true;
+}
+
+/* Branch-free comparison of fixed-size vectors of the same type: */
+template<class E, int N>
+inline bool
+vector_approx_equal(const vector<E, compiled<N>>& left,
+  const vector<E, compiled<N>>& right, E abs_tol, E rel_tol)
+{
+  return detail::approx_equal_n<N>(left.data(), right.data(), abs_tol,
+    rel_tol);
+}
+
+} // namespace detail
+
 template<class Sub1, class Sub2>
 bool
 operator<(const readable_vector<Sub1>& left, const readable_vector<Sub2>& right)
@@ -83,4 +111,53 @@ operator!=(const readable_vector<Sub1>& left,
 {
   return !(left == right);
 }
+
+template<class Sub1, class Sub2>
+bool
+approx_equal(const readable_vector<Sub1>& left,
+  const readable_vector<Sub2>& right,
+  value_type_trait_promote_t<Sub1, Sub2> abs_tol,
+  value_type_trait_promote_t<Sub1, Sub2> rel_tol)
+{
+  return detail::vector_approx_equal(left.actual(), right.actual(), abs_tol,
+    rel_tol);
+}
+
+template<class Sub1, class Sub2>
+bool
+approx_equal_ulps(const readable_vector<Sub1>& left,
+  const readable_vector<Sub2>& right, std::int64_t max_ulps)
+{
+  using value_type = value_type_trait_promote_t<Sub1, Sub2>;
+  if(left.size() != right.size()) return false;
+  for(int i = 0; i < left.size(); ++i)
+    if(cml::ulp_distance(value_type(left[i]), value_type(right[i]))
+      > max_ulps)
+      return false;
+  return true;
+}
+
+template<class E, int N>
+int
+find_approx_equal(const vector<E, compiled<N>>* items, int n,
+  const vector<E, compiled<N>>& key, E abs_tol, E rel_tol)
+{
+  for(int k = 0; k < n; ++k)
+    if(detail::approx_equal_n<N>(items[k].data(), key.data(), abs_tol,
+         rel_tol))
+      return k;
+  return -1;
+}
+
+template<class E, int N>
+bool
+all_approx_equal(const vector<E, compiled<N>>* left,
+  const vector<E, compiled<N>>* right, int n, E abs_tol, E rel_tol)
+{
+  for(int k = 0; k < n; ++k)
+    if(!detail::approx_equal_n<N>(left[k].data(), right[k].data(), abs_tol,
+         rel_tol))
+      return false;
+  return true;
+}
 } // namespace cml
@@ -72,7 +72,7 @@ class vector_cross_node : public readable_vector<vector_cross_node<Sub1, Sub2>>
    * both Sub1 and Sub2 are fixed-size expressions, then the sizes are
    * checked at compile time.
    */
-  vector_cross_node(Sub1 left, Sub2 right);
+  vector_cross_node(Sub1 left, Sub2 right) CML_SIZE_CHECK_NOEXCEPT;
 
   /** Move constructor. */
   vector_cross_node(node_type&& other);
@@ -12,7 +12,8 @@ namespace cml {
 /* vector_cross_node 'structors: */
 
 template<class Sub1, class Sub2>
-vector_cross_node<Sub1, Sub2>::vector_cross_node(Sub1 left, Sub2 right)
+vector_cross_node<Sub1, Sub2>::vector_cross_node(Sub1 left,
+  Sub2 right) CML_SIZE_CHECK_NOEXCEPT
   : m_left(std::move(left))
     , m_right(std::move(right))
 {
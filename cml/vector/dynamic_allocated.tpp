@@ -7,6 +7,7 @@
 #endif
 
 #include <cml/common/exception.h>
+#include <cml/common/instrument.h>
 
 namespace cml {
 /* dynamic 'structors: */
@@ -147,6 +148,7 @@ vector<E, dynamic<A>>::resize(int n)
   pointer data = this->m_data;
   int size = this->m_size;
   pointer copy = allocator_traits::allocate(allocator, n);
+  detail::instrument_allocation(n * sizeof(E));
   try {
     /* Destruct elements if necessary: */
     this->destruct(data, size,
@@ -188,6 +190,7 @@ vector<E, dynamic<A>>::resize_fast(int n)
   pointer data = this->m_data;
   int size = this->m_size;
   pointer copy = allocator_traits::allocate(allocator, n);
+  detail::instrument_allocation(n * sizeof(E));
   try {
     /* Destruct elements if necessary: */
     this->destruct(data, size,
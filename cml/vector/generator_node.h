@@ -0,0 +1,92 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cml/storage/allocated_selector.h>
+#include <cml/storage/compiled_selector.h>
+#include <cml/vector/readable_vector.h>
+
+namespace cml {
+template<class Generator, int Size> class vector_generator_node;
+
+/** vector_generator_node<> traits. */
+template<class Generator, int Size>
+struct vector_traits<vector_generator_node<Generator, Size>>
+{
+  using vector_type = vector_generator_node<Generator, Size>;
+  using generator_type = Generator;
+  using element_traits = scalar_traits<typename Generator::value_type>;
+  using value_type = typename element_traits::value_type;
+  using immutable_value = value_type;
+
+  /* Fixed-size if Size is non-negative, dynamic otherwise: */
+  static const bool is_fixed = Size >= 0;
+  using fixed_type = compiled<(is_fixed ? Size : 1)>;
+  using storage_type = rebind_t<cml::if_t<is_fixed, fixed_type, allocated<>>,
+    vector_storage_tag>;
+
+  /* Traits and types for the storage: */
+  using size_tag = typename storage_type::size_tag;
+
+  /* Array size: */
+  static const int array_size = storage_type::array_size;
+};
+
+/** Represents a vector whose elements are computed from their indices by
+ * @c Generator, such as a constant or unit vector, in an expression tree.
+ * No storage is allocated for the elements.
+ */
+template<class Generator, int Size>
+class vector_generator_node
+  : public readable_vector<vector_generator_node<Generator, Size>>
+{
+  public:
+  using node_type = vector_generator_node<Generator, Size>;
+  using readable_type = readable_vector<node_type>;
+  using traits_type = vector_traits<node_type>;
+  using generator_type = typename traits_type::generator_type;
+  using element_traits = typename traits_type::element_traits;
+  using value_type = typename traits_type::value_type;
+  using immutable_value = typename traits_type::immutable_value;
+  using storage_type = typename traits_type::storage_type;
+  using size_tag = typename traits_type::size_tag;
+
+  public:
+  /** Constant containing the array size. */
+  static const int array_size = traits_type::array_size;
+
+  public:
+  /** Construct a vector of @c size elements from @c generator.  @c size
+   * is ignored if the node has a fixed size.
+   */
+  vector_generator_node(int size, const Generator& generator);
+
+  protected:
+  /** @name readable_vector Interface */
+  /*@{*/
+
+  friend readable_type;
+
+  /** Return the size of the vector expression. */
+  int i_size() const;
+
+  /** Return the generated element @c i. */
+  immutable_value i_get(int i) const;
+
+  /*@}*/
+
+
+  protected:
+  /** The element generator. */
+  Generator m_generator;
+
+  /** The run-time size, used if Size is negative. */
+  int m_size;
+};
+} // namespace cml
+
+#define __CML_VECTOR_GENERATOR_NODE_TPP
+#include <cml/vector/generator_node.tpp>
+#undef __CML_VECTOR_GENERATOR_NODE_TPP
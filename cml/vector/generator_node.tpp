@@ -0,0 +1,38 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#ifndef __CML_VECTOR_GENERATOR_NODE_TPP
+#  error "vector/generator_node.tpp not included correctly"
+#endif
+
+namespace cml {
+/* vector_generator_node 'structors: */
+
+template<class Generator, int Size>
+vector_generator_node<Generator, Size>::vector_generator_node(int size,
+  const Generator& generator)
+  : m_generator(generator)
+    , m_size(Size < 0 ? size : Size)
+{
+}
+
+
+/* Internal methods: */
+
+/* readable_vector interface: */
+
+template<class Generator, int Size>
+int
+vector_generator_node<Generator, Size>::i_size() const
+{
+  return Size < 0 ? this->m_size : Size;
+}
+
+template<class Generator, int Size>
+auto
+vector_generator_node<Generator, Size>::i_get(int i) const -> immutable_value
+{
+  return this->m_generator.apply(i);
+}
+} // namespace cml
@@ -0,0 +1,65 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cml/scalar/generator_ops.h>
+#include <cml/vector/generator_node.h>
+
+namespace cml {
+/** @defgroup cml_vector_generators Vector Generator Expressions
+ *
+ * Lazy vectors whose elements are computed on demand, for use in vector
+ * expressions.  Nothing is allocated, and an element costs at most one
+ * integer comparison.  The size argument is either an int, giving a
+ * dynamically-sized expression, or int_c<N>(), giving a fixed-size one.
+ *
+ * The default element type is int, which promotes to the element type of
+ * any floating-point expression the generator is combined with, so that
+ * v - unit(3, 0) has the element type of v.  Specify @c Element when the
+ * generator is used on its own and the elements should not be integers.
+ *
+ * @note The fixed-size, concrete double-precision zero<N>() and axis<N>()
+ * are in mathlib/vector/generators.h.
+ */
+/*@{*/
+
+/** Return an expression for the zero vector of size @c n. */
+template<class Element = int, class Size>
+auto
+zero(Size n)
+  -> vector_generator_node<op::generate_constant<Element>,
+    detail::generator_size<Size>::value>
+{
+  return {int(n), op::generate_constant<Element>(Element(0))};
+}
+
+/** Return an expression for the vector of size @c n having every element
+ * equal to @c v.
+ */
+template<class Size, class Scalar,
+  enable_if_arithmetic_t<cml::unqualified_type_t<Scalar>>* = nullptr>
+auto
+constant(Size n, const Scalar& v)
+  -> vector_generator_node<op::generate_constant<Scalar>,
+    detail::generator_size<Size>::value>
+{
+  return {int(n), op::generate_constant<Scalar>(v)};
+}
+
+/** Return an expression for the vector of size @c n having element @c i
+ * equal to 1, and the others 0.  If @c i is not in [0, n), all elements
+ * are 0.
+ */
+template<class Element = int, class Size>
+auto
+unit(Size n, int i)
+  -> vector_generator_node<op::generate_unit<Element>,
+    detail::generator_size<Size>::value>
+{
+  return {int(n), op::generate_unit<Element>(i)};
+}
+
+/*@}*/
+} // namespace cml
@@ -7,12 +7,33 @@
 #endif
 
 #include <cml/scalar/functions.h>
+#include <cml/scalar/accumulator.h>
 #include <cml/scalar/binary_ops.h>
 #include <cml/vector/scalar_node.h>
 #include <cml/vector/subvector_node.h>
 #include <cml/vector/size_checking.h>
 
 namespace cml {
+namespace detail {
+
+/* Return the squared length of @c v, summed in the accumulator type of its
+ * elements:
+ */
+template<class DT>
+auto
+accumulate_length_squared(const readable_vector<DT>& v)
+  -> accumulator_of_t<value_type_trait_of_t<DT>>
+{
+  using accumulator_type = accumulator_of_t<value_type_trait_of_t<DT>>;
+  cml::check_minimum_size(v, cml::int_c<1>());
+  auto accum = cml::sqr(accumulator_type(v.get(0)));
+  for(int i = 1; i < v.size(); ++i)
+    accum += cml::sqr(accumulator_type(v.get(i)));
+  return accum;
+}
+
+} // namespace detail
+
 /* Public methods: */
 
 template<class DT>
@@ -55,17 +76,16 @@ template<class DT>
 auto
 readable_vector<DT>::length_squared() const -> value_type
 {
-  cml::check_minimum_size(*this, cml::int_c<1>());
-  auto accum = cml::sqr(this->get(0));
-  for(int i = 1; i < this->size(); ++i) accum += cml::sqr(this->get(i));
-  return accum;
+  return value_type(detail::accumulate_length_squared(*this));
 }
 
 template<class DT>
 auto
 readable_vector<DT>::length() const -> value_type
 {
-  return element_traits::sqrt(this->length_squared());
+  using accumulator_type = accumulator_of_t<value_type>;
+  return value_type(scalar_traits<accumulator_type>::sqrt(
+    detail::accumulate_length_squared(*this)));
 }
 
 template<class DT>
@@ -0,0 +1,98 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cml/common/thread_count.h>
+#include <cml/vector/readable_vector.h>
+
+namespace cml {
+/** @defgroup cml_vector_reductions Vector Reductions
+ *
+ * Reductions of the elements of a vector or vector expression to a
+ * scalar.  Expressions are evaluated element by element as they are
+ * reduced, without a temporary.  Sums are accumulated with
+ * accumulator_of_t<> in several independent lanes, combined by pairwise
+ * summation, so the rounding error grows as O(log n) rather than O(n).
+ *
+ * Vectors with at least CML_REDUCTION_PARALLEL_THRESHOLD elements are
+ * split across the number of threads given by @c threads, a thread_count
+ * (e.g. sum(v, thread_count(4)); thread_count(0) selects
+ * std::thread::hardware_concurrency()).  Each thread reduces one
+ * contiguous range, so a parallel sum may differ from a serial one in the
+ * last bits.
+ *
+ * The results of min(), max(), argmin(), argmax() and norm_inf() are
+ * unspecified if @c v contains NaN.
+ */
+/*@{*/
+
+/** Return the sum of the elements of @c v, or 0 if @c v is empty. */
+template<class Sub>
+auto sum(const readable_vector<Sub>& v,
+  thread_count threads = thread_count())
+  -> value_type_trait_of_t<Sub>;
+
+/** Return the smallest element of @c v.
+ *
+ * @throws minimum_vector_size_error if @c v is empty.
+ */
+template<class Sub>
+auto min(const readable_vector<Sub>& v,
+  thread_count threads = thread_count())
+  -> value_type_trait_of_t<Sub>;
+
+/** Return the largest element of @c v.
+ *
+ * @throws minimum_vector_size_error if @c v is empty.
+ */
+template<class Sub>
+auto max(const readable_vector<Sub>& v,
+  thread_count threads = thread_count())
+  -> value_type_trait_of_t<Sub>;
+
+/** Return the index of the first smallest element of @c v.
+ *
+ * @throws minimum_vector_size_error if @c v is empty.
+ */
+template<class Sub>
+int argmin(const readable_vector<Sub>& v,
+  thread_count threads = thread_count());
+
+/** Return the index of the first largest element of @c v.
+ *
+ * @throws minimum_vector_size_error if @c v is empty.
+ */
+template<class Sub>
+int argmax(const readable_vector<Sub>& v,
+  thread_count threads = thread_count());
+
+/** Return the 1-norm of @c v, the sum of the magnitudes of its elements. */
+template<class Sub>
+auto norm_1(const readable_vector<Sub>& v,
+  thread_count threads = thread_count())
+  -> value_type_trait_of_t<Sub>;
+
+/** Return the infinity norm of @c v, the largest magnitude of its
+ * elements, or 0 if @c v is empty.
+ */
+template<class Sub>
+auto norm_inf(const readable_vector<Sub>& v,
+  thread_count threads = thread_count())
+  -> value_type_trait_of_t<Sub>;
+
+/** Return the Frobenius (Euclidean) norm of @c v.  Unlike length(), this
+ * uses pairwise summation and may use several threads.
+ */
+template<class Sub>
+auto norm_frobenius(const readable_vector<Sub>& v,
+  thread_count threads = thread_count())
+  -> value_type_trait_of_t<Sub>;
+
+/*@}*/
+} // namespace cml
+
+#define __CML_VECTOR_REDUCTIONS_TPP
+#include <cml/vector/reductions.tpp>
+#undef __CML_VECTOR_REDUCTIONS_TPP
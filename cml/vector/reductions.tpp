@@ -0,0 +1,169 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#ifndef __CML_VECTOR_REDUCTIONS_TPP
+#  error "vector/reductions.tpp not included correctly"
+#endif
+
+#include <functional>
+#include <utility>
+#include <cml/common/reduction.h>
+#include <cml/scalar/accumulator.h>
+#include <cml/scalar/traits.h>
+#include <cml/vector/size_checking.h>
+
+namespace cml {
+namespace detail {
+
+/* Return the sum of f(i) over the elements of @c v, in the accumulator
+ * type of its elements:
+ */
+template<class Sub, class F>
+auto
+vector_reduce_sum(const readable_vector<Sub>& v, const F& f, int threads)
+  -> accumulator_of_t<value_type_trait_of_t<Sub>>
+{
+  using accumulator_type = accumulator_of_t<value_type_trait_of_t<Sub>>;
+  return reduce_parallel<accumulator_type>(
+    v.size(), 1, threads,
+    [&f](int begin, int end) {
+      return reduce_sum<accumulator_type>(f, begin, end);
+    },
+    [](accumulator_type a, accumulator_type b) { return a + b; });
+}
+
+/* Return the first element of f(i) over @c v that is best by @c better,
+ * and its index:
+ */
+template<class Sub, class F, class Better>
+auto
+vector_reduce_best(const readable_vector<Sub>& v, const F& f, Better better,
+  int threads) -> std::pair<value_type_trait_of_t<Sub>, int>
+{
+  using result_type = std::pair<value_type_trait_of_t<Sub>, int>;
+  cml::check_minimum_size(v, cml::int_c<1>());
+  return reduce_parallel<result_type>(
+    v.size(), 1, threads,
+    [&f, &better](int begin, int end) {
+      result_type r;
+      reduce_best(f, begin, end, better, r.first, r.second);
+      return r;
+    },
+    [&better](const result_type& a, const result_type& b) {
+      return better(b.first, a.first) ? b : a;
+    });
+}
+
+/* Return the element of f(i) over @c v that is best by @c better: */
+template<class Sub, class F, class Better>
+auto
+vector_reduce_extreme(const readable_vector<Sub>& v, const F& f,
+  Better better, int threads) -> value_type_trait_of_t<Sub>
+{
+  using value_type = value_type_trait_of_t<Sub>;
+  cml::check_minimum_size(v, cml::int_c<1>());
+  return reduce_parallel<value_type>(
+    v.size(), 1, threads,
+    [&f, &better](int begin, int end) {
+      return reduce_extreme<value_type>(f, begin, end, better);
+    },
+    [&better](value_type a, value_type b) { return better(b, a) ? b : a; });
+}
+
+} // namespace detail
+
+template<class Sub>
+auto
+sum(const readable_vector<Sub>& v, thread_count threads)
+  -> value_type_trait_of_t<Sub>
+{
+  using value_type = value_type_trait_of_t<Sub>;
+  const auto& a = v.actual();
+  return value_type(detail::vector_reduce_sum(v,
+    [&a](int i) { return a.get(i); }, threads.value));
+}
+
+template<class Sub>
+auto
+min(const readable_vector<Sub>& v, thread_count threads)
+  -> value_type_trait_of_t<Sub>
+{
+  const auto& a = v.actual();
+  return detail::vector_reduce_extreme(v, [&a](int i) { return a.get(i); },
+    std::less<>(), threads.value);
+}
+
+template<class Sub>
+auto
+max(const readable_vector<Sub>& v, thread_count threads)
+  -> value_type_trait_of_t<Sub>
+{
+  const auto& a = v.actual();
+  return detail::vector_reduce_extreme(v, [&a](int i) { return a.get(i); },
+    std::greater<>(), threads.value);
+}
+
+template<class Sub>
+int
+argmin(const readable_vector<Sub>& v, thread_count threads)
+{
+  const auto& a = v.actual();
+  return detail::vector_reduce_best(v, [&a](int i) { return a.get(i); },
+    std::less<>(), threads.value)
+    .second;
+}
+
+template<class Sub>
+int
+argmax(const readable_vector<Sub>& v, thread_count threads)
+{
+  const auto& a = v.actual();
+  return detail::vector_reduce_best(v, [&a](int i) { return a.get(i); },
+    std::greater<>(), threads.value)
+    .second;
+}
+
+template<class Sub>
+auto
+norm_1(const readable_vector<Sub>& v, thread_count threads)
+  -> value_type_trait_of_t<Sub>
+{
+  using value_type = value_type_trait_of_t<Sub>;
+  using value_traits = scalar_traits<value_type>;
+  const auto& a = v.actual();
+  return value_type(detail::vector_reduce_sum(v,
+    [&a](int i) { return value_traits::fabs(a.get(i)); }, threads.value));
+}
+
+template<class Sub>
+auto
+norm_inf(const readable_vector<Sub>& v, thread_count threads)
+  -> value_type_trait_of_t<Sub>
+{
+  using value_type = value_type_trait_of_t<Sub>;
+  using value_traits = scalar_traits<value_type>;
+  if(v.size() == 0) return value_type(0);
+  const auto& a = v.actual();
+  return detail::vector_reduce_extreme(v,
+    [&a](int i) { return value_traits::fabs(a.get(i)); }, std::greater<>(),
+    threads.value);
+}
+
+template<class Sub>
+auto
+norm_frobenius(const readable_vector<Sub>& v, thread_count threads)
+  -> value_type_trait_of_t<Sub>
+{
+  using value_type = value_type_trait_of_t<Sub>;
+  using accumulator_type = accumulator_of_t<value_type>;
+  const auto& a = v.actual();
+  return value_type(scalar_traits<accumulator_type>::sqrt(
+    detail::vector_reduce_sum(v,
+      [&a](int i) {
+        const accumulator_type x(a.get(i));
+        return x * x;
+      },
+      threads.value)));
+}
+} // namespace cml
@@ -74,7 +74,7 @@ struct vector_size_range_error : std::runtime_error
  */
 template<class Sub1, class Sub2>
 void check_same_size(const readable_vector<Sub1>& left,
-  const readable_vector<Sub2>& right);
+  const readable_vector<Sub2>& right) CML_SIZE_CHECK_NOEXCEPT;
 
 /** Front-end for both compile-time and run-time vector binary expression
  * length checking against a fixed-length array.  The first expression must
@@ -97,7 +97,7 @@ void check_same_size(const readable_vector<Sub1>& left,
  */
 template<class Sub1, class Sub2>
 void check_same_size(const readable_vector<Sub1>& left, const Sub2& right,
-  enable_if_array_t<Sub2>* = 0);
+  enable_if_array_t<Sub2>* = 0) CML_SIZE_CHECK_NOEXCEPT;
 
 /** Front-end for run-time vector binary expression length checking.  The
  * first expression must derive from readable_vector, and the second must
@@ -115,7 +115,8 @@ void check_same_size(const readable_vector<Sub1>& left, const Sub2& right,
  * CML_NO_RUNTIME_VECTOR_SIZE_CHECKS at compile time.
  */
 template<class Sub1, class Sub2>
-auto check_same_size(const readable_vector<Sub1>& left, const Sub2& right)
+auto check_same_size(const readable_vector<Sub1>& left,
+  const Sub2& right) CML_SIZE_CHECK_NOEXCEPT
   -> decltype(right.size(), void());
 
 
@@ -131,7 +132,8 @@ auto check_same_size(const readable_vector<Sub1>& left, const Sub2& right)
  * CML_NO_RUNTIME_VECTOR_SIZE_CHECKS at compile time.
  */
 template<class Sub>
-void check_minimum_size(const readable_vector<Sub>& left, int N);
+void check_minimum_size(const readable_vector<Sub>& left,
+  int N) CML_SIZE_CHECK_NOEXCEPT;
 
 /** Front-end for compile-time and run-time minimum vector expression
  * length checking against an integer constant via cml::int_c<N>.  The
@@ -147,7 +149,8 @@ void check_minimum_size(const readable_vector<Sub>& left, int N);
  * CML_NO_RUNTIME_VECTOR_SIZE_CHECKS at compile time.
  */
 template<class Sub, int N>
-void check_minimum_size(const readable_vector<Sub>& left, cml::int_c<N>);
+void check_minimum_size(const readable_vector<Sub>& left,
+  cml::int_c<N>) CML_SIZE_CHECK_NOEXCEPT;
 
 
 /** Front-end for vector expression length checking against a run-time
@@ -161,7 +164,9 @@ void check_minimum_size(const readable_vector<Sub>& left, cml::int_c<N>);
  * @note Run-time checking can be disabled by defining
  * CML_NO_RUNTIME_VECTOR_SIZE_CHECKS at compile time.
  */
-template<class Sub> void check_size(const readable_vector<Sub>& left, int N);
+template<class Sub>
+void check_size(const readable_vector<Sub>& left,
+  int N) CML_SIZE_CHECK_NOEXCEPT;
 
 /** Front-end for compile-time and run-time vector expression length
  * checking against an integer constant via int_c<N>.  The expression must
@@ -177,7 +182,8 @@ template<class Sub> void check_size(const readable_vector<Sub>& left, int N);
  * CML_NO_RUNTIME_VECTOR_SIZE_CHECKS at compile time.
  */
 template<class Sub, int N>
-void check_size(const readable_vector<Sub>& left, cml::int_c<N>);
+void check_size(const readable_vector<Sub>& left,
+  cml::int_c<N>) CML_SIZE_CHECK_NOEXCEPT;
 
 
 /** Front-end for vector expression length checking against a run-time
@@ -194,7 +200,8 @@ void check_size(const readable_vector<Sub>& left, cml::int_c<N>);
  * CML_NO_RUNTIME_VECTOR_SIZE_CHECKS at compile time.
  */
 template<class Sub>
-void check_size_range(const readable_vector<Sub>& left, int Low, int High);
+void check_size_range(const readable_vector<Sub>& left, int Low,
+  int High) CML_SIZE_CHECK_NOEXCEPT;
 
 /** Front-end for compile-time and run-time vector expression length
  * checking against an integer constant inclusive range via int_c<N>.  The
@@ -212,7 +219,7 @@ void check_size_range(const readable_vector<Sub>& left, int Low, int High);
  */
 template<class Sub, int Low, int High>
 void check_size_range(const readable_vector<Sub>& left, cml::int_c<Low>,
-  cml::int_c<High>);
+  cml::int_c<High>) CML_SIZE_CHECK_NOEXCEPT;
 } // namespace cml
 
 #define __CML_VECTOR_SIZE_CHECKING_TPP
@@ -15,14 +15,16 @@ namespace detail {
 /* No-op binary vector expression size checking: */
 template<class Sub1, class Sub2>
 void
-check_same_size(const readable_vector<Sub1>&, const Sub2&, any_size_tag)
+check_same_size(const readable_vector<Sub1>&, const Sub2&,
+  any_size_tag) CML_SIZE_CHECK_NOEXCEPT
 {
 }
 
 /* Compile-time binary vector expression size checking: */
 template<class Sub1, class Sub2>
 void
-check_same_size(const readable_vector<Sub1>&, const Sub2&, fixed_size_tag)
+check_same_size(const readable_vector<Sub1>&, const Sub2&,
+  fixed_size_tag) CML_SIZE_CHECK_NOEXCEPT
 {
   static_assert(array_size_of_c<Sub1>::value == array_size_of_c<Sub2>::value,
     "incompatible vector expression sizes");
@@ -32,10 +34,10 @@ check_same_size(const readable_vector<Sub1>&, const Sub2&, fixed_size_tag)
 template<class Sub1, class Sub2>
 void
 check_same_size(const readable_vector<Sub1>& left, const Sub2& right,
-  dynamic_size_tag)
+  dynamic_size_tag) CML_SIZE_CHECK_NOEXCEPT
 {
 #ifndef CML_NO_RUNTIME_VECTOR_SIZE_CHECKS
-  cml_require(array_size_of(left) == array_size_of(right),
+  cml_size_require(array_size_of(left) == array_size_of(right),
     incompatible_vector_size_error,
     /**/);
 #endif
@@ -45,7 +47,7 @@ check_same_size(const readable_vector<Sub1>& left, const Sub2& right,
 template<class Sub>
 void
 check_minimum_size(const readable_vector<Sub>&, int,
-  enable_if_any_size_t<Sub>* = nullptr)
+  enable_if_any_size_t<Sub>* = nullptr) CML_SIZE_CHECK_NOEXCEPT
 {
 }
 
@@ -53,7 +55,7 @@ check_minimum_size(const readable_vector<Sub>&, int,
 template<class Sub, int N>
 void
 check_minimum_size(const readable_vector<Sub>&, cml::int_c<N>,
-  enable_if_fixed_size_t<Sub>* = nullptr)
+  enable_if_fixed_size_t<Sub>* = nullptr) CML_SIZE_CHECK_NOEXCEPT
 {
   static_assert(array_size_of_c<Sub>::value >= N,
     "vector expression too short");
@@ -62,10 +64,11 @@ check_minimum_size(const readable_vector<Sub>&, cml::int_c<N>,
 /* Run-time minimum vector size checking. */
 template<class Sub>
 void
-check_minimum_size(const readable_vector<Sub>& sub, int N)
+check_minimum_size(const readable_vector<Sub>& sub,
+  int N) CML_SIZE_CHECK_NOEXCEPT
 {
 #ifndef CML_NO_RUNTIME_VECTOR_SIZE_CHECKS
-  cml_require(array_size_of(sub) >= N, minimum_vector_size_error, /**/);
+  cml_size_require(array_size_of(sub) >= N, minimum_vector_size_error, /**/);
 #endif
 }
 
@@ -73,7 +76,7 @@ check_minimum_size(const readable_vector<Sub>& sub, int N)
 template<class Sub>
 void
 check_size(const readable_vector<Sub>&, int,
-  enable_if_any_size_t<Sub>* = nullptr)
+  enable_if_any_size_t<Sub>* = nullptr) CML_SIZE_CHECK_NOEXCEPT
 {
 }
 
@@ -81,7 +84,7 @@ check_size(const readable_vector<Sub>&, int,
 template<class Sub, int N>
 void
 check_size(const readable_vector<Sub>&, cml::int_c<N>,
-  enable_if_fixed_size_t<Sub>* = nullptr)
+  enable_if_fixed_size_t<Sub>* = nullptr) CML_SIZE_CHECK_NOEXCEPT
 {
   static_assert(array_size_of_c<Sub>::value == N,
     "incorrect vector expression size");
@@ -90,10 +93,10 @@ check_size(const readable_vector<Sub>&, cml::int_c<N>,
 /* Run-time vector size checking. */
 template<class Sub>
 void
-check_size(const readable_vector<Sub>& sub, int N)
+check_size(const readable_vector<Sub>& sub, int N) CML_SIZE_CHECK_NOEXCEPT
 {
 #ifndef CML_NO_RUNTIME_VECTOR_SIZE_CHECKS
-  cml_require(array_size_of(sub) == N, vector_size_error, /**/);
+  cml_size_require(array_size_of(sub) == N, vector_size_error, /**/);
 #endif
 }
 
@@ -101,7 +104,7 @@ check_size(const readable_vector<Sub>& sub, int N)
 template<class Sub>
 void
 check_size_range(const readable_vector<Sub>&, int, int,
-  enable_if_any_size_t<Sub>* = nullptr)
+  enable_if_any_size_t<Sub>* = nullptr) CML_SIZE_CHECK_NOEXCEPT
 {
 }
 
@@ -109,7 +112,7 @@ check_size_range(const readable_vector<Sub>&, int, int,
 template<class Sub, int Low, int High>
 void
 check_size_range(const readable_vector<Sub>&, cml::int_c<Low>, cml::int_c<High>,
-  enable_if_fixed_size_t<Sub>* = nullptr)
+  enable_if_fixed_size_t<Sub>* = nullptr) CML_SIZE_CHECK_NOEXCEPT
 {
   static_assert(
     array_size_of_c<Sub>::value >= Low && array_size_of_c<Sub>::value <= High,
@@ -119,10 +122,11 @@ check_size_range(const readable_vector<Sub>&, cml::int_c<Low>, cml::int_c<High>,
 /* Run-time vector size checking. */
 template<class Sub>
 void
-check_size_range(const readable_vector<Sub>& sub, int Low, int High)
+check_size_range(const readable_vector<Sub>& sub, int Low,
+  int High) CML_SIZE_CHECK_NOEXCEPT
 {
 #ifndef CML_NO_RUNTIME_VECTOR_SIZE_CHECKS
-  cml_require(array_size_of(sub) >= Low && array_size_of(sub) <= High,
+  cml_size_require(array_size_of(sub) >= Low && array_size_of(sub) <= High,
     vector_size_range_error,
     /**/);
 #endif
@@ -134,7 +138,7 @@ check_size_range(const readable_vector<Sub>& sub, int Low, int High)
 template<class Sub1, class Sub2>
 void
 check_same_size(const readable_vector<Sub1>& left,
-  const readable_vector<Sub2>& right)
+  const readable_vector<Sub2>& right) CML_SIZE_CHECK_NOEXCEPT
 {
   using tag1 = size_tag_of_t<Sub1>;
   using tag2 = size_tag_of_t<Sub2>;
@@ -145,7 +149,7 @@ check_same_size(const readable_vector<Sub1>& left,
 template<class Sub1, class Sub2>
 void
 check_same_size(const readable_vector<Sub1>& left, const Sub2& right,
-  enable_if_array_t<Sub2>*)
+  enable_if_array_t<Sub2>*) CML_SIZE_CHECK_NOEXCEPT
 {
   using tag1 = size_tag_of_t<Sub1>;
   using tag2 = tag1; // dynamic/dynamic or fixed/fixed.
@@ -154,7 +158,8 @@ check_same_size(const readable_vector<Sub1>& left, const Sub2& right,
 
 template<class Sub1, class Sub2>
 auto
-check_same_size(const readable_vector<Sub1>& left, const Sub2& right)
+check_same_size(const readable_vector<Sub1>& left,
+  const Sub2& right) CML_SIZE_CHECK_NOEXCEPT
   -> decltype(right.size(), void())
 {
   using tag1 = size_tag_of_t<Sub1>;
@@ -166,14 +171,16 @@ check_same_size(const readable_vector<Sub1>& left, const Sub2& right)
 
 template<class Sub>
 void
-check_minimum_size(const readable_vector<Sub>& left, int N)
+check_minimum_size(const readable_vector<Sub>& left,
+  int N) CML_SIZE_CHECK_NOEXCEPT
 {
   detail::check_minimum_size(left, N);
 }
 
 template<class Sub, int N>
 void
-check_minimum_size(const readable_vector<Sub>& left, cml::int_c<N>)
+check_minimum_size(const readable_vector<Sub>& left,
+  cml::int_c<N>) CML_SIZE_CHECK_NOEXCEPT
 {
   detail::check_minimum_size(left, cml::int_c<N>());
 }
@@ -182,14 +189,15 @@ check_minimum_size(const readable_vector<Sub>& left, cml::int_c<N>)
 
 template<class Sub>
 void
-check_size(const readable_vector<Sub>& left, int N)
+check_size(const readable_vector<Sub>& left, int N) CML_SIZE_CHECK_NOEXCEPT
 {
   detail::check_size(left, N);
 }
 
 template<class Sub, int N>
 void
-check_size(const readable_vector<Sub>& left, cml::int_c<N>)
+check_size(const readable_vector<Sub>& left,
+  cml::int_c<N>) CML_SIZE_CHECK_NOEXCEPT
 {
   detail::check_size(left, cml::int_c<N>());
 }
@@ -198,7 +206,8 @@ check_size(const readable_vector<Sub>& left, cml::int_c<N>)
 
 template<class Sub>
 void
-check_size_range(const readable_vector<Sub>& left, int Low, int High)
+check_size_range(const readable_vector<Sub>& left, int Low,
+  int High) CML_SIZE_CHECK_NOEXCEPT
 {
   detail::check_size_range(left, Low, High);
 }
@@ -206,7 +215,7 @@ check_size_range(const readable_vector<Sub>& left, int Low, int High)
 template<class Sub, int Low, int High>
 void
 check_size_range(const readable_vector<Sub>& left, cml::int_c<Low>,
-  cml::int_c<High>)
+  cml::int_c<High>) CML_SIZE_CHECK_NOEXCEPT
 {
   detail::check_size_range(left, cml::int_c<Low>(), cml::int_c<High>());
 }
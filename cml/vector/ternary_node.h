@@ -0,0 +1,139 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cml/vector/readable_vector.h>
+#include <cml/vector/promotion.h>
+
+namespace cml {
+template<class Sub1, class Sub2, class Sub3, class Op>
+class vector_ternary_node;
+
+/** vector_ternary_node<> traits. */
+template<class Sub1, class Sub2, class Sub3, class Op>
+struct vector_traits<vector_ternary_node<Sub1, Sub2, Sub3, Op>>
+{
+  using vector_type = vector_ternary_node<Sub1, Sub2, Sub3, Op>;
+  using first_arg_type = Sub1;
+  using second_arg_type = Sub2;
+  using third_arg_type = Sub3;
+  using first_type = cml::unqualified_type_t<Sub1>;
+  using second_type = cml::unqualified_type_t<Sub2>;
+  using third_type = cml::unqualified_type_t<Sub3>;
+  using first_traits = vector_traits<first_type>;
+  using second_traits = vector_traits<second_type>;
+  using third_traits = vector_traits<third_type>;
+  using element_traits = scalar_traits<typename Op::result_type>;
+  using value_type = typename element_traits::value_type;
+  using immutable_value = value_type;
+
+  /* Determine the common storage type for the node, based on the storage
+   * types of its subexpressions:
+   */
+  using storage_type = vector_binary_storage_promote_t<
+    vector_binary_storage_promote_t<storage_type_of_t<first_traits>,
+      storage_type_of_t<second_traits>>,
+    storage_type_of_t<third_traits>>;
+
+  /* Traits and types for the storage: */
+  using size_tag = typename storage_type::size_tag;
+
+  /* Array size: */
+  static const int array_size = storage_type::array_size;
+};
+
+/** Represents a ternary vector operation, such as a fused multiply-add, in
+ * an expression tree.
+ */
+template<class Sub1, class Sub2, class Sub3, class Op>
+class vector_ternary_node
+  : public readable_vector<vector_ternary_node<Sub1, Sub2, Sub3, Op>>
+{
+  public:
+  using node_type = vector_ternary_node<Sub1, Sub2, Sub3, Op>;
+  using readable_type = readable_vector<node_type>;
+  using traits_type = vector_traits<node_type>;
+  using first_arg_type = typename traits_type::first_arg_type;
+  using second_arg_type = typename traits_type::second_arg_type;
+  using third_arg_type = typename traits_type::third_arg_type;
+  using first_type = typename traits_type::first_type;
+  using second_type = typename traits_type::second_type;
+  using third_type = typename traits_type::third_type;
+  using element_traits = typename traits_type::element_traits;
+  using value_type = typename traits_type::value_type;
+  using immutable_value = typename traits_type::immutable_value;
+  using storage_type = typename traits_type::storage_type;
+  using size_tag = typename traits_type::size_tag;
+
+  public:
+  /** Constant containing the array size. */
+  static const int array_size = traits_type::array_size;
+
+  public:
+  /** Construct from the wrapped sub-expressions.  Sub1, Sub2 and Sub3
+   * must be lvalue reference or rvalue reference types.
+   *
+   * @throws incompatible_vector_size_error at run-time if any of the
+   * subexpressions is a dynamically-sized vector, and the sizes differ.
+   * If all of them are fixed-size expressions, then the sizes are checked
+   * at compile time.
+   */
+  vector_ternary_node(Sub1 first, Sub2 second,
+    Sub3 third) CML_SIZE_CHECK_NOEXCEPT;
+
+  /** Move constructor. */
+  vector_ternary_node(node_type&& other);
+
+  /** Copy constructor. */
+  vector_ternary_node(const node_type& other);
+
+  protected:
+  /** @name readable_vector Interface */
+  /*@{*/
+
+  friend readable_type;
+
+  /** Return the size of the vector expression. */
+  int i_size() const;
+
+  /** Apply the operator to element @c i of the subexpressions and return
+   * the result.
+   */
+  immutable_value i_get(int i) const;
+
+  /*@}*/
+
+
+  protected:
+  /** The types used to store the subexpressions.  An expression is stored
+   * as a copy if its type is an rvalue reference (temporary), or by const
+   * reference if it is an lvalue reference.
+   */
+  using first_wrap_type = cml::if_t<std::is_lvalue_reference<Sub1>::value,
+    const first_type&, first_type>;
+  using second_wrap_type = cml::if_t<std::is_lvalue_reference<Sub2>::value,
+    const second_type&, second_type>;
+  using third_wrap_type = cml::if_t<std::is_lvalue_reference<Sub3>::value,
+    const third_type&, third_type>;
+
+  protected:
+  /** The wrapped first subexpression. */
+  first_wrap_type m_first;
+
+  /** The wrapped second subexpression. */
+  second_wrap_type m_second;
+
+  /** The wrapped third subexpression. */
+  third_wrap_type m_third;
+
+  private:
+  // Not assignable.
+  node_type& operator=(const node_type&);
+};
+} // namespace cml
+
+#define __CML_VECTOR_TERNARY_NODE_TPP
+#include <cml/vector/ternary_node.tpp>
+#undef __CML_VECTOR_TERNARY_NODE_TPP
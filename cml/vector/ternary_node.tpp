@@ -0,0 +1,63 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#ifndef __CML_VECTOR_TERNARY_NODE_TPP
+#  error "vector/ternary_node.tpp not included correctly"
+#endif
+
+#include <cml/vector/size_checking.h>
+
+namespace cml {
+/* vector_ternary_node 'structors: */
+
+template<class Sub1, class Sub2, class Sub3, class Op>
+vector_ternary_node<Sub1, Sub2, Sub3, Op>::vector_ternary_node(Sub1 first,
+  Sub2 second, Sub3 third) CML_SIZE_CHECK_NOEXCEPT
+  : m_first(std::move(first))
+    , m_second(std::move(second))
+    , m_third(std::move(third))
+{
+  cml::check_same_size(this->m_first, this->m_second);
+  cml::check_same_size(this->m_first, this->m_third);
+}
+
+template<class Sub1, class Sub2, class Sub3, class Op>
+vector_ternary_node<Sub1, Sub2, Sub3, Op>::vector_ternary_node(
+  node_type&& other)
+  : m_first(std::move(other.m_first))
+    , m_second(std::move(other.m_second))
+    , m_third(std::move(other.m_third))
+{
+}
+
+template<class Sub1, class Sub2, class Sub3, class Op>
+vector_ternary_node<Sub1, Sub2, Sub3, Op>::vector_ternary_node(
+  const node_type& other)
+  : m_first(other.m_first)
+    , m_second(other.m_second)
+    , m_third(other.m_third)
+{
+}
+
+
+/* Internal methods: */
+
+/* readable_vector interface: */
+
+template<class Sub1, class Sub2, class Sub3, class Op>
+int
+vector_ternary_node<Sub1, Sub2, Sub3, Op>::i_size() const
+{
+  return this->m_first.size();
+}
+
+template<class Sub1, class Sub2, class Sub3, class Op>
+auto
+vector_ternary_node<Sub1, Sub2, Sub3, Op>::i_get(int i) const
+  -> immutable_value
+{
+  return Op().apply(this->m_first.get(i), this->m_second.get(i),
+    this->m_third.get(i));
+}
+} // namespace cml
@@ -0,0 +1,40 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cml/scalar/ternary_ops.h>
+#include <cml/vector/ternary_node.h>
+
+namespace cml {
+/** Helper function to generate a vector_ternary_node from three vector
+ * types (i.e. derived from readable_vector<>).
+ */
+template<class Op, class Sub1, class Sub2, class Sub3,
+  enable_if_vector_t<Sub1>* = nullptr, enable_if_vector_t<Sub2>* = nullptr,
+  enable_if_vector_t<Sub3>* = nullptr>
+auto
+make_vector_ternary_node(Sub1&& sub1, Sub2&& sub2, Sub3&& sub3)
+  -> vector_ternary_node<actual_operand_type_of_t<decltype(sub1)>,
+    actual_operand_type_of_t<decltype(sub2)>,
+    actual_operand_type_of_t<decltype(sub3)>, Op>
+{
+  static_assert(
+    std::is_same<decltype(sub1), decltype(std::forward<Sub1>(sub1))>::value,
+    "internal error: unexpected expression type (sub1)");
+  static_assert(
+    std::is_same<decltype(sub2), decltype(std::forward<Sub2>(sub2))>::value,
+    "internal error: unexpected expression type (sub2)");
+  static_assert(
+    std::is_same<decltype(sub3), decltype(std::forward<Sub3>(sub3))>::value,
+    "internal error: unexpected expression type (sub3)");
+
+  /* Deduce the operand types of the subexpressions (&, const&, &&): */
+  using sub1_type = actual_operand_type_of_t<decltype(sub1)>;
+  using sub2_type = actual_operand_type_of_t<decltype(sub2)>;
+  using sub3_type = actual_operand_type_of_t<decltype(sub3)>;
+  return vector_ternary_node<sub1_type, sub2_type, sub3_type, Op>(
+    (sub1_type) sub1, (sub2_type) sub2, (sub3_type) sub3);
+}
+} // namespace cml
@@ -7,6 +7,7 @@
 #endif
 
 #include <random>
+#include <cml/common/instrument.h>
 #include <cml/scalar/binary_ops.h>
 #include <cml/vector/detail/check_or_resize.h>
 
@@ -395,8 +396,10 @@ template<class ODT>
 DT&
 writable_vector<DT>::assign(const readable_vector<ODT>& other)
 {
+  detail::instrument_scope scope("vector_assign");
   detail::check_or_resize(*this, other);
   for(int i = 0; i < this->size(); ++i) this->put(i, other.get(i));
+  detail::instrument_evaluation("vector_assign", this->size());
   return this->actual();
 }
 
@@ -0,0 +1,160 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#define CML_ENABLE_INSTRUMENTATION
+
+// Make sure the main header compiles cleanly:
+#include <cml/common/instrument.h>
+
+#include <string>
+#include <vector>
+#include <cml/vector.h>
+#include <cml/matrix.h>
+#include <cml/matrix/determinant.h>
+#include <cml/matrix/inverse.h>
+#include <cml/matrix/lu.h>
+
+/* Testing headers: */
+#include "catch_runner.h"
+
+CATCH_TEST_CASE("enabled1")
+{
+  CATCH_CHECK(cml::instrument_enabled());
+}
+
+CATCH_TEST_CASE("allocation1")
+{
+  cml::instrument_reset();
+  cml::matrixd M(3, 4);
+  cml::vectord v(5);
+
+  auto other = cml::instrument_query("other");
+  CATCH_CHECK(other.allocations == 2);
+  CATCH_CHECK(other.allocated_bytes == 17 * long(sizeof(double)));
+
+  /* Same-size resizes do not allocate: */
+  M.resize(4, 3);
+  CATCH_CHECK(cml::instrument_query("other").allocations == 2);
+}
+
+CATCH_TEST_CASE("product1")
+{
+  cml::matrixd A(4, 5), B(5, 6);
+  A.zero();
+  B.zero();
+  cml::vectord x(5);
+  x.zero();
+
+  cml::instrument_reset();
+  cml::matrixd C = A * B;
+  auto product = cml::instrument_query("matrix_product");
+  CATCH_CHECK(product.temporaries == 1);
+  CATCH_CHECK(product.allocations == 1);
+  CATCH_CHECK(product.allocated_bytes == 24 * long(sizeof(double)));
+  CATCH_CHECK(product.elements == 24);
+
+  cml::vectord y = A * x;
+  auto mv = cml::instrument_query("matrix_vector_product");
+  CATCH_CHECK(mv.temporaries == 1);
+  CATCH_CHECK(mv.elements == 4);
+  CATCH_CHECK(C.rows() == 4);
+  CATCH_CHECK(y.size() == 4);
+}
+
+CATCH_TEST_CASE("fixed1")
+{
+  /* Fixed-size operations count temporaries but do not allocate: */
+  cml::matrix33d A;
+  A.identity();
+
+  cml::instrument_reset();
+  cml::matrix33d B = A * A;
+  auto product = cml::instrument_query("matrix_product");
+  CATCH_CHECK(product.temporaries == 1);
+  CATCH_CHECK(product.allocations == 0);
+  CATCH_CHECK(cml::instrument_total().allocations == 0);
+  CATCH_CHECK(B(0, 0) == 1.);
+}
+
+CATCH_TEST_CASE("factorization1")
+{
+  cml::matrixd M(3, 3, 4., 1., 0., 1., 4., 1., 0., 1., 4.);
+
+  cml::instrument_reset();
+  auto Minv = cml::inverse(M);
+  CATCH_CHECK(cml::instrument_query("inverse").temporaries == 1);
+  CATCH_CHECK(cml::instrument_query("inverse").allocations == 1);
+
+  auto LU = cml::lu(M);
+  CATCH_CHECK(cml::instrument_query("lu").temporaries == 1);
+
+  cml::vectord b(1., 2., 3.);
+  auto x = cml::lu_solve(LU, b);
+  CATCH_CHECK(cml::instrument_query("lu_solve").temporaries == 2);
+  CATCH_CHECK(Minv.rows() == 3);
+  CATCH_CHECK(x.size() == 3);
+}
+
+CATCH_TEST_CASE("determinant1")
+{
+  cml::matrixd M(5, 5);
+  M.identity();
+
+  /* The copy of M fits in the small buffer: */
+  cml::instrument_reset();
+  CATCH_CHECK(cml::determinant(M) == 1.);
+  auto det = cml::instrument_query("determinant");
+  CATCH_CHECK(det.temporaries == 1);
+  CATCH_CHECK(det.allocations == 0);
+
+  /* A larger copy goes to the heap: */
+  cml::matrixd N(20, 20);
+  N.identity();
+  cml::instrument_reset();
+  CATCH_CHECK(cml::determinant(N) == 1.);
+  det = cml::instrument_query("determinant");
+  CATCH_CHECK(det.temporaries == 1);
+  CATCH_CHECK(det.allocations == 1);
+  CATCH_CHECK(det.allocated_bytes == 400 * long(sizeof(double)));
+}
+
+CATCH_TEST_CASE("assign1")
+{
+  cml::vectord a(1., 2., 3.), b(4., 5., 6.);
+  cml::vectord c(3);
+
+  cml::instrument_reset();
+  c = a + b;
+  auto assign = cml::instrument_query("vector_assign");
+  CATCH_CHECK(assign.elements == 3);
+  CATCH_CHECK(assign.allocations == 0);
+  CATCH_CHECK(assign.temporaries == 0);
+}
+
+CATCH_TEST_CASE("callback1")
+{
+  std::vector<std::string> ops;
+  long long bytes = 0;
+  cml::instrument_set_callback(
+    [&](cml::instrument_kind kind, const char* op, long long n) {
+      ops.push_back(op);
+      if(kind == cml::instrument_allocation_c) bytes += n;
+    });
+
+  cml::matrixd A(2, 2, 1., 2., 3., 4.);
+  cml::matrixd B = A * A;
+  cml::instrument_set_callback(nullptr);
+  cml::matrixd C(8, 8);
+
+  /* A, then the product temporary; C is not traced: */
+  CATCH_REQUIRE(ops.size() >= 3);
+  CATCH_CHECK(ops[0] == "other");
+  CATCH_CHECK(ops[1] == "matrix_product");
+  CATCH_CHECK(bytes >= 8 * long(sizeof(double)));
+  CATCH_CHECK(bytes < 64 * long(sizeof(double)));
+  CATCH_CHECK(B(0, 0) == 7.);
+
+  cml::instrument_reset();
+  CATCH_CHECK(cml::instrument_snapshot().empty());
+}
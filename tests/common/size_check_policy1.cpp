@@ -0,0 +1,49 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+/* Disable run-time size checks for this test, overriding any policy set
+ * for the cml target:
+ */
+#ifdef CML_SIZE_CHECK_POLICY
+#  undef CML_SIZE_CHECK_POLICY
+#endif
+#define CML_SIZE_CHECK_POLICY CML_SIZE_CHECK_NONE
+
+#include <cml/common/exception.h>
+
+#include <type_traits>
+#include <utility>
+#include <cml/vector.h>
+#include <cml/matrix.h>
+#include <cml/mathlib/matrix/size_checking.h>
+
+/* Testing headers: */
+#include "catch_runner.h"
+
+CATCH_TEST_CASE("none, noexcept1")
+{
+  cml::vectord a(3), b(4);
+  cml::matrixd M(2, 3);
+  CATCH_CHECK(noexcept(cml::check_same_size(a, b)));
+  CATCH_CHECK(noexcept(cml::check_size(a, 3)));
+  CATCH_CHECK(noexcept(cml::check_square(M)));
+  CATCH_CHECK(noexcept(cml::check_same_inner_size(M, a)));
+  CATCH_CHECK(noexcept(cml::check_affine_3D(M)));
+
+  using node_type = cml::vector_binary_node<const cml::vectord&,
+    const cml::vectord&, cml::op::binary_plus<double, double>>;
+  CATCH_CHECK((std::is_nothrow_constructible_v<node_type, const cml::vectord&,
+    const cml::vectord&>));
+}
+
+CATCH_TEST_CASE("none, unchecked1")
+{
+  /* Mismatched sizes are not reported: */
+  cml::vectord a(3), b(4);
+  cml::matrixd M(2, 3);
+  cml::check_same_size(a, b);
+  cml::check_square(M);
+  auto node = a + b;
+  CATCH_CHECK(node.size() == 3);
+}
@@ -0,0 +1,85 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+/* Deterministic operands and comparisons shared by the matrix tests. */
+namespace cml_test {
+
+/* Fill @c A with the deterministic M x N pattern sin(1 + i + 3j + shift).
+ * The pattern has rank 2, so use fill_regular() for factorization tests.
+ */
+template<class Matrix>
+void
+fill_matrix(Matrix& A, int M, int N, double shift = 0.)
+{
+  A.resize(M, N);
+  for(int i = 0; i < M; ++i)
+    for(int j = 0; j < N; ++j) A(i, j) = std::sin(1. + i + 3. * j + shift);
+}
+
+/* Fill @c A with a deterministic, well-conditioned M x N pattern. */
+template<class Matrix>
+void
+fill_regular(Matrix& A, int M, int N)
+{
+  A.resize(M, N);
+  for(int i = 0; i < M; ++i)
+    for(int j = 0; j < N; ++j)
+      A(i, j) = std::sin(1. + i * 1.3 + j * j * .7) + (i == j ? 2. : 0.);
+}
+
+/* Fill @c A with A(i,j) = 10*i + j, so elements name their position. */
+template<class Matrix>
+void
+fill_indices(Matrix& A)
+{
+  for(int i = 0; i < A.rows(); ++i)
+    for(int j = 0; j < A.cols(); ++j) A(i, j) = 10. * i + j;
+}
+
+/* Fill @c v with the deterministic N-element pattern cos(2i + shift). */
+template<class Vector>
+void
+fill_vector(Vector& v, int N, double shift = 0.)
+{
+  v.resize(N);
+  for(int i = 0; i < N; ++i) v[i] = std::cos(2. * i + shift);
+}
+
+/* Return the largest element of |A - B| on or below the diagonal if @c
+ * lower is true, or over all of A otherwise.
+ */
+template<class Matrix1, class Matrix2>
+double
+max_difference(const Matrix1& A, const Matrix2& B, bool lower = false)
+{
+  double err = 0.;
+  for(int i = 0; i < A.rows(); ++i)
+    for(int j = 0; j < (lower ? i + 1 : A.cols()); ++j)
+      err = std::max(err, double(std::fabs(A(i, j) - B(i, j))));
+  return err;
+}
+
+/* Return the largest deviation of the columns of @c Q from an orthonormal
+ * set.
+ */
+template<class Matrix>
+double
+orthonormality_error(const Matrix& Q)
+{
+  double err = 0.;
+  for(int i = 0; i < Q.cols(); ++i)
+    for(int j = 0; j < Q.cols(); ++j) {
+      double d = 0.;
+      for(int k = 0; k < Q.rows(); ++k) d += Q(k, i) * Q(k, j);
+      err = std::max(err, std::fabs(d - (i == j ? 1. : 0.)));
+    }
+  return err;
+}
+
+} // namespace cml_test
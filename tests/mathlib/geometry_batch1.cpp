@@ -0,0 +1,119 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#include <limits>
+#include <random>
+
+// Make sure the main header compiles cleanly:
+#include <cml/mathlib/geometry/batch.h>
+
+#include <cml/vector.h>
+#include <cml/mathlib/geometry/intersect.h>
+
+/* Testing headers: */
+#include "catch_runner.h"
+
+namespace {
+
+cml::vector3d
+random_point(std::mt19937& gen, double lo, double hi)
+{
+  std::uniform_real_distribution<double> d(lo, hi);
+  return cml::vector3d(d(gen), d(gen), d(gen));
+}
+
+} // namespace
+
+CATCH_TEST_CASE("batch, aabb1")
+{
+  std::mt19937 gen(1);
+  cml::aabb_batch<double> boxes;
+  for(int i = 0; i < 500; ++i) {
+    cml::vector3d c = random_point(gen, -10., 10.);
+    cml::vector3d e = random_point(gen, .1, 1.);
+    boxes.push_back(cml::aabbd(c - e, c + e));
+  }
+  CATCH_REQUIRE(boxes.size() == 500);
+
+  cml::rayd r(cml::vector3d(-12., .5, .3), cml::vector3d(1., .1, -.05));
+  std::vector<double> t;
+  cml::intersect(r, boxes, t);
+  CATCH_REQUIRE(t.size() == 500);
+
+  int hits = 0;
+  for(int i = 0; i < boxes.size(); ++i) {
+    double t0, t1;
+    bool hit = cml::intersect(r, boxes.get(i), t0, t1);
+    CATCH_CHECK(hit == (t[i] != std::numeric_limits<double>::infinity()));
+    if(hit) {
+      CATCH_CHECK(t[i] == Approx(t0).epsilon(1e-12));
+      ++hits;
+    }
+  }
+  CATCH_CHECK(hits > 0);
+
+  double t_min;
+  int nearest = cml::intersect_nearest(r, boxes, t_min);
+  CATCH_REQUIRE(nearest != -1);
+  for(int i = 0; i < boxes.size(); ++i) CATCH_CHECK(t_min <= t[i]);
+}
+
+CATCH_TEST_CASE("batch, triangle1")
+{
+  std::mt19937 gen(2);
+  cml::triangle_batch<double> tris;
+  for(int i = 0; i < 500; ++i) {
+    cml::vector3d v0 = random_point(gen, -5., 5.);
+    tris.push_back(cml::triangled(v0, v0 + random_point(gen, -2., 2.),
+      v0 + random_point(gen, -2., 2.)));
+  }
+
+  cml::rayd r(cml::vector3d(0., 0., -10.), cml::vector3d(.05, -.02, 1.));
+  for(bool cull : {false, true}) {
+    std::vector<double> t;
+    cml::intersect(r, tris, t, cull);
+    CATCH_REQUIRE(t.size() == 500);
+
+    int hits = 0;
+    for(int i = 0; i < tris.size(); ++i) {
+      double ti, u, v;
+      bool hit = cml::intersect(r, tris.get(i), ti, u, v, cull);
+      CATCH_CHECK(hit == (t[i] != std::numeric_limits<double>::infinity()));
+      if(hit) {
+        CATCH_CHECK(t[i] == Approx(ti).epsilon(1e-9));
+        ++hits;
+      }
+    }
+    CATCH_CHECK(hits > 0);
+
+    double t_min;
+    int nearest = cml::intersect_nearest(r, tris, t_min, cull);
+    CATCH_REQUIRE(nearest != -1);
+    CATCH_CHECK(t_min == t[nearest]);
+  }
+}
+
+CATCH_TEST_CASE("batch, frustum1")
+{
+  cml::planed planes[6] = {
+    cml::planed(1., 0., 0., 1.), cml::planed(-1., 0., 0., 1.),
+    cml::planed(0., 1., 0., 1.), cml::planed(0., -1., 0., 1.),
+    cml::planed(0., 0., 1., 1.), cml::planed(0., 0., -1., 1.)};
+
+  std::mt19937 gen(3);
+  cml::aabb_batch<double> boxes;
+  for(int i = 0; i < 200; ++i) {
+    cml::vector3d c = random_point(gen, -3., 3.);
+    cml::vector3d e = random_point(gen, .1, .5);
+    boxes.push_back(cml::aabbd(c - e, c + e));
+  }
+
+  std::vector<unsigned char> visible;
+  cml::intersect_frustum(planes, boxes, visible);
+  CATCH_REQUIRE(visible.size() == 200);
+  for(int i = 0; i < boxes.size(); ++i) {
+    bool expected = cml::intersect_frustum(planes, boxes.get(i));
+    CATCH_CHECK(bool(visible[i]) == expected);
+  }
+}
@@ -0,0 +1,184 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+// Make sure the main header compiles cleanly:
+#include <cml/mathlib/geometry/intersect.h>
+
+#include <cml/vector.h>
+#include <cml/matrix.h>
+#include <cml/mathlib/frustum.h>
+#include <cml/mathlib/matrix/projection.h>
+
+/* Testing headers: */
+#include "catch_runner.h"
+
+CATCH_TEST_CASE("primitives, aabb1")
+{
+  cml::aabbd box;
+  CATCH_CHECK(box.empty());
+  box.extend(cml::vector3d(1., 2., 3.)).extend(cml::vector3d(-1., 0., 1.));
+  CATCH_CHECK(!box.empty());
+  CATCH_CHECK(box.center() == cml::vector3d(0., 1., 2.));
+  CATCH_CHECK(box.extent() == cml::vector3d(1., 1., 1.));
+  CATCH_CHECK(box.contains(cml::vector3d(.5, .5, 1.5)));
+  CATCH_CHECK(!box.contains(cml::vector3d(.5, .5, 3.5)));
+}
+
+CATCH_TEST_CASE("primitives, plane1")
+{
+  cml::planed p(cml::vector3d(0., 0., 2.), cml::vector3d(0., 0., 4.));
+  cml::vector3d x(1., 1., 3.);
+  CATCH_CHECK(p.distance(x) == Approx(4.).epsilon(1e-12));
+  p.normalize();
+  CATCH_CHECK(p.distance(x) == Approx(1.).epsilon(1e-12));
+
+  double abcd[4] = {1., 0., 0., -2.};
+  cml::planed q(abcd);
+  CATCH_CHECK(q.distance(cml::vector3d(3., 0., 0.))
+    == Approx(1.).epsilon(1e-12));
+}
+
+CATCH_TEST_CASE("primitives, triangle1")
+{
+  cml::triangled tri(cml::vector3d(0., 0., 0.), cml::vector3d(2., 0., 0.),
+    cml::vector3d(0., 2., 0.));
+  CATCH_CHECK(tri.normal() == cml::vector3d(0., 0., 4.));
+  CATCH_CHECK(tri.area() == Approx(2.).epsilon(1e-12));
+}
+
+CATCH_TEST_CASE("ray, aabb1")
+{
+  cml::aabbd box(cml::vector3d(-1., -1., -1.), cml::vector3d(1., 1., 1.));
+  double t0, t1;
+
+  cml::rayd r(cml::vector3d(-5., 0., 0.), cml::vector3d(1., 0., 0.));
+  CATCH_REQUIRE(cml::intersect(r, box, t0, t1));
+  CATCH_CHECK(t0 == Approx(4.).epsilon(1e-12));
+  CATCH_CHECK(t1 == Approx(6.).epsilon(1e-12));
+
+  cml::rayd inside(cml::vector3d(0., 0., 0.), cml::vector3d(0., 1., 1.));
+  CATCH_REQUIRE(cml::intersect(inside, box, t0, t1));
+  CATCH_CHECK(t0 == 0.);
+
+  cml::rayd away(cml::vector3d(-5., 0., 0.), cml::vector3d(-1., 0., 0.));
+  CATCH_CHECK(!cml::intersect(away, box, t0, t1));
+
+  cml::rayd miss(cml::vector3d(-5., 2., 0.), cml::vector3d(1., 0., 0.));
+  CATCH_CHECK(!cml::intersect(miss, box, t0, t1));
+}
+
+CATCH_TEST_CASE("ray, sphere1")
+{
+  cml::sphered s(cml::vector3d(0., 0., 5.), 1.);
+  double t;
+  cml::rayd r(cml::vector3d(0., 0., 0.), cml::vector3d(0., 0., 2.));
+  CATCH_REQUIRE(cml::intersect(r, s, t));
+  CATCH_CHECK(t == Approx(2.).epsilon(1e-12));
+
+  cml::rayd inside(cml::vector3d(0., 0., 5.), cml::vector3d(1., 0., 0.));
+  CATCH_REQUIRE(cml::intersect(inside, s, t));
+  CATCH_CHECK(t == Approx(1.).epsilon(1e-12));
+
+  cml::rayd miss(cml::vector3d(0., 2., 0.), cml::vector3d(0., 0., 1.));
+  CATCH_CHECK(!cml::intersect(miss, s, t));
+}
+
+CATCH_TEST_CASE("ray, plane1")
+{
+  cml::planed p(0., 1., 0., -2.);
+  double t;
+  cml::rayd r(cml::vector3d(0., 0., 0.), cml::vector3d(0., 1., 1.));
+  CATCH_REQUIRE(cml::intersect(r, p, t));
+  CATCH_CHECK(t == Approx(2.).epsilon(1e-12));
+
+  cml::rayd parallel(cml::vector3d(0., 0., 0.), cml::vector3d(1., 0., 0.));
+  CATCH_CHECK(!cml::intersect(parallel, p, t));
+}
+
+CATCH_TEST_CASE("ray, triangle1")
+{
+  cml::triangled tri(cml::vector3d(0., 0., 0.), cml::vector3d(1., 0., 0.),
+    cml::vector3d(0., 1., 0.));
+  double t, u, v;
+
+  cml::rayd down(cml::vector3d(.25, .5, 2.), cml::vector3d(0., 0., -1.));
+  CATCH_REQUIRE(cml::intersect(down, tri, t, u, v));
+  CATCH_CHECK(t == Approx(2.).epsilon(1e-12));
+  CATCH_CHECK(u == Approx(.25).epsilon(1e-12));
+  CATCH_CHECK(v == Approx(.5).epsilon(1e-12));
+  CATCH_CHECK(cml::intersect(down, tri, t, u, v, true));
+
+  cml::rayd up(cml::vector3d(.25, .5, -2.), cml::vector3d(0., 0., 1.));
+  CATCH_CHECK(cml::intersect(up, tri, t, u, v));
+  CATCH_CHECK(!cml::intersect(up, tri, t, u, v, true));
+
+  cml::rayd miss(cml::vector3d(.75, .5, 2.), cml::vector3d(0., 0., -1.));
+  CATCH_CHECK(!cml::intersect(miss, tri, t, u, v));
+}
+
+CATCH_TEST_CASE("overlap1")
+{
+  cml::aabbd a(cml::vector3d(0., 0., 0.), cml::vector3d(1., 1., 1.));
+  cml::aabbd b(cml::vector3d(.5, .5, .5), cml::vector3d(2., 2., 2.));
+  cml::aabbd c(cml::vector3d(1.5, 0., 0.), cml::vector3d(2., 1., 1.));
+  CATCH_CHECK(cml::intersect(a, b));
+  CATCH_CHECK(!cml::intersect(a, c));
+
+  cml::sphered s(cml::vector3d(2., .5, .5), 1.1);
+  CATCH_CHECK(cml::intersect(s, a));
+  CATCH_CHECK(!cml::intersect(cml::sphered(cml::vector3d(3., 3., 3.), 1.), a));
+  CATCH_CHECK(cml::intersect(s, cml::sphered(cml::vector3d(0., .5, .5), 1.)));
+}
+
+CATCH_TEST_CASE("frustum, box1")
+{
+  /* The unit cube [-1,1]^3 as 6 inward-facing planes: */
+  cml::planed planes[6] = {
+    cml::planed(1., 0., 0., 1.), cml::planed(-1., 0., 0., 1.),
+    cml::planed(0., 1., 0., 1.), cml::planed(0., -1., 0., 1.),
+    cml::planed(0., 0., 1., 1.), cml::planed(0., 0., -1., 1.)};
+
+  cml::aabbd inside(cml::vector3d(-.5, -.5, -.5), cml::vector3d(.5, .5, .5));
+  cml::aabbd straddle(cml::vector3d(.5, .5, .5), cml::vector3d(2., 2., 2.));
+  cml::aabbd outside(cml::vector3d(1.5, 0., 0.), cml::vector3d(2., 1., 1.));
+  CATCH_CHECK(cml::intersect_frustum(planes, inside));
+  CATCH_CHECK(cml::intersect_frustum(planes, straddle));
+  CATCH_CHECK(!cml::intersect_frustum(planes, outside));
+
+  CATCH_CHECK(cml::intersect_frustum(planes,
+    cml::sphered(cml::vector3d(1.5, 0., 0.), .6)));
+  CATCH_CHECK(!cml::intersect_frustum(planes,
+    cml::sphered(cml::vector3d(1.5, 0., 0.), .4)));
+
+  auto corner = cml::intersect_planes(planes[1], planes[3], planes[5]);
+  CATCH_CHECK(corner[0] == Approx(1.).epsilon(1e-12));
+  CATCH_CHECK(corner[1] == Approx(1.).epsilon(1e-12));
+  CATCH_CHECK(corner[2] == Approx(1.).epsilon(1e-12));
+}
+
+CATCH_TEST_CASE("frustum, corners1")
+{
+  /* Perspective frustum with near plane z = -1 and far plane z = -10: */
+  cml::matrix44d P;
+  cml::matrix_perspective(P, -1., 1., -1., 1., 1., 10., cml::right_handed,
+    cml::z_clip_neg_one);
+  double m[6][4];
+  cml::extract_frustum_planes(P, m, cml::z_clip_neg_one);
+  cml::planed planes[6];
+  for(int i = 0; i < 6; ++i)
+    planes[i] = cml::planed(m[i][0], m[i][1], m[i][2], m[i][3]);
+
+  cml::vector3d corners[8];
+  cml::frustum_corners(planes, corners);
+  const double x[4] = {-1., 1., 1., -1.}, y[4] = {-1., -1., 1., 1.};
+  for(int k = 0; k < 2; ++k) {
+    const double z = k == 0 ? 1. : 10.;
+    for(int c = 0; c < 4; ++c) {
+      const auto& p = corners[4 * k + c];
+      CATCH_CHECK(p[0] == Approx(x[c] * z).epsilon(1e-9));
+      CATCH_CHECK(p[1] == Approx(y[c] * z).epsilon(1e-9));
+      CATCH_CHECK(p[2] == Approx(-z).epsilon(1e-9));
+    }
+  }
+}
@@ -0,0 +1,52 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+// Make sure the main header compiles cleanly:
+#include <cml/mathlib/geometry/pick.h>
+
+#include <cml/vector.h>
+#include <cml/matrix.h>
+#include <cml/mathlib/constants.h>
+#include <cml/mathlib/matrix/projection.h>
+#include <cml/mathlib/matrix/transform.h>
+
+/* Testing headers: */
+#include "catch_runner.h"
+
+CATCH_TEST_CASE("pick, center1")
+{
+  cml::matrix44d view, projection;
+  cml::matrix_look_at_RH(view, cml::vector3d(0., 0., 10.),
+    cml::vector3d(0., 0., 0.), cml::vector3d(0., 1., 0.));
+  cml::matrix_perspective_yfov_RH(projection, cml::rad(60.), 4. / 3., 1.,
+    100., cml::z_clip_neg_one);
+
+  auto r = cml::make_pick_ray(400., 300., 0., 0., 800., 600., view,
+    projection, cml::z_clip_neg_one);
+  CATCH_CHECK(r.origin[0] == Approx(0.).margin(1e-12));
+  CATCH_CHECK(r.origin[1] == Approx(0.).margin(1e-12));
+  CATCH_CHECK(r.origin[2] == Approx(9.).epsilon(1e-12));
+  CATCH_CHECK(r.direction[2] == Approx(-1.).epsilon(1e-12));
+}
+
+CATCH_TEST_CASE("pick, corner1")
+{
+  cml::matrix44d view, projection;
+  cml::matrix_look_at_RH(view, cml::vector3d(0., 0., 10.),
+    cml::vector3d(0., 0., 0.), cml::vector3d(0., 1., 0.));
+  cml::matrix_perspective_yfov_RH(projection, cml::rad(90.), 1., 1., 100.,
+    cml::z_clip_zero);
+
+  /* The top-right corner of a 90 degree frustum on the near plane: */
+  auto r = cml::make_pick_ray(100., 100., 0., 0., 100., 100., view,
+    projection, cml::z_clip_zero);
+  CATCH_CHECK(r.origin[0] == Approx(1.).epsilon(1e-12));
+  CATCH_CHECK(r.origin[1] == Approx(1.).epsilon(1e-12));
+  CATCH_CHECK(r.origin[2] == Approx(9.).epsilon(1e-12));
+
+  auto p = r.at(std::sqrt(3.) * 9.);
+  CATCH_CHECK(p[0] == Approx(10.).epsilon(1e-9));
+  CATCH_CHECK(p[1] == Approx(10.).epsilon(1e-9));
+  CATCH_CHECK(p[2] == Approx(0.).margin(1e-9));
+}
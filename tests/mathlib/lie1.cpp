@@ -0,0 +1,204 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+// Make sure the main header compiles cleanly:
+#include <cml/mathlib/lie.h>
+
+#include <cml/vector.h>
+#include <cml/matrix.h>
+#include <cml/quaternion.h>
+#include <cml/matrix/matrix_product.h>
+#include <cml/mathlib/matrix/rotation.h>
+#include <cml/mathlib/quaternion/rotation.h>
+
+/* Testing headers: */
+#include "catch_runner.h"
+#include "matrix_test_util.h"
+
+namespace {
+
+using vector6d = cml::vector<double, cml::compiled<6>>;
+using matrix66d = cml::matrix<double, cml::compiled<6, 6>>;
+
+using cml_test::max_difference;
+
+} // namespace
+
+CATCH_TEST_CASE("so3_exp, axis_angle1")
+{
+  cml::vector3d axis(1., -2., 2.);
+  axis.normalize();
+  const double angle = 1.2;
+
+  cml::matrix33d R, R0;
+  cml::so3_exp(R, angle * axis);
+  cml::matrix_rotation_axis_angle(R0, axis, angle);
+  CATCH_CHECK(max_difference(R, R0) < 1e-15);
+
+  cml::matrix33d_r Rr, Rr0;
+  cml::so3_exp(Rr, angle * axis);
+  cml::matrix_rotation_axis_angle(Rr0, axis, angle);
+  CATCH_CHECK(max_difference(Rr, Rr0) < 1e-15);
+
+  cml::quaterniond q, q0;
+  cml::so3_exp(q, angle * axis);
+  cml::quaternion_rotation_axis_angle(q0, axis, angle);
+  for(int i = 0; i < 4; ++i) CATCH_CHECK(q[i] == Approx(q0[i]).epsilon(1e-15));
+}
+
+CATCH_TEST_CASE("so3_log, round_trip1")
+{
+  /* Zero, tiny, moderate, and near-pi angles: */
+  const double angles[] = {0., 1e-9, 1e-3, .5, 2., 3.1, M_PI - 1e-7};
+  cml::vector3d axis(.3, .4, -.5);
+  axis.normalize();
+  for(double angle : angles) {
+    const cml::vector3d w = angle * axis;
+    cml::matrix33d R;
+    cml::so3_exp(R, w);
+    const cml::vector3d v = cml::so3_log(R);
+    for(int i = 0; i < 3; ++i) CATCH_CHECK(v[i] == Approx(w[i]).margin(1e-12));
+
+    cml::matrix44d_r T;
+    cml::so3_exp(T, w);
+    CATCH_CHECK(T(3, 3) == 1.);
+    const cml::vector3d vt = cml::so3_log(T);
+    for(int i = 0; i < 3; ++i) CATCH_CHECK(vt[i] == Approx(w[i]).margin(1e-12));
+
+    cml::quaterniond q;
+    cml::so3_exp(q, w);
+    const cml::vector3d vq = cml::so3_log(q);
+    for(int i = 0; i < 3; ++i) CATCH_CHECK(vq[i] == Approx(w[i]).margin(1e-12));
+
+    /* -q is the same rotation: */
+    const cml::vector3d vn = cml::so3_log(cml::quaterniond(-q));
+    for(int i = 0; i < 3; ++i) CATCH_CHECK(vn[i] == Approx(w[i]).margin(1e-12));
+  }
+}
+
+CATCH_TEST_CASE("so3_jacobian, finite_difference1")
+{
+  /* exp(w + h*d) = exp(h*J_l*d)*exp(w) = exp(w)*exp(h*J_r*d) + O(h^2): */
+  const double angles[] = {1e-6, .7, 2.5};
+  const cml::vector3d d(.2, -.7, .4);
+  const double h = 1e-6;
+  for(double angle : angles) {
+    const cml::vector3d w = angle * cml::vector3d(.6, .0, .8);
+    cml::matrix33d R, Rd, Jl, Jr, Dl, Dr;
+    cml::so3_exp(R, w);
+    cml::so3_exp(Rd, w + h * d);
+    cml::so3_left_jacobian(Jl, w);
+    cml::so3_right_jacobian(Jr, w);
+    cml::so3_exp(Dl, h * (Jl * d));
+    cml::so3_exp(Dr, h * (Jr * d));
+    CATCH_CHECK(max_difference(Rd, cml::matrix33d(Dl * R)) < 1e-11);
+    CATCH_CHECK(max_difference(Rd, cml::matrix33d(R * Dr)) < 1e-11);
+
+    cml::matrix33d Jli, Jri;
+    cml::so3_left_jacobian_inverse(Jli, w);
+    cml::so3_right_jacobian_inverse(Jri, w);
+    cml::matrix33d I;
+    I.identity();
+    CATCH_CHECK(max_difference(cml::matrix33d(Jl * Jli), I) < 1e-14);
+    CATCH_CHECK(max_difference(cml::matrix33d(Jr * Jri), I) < 1e-14);
+  }
+}
+
+CATCH_TEST_CASE("se3_exp, round_trip1")
+{
+  const double angles[] = {0., 1e-8, .9, 3.};
+  for(double angle : angles) {
+    cml::vector3d axis(-.2, .9, .1);
+    axis.normalize();
+    const vector6d xi(1., -2., .5, angle * axis[0], angle * axis[1],
+      angle * axis[2]);
+
+    cml::matrix44d T;
+    cml::se3_exp(T, xi);
+
+    /* The rotation is exp(omega), and the translation J_l(omega)*rho: */
+    cml::matrix33d R, J;
+    cml::so3_exp(R, angle * axis);
+    cml::so3_left_jacobian(J, angle * axis);
+    const cml::vector3d t = J * cml::vector3d(1., -2., .5);
+    for(int i = 0; i < 3; ++i) {
+      for(int j = 0; j < 3; ++j)
+        CATCH_CHECK(T(i, j) == Approx(R(i, j)).margin(1e-15));
+      CATCH_CHECK(T(i, 3) == Approx(t[i]).margin(1e-15));
+      CATCH_CHECK(T(3, i) == 0.);
+    }
+
+    const vector6d v = cml::se3_log(T);
+    for(int i = 0; i < 6; ++i) CATCH_CHECK(v[i] == Approx(xi[i]).margin(1e-12));
+  }
+}
+
+CATCH_TEST_CASE("se3_jacobian, finite_difference1")
+{
+  /* exp(xi + h*d) = exp(h*J_l*d)*exp(xi) = exp(xi)*exp(h*J_r*d) + O(h^2): */
+  const double angles[] = {1e-5, .8, 2.9};
+  const vector6d d(.3, .1, -.6, .2, -.7, .4);
+  const double h = 1e-6;
+  for(double angle : angles) {
+    const vector6d xi(.5, -1., 2., angle * .6, 0., angle * -.8);
+    cml::matrix44d T, Td, Dl, Dr;
+    matrix66d Jl, Jr;
+    cml::se3_exp(T, xi);
+    cml::se3_exp(Td, xi + h * d);
+    cml::se3_left_jacobian(Jl, xi);
+    cml::se3_right_jacobian(Jr, xi);
+    cml::se3_exp(Dl, h * (Jl * d));
+    cml::se3_exp(Dr, h * (Jr * d));
+    CATCH_CHECK(max_difference(Td, cml::matrix44d(Dl * T)) < 1e-11);
+    CATCH_CHECK(max_difference(Td, cml::matrix44d(T * Dr)) < 1e-11);
+  }
+}
+
+CATCH_TEST_CASE("lie, batch1")
+{
+  const int n = 5;
+  cml::vector3d w[n];
+  vector6d xi[n];
+  for(int k = 0; k < n; ++k) {
+    w[k].set(.1 * k, -.3 * k, .7 * k);
+    xi[k].set(k, 1. - k, .5 * k, w[k][0], w[k][1], w[k][2]);
+  }
+
+  cml::matrix33d R[n];
+  cml::quaterniond q[n];
+  cml::matrix44d T[n];
+  cml::vector3d wr[n], wq[n];
+  vector6d xr[n];
+  cml::so3_exp(w, n, R);
+  cml::so3_exp(w, n, q);
+  cml::se3_exp(xi, n, T);
+  cml::so3_log(R, n, wr);
+  cml::so3_log(q, n, wq);
+  cml::se3_log(T, n, xr);
+
+  for(int k = 0; k < n; ++k) {
+    cml::matrix33d R0;
+    cml::so3_exp(R0, w[k]);
+    CATCH_CHECK(max_difference(R[k], R0) == 0.);
+    cml::matrix44d T0;
+    cml::se3_exp(T0, xi[k]);
+    CATCH_CHECK(max_difference(T[k], T0) == 0.);
+    for(int i = 0; i < 3; ++i) {
+      CATCH_CHECK(wr[k][i] == Approx(w[k][i]).margin(1e-12));
+      CATCH_CHECK(wq[k][i] == Approx(w[k][i]).margin(1e-12));
+    }
+    for(int i = 0; i < 6; ++i)
+      CATCH_CHECK(xr[k][i] == Approx(xi[k][i]).margin(1e-12));
+  }
+}
+
+CATCH_TEST_CASE("lie, size_error1")
+{
+  cml::matrixd J(4, 4);
+  CATCH_CHECK_THROWS_AS(cml::so3_left_jacobian(J, cml::vector3d(1., 0., 0.)),
+    cml::matrix_size_error);
+  cml::matrix33d R;
+  CATCH_CHECK_THROWS_AS(cml::so3_exp(R, cml::vectord(1., 0.)),
+    cml::vector_size_error);
+}
@@ -0,0 +1,202 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+// Make sure the main header compiles cleanly:
+#include <cml/mathlib/matrix/orthonormalize.h>
+
+#include <vector>
+#include <cml/vector.h>
+#include <cml/matrix.h>
+#include <cml/quaternion.h>
+#include <cml/matrix/matrix_product.h>
+#include <cml/matrix/determinant.h>
+#include <cml/mathlib/matrix/rotation.h>
+#include <cml/mathlib/quaternion/rotation.h>
+
+/* Testing headers: */
+#include "catch_runner.h"
+
+namespace {
+
+/* Return the largest deviation of M^T*M from the identity, over the
+ * upper-left 3x3 submatrix.
+ */
+template<class Matrix>
+double
+orthogonality_error(const Matrix& M)
+{
+  double err = 0.;
+  for(int i = 0; i < 3; ++i)
+    for(int j = 0; j < 3; ++j) {
+      double d = 0.;
+      for(int k = 0; k < 3; ++k) d += double(M(k, i)) * double(M(k, j));
+      err = std::max(err, std::fabs(d - (i == j ? 1. : 0.)));
+    }
+  return err;
+}
+
+/* Perturb the upper-left 3x3 submatrix of @c M by a small amount. */
+template<class Matrix>
+void
+drift(Matrix& M, double scale)
+{
+  for(int i = 0; i < 3; ++i)
+    for(int j = 0; j < 3; ++j) M(i, j) += scale * double((3 * i + j) % 5 - 2);
+}
+
+} // namespace
+
+CATCH_TEST_CASE("gram_schmidt1")
+{
+  cml::matrix33d M;
+  cml::matrix_rotation_axis_angle(M, cml::vector3d(1., 2., 3.).normalize(),
+    .7);
+  cml::matrix33d R = M;
+  drift(M, 1e-3);
+  CATCH_REQUIRE(orthogonality_error(M) > 1e-4);
+
+  cml::matrix_orthonormalize(M);
+  CATCH_CHECK(orthogonality_error(M) < 1e-12);
+  CATCH_CHECK(cml::determinant(M) == Approx(1.).epsilon(1e-12));
+
+  /* The z basis vector keeps its direction: */
+  cml::vector3d z(M(0, 2), M(1, 2), M(2, 2));
+  cml::vector3d z0(R(0, 2), R(1, 2), R(2, 2));
+  CATCH_CHECK(cml::dot(z, z0) == Approx(1.).epsilon(1e-5));
+}
+
+CATCH_TEST_CASE("gram_schmidt_stable_axis1")
+{
+  cml::matrix33d_r M;
+  cml::matrix_rotation_axis_angle(M, cml::vector3d(0., 1., 0.), .3);
+  drift(M, 1e-3);
+  cml::vector3d x = cml::matrix_get_x_basis_vector(M).normalize();
+
+  cml::matrix_orthonormalize(M, 0);
+  CATCH_CHECK(orthogonality_error(M) < 1e-12);
+  CATCH_CHECK(cml::determinant(M) == Approx(1.).epsilon(1e-12));
+  for(int j = 0; j < 3; ++j)
+    CATCH_CHECK(M(0, j) == Approx(x[j]).epsilon(1e-12));
+
+  CATCH_CHECK_THROWS_AS(cml::matrix_orthonormalize(M, 3),
+    std::invalid_argument);
+}
+
+CATCH_TEST_CASE("gram_schmidt_4x4")
+{
+  cml::matrix44d M;
+  cml::matrix_rotation_axis_angle(M, cml::vector3d(0., 0., 1.), 1.1);
+  M(0, 3) = 5.;
+  M(3, 0) = 6.;
+  drift(M, 1e-3);
+
+  cml::matrix_orthonormalize(M);
+  CATCH_CHECK(orthogonality_error(M) < 1e-12);
+  CATCH_CHECK(M(0, 3) == 5.);
+  CATCH_CHECK(M(3, 0) == 6.);
+}
+
+CATCH_TEST_CASE("symmetric1")
+{
+  cml::matrix33d M;
+  cml::matrix_rotation_axis_angle(M, cml::vector3d(1., 2., 3.).normalize(),
+    .7);
+  cml::matrix33d R = M;
+  drift(M, 1e-3);
+
+  cml::matrix_orthonormalize_symmetric(M, 3);
+  CATCH_CHECK(orthogonality_error(M) < 1e-12);
+  CATCH_CHECK(cml::determinant(M) == Approx(1.).epsilon(1e-12));
+
+  /* The polar factor stays close to the original rotation: */
+  for(int i = 0; i < 3; ++i)
+    for(int j = 0; j < 3; ++j)
+      CATCH_CHECK(M(i, j) == Approx(R(i, j)).margin(5e-3));
+}
+
+CATCH_TEST_CASE("symmetric_dynamic1")
+{
+  cml::matrixd M(4, 4);
+  M.identity();
+  drift(M, 1e-3);
+  M(3, 3) = 7.;
+
+  cml::matrix_orthonormalize_symmetric(M, 3);
+  CATCH_CHECK(orthogonality_error(M) < 1e-12);
+  CATCH_CHECK(M(3, 3) == 7.);
+}
+
+CATCH_TEST_CASE("batch_gram_schmidt1")
+{
+  std::vector<cml::matrix33f> Ms(150), Gs(150);
+  for(int i = 0; i < int(Ms.size()); ++i) {
+    cml::matrix_rotation_axis_angle(Ms[i],
+      cml::vector3f(1.f, float(i), 2.f).normalize(), .01f * float(i));
+    drift(Ms[i], 1e-4);
+    Gs[i] = Ms[i];
+    cml::matrix_orthonormalize(Gs[i]);
+  }
+
+  cml::matrix_orthonormalize(Ms.data(), int(Ms.size()));
+  for(int i = 0; i < int(Ms.size()); ++i) {
+    CATCH_CHECK(orthogonality_error(Ms[i]) < 1e-5);
+    for(int j = 0; j < 3; ++j)
+      for(int k = 0; k < 3; ++k)
+        CATCH_CHECK(Ms[i](j, k) == Approx(Gs[i](j, k)).margin(1e-5));
+  }
+}
+
+CATCH_TEST_CASE("batch_gram_schmidt_refinements1")
+{
+  /* A large drift needs more refinements: */
+  cml::matrix44d_r Ms[3];
+  for(auto& M : Ms) {
+    M.identity();
+    drift(M, 2e-2);
+  }
+
+  cml::matrix_orthonormalize(&Ms[0], 1, 1);
+  cml::matrix_orthonormalize(&Ms[1], 1, 4);
+  cml::matrix_orthonormalize(&Ms[2], 1, 0);
+  CATCH_CHECK(orthogonality_error(Ms[0]) > 1e-6);
+  CATCH_CHECK(orthogonality_error(Ms[1]) < 1e-12);
+  CATCH_CHECK(orthogonality_error(Ms[2]) < 1e-12);
+}
+
+CATCH_TEST_CASE("batch_symmetric1")
+{
+  std::vector<cml::matrix33d_r> Ms(100), Ss(100);
+  for(int i = 0; i < int(Ms.size()); ++i) {
+    cml::matrix_rotation_axis_angle(Ms[i],
+      cml::vector3d(double(i), 1., 2.).normalize(), .02 * double(i));
+    drift(Ms[i], 1e-3);
+    Ss[i] = Ms[i];
+    cml::matrix_orthonormalize_symmetric(Ss[i], 3);
+  }
+
+  cml::matrix_orthonormalize_symmetric(Ms.data(), int(Ms.size()), 3);
+  for(int i = 0; i < int(Ms.size()); ++i) {
+    CATCH_CHECK(orthogonality_error(Ms[i]) < 1e-12);
+    for(int j = 0; j < 3; ++j)
+      for(int k = 0; k < 3; ++k)
+        CATCH_CHECK(Ms[i](j, k) == Approx(Ss[i](j, k)).epsilon(1e-12));
+  }
+}
+
+CATCH_TEST_CASE("batch_quaternion1")
+{
+  std::vector<cml::quaterniond> qs(130);
+  for(int i = 0; i < int(qs.size()); ++i) {
+    cml::quaternion_rotation_axis_angle(qs[i],
+      cml::vector3d(1., double(i), 3.).normalize(), .05 * double(i));
+    qs[i] *= 1. + 1e-4 * double(i % 7 - 3);
+  }
+
+  cml::quaternion_normalize(qs.data(), int(qs.size()), 2);
+  for(const auto& q : qs) CATCH_CHECK(q.length() == Approx(1.).epsilon(1e-12));
+
+  cml::quaterniond q(0., 0., 0., 2.);
+  cml::quaternion_normalize(&q, 1, 0);
+  CATCH_CHECK(q.length() == Approx(1.).epsilon(1e-12));
+}
@@ -0,0 +1,135 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+// Make sure the main header compiles cleanly:
+#include <cml/matrix/block.h>
+
+#include <cml/vector.h>
+#include <cml/matrix.h>
+#include <cml/matrix/rank_update.h>
+
+/* Testing headers: */
+#include "catch_runner.h"
+#include "matrix_test_util.h"
+
+namespace {
+
+using matrix44d_c = cml::matrix<double, cml::fixed<4, 4>, cml::col_basis,
+  cml::col_major>;
+
+using cml_test::fill_indices;
+
+} // namespace
+
+CATCH_TEST_CASE("block, read1")
+{
+  cml::matrixd M(5, 6);
+  fill_indices(M);
+
+  auto B = cml::block(M, 1, 2, 3, 2);
+  CATCH_REQUIRE(B.rows() == 3);
+  CATCH_REQUIRE(B.cols() == 2);
+  CATCH_CHECK(B.leading_dimension() == 6);
+  CATCH_CHECK(!B.is_contiguous());
+  CATCH_CHECK(B(0, 0) == 12.);
+  CATCH_CHECK(B(2, 1) == 33.);
+  CATCH_CHECK(B.data() == &M(1, 2));
+
+  /* Blocks of blocks: */
+  auto C = cml::block(B, 1, 1, 2, 1);
+  CATCH_CHECK(C(0, 0) == 23.);
+  CATCH_CHECK(C(1, 0) == 33.);
+
+  /* Full-width blocks are contiguous: */
+  CATCH_CHECK(cml::block(M, 2, 0, 2, 6).is_contiguous());
+
+  /* Read-only blocks: */
+  const cml::matrixd& cM = M;
+  cml::matrix_block<const double, cml::col_basis, cml::row_major> R =
+    cml::block(cM, 4, 0, 1, 6);
+  CATCH_CHECK(R(0, 5) == 45.);
+  CATCH_CHECK(R.is_contiguous());
+}
+
+CATCH_TEST_CASE("block, col_major1")
+{
+  matrix44d_c M;
+  fill_indices(M);
+  auto B = cml::block(M, 1, 1, 2, 3);
+  CATCH_CHECK(B.leading_dimension() == 4);
+  CATCH_CHECK(B(0, 0) == 11.);
+  CATCH_CHECK(B(1, 2) == 23.);
+  CATCH_CHECK(cml::block(M, 0, 1, 4, 2).is_contiguous());
+}
+
+CATCH_TEST_CASE("block, write1")
+{
+  cml::matrixd M(4, 4);
+  M.zero();
+
+  /* Assignment writes through the view: */
+  cml::block(M, 0, 2, 2, 2) = cml::matrix22d(1., 2., 3., 4.);
+  CATCH_CHECK(M(0, 2) == 1.);
+  CATCH_CHECK(M(1, 3) == 4.);
+
+  auto B = cml::block(M, 2, 0, 2, 2);
+  B.identity();
+  B *= 3.;
+  CATCH_CHECK(M(2, 0) == 3.);
+  CATCH_CHECK(M(3, 1) == 3.);
+  CATCH_CHECK(M(2, 1) == 0.);
+
+  /* Copying one block into another copies the elements: */
+  auto D = cml::block(M, 2, 2, 2, 2);
+  D = cml::block(M, 0, 2, 2, 2);
+  CATCH_CHECK(M(2, 2) == 1.);
+  CATCH_CHECK(M(3, 3) == 4.);
+  CATCH_CHECK(D.data() == &M(2, 2));
+
+  CATCH_CHECK_THROWS_AS(B = cml::matrixd(3, 2),
+    cml::incompatible_matrix_size_error);
+}
+
+CATCH_TEST_CASE("block, expressions1")
+{
+  cml::matrixd M(4, 5);
+  fill_indices(M);
+  auto A = cml::block(M, 0, 0, 2, 3);
+  auto B = cml::block(M, 2, 2, 2, 3);
+
+  const cml::matrixd S = A + B;
+  CATCH_CHECK(S(1, 2) == 12. + 34.);
+
+  const cml::matrixd P = A * cml::transpose(B);
+  CATCH_CHECK(P(0, 1) == 0. * 32. + 1. * 33. + 2. * 34.);
+
+  const cml::vectord x = B * cml::vector3d(1., 0., -1.);
+  CATCH_CHECK(x[0] == 22. - 24.);
+  CATCH_CHECK(cml::row(A, 1)[2] == 12.);
+  CATCH_CHECK(cml::trace(cml::block(M, 1, 1, 3, 3)) == 11. + 22. + 33.);
+}
+
+CATCH_TEST_CASE("block, rank_update1")
+{
+  cml::matrixd M(4, 4);
+  M.zero();
+  auto B = cml::block(M, 1, 1, 2, 3);
+  cml::rank_update(B, 2., cml::vector2d(1., 2.), cml::vector3d(1., 0., 1.));
+  CATCH_CHECK(M(1, 1) == 2.);
+  CATCH_CHECK(M(2, 3) == 4.);
+  CATCH_CHECK(M(2, 2) == 0.);
+  CATCH_CHECK(M(0, 1) == 0.);
+  CATCH_CHECK(M(3, 1) == 0.);
+}
+
+CATCH_TEST_CASE("block, range_error1")
+{
+  cml::matrixd M(3, 3);
+  CATCH_CHECK_THROWS_AS(cml::block(M, 1, 1, 3, 1), std::invalid_argument);
+  CATCH_CHECK_THROWS_AS(cml::block(M, -1, 0, 1, 1), std::invalid_argument);
+  double data[6];
+  CATCH_CHECK_THROWS_AS(
+    (cml::matrix_block<double, cml::col_basis, cml::row_major>(data, 2, 3, 2)),
+    std::invalid_argument);
+}
@@ -0,0 +1,244 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+// Make sure the main header compiles cleanly:
+#include <cml/matrix/eigen.h>
+
+#include <vector>
+#include <cml/vector.h>
+#include <cml/matrix.h>
+#include <cml/matrix/matrix_product.h>
+#include <cml/matrix/determinant.h>
+#include <cml/mathlib/matrix/rotation.h>
+
+/* Testing headers: */
+#include "catch_runner.h"
+
+namespace {
+
+/* Return R*diag(d)*R^T for a fixed rotation R: */
+template<class Matrix>
+Matrix
+make_symmetric(double d0, double d1, double d2)
+{
+  Matrix R, D;
+  cml::matrix_rotation_axis_angle(R,
+    cml::vector3d(1., -2., .5).normalize(), .9);
+  D.zero();
+  D(0, 0) = d0;
+  D(1, 1) = d1;
+  D(2, 2) = d2;
+  return R * D * cml::transpose(R);
+}
+
+/* Return the largest residual |A*v_i - values[i]*v_i|, where v_i is basis
+ * vector i of @c vectors, relative to the largest |values[i]|.
+ */
+template<class MatrixA, class Values, class Vectors>
+double
+eigen_residual(const MatrixA& A, const Values& values, const Vectors& vectors)
+{
+  const int N = A.rows();
+  double scale = 0., err = 0.;
+  for(int i = 0; i < N; ++i) scale = std::max(scale, std::fabs(values[i]));
+  for(int i = 0; i < N; ++i)
+    for(int r = 0; r < N; ++r) {
+      double Av = 0.;
+      for(int c = 0; c < N; ++c) Av += A(r, c) * vectors.basis_element(i, c);
+      err = std::max(err,
+        std::fabs(Av - values[i] * vectors.basis_element(i, r)));
+    }
+  return scale > 0. ? err / scale : err;
+}
+
+/* Return the largest deviation of the basis vectors of @c V from an
+ * orthonormal set.
+ */
+template<class Vectors>
+double
+orthonormality_error(const Vectors& V)
+{
+  const int N = V.rows();
+  double err = 0.;
+  for(int i = 0; i < N; ++i)
+    for(int j = 0; j < N; ++j) {
+      double d = 0.;
+      for(int k = 0; k < N; ++k)
+        d += V.basis_element(i, k) * V.basis_element(j, k);
+      err = std::max(err, std::fabs(d - (i == j ? 1. : 0.)));
+    }
+  return err;
+}
+
+} // namespace
+
+CATCH_TEST_CASE("eigen_3x3, diagonal1")
+{
+  cml::matrix33d A(3., 0., 0., 0., -1., 0., 0., 0., 2.);
+  cml::vector3d values;
+  cml::matrix33d vectors;
+  cml::symmetric_eigen_3x3(A, values, vectors);
+
+  CATCH_CHECK(values[0] == Approx(-1.).epsilon(1e-12));
+  CATCH_CHECK(values[1] == Approx(2.).epsilon(1e-12));
+  CATCH_CHECK(values[2] == Approx(3.).epsilon(1e-12));
+  CATCH_CHECK(eigen_residual(A, values, vectors) < 1e-14);
+  CATCH_CHECK(cml::determinant(vectors) == Approx(1.).epsilon(1e-12));
+}
+
+CATCH_TEST_CASE("eigen_3x3, rotated1")
+{
+  auto A = make_symmetric<cml::matrix33d>(1., 2., 5.);
+  cml::vector3d values;
+  cml::matrix33d vectors;
+  cml::symmetric_eigen_3x3(A, values, vectors);
+
+  CATCH_CHECK(values[0] == Approx(1.).epsilon(1e-12));
+  CATCH_CHECK(values[1] == Approx(2.).epsilon(1e-12));
+  CATCH_CHECK(values[2] == Approx(5.).epsilon(1e-12));
+  CATCH_CHECK(eigen_residual(A, values, vectors) < 1e-13);
+  CATCH_CHECK(orthonormality_error(vectors) < 1e-13);
+  CATCH_CHECK(cml::determinant(vectors) == Approx(1.).epsilon(1e-12));
+}
+
+CATCH_TEST_CASE("eigen_3x3, degenerate1")
+{
+  const double cases[][3] = {
+    {2., 2., 5.}, {-1., 4., 4.}, {2., 2. + 1e-9, 5.}, {0., 0., 1.},
+    {1e-8, 1., 1.}};
+  for(const auto& d : cases) {
+    auto A = make_symmetric<cml::matrix33d_r>(d[0], d[1], d[2]);
+    cml::vector3d values;
+    cml::matrix33d_r vectors;
+    cml::symmetric_eigen_3x3(A, values, vectors);
+
+    for(int i = 0; i < 3; ++i)
+      CATCH_CHECK(values[i] == Approx(d[i]).margin(1e-12));
+    CATCH_CHECK(eigen_residual(A, values, vectors) < 1e-13);
+    CATCH_CHECK(orthonormality_error(vectors) < 1e-13);
+  }
+
+  /* A multiple of the identity: */
+  cml::matrix33d A(4., 0., 0., 0., 4., 0., 0., 0., 4.);
+  cml::vector3d values;
+  cml::matrix33d vectors;
+  cml::symmetric_eigen_3x3(A, values, vectors);
+  for(int i = 0; i < 3; ++i) CATCH_CHECK(values[i] == 4.);
+  CATCH_CHECK(orthonormality_error(vectors) == 0.);
+
+  A.zero();
+  cml::symmetric_eigen_3x3(A, values, vectors);
+  for(int i = 0; i < 3; ++i) CATCH_CHECK(values[i] == 0.);
+}
+
+CATCH_TEST_CASE("eigen_3x3, scale1")
+{
+  for(double s : {1e-150, 1e150}) {
+    auto A = make_symmetric<cml::matrix33d>(s, 2. * s, 3. * s);
+    cml::vector3d values;
+    cml::matrix33d vectors;
+    cml::symmetric_eigen_3x3(A, values, vectors);
+    for(int i = 0; i < 3; ++i)
+      CATCH_CHECK(values[i] == Approx((i + 1) * s).epsilon(1e-12));
+    CATCH_CHECK(eigen_residual(A, values, vectors) < 1e-13);
+  }
+}
+
+CATCH_TEST_CASE("eigen_3x3, float1")
+{
+  auto A = make_symmetric<cml::matrix33d>(.5, 1.5, 3.);
+  cml::matrix33f Af(A);
+  cml::vector3f values;
+  cml::matrix33f vectors;
+  cml::symmetric_eigen_3x3(Af, values, vectors);
+  CATCH_CHECK(values[0] == Approx(.5).epsilon(1e-5));
+  CATCH_CHECK(values[1] == Approx(1.5).epsilon(1e-5));
+  CATCH_CHECK(values[2] == Approx(3.).epsilon(1e-5));
+  CATCH_CHECK(orthonormality_error(vectors) < 1e-5);
+}
+
+CATCH_TEST_CASE("eigen_3x3, batch1")
+{
+  const int n = 100;
+  std::vector<cml::matrix33d> As(n), vectors(n);
+  std::vector<cml::vector3d> values(n), values_only(n);
+  for(int k = 0; k < n; ++k)
+    As[k] = make_symmetric<cml::matrix33d>(k, .5 * k + 1., 3. - k);
+
+  cml::symmetric_eigen_3x3(As.data(), n, values.data(), vectors.data(), 2);
+  cml::symmetric_eigen_3x3(As.data(), n, values_only.data());
+  for(int k = 0; k < n; ++k) {
+    cml::vector3d l;
+    cml::matrix33d V;
+    cml::symmetric_eigen_3x3(As[k], l, V);
+    for(int i = 0; i < 3; ++i) {
+      CATCH_CHECK(values[k][i] == l[i]);
+      CATCH_CHECK(values_only[k][i] == l[i]);
+      for(int j = 0; j < 3; ++j) CATCH_CHECK(vectors[k](i, j) == V(i, j));
+    }
+  }
+}
+
+CATCH_TEST_CASE("eigen_jacobi, dynamic1")
+{
+  const int N = 7;
+  cml::matrixd A(N, N);
+  for(int i = 0; i < N; ++i)
+    for(int j = 0; j < N; ++j)
+      A(i, j) = 1. / (1. + i + j) + ((i == j) ? double(i % 3) : 0.);
+
+  cml::vectord values;
+  cml::matrixd vectors;
+  CATCH_REQUIRE(cml::symmetric_eigen(A, values, vectors));
+  CATCH_REQUIRE(values.size() == N);
+  CATCH_REQUIRE(vectors.rows() == N);
+  for(int i = 1; i < N; ++i) CATCH_CHECK(values[i - 1] <= values[i]);
+  CATCH_CHECK(eigen_residual(A, values, vectors) < 1e-13);
+  CATCH_CHECK(orthonormality_error(vectors) < 1e-13);
+
+  /* The trace is the sum of the eigenvalues: */
+  double trace = 0., sum = 0.;
+  for(int i = 0; i < N; ++i) {
+    trace += A(i, i);
+    sum += values[i];
+  }
+  CATCH_CHECK(sum == Approx(trace).epsilon(1e-12));
+}
+
+CATCH_TEST_CASE("eigen_jacobi, matches_3x3")
+{
+  auto A = make_symmetric<cml::matrix33d>(-2., 1., 7.);
+  cml::vector3d l3;
+  cml::matrix33d V3;
+  cml::symmetric_eigen_3x3(A, l3, V3);
+
+  cml::vector3d l;
+  cml::matrix33d V;
+  CATCH_REQUIRE(cml::symmetric_eigen(A, l, V));
+  for(int i = 0; i < 3; ++i) {
+    CATCH_CHECK(l[i] == Approx(l3[i]).epsilon(1e-12));
+
+    /* Eigenvectors agree up to sign: */
+    double d = 0.;
+    for(int j = 0; j < 3; ++j)
+      d += V.basis_element(i, j) * V3.basis_element(i, j);
+    CATCH_CHECK(std::fabs(d) == Approx(1.).epsilon(1e-12));
+  }
+}
+
+CATCH_TEST_CASE("eigen_jacobi, size1")
+{
+  cml::matrixd A(3, 4);
+  A.zero();
+  cml::vectord values;
+  cml::matrixd vectors;
+  CATCH_CHECK_THROWS_AS(cml::symmetric_eigen(A, values, vectors),
+    cml::non_square_matrix_error);
+
+  cml::matrixd B(4, 4);
+  B.identity();
+  cml::vector3d fixed_values;
+  CATCH_CHECK_THROWS_AS(cml::symmetric_eigen(B, fixed_values, vectors),
+    cml::vector_size_error);
+}
@@ -531,3 +531,13 @@ CATCH_TEST_CASE("dynamic, lu_pivot_solve3")
   auto Ax = A * x;
   for(int i = 0; i < 4; ++i) CATCH_CHECK(Ax[i] == Approx(b[i]).epsilon(1e-12));
 }
+
+CATCH_TEST_CASE("dynamic, lu_pivot_negative1")
+{
+  /* A negative leading pivot with no larger entry below it: */
+  cml::matrixd M(2, 2, -2., 1., 0., 3.);
+  auto lup = cml::lu_pivot(M);
+  CATCH_REQUIRE(lup.sign == 1);
+  CATCH_CHECK(lup.lu(0, 0) == Approx(-2.).epsilon(1e-12));
+  CATCH_CHECK(lup.lu(1, 1) == Approx(3.).epsilon(1e-12));
+}
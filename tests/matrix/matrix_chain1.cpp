@@ -0,0 +1,107 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+// Make sure the main header compiles cleanly:
+#include <cml/matrix/matrix_chain.h>
+
+#include <cml/vector.h>
+#include <cml/matrix.h>
+
+/* Testing headers: */
+#include "catch_runner.h"
+#include "matrix_test_util.h"
+
+using cml_test::fill_matrix;
+using cml_test::max_difference;
+
+CATCH_TEST_CASE("multiply_chain, matrices1")
+{
+  /* The cheapest order is (A*(B*C))*D: */
+  cml::matrixd A, B, C, D;
+  fill_matrix(A, 10, 30);
+  fill_matrix(B, 30, 5, 1.);
+  fill_matrix(C, 5, 60, 2.);
+  fill_matrix(D, 60, 8, 3.);
+
+  const cml::matrixd expected = A * B * C * D;
+  const cml::matrixd P = cml::multiply_chain(A, B, C, D);
+  CATCH_REQUIRE(P.rows() == 10);
+  CATCH_REQUIRE(P.cols() == 8);
+  CATCH_CHECK(max_difference(P, expected) < 1e-11);
+
+  /* Two operands: */
+  CATCH_CHECK(max_difference(cml::multiply_chain(A, B), A * B) == 0.);
+}
+
+CATCH_TEST_CASE("multiply_chain, vector1")
+{
+  const int N = 40;
+  cml::matrixd A, B, C;
+  fill_matrix(A, N, N);
+  fill_matrix(B, N, N, 1.);
+  fill_matrix(C, N, N, 2.);
+  cml::vectord x(N);
+  for(int i = 0; i < N; ++i) x[i] = std::cos(double(i));
+
+  const cml::vectord expected = A * (B * (C * x));
+  const cml::vectord y = cml::multiply_chain(A, B, C, x);
+  CATCH_REQUIRE(y.size() == N);
+  for(int i = 0; i < N; ++i)
+    CATCH_CHECK(y[i] == Approx(expected[i]).epsilon(1e-12));
+}
+
+CATCH_TEST_CASE("multiply_chain, fixed1")
+{
+  cml::matrix33d R(0., -1., 0., 1., 0., 0., 0., 0., 1.);
+  cml::matrix33d S(2., 0., 0., 0., 3., 0., 0., 0., 4.);
+  cml::matrixd T(3, 3, 1., 0., 1., 0., 1., 0., 0., 0., 1.);
+
+  const cml::matrix33d expected = R * S * R;
+  CATCH_CHECK(max_difference(cml::multiply_chain(R, S, R), expected) == 0.);
+  CATCH_CHECK(
+    max_difference(cml::multiply_chain(R, S, T), cml::matrixd(R * S * T))
+    == 0.);
+
+  const cml::vector3d v = cml::multiply_chain(R, S, cml::vector3d(1., 2., 3.));
+  CATCH_CHECK(v[0] == -6.);
+  CATCH_CHECK(v[1] == 2.);
+  CATCH_CHECK(v[2] == 12.);
+}
+
+CATCH_TEST_CASE("multiply_chain, fixed_nonsquare1")
+{
+  cml::matrix<double, cml::compiled<2, 3>> A;
+  cml::matrix<double, cml::compiled<3, 4>> B;
+  cml::matrix<double, cml::compiled<4, 2>> C;
+  cml::matrix<double, cml::compiled<2, 5>> D;
+  for(int i = 0; i < 2; ++i)
+    for(int j = 0; j < 3; ++j) A(i, j) = 1. + i - j;
+  for(int i = 0; i < 3; ++i)
+    for(int j = 0; j < 4; ++j) B(i, j) = .5 * i + j;
+  for(int i = 0; i < 4; ++i)
+    for(int j = 0; j < 2; ++j) C(i, j) = i - 2. * j;
+  for(int i = 0; i < 2; ++i)
+    for(int j = 0; j < 5; ++j) D(i, j) = 2. - i * j;
+
+  const auto P = cml::multiply_chain(A, B, C, D);
+  CATCH_REQUIRE(P.rows() == 2);
+  CATCH_REQUIRE(P.cols() == 5);
+  CATCH_CHECK(max_difference(P, A * B * C * D) < 1e-12);
+
+  const cml::vector3d x(1., -1., 2.);
+  const auto y = cml::multiply_chain(C, A, x);
+  CATCH_CHECK(y.size() == 4);
+  const cml::vector4d expected = C * (A * x);
+  for(int i = 0; i < 4; ++i)
+    CATCH_CHECK(y[i] == Approx(expected[i]).epsilon(1e-12));
+}
+
+CATCH_TEST_CASE("multiply_chain, size_error1")
+{
+  cml::matrixd A(3, 4), B(4, 2), C(3, 3);
+  CATCH_CHECK_THROWS_AS(cml::multiply_chain(A, B, C),
+    cml::incompatible_matrix_inner_size_error);
+  CATCH_CHECK_THROWS_AS(cml::multiply_chain(A, B, cml::vectord(3)),
+    cml::incompatible_matrix_inner_size_error);
+}
@@ -6,6 +6,7 @@
 #include <cml/matrix/comparison.h>
 
 #include <cml/matrix/fixed.h>
+#include <cml/matrix/dynamic.h>
 #include <cml/matrix/types.h>
 
 // For Catch:
@@ -33,3 +34,27 @@ CATCH_TEST_CASE("not_equal1")
 
   CATCH_CHECK(M != expected);
 }
+
+CATCH_TEST_CASE("approx_equal1")
+{
+  cml::matrix22d M(1., 2., 3., 4.);
+  cml::matrix22d N(1., 2., 3. + 1e-10, 4.);
+  CATCH_CHECK(cml::approx_equal(M, N, 1e-9));
+  CATCH_CHECK(!cml::approx_equal(M, N, 1e-11));
+
+  cml::matrixd D(2, 2, 1., 2., 3., 4.);
+  CATCH_CHECK(cml::approx_equal(D, N, 1e-9));
+  CATCH_CHECK(!cml::approx_equal(D, cml::matrixd(2, 1, 1., 3.), 1e-9));
+  CATCH_CHECK(cml::approx_equal_ulps(D, M, 0));
+  CATCH_CHECK(!cml::approx_equal_ulps(M, N, 4));
+}
+
+CATCH_TEST_CASE("batch_approx_equal1")
+{
+  cml::matrix22d items[] = {
+    {1., 0., 0., 1.}, {0., 1., 1., 0.}, {2., 0., 0., 2.}};
+  CATCH_CHECK(cml::find_approx_equal(items, 3, cml::matrix22d(2., 0., 0., 2.),
+                1e-9)
+    == 2);
+  CATCH_CHECK(cml::all_approx_equal(items, items, 3, 0.));
+}
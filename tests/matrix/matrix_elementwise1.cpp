@@ -0,0 +1,70 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+// Make sure the main header compiles cleanly:
+#include <cml/matrix/elementwise.h>
+
+#include <cml/matrix.h>
+
+/* Testing headers: */
+#include "catch_runner.h"
+
+CATCH_TEST_CASE("unary1")
+{
+  cml::matrix22d M(-4., 9., 16., -1.);
+  cml::matrix22d N = cml::sqrt(cml::abs(M));
+  CATCH_CHECK(N(0, 0) == 2.);
+  CATCH_CHECK(N(0, 1) == 3.);
+  CATCH_CHECK(N(1, 0) == 4.);
+  CATCH_CHECK(N(1, 1) == 1.);
+
+  cml::matrixd E = cml::exp(cml::matrix22d(0., 0., 0., 0.));
+  CATCH_REQUIRE(E.rows() == 2);
+  CATCH_CHECK(E(0, 1) == 1.);
+}
+
+CATCH_TEST_CASE("min_max1")
+{
+  cml::matrix22d A(1., 5., -2., 0.), B(3., -1., -2., 1.);
+  cml::matrix22d L = cml::min(A, B), H = cml::max(A, B);
+  CATCH_CHECK(L(0, 0) == 1.);
+  CATCH_CHECK(L(0, 1) == -1.);
+  CATCH_CHECK(L(1, 0) == -2.);
+  CATCH_CHECK(H(0, 1) == 5.);
+  CATCH_CHECK(H(1, 1) == 1.);
+}
+
+CATCH_TEST_CASE("clamp1")
+{
+  cml::matrix22d_c M(-1., 0.25, 0.75, 2.);
+  cml::matrix22d_c N = cml::clamp(M, 0., 1.);
+  CATCH_CHECK(N(0, 0) == 0.);
+  CATCH_CHECK(N(0, 1) == 0.25);
+  CATCH_CHECK(N(1, 0) == 0.75);
+  CATCH_CHECK(N(1, 1) == 1.);
+
+  cml::matrix22d_c lo(0., 0.5, 0., 0.), hi(1., 1., 0.5, 3.);
+  N = cml::clamp(M, lo, hi);
+  CATCH_CHECK(N(0, 1) == 0.5);
+  CATCH_CHECK(N(1, 0) == 0.5);
+  CATCH_CHECK(N(1, 1) == 2.);
+}
+
+CATCH_TEST_CASE("fma1")
+{
+  cml::matrix22d A(1., 2., 3., 4.), B(5., 6., 7., 8.), C(1., 1., 1., 1.);
+  cml::matrix22d_c D = cml::fma(A, B, C);
+  CATCH_CHECK(D(0, 0) == 6.);
+  CATCH_CHECK(D(0, 1) == 13.);
+  CATCH_CHECK(D(1, 0) == 22.);
+  CATCH_CHECK(D(1, 1) == 33.);
+}
+
+CATCH_TEST_CASE("size_checking1")
+{
+  cml::matrixd A(2, 2), B(2, 3);
+  CATCH_CHECK_THROWS_AS(cml::min(A, B), cml::incompatible_matrix_size_error);
+  CATCH_CHECK_THROWS_AS(cml::clamp(A, A, B),
+    cml::incompatible_matrix_size_error);
+}
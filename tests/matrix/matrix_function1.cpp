@@ -0,0 +1,149 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+// Make sure the main header compiles cleanly:
+#include <cml/matrix/matrix_function.h>
+
+#include <cmath>
+#include <limits>
+#include <cml/matrix/inverse.h>
+#include <cml/matrix.h>
+
+/* Testing headers: */
+#include "catch_runner.h"
+
+namespace {
+
+/* Non-symmetric n x n test matrix with 1-norm of roughly @c scale: */
+cml::matrixd
+make_matrix(int n, double scale)
+{
+  cml::matrixd M(n, n);
+  for(int i = 0; i < n; ++i)
+    for(int j = 0; j < n; ++j)
+      M(i, j) = scale * ((i == j) ? .5 : .3 / (1. + i + 2. * j) - .1 * (j > i));
+  return M;
+}
+
+template<class Sub1, class Sub2>
+void
+check_equal(const cml::readable_matrix<Sub1>& A,
+  const cml::readable_matrix<Sub2>& B, double eps)
+{
+  CATCH_REQUIRE(A.rows() == B.rows());
+  CATCH_REQUIRE(A.cols() == B.cols());
+  for(int i = 0; i < A.rows(); ++i)
+    for(int j = 0; j < A.cols(); ++j)
+      CATCH_CHECK(A(i, j) == Approx(B(i, j)).epsilon(eps).margin(eps));
+}
+
+} // namespace
+
+CATCH_TEST_CASE("pow, fixed1")
+{
+  cml::matrix33d M(1., 2., 0., -1., .5, 3., .25, 0., 2.);
+  cml::matrix33d I;
+  I.identity();
+  check_equal(cml::matrix_pow(M, 0), I, 1e-14);
+  check_equal(cml::matrix_pow(M, 1), M, 1e-14);
+  check_equal(cml::matrix_pow(M, 5), M * M * M * M * M, 1e-12);
+  check_equal(cml::matrix_pow(M, -2), cml::inverse(M * M), 1e-12);
+}
+
+CATCH_TEST_CASE("pow, dynamic1")
+{
+  auto M = make_matrix(9, 1.);
+  cml::matrix_workspace<double> W;
+  cml::matrixd P;
+  cml::matrix_pow(M, 6, P, W);
+  check_equal(P, M * M * M * M * M * M, 1e-12);
+
+  /* The result may alias the argument: */
+  cml::matrixd Q = M;
+  cml::matrix_pow(Q, 3, Q, W);
+  check_equal(Q, M * M * M, 1e-12);
+
+  CATCH_CHECK_THROWS_AS(cml::matrix_pow(cml::matrixd(2, 3), 2),
+    cml::non_square_matrix_error);
+  CATCH_CHECK_THROWS_AS(cml::matrix_pow(cml::matrixd(3, 3), -1),
+    std::invalid_argument);
+}
+
+CATCH_TEST_CASE("exp, closed form1")
+{
+  /* Nilpotent: */
+  cml::matrix22d N(0., 1., 0., 0.);
+  check_equal(cml::matrix_exp(N), cml::matrix22d(1., 1., 0., 1.), 1e-14);
+
+  /* Rotation generators, small and large enough to need scaling: */
+  for(double t : {1e-3, .5, 2., 10., 100.}) {
+    cml::matrix22d A(0., -t, t, 0.);
+    cml::matrix22d R(std::cos(t), -std::sin(t), std::sin(t), std::cos(t));
+    check_equal(cml::matrix_exp(A), R, 1e-10);
+  }
+
+  /* Diagonal: */
+  cml::matrixd D(4, 4);
+  D.zero();
+  for(int i = 0; i < 4; ++i) D(i, i) = i - 1.5;
+  auto E = cml::matrix_exp(D);
+  for(int i = 0; i < 4; ++i)
+    CATCH_CHECK(E(i, i) == Approx(std::exp(i - 1.5)).epsilon(1e-14));
+}
+
+CATCH_TEST_CASE("exp, inverse1")
+{
+  cml::matrix_workspace<double> W;
+  for(double scale : {1e-2, .2, .8, 3., 40.}) {
+    auto A = make_matrix(12, scale);
+    cml::matrixd E, F;
+    cml::matrix_exp(A, E, W);
+    cml::matrix_exp(-A, F, W);
+    cml::matrixd I(12, 12);
+    I.identity();
+    check_equal(E * F, I, 1e-9);
+  }
+}
+
+CATCH_TEST_CASE("exp, fixed1")
+{
+  cml::matrix44d A;
+  for(int i = 0; i < 4; ++i)
+    for(int j = 0; j < 4; ++j) A(i, j) = .1 * (i + 1) - .05 * j * j;
+  cml::matrixd D = A;
+  check_equal(cml::matrix_exp(A), cml::matrix_exp(D), 1e-14);
+
+  /* Too large for inline scratch storage: */
+  cml::matrix<double, cml::compiled<31, 31>> B = make_matrix(31, 1.);
+  check_equal(cml::matrix_exp(B), cml::matrix_exp(make_matrix(31, 1.)),
+    1e-13);
+}
+
+CATCH_TEST_CASE("exp, not_finite1")
+{
+  cml::matrixd A(3, 3);
+  A.zero();
+  A(1, 1) = std::numeric_limits<double>::quiet_NaN();
+  CATCH_CHECK_THROWS_AS(cml::matrix_exp(A), std::invalid_argument);
+}
+
+CATCH_TEST_CASE("sqrt1")
+{
+  cml::matrix22d D(4., 0., 0., 9.);
+  check_equal(cml::matrix_sqrt(D), cml::matrix22d(2., 0., 0., 3.), 1e-12);
+
+  auto A = make_matrix(8, 2.);
+  cml::matrix_workspace<double> W;
+  cml::matrixd S;
+  CATCH_REQUIRE(cml::matrix_sqrt(A, S, W));
+  check_equal(S * S, A, 1e-10);
+
+  /* -I has no real principal square root: */
+  cml::matrix33d M;
+  M.identity();
+  M *= -1.;
+  cml::matrix33d R;
+  CATCH_CHECK_FALSE(cml::matrix_sqrt(M, R, W));
+  CATCH_CHECK_THROWS_AS(cml::matrix_sqrt(M), std::invalid_argument);
+}
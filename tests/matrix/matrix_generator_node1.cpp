@@ -0,0 +1,86 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+// Make sure the main header compiles cleanly:
+#include <cml/matrix/generators.h>
+
+#include <cml/matrix.h>
+#include <cml/mathlib/matrix/generators.h>
+
+/* Testing headers: */
+#include "catch_runner.h"
+
+CATCH_TEST_CASE("generator_types1")
+{
+  {
+    auto xpr = cml::identity(3, 4);
+    using xpr_type = decltype(xpr);
+    CATCH_CHECK((std::is_same<xpr_type::value_type, int>::value));
+    CATCH_CHECK(
+      (std::is_same<xpr_type::size_tag, cml::dynamic_size_tag>::value));
+    CATCH_CHECK(xpr.rows() == 3);
+    CATCH_CHECK(xpr.cols() == 4);
+  }
+  {
+    auto xpr = cml::identity<float>(cml::int_c<4>(), cml::int_c<4>());
+    using xpr_type = decltype(xpr);
+    CATCH_CHECK((std::is_same<xpr_type::value_type, float>::value));
+    CATCH_CHECK(
+      (std::is_same<xpr_type::size_tag, cml::fixed_size_tag>::value));
+    CATCH_CHECK((xpr_type::array_rows == 4));
+    CATCH_CHECK((xpr_type::array_cols == 4));
+  }
+  {
+    /* Mixed sizes give a dynamic expression: */
+    auto xpr = cml::zero(cml::int_c<2>(), 3);
+    using xpr_type = decltype(xpr);
+    CATCH_CHECK(
+      (std::is_same<xpr_type::size_tag, cml::dynamic_size_tag>::value));
+    CATCH_CHECK(xpr.rows() == 2);
+    CATCH_CHECK(xpr.cols() == 3);
+  }
+}
+
+CATCH_TEST_CASE("generator_assign1")
+{
+  cml::matrix44f M = cml::identity(4, 4);
+  for(int i = 0; i < 4; ++i)
+    for(int j = 0; j < 4; ++j) CATCH_CHECK(M(i, j) == (i == j ? 1.f : 0.f));
+
+  cml::matrix44d_c N = cml::identity(4, 4);
+  cml::matrix44d I = cml::identity_4x4();
+  CATCH_CHECK(N == I);
+
+  cml::matrixd D = cml::constant(2, 3, -1.5);
+  CATCH_REQUIRE(D.rows() == 2);
+  CATCH_REQUIRE(D.cols() == 3);
+  CATCH_CHECK(D(1, 2) == -1.5);
+
+  D = cml::zero(3, 2);
+  CATCH_REQUIRE(D.rows() == 3);
+  CATCH_CHECK(D(2, 1) == 0.);
+}
+
+CATCH_TEST_CASE("generator_expression1")
+{
+  cml::matrix22f A(2.f, 1.f, 1.f, 3.f);
+
+  /* The int generators do not promote float expressions to double: */
+  auto xpr = A - cml::identity(2, 2);
+  CATCH_CHECK((std::is_same<decltype(xpr)::value_type, float>::value));
+  cml::matrix22f B = xpr;
+  CATCH_CHECK(B(0, 0) == 1.f);
+  CATCH_CHECK(B(0, 1) == 1.f);
+  CATCH_CHECK(B(1, 1) == 2.f);
+
+  B = A + cml::constant(cml::int_c<2>(), cml::int_c<2>(), 0.5f);
+  CATCH_CHECK(B(1, 0) == 1.5f);
+}
+
+CATCH_TEST_CASE("generator_size_checking1")
+{
+  cml::matrix33d M;
+  CATCH_CHECK_THROWS_AS(M = cml::identity(3, 4),
+    cml::incompatible_matrix_size_error);
+}
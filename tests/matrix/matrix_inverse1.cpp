@@ -9,6 +9,7 @@
 #include <cml/matrix/dynamic.h>
 #include <cml/matrix/external.h>
 #include <cml/matrix/types.h>
+#include <cml/matrix/matrix_product.h>
 
 /* Testing headers: */
 #include "catch_runner.h"
@@ -225,3 +226,86 @@ CATCH_TEST_CASE("dynamic, size_check1")
   CATCH_REQUIRE(M.cols() == 4);
   CATCH_REQUIRE_THROWS_AS(M.inverse(), cml::non_square_matrix_error);
 }
+
+namespace {
+
+/* Non-symmetric n x n test matrix requiring row pivots: */
+cml::matrixd
+make_pivot_matrix(int n)
+{
+  cml::matrixd M(n, n);
+  for(int i = 0; i < n; ++i)
+    for(int j = 0; j < n; ++j)
+      M(i, j) = (i == (j + 1) % n) ? n : 1. / (1. + i + 2. * j);
+  return M;
+}
+
+void
+check_inverse(const cml::matrixd& M, const cml::matrixd& Minv)
+{
+  cml::matrixd P = M * Minv;
+  for(int i = 0; i < P.rows(); ++i)
+    for(int j = 0; j < P.cols(); ++j)
+      CATCH_CHECK(P(i, j) == Approx(i == j ? 1. : 0.).margin(1e-10));
+}
+
+} // namespace
+
+CATCH_TEST_CASE("dynamic, inverse_lu1")
+{
+  auto M = make_pivot_matrix(CML_MATRIX_LU_INVERSE_SIZE + 17);
+  cml::matrixd Minv = cml::inverse(M);
+  check_inverse(M, Minv);
+}
+
+CATCH_TEST_CASE("dynamic, try_inverse1")
+{
+  auto M = make_pivot_matrix(150);
+  cml::matrixd Minv;
+  CATCH_REQUIRE(cml::try_inverse(M, Minv, 4));
+  check_inverse(M, Minv);
+
+  cml::matrixd Minv1;
+  CATCH_REQUIRE(cml::try_inverse(M, Minv1));
+  for(int i = 0; i < 150; ++i)
+    for(int j = 0; j < 150; ++j)
+      CATCH_CHECK(Minv1(i, j) == Approx(Minv(i, j)).margin(1e-14));
+}
+
+CATCH_TEST_CASE("dynamic, try_inverse_singular1")
+{
+  auto M = make_pivot_matrix(40);
+  for(int j = 0; j < 40; ++j) M(7, j) = 2. * M(3, j) - M(5, j);
+  cml::matrixd Minv;
+  CATCH_CHECK(!cml::try_inverse(M, Minv, 2));
+  CATCH_CHECK(!cml::try_inverse(cml::matrixd(3, 3).zero(), Minv));
+}
+
+CATCH_TEST_CASE("fixed, try_inverse1")
+{
+  cml::matrix44d M(1., 2., 3., 4., 1., 4., 9., 16., 1., 16., 25., 36., 1.,
+    36., 81., 100.);
+  cml::matrix44d Minv;
+  CATCH_REQUIRE(cml::try_inverse(M, Minv));
+
+  auto expected = cml::matrix44d(242., 20., -33., -1., 12., -48., 45., -9.,
+    46., -32., -27., 13., -44., 43., 6., -5.);
+  expected *= 1. / 228.;
+  for(int i = 0; i < 4; ++i)
+    for(int j = 0; j < 4; ++j)
+      CATCH_CHECK(Minv(i, j) == Approx(expected(i, j)).epsilon(1e-12));
+}
+
+CATCH_TEST_CASE("dynamic, inverse_singular1")
+{
+  /* inverse() does not report singularity at any size: */
+  for(int n : {8, CML_MATRIX_LU_INVERSE_SIZE}) {
+    auto M = make_pivot_matrix(n);
+    for(int j = 0; j < M.cols(); ++j) M(2, j) = M(0, j);
+    cml::matrixd Minv;
+    cml::matrix_workspace<double> W;
+    CATCH_CHECK_NOTHROW(cml::inverse(M));
+    CATCH_CHECK_NOTHROW(cml::inverse(M, Minv, W));
+    CATCH_CHECK(!cml::try_inverse(M, Minv, W));
+  }
+}
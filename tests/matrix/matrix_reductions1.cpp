@@ -0,0 +1,78 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+// Make sure the main header compiles cleanly:
+#include <cml/matrix/reductions.h>
+
+#include <cml/vector.h>
+#include <cml/matrix.h>
+
+/* Testing headers: */
+#include "catch_runner.h"
+
+namespace {
+
+using matrixd_c = cml::matrix<double, cml::dynamic<>, cml::col_basis,
+  cml::col_major>;
+
+} // namespace
+
+CATCH_TEST_CASE("sum1")
+{
+  cml::matrix23d M(1., -2., 3., 4., 5., -6.);
+  CATCH_CHECK(cml::sum(M) == 5.);
+  CATCH_CHECK(cml::sum(M + M) == 10.);
+  CATCH_CHECK(cml::sum(cml::transpose(M)) == 5.);
+  CATCH_CHECK(cml::sum(cml::matrixd()) == 0.);
+}
+
+CATCH_TEST_CASE("min_max1")
+{
+  cml::matrix23d M(1., -2., 3., 4., 5., -6.);
+  CATCH_CHECK(cml::min(M) == -6.);
+  CATCH_CHECK(cml::max(M) == 5.);
+  CATCH_CHECK(cml::argmin(M) == std::make_pair(1, 2));
+  CATCH_CHECK(cml::argmax(M) == std::make_pair(1, 1));
+
+  /* Ties go to the first element in storage order: */
+  cml::matrixd R(2, 2, 1., 7., 7., 0.);
+  matrixd_c C(2, 2, 1., 7., 7., 0.);
+  CATCH_CHECK(cml::argmax(R) == std::make_pair(0, 1));
+  CATCH_CHECK(cml::argmax(C) == std::make_pair(1, 0));
+
+  CATCH_CHECK_THROWS_AS(cml::max(cml::matrixd(0, 3)),
+    cml::minimum_matrix_size_error);
+}
+
+CATCH_TEST_CASE("norms1")
+{
+  cml::matrix23d M(1., -2., 3., 4., 5., -6.);
+  CATCH_CHECK(cml::norm_1(M) == 9.);
+  CATCH_CHECK(cml::norm_inf(M) == 15.);
+  CATCH_CHECK(cml::norm_frobenius(M) == Approx(std::sqrt(91.)).epsilon(1e-15));
+
+  matrixd_c C(2, 3, 1., -2., 3., 4., 5., -6.);
+  CATCH_CHECK(cml::norm_1(C) == 9.);
+  CATCH_CHECK(cml::norm_inf(C) == 15.);
+  CATCH_CHECK(cml::norm_1(cml::matrixd()) == 0.);
+}
+
+CATCH_TEST_CASE("threads1")
+{
+  const int N = 400;
+  cml::matrixd M(N, N);
+  matrixd_c C(N, N);
+  for(int i = 0; i < N; ++i)
+    for(int j = 0; j < N; ++j) M(i, j) = C(i, j) = std::sin(i + 2. * j);
+
+  const cml::thread_count threads(4);
+  CATCH_CHECK(cml::sum(M, threads) == Approx(cml::sum(M)).epsilon(1e-12));
+  CATCH_CHECK(cml::sum(C, threads) == Approx(cml::sum(M)).epsilon(1e-12));
+  CATCH_CHECK(cml::argmin(M, cml::thread_count(3)) == cml::argmin(M));
+  CATCH_CHECK(cml::max(C, cml::thread_count(3)) == cml::max(M));
+  CATCH_CHECK(
+    cml::norm_1(M, threads) == Approx(cml::norm_1(C)).epsilon(1e-12));
+  CATCH_CHECK(
+    cml::norm_inf(C, threads) == Approx(cml::norm_inf(M)).epsilon(1e-12));
+}
@@ -147,3 +147,62 @@ CATCH_TEST_CASE("dynamic transpose_3x3_2")
   for(int i = 0; i < 3; ++i)
     for(int j = 0; j < 3; ++j) CATCH_CHECK(T(i, j) == expected(i, j));
 }
+
+CATCH_TEST_CASE("dynamic transpose_blocked_assign1")
+{
+  /* Sizes not a multiple of the tile size: */
+  cml::matrixd M(45, 70);
+  for(int i = 0; i < M.rows(); ++i)
+    for(int j = 0; j < M.cols(); ++j) M(i, j) = 100. * i + j;
+
+  cml::matrixd T = cml::transpose(M);
+  CATCH_REQUIRE(T.rows() == 70);
+  CATCH_REQUIRE(T.cols() == 45);
+  for(int i = 0; i < T.rows(); ++i)
+    for(int j = 0; j < T.cols(); ++j) CATCH_CHECK(T(i, j) == M(j, i));
+
+  cml::matrixd_r R;
+  R = cml::transpose(M);
+  for(int i = 0; i < R.rows(); ++i)
+    for(int j = 0; j < R.cols(); ++j) CATCH_CHECK(R(i, j) == M(j, i));
+}
+
+CATCH_TEST_CASE("dynamic transpose_blocked_threads1")
+{
+  cml::matrixd M(300, 257);
+  for(int i = 0; i < M.rows(); ++i)
+    for(int j = 0; j < M.cols(); ++j) M(i, j) = 1000. * i + j;
+
+  cml::matrixd T;
+  cml::transpose(M, T, 4);
+  CATCH_REQUIRE(T.rows() == 257);
+  CATCH_REQUIRE(T.cols() == 300);
+  for(int i = 0; i < T.rows(); ++i)
+    for(int j = 0; j < T.cols(); ++j) CATCH_CHECK(T(i, j) == M(j, i));
+
+  cml::matrix33d F;
+  CATCH_CHECK_THROWS_AS(cml::transpose(M, F, 1),
+    cml::incompatible_matrix_size_error);
+}
+
+CATCH_TEST_CASE("dynamic transpose_blocked_inplace1")
+{
+  cml::matrixd M(77, 77);
+  for(int i = 0; i < M.rows(); ++i)
+    for(int j = 0; j < M.cols(); ++j) M(i, j) = 100. * i + j;
+
+  M.transpose();
+  for(int i = 0; i < M.rows(); ++i)
+    for(int j = 0; j < M.cols(); ++j) CATCH_CHECK(M(i, j) == 100. * j + i);
+
+  /* Non-square matrices are transposed using a temporary: */
+  cml::matrixd N(40, 3);
+  for(int i = 0; i < N.rows(); ++i)
+    for(int j = 0; j < N.cols(); ++j) N(i, j) = 100. * i + j;
+
+  N.transpose();
+  CATCH_REQUIRE(N.rows() == 3);
+  CATCH_REQUIRE(N.cols() == 40);
+  for(int i = 0; i < N.rows(); ++i)
+    for(int j = 0; j < N.cols(); ++j) CATCH_CHECK(N(i, j) == 100. * j + i);
+}
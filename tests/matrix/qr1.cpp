@@ -0,0 +1,158 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+// Make sure the main header compiles cleanly:
+#include <cml/matrix/qr.h>
+
+#include <cml/vector.h>
+#include <cml/matrix.h>
+
+/* Testing headers: */
+#include "catch_runner.h"
+#include "matrix_test_util.h"
+
+namespace {
+
+using cml_test::fill_regular;
+
+/* Return the largest element of |A*P - Q*R|, applying Q implicitly. */
+template<class Matrix>
+double
+qr_residual(const Matrix& A, const cml::qr_result<double>& f)
+{
+  const int M = A.rows(), N = A.cols();
+  double err = 0.;
+  for(int j = 0; j < N; ++j) {
+    cml::vectord r(M);
+    for(int i = 0; i < M; ++i) r[i] = (i <= j) ? f.qr(i, j) : 0.;
+    cml::qr_apply_q(f, r);
+    for(int i = 0; i < M; ++i)
+      err = std::max(err, std::fabs(r[i] - A(i, f.order[j])));
+  }
+  return err;
+}
+
+} // namespace
+
+CATCH_TEST_CASE("qr, blocked1")
+{
+  /* More columns than the block size, to exercise the trailing update: */
+  cml::matrixd_r A;
+  fill_regular(A, 120, 40);
+  auto f = cml::qr(A);
+  CATCH_REQUIRE(f.qr.rows() == 120);
+  CATCH_REQUIRE(f.qr.cols() == 40);
+  CATCH_CHECK(f.rank == 40);
+  for(int j = 0; j < 40; ++j) CATCH_CHECK(f.order[j] == j);
+  CATCH_CHECK(qr_residual(A, f) < 1e-12);
+}
+
+CATCH_TEST_CASE("qr, apply1")
+{
+  cml::matrixd A;
+  fill_regular(A, 30, 7);
+  auto f = cml::qr(A);
+
+  /* Q^T*Q*b = b, and |Q^T*b| = |b|: */
+  cml::vectord b(30);
+  for(int i = 0; i < 30; ++i) b[i] = std::cos(i * .4);
+  cml::vectord y = b;
+  cml::qr_apply_qt(f, y);
+  CATCH_CHECK(y.length() == Approx(b.length()).epsilon(1e-14));
+  cml::qr_apply_q(f, y);
+  for(int i = 0; i < 30; ++i) CATCH_CHECK(y[i] == Approx(b[i]).margin(1e-14));
+}
+
+CATCH_TEST_CASE("qr, pivoted1")
+{
+  /* Column 3 is a combination of columns 0 and 1: */
+  cml::matrixd A;
+  fill_regular(A, 20, 5);
+  for(int i = 0; i < 20; ++i) A(i, 3) = A(i, 0) - 2. * A(i, 1);
+
+  auto f = cml::qr(A, true);
+  CATCH_CHECK(f.rank == 4);
+  for(int k = 1; k < 5; ++k)
+    CATCH_CHECK(std::fabs(f.qr(k, k)) <= std::fabs(f.qr(k - 1, k - 1)));
+  CATCH_CHECK(qr_residual(A, f) < 1e-13);
+}
+
+CATCH_TEST_CASE("qr, reuse1")
+{
+  cml::matrixd A, B;
+  fill_regular(A, 12, 4);
+  fill_regular(B, 12, 4);
+  B *= 2.;
+  cml::qr_result<double> f;
+  cml::qr(A, f);
+  const double* data = f.qr.data();
+  cml::qr(B, f);
+  CATCH_CHECK(f.qr.data() == data);
+  CATCH_CHECK(qr_residual(B, f) < 1e-13);
+}
+
+CATCH_TEST_CASE("least_squares_solve, exact1")
+{
+  /* b = A*x0 is consistent, so the solution is x0: */
+  cml::matrixd A;
+  fill_regular(A, 50, 6);
+  cml::vectord x0(1., -2., .5, 3., 0., -1.);
+  cml::vectord b(50);
+  for(int i = 0; i < 50; ++i) {
+    b[i] = 0.;
+    for(int j = 0; j < 6; ++j) b[i] += A(i, j) * x0[j];
+  }
+
+  cml::vectord x;
+  cml::least_squares_solve(A, x, b);
+  CATCH_REQUIRE(x.size() == 6);
+  for(int j = 0; j < 6; ++j) CATCH_CHECK(x[j] == Approx(x0[j]).margin(1e-12));
+
+  cml::vectord x1;
+  cml::least_squares_solve(cml::qr(A), x1, b);
+  for(int j = 0; j < 6; ++j) CATCH_CHECK(x1[j] == Approx(x0[j]).margin(1e-12));
+}
+
+CATCH_TEST_CASE("least_squares_solve, line_fit1")
+{
+  /* Fit y = c0 + c1*t through (0,1), (1,3), (2,4), (3,4): the normal
+   * equations give c0 = 1.5, c1 = 1.
+   */
+  cml::matrixd A(4, 2, 1., 0., 1., 1., 1., 2., 1., 3.);
+  cml::vectord b(1., 3., 4., 4.);
+  cml::vector2d c;
+  cml::least_squares_solve(A, c, b);
+  CATCH_CHECK(c[0] == Approx(1.5).epsilon(1e-14));
+  CATCH_CHECK(c[1] == Approx(1.).epsilon(1e-14));
+
+  /* The residual is orthogonal to the columns of A: */
+  for(int j = 0; j < 2; ++j) {
+    double d = 0.;
+    for(int i = 0; i < 4; ++i)
+      d += A(i, j) * (b[i] - A(i, 0) * c[0] - A(i, 1) * c[1]);
+    CATCH_CHECK(d == Approx(0.).margin(1e-13));
+  }
+}
+
+CATCH_TEST_CASE("least_squares_solve, rank_deficient1")
+{
+  /* Columns 0 and 2 are equal, so the basic solution sets one to zero: */
+  cml::matrixd A(4, 3, 1., 1., 1., 1., 2., 1., 1., 3., 1., 1., 4., 1.);
+  cml::vectord b(2., 3., 4., 5.);
+  cml::vectord x;
+  cml::least_squares_solve(A, x, b);
+  CATCH_CHECK(x[0] * x[2] == 0.);
+  CATCH_CHECK(x[0] + x[2] == Approx(1.).epsilon(1e-13));
+  CATCH_CHECK(x[1] == Approx(1.).epsilon(1e-13));
+}
+
+CATCH_TEST_CASE("least_squares_solve, size_error1")
+{
+  cml::matrixd A(4, 2);
+  A.zero();
+  cml::vectord b(3);
+  cml::vectord x;
+  CATCH_CHECK_THROWS_AS(cml::least_squares_solve(A, x, b),
+    cml::incompatible_matrix_row_size_error);
+}
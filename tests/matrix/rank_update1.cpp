@@ -0,0 +1,165 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+// Make sure the main header compiles cleanly:
+#include <cml/matrix/rank_update.h>
+
+#include <cml/vector.h>
+#include <cml/matrix.h>
+
+/* Testing headers: */
+#include "catch_runner.h"
+#include "matrix_test_util.h"
+
+namespace {
+
+using matrixd_r = cml::matrix<double, cml::dynamic<>, cml::row_basis,
+  cml::row_major>;
+using matrixd_c = cml::matrix<double, cml::dynamic<>, cml::col_basis,
+  cml::col_major>;
+
+using cml_test::fill_matrix;
+using cml_test::fill_vector;
+using cml_test::max_difference;
+
+} // namespace
+
+CATCH_TEST_CASE("rank_update1")
+{
+  const int M = 37, N = 300;
+  cml::vectord u, v;
+  fill_vector(u, M);
+  fill_vector(v, N, 1.);
+
+  matrixd_r A;
+  fill_matrix(A, M, N);
+  const cml::matrixd expected = A + 2.5 * cml::outer(u, v);
+
+  cml::rank_update(A, 2.5, u, v);
+  CATCH_CHECK(max_difference(A, expected) < 1e-14);
+
+  matrixd_c C;
+  fill_matrix(C, M, N);
+  cml::rank_update(C, 2.5, u, v, 0);
+  CATCH_CHECK(max_difference(C, expected) < 1e-14);
+
+  /* Vector expressions and fixed-size matrices: */
+  cml::matrix33d F;
+  F.zero();
+  cml::rank_update(F, 1, cml::vector3d(1., 2., 3.),
+    2. * cml::vector3d(1., 0., -1.));
+  CATCH_CHECK(F(2, 0) == 6.);
+  CATCH_CHECK(F(2, 2) == -6.);
+  CATCH_CHECK(F(0, 1) == 0.);
+}
+
+CATCH_TEST_CASE("rank_k_update1")
+{
+  const int M = 50, N = 280, K = 4;
+  cml::matrixd U, V;
+  fill_matrix(U, M, K);
+  fill_matrix(V, N, K, 2.);
+
+  matrixd_r A;
+  fill_matrix(A, M, N);
+  const cml::matrixd expected = A - 0.5 * (U * cml::transpose(V));
+
+  cml::rank_k_update(A, -0.5, U, V);
+  CATCH_CHECK(max_difference(A, expected) < 1e-13);
+
+  matrixd_c C;
+  fill_matrix(C, M, N);
+  cml::rank_k_update(C, -0.5, U, V, 3);
+  CATCH_CHECK(max_difference(C, expected) < 1e-13);
+}
+
+CATCH_TEST_CASE("symmetric_rank_update1")
+{
+  const int N = 270;
+  cml::vectord u, v;
+  fill_vector(u, N);
+  fill_vector(v, N, 1.);
+
+  matrixd_r A;
+  fill_matrix(A, N, N);
+  const matrixd_r A0 = A;
+  matrixd_c C;
+  fill_matrix(C, N, N);
+
+  /* Rank-1, lower triangle only: */
+  cml::matrixd expected = A + 2. * cml::outer(u, u);
+  cml::symmetric_rank_update(A, 2., u);
+  cml::symmetric_rank_update(C, 2., u, 2);
+  CATCH_CHECK(max_difference(A, expected, true) < 1e-14);
+  CATCH_CHECK(max_difference(C, expected, true) < 1e-14);
+  CATCH_CHECK(A(0, 1) == A0(0, 1));
+  CATCH_CHECK(C(N - 2, N - 1) == A0(N - 2, N - 1));
+
+  /* Rank-2: */
+  expected = expected + 3. * (cml::outer(u, v) + cml::outer(v, u));
+  cml::symmetric_rank_update(A, 3., u, v);
+  cml::symmetric_rank_update(C, 3., u, v);
+  CATCH_CHECK(max_difference(A, expected, true) < 1e-13);
+  CATCH_CHECK(max_difference(C, expected, true) < 1e-13);
+  CATCH_CHECK(A(0, 1) == A0(0, 1));
+}
+
+CATCH_TEST_CASE("symmetric_rank_k_update1")
+{
+  const int N = 40, K = 3;
+  cml::matrixd U, V;
+  fill_matrix(U, N, K);
+  fill_matrix(V, N, K, 1.);
+
+  matrixd_r A;
+  fill_matrix(A, N, N);
+  matrixd_c C;
+  fill_matrix(C, N, N);
+
+  cml::matrixd expected = A + 1.5 * (U * cml::transpose(U));
+  cml::symmetric_rank_k_update(A, 1.5, U);
+  cml::symmetric_rank_k_update(C, 1.5, U);
+  CATCH_CHECK(max_difference(A, expected, true) < 1e-13);
+  CATCH_CHECK(max_difference(C, expected, true) < 1e-13);
+
+  expected = expected
+    - (U * cml::transpose(V)) - (V * cml::transpose(U));
+  cml::symmetric_rank_k_update(A, -1., U, V);
+  cml::symmetric_rank_k_update(C, -1., U, V);
+  CATCH_CHECK(max_difference(A, expected, true) < 1e-13);
+  CATCH_CHECK(max_difference(C, expected, true) < 1e-13);
+}
+
+CATCH_TEST_CASE("rank_k_update, empty1")
+{
+  matrixd_r A;
+  fill_matrix(A, 4, 4);
+  matrixd_c C;
+  fill_matrix(C, 4, 4);
+  const cml::matrixd expected = A;
+  const cml::matrixd U(4, 0), V(4, 0);
+
+  cml::rank_k_update(A, 1., U, V);
+  cml::symmetric_rank_k_update(A, 1., U);
+  cml::symmetric_rank_k_update(A, 1., U, V);
+  cml::rank_k_update(C, 1., U, V);
+  cml::symmetric_rank_k_update(C, 1., U);
+  cml::symmetric_rank_k_update(C, 1., U, V);
+  CATCH_CHECK(max_difference(A, expected) == 0.);
+  CATCH_CHECK(max_difference(C, expected) == 0.);
+}
+
+CATCH_TEST_CASE("rank_update, size_error1")
+{
+  cml::matrixd A(3, 4), B(3, 3), U(3, 2), V(4, 3);
+  CATCH_CHECK_THROWS_AS(
+    cml::rank_update(A, 1., cml::vectord(1., 2., 3.), cml::vectord(1., 2.)),
+    cml::incompatible_matrix_col_size_error);
+  CATCH_CHECK_THROWS_AS(cml::rank_k_update(A, 1., U, V),
+    cml::incompatible_matrix_inner_size_error);
+  CATCH_CHECK_THROWS_AS(cml::symmetric_rank_update(A, 1., cml::vectord(3)),
+    cml::non_square_matrix_error);
+  CATCH_CHECK_THROWS_AS(cml::symmetric_rank_update(B, 1., cml::vectord(4)),
+    cml::incompatible_matrix_row_size_error);
+}
@@ -0,0 +1,192 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+// Make sure the main header compiles cleanly:
+#include <cml/matrix/sparse.h>
+
+#include <cml/vector.h>
+#include <cml/matrix.h>
+
+/* Testing headers: */
+#include "catch_runner.h"
+
+namespace {
+
+/* 1D Laplacian-like tridiagonal triplets, plus one duplicate entry: */
+std::vector<cml::sparse_triplet<double>>
+make_triplets(int n)
+{
+  std::vector<cml::sparse_triplet<double>> t;
+  for(int i = n - 1; i >= 0; --i) {
+    t.push_back({i, i, 2.});
+    if(i > 0) t.push_back({i, i - 1, -1.});
+    if(i < n - 1) t.push_back({i, i + 1, -1. - i});
+  }
+  t.push_back({0, 0, .5});
+  return t;
+}
+
+template<class Sparse>
+cml::matrixd
+make_dense(const Sparse& A)
+{
+  cml::matrixd D(A.rows(), A.cols());
+  for(int i = 0; i < A.rows(); ++i)
+    for(int j = 0; j < A.cols(); ++j) D(i, j) = A(i, j);
+  return D;
+}
+
+} // namespace
+
+CATCH_TEST_CASE("csr, assemble1")
+{
+  auto t = make_triplets(5);
+  cml::csr_matrixd A(5, 5, t.begin(), t.end());
+  CATCH_REQUIRE(A.rows() == 5);
+  CATCH_REQUIRE(A.cols() == 5);
+  CATCH_CHECK(A.nonzeros() == 13);
+  CATCH_CHECK(A(0, 0) == 2.5);
+  CATCH_CHECK(A(1, 0) == -1.);
+  CATCH_CHECK(A(1, 2) == -2.);
+  CATCH_CHECK(A(0, 4) == 0.);
+  CATCH_CHECK(A.offsets()[5] == 13);
+  for(int k = 0; k < 5; ++k)
+    for(int p = A.offsets()[k] + 1; p < A.offsets()[k + 1]; ++p)
+      CATCH_CHECK(A.indices()[p - 1] < A.indices()[p]);
+}
+
+CATCH_TEST_CASE("csc, assemble1")
+{
+  auto t = make_triplets(5);
+  cml::csc_matrixd A(5, 5, t.begin(), t.end());
+  cml::csr_matrixd B(5, 5, t.begin(), t.end());
+  CATCH_CHECK(A.nonzeros() == 13);
+  for(int i = 0; i < 5; ++i)
+    for(int j = 0; j < 5; ++j) CATCH_CHECK(A(i, j) == B(i, j));
+}
+
+CATCH_TEST_CASE("assemble, invalid1")
+{
+  std::vector<cml::sparse_triplet<double>> t = {{0, 3, 1.}};
+  CATCH_CHECK_THROWS_AS(cml::csr_matrixd(3, 3, t.begin(), t.end()),
+    std::invalid_argument);
+}
+
+CATCH_TEST_CASE("csr, from arrays1")
+{
+  cml::csr_matrixd A(2, 3, {0, 2, 3}, {0, 2, 1}, {1., 2., 3.});
+  CATCH_CHECK(A(0, 0) == 1.);
+  CATCH_CHECK(A(0, 2) == 2.);
+  CATCH_CHECK(A(1, 1) == 3.);
+  CATCH_CHECK(A(1, 0) == 0.);
+  CATCH_CHECK_THROWS_AS(cml::csr_matrixd(2, 3, {0, 2}, {0, 2}, {1., 2.}),
+    std::invalid_argument);
+
+  /* Decreasing offsets: */
+  CATCH_CHECK_THROWS_AS(
+    cml::csr_matrixd(2, 3, {0, 3, 2}, {0, 1, 2}, {1., 2., 3.}),
+    std::invalid_argument);
+
+  /* Index out of range: */
+  CATCH_CHECK_THROWS_AS(
+    cml::csr_matrixd(2, 3, {0, 2, 3}, {0, 3, 1}, {1., 2., 3.}),
+    std::invalid_argument);
+  CATCH_CHECK_THROWS_AS(
+    cml::csc_matrixd(2, 3, {0, 1, 2, 3}, {0, -1, 1}, {1., 2., 3.}),
+    std::invalid_argument);
+
+  /* Unsorted and repeated indices: */
+  CATCH_CHECK_THROWS_AS(
+    cml::csr_matrixd(2, 3, {0, 2, 3}, {2, 0, 1}, {1., 2., 3.}),
+    std::invalid_argument);
+  CATCH_CHECK_THROWS_AS(
+    cml::csr_matrixd(2, 3, {0, 2, 3}, {1, 1, 1}, {1., 2., 3.}),
+    std::invalid_argument);
+}
+
+CATCH_TEST_CASE("spmv1")
+{
+  const int n = 37;
+  auto t = make_triplets(n);
+  cml::csr_matrixd A(n, n, t.begin(), t.end());
+  cml::csc_matrixd B(n, n, t.begin(), t.end());
+  auto D = make_dense(A);
+
+  cml::vectord x(n);
+  for(int i = 0; i < n; ++i) x[i] = 1. + .25 * i;
+  cml::vectord expected = D * x;
+  cml::vectord expected_t = cml::transpose(D) * x;
+
+  for(int threads : {1, 3, 0}) {
+    auto y1 = cml::sparse_product(A, x, threads);
+    auto y2 = cml::sparse_product(B, x, threads);
+    auto z1 = cml::sparse_transpose_product(A, x, threads);
+    auto z2 = cml::sparse_transpose_product(B, x, threads);
+    CATCH_REQUIRE(y1.size() == n);
+    CATCH_REQUIRE(z2.size() == n);
+    for(int i = 0; i < n; ++i) {
+      CATCH_CHECK(y1[i] == Approx(expected[i]).epsilon(1e-12));
+      CATCH_CHECK(y2[i] == Approx(expected[i]).epsilon(1e-12));
+      CATCH_CHECK(z1[i] == Approx(expected_t[i]).epsilon(1e-12));
+      CATCH_CHECK(z2[i] == Approx(expected_t[i]).epsilon(1e-12));
+    }
+  }
+
+  /* Scatter products with a reused workspace: */
+  cml::matrix_workspace<double> W;
+  cml::vectord y(n), z(n);
+  for(int pass = 0; pass < 2; ++pass) {
+    cml::sparse_product(B, x, y, W, 3);
+    cml::sparse_transpose_product(A, x, z, W, 3);
+    for(int i = 0; i < n; ++i) {
+      CATCH_CHECK(y[i] == Approx(expected[i]).epsilon(1e-12));
+      CATCH_CHECK(z[i] == Approx(expected_t[i]).epsilon(1e-12));
+    }
+  }
+}
+
+CATCH_TEST_CASE("spmv, output1")
+{
+  auto t = make_triplets(3);
+  cml::csr_matrixd A(3, 3, t.begin(), t.end());
+  cml::vector3d x(1., 2., 3.), y;
+  cml::sparse_product(A, x, y);
+  CATCH_CHECK(y[0] == Approx(2.5 - 1. * 2.).epsilon(1e-12));
+  CATCH_CHECK(y[1] == Approx(-1. + 4. - 2. * 3.).epsilon(1e-12));
+  CATCH_CHECK(y[2] == Approx(-2. + 6.).epsilon(1e-12));
+
+  cml::vectord z(4);
+  CATCH_CHECK_THROWS_AS(cml::sparse_product(A, z),
+    cml::incompatible_matrix_inner_size_error);
+}
+
+CATCH_TEST_CASE("spmm1")
+{
+  const int n = 11;
+  auto t = make_triplets(n);
+  cml::csr_matrixd A(n, n, t.begin(), t.end());
+  cml::csc_matrixd B(n, n, t.begin(), t.end());
+  auto D = make_dense(A);
+
+  cml::matrixd X(n, 4);
+  for(int i = 0; i < n; ++i)
+    for(int j = 0; j < 4; ++j) X(i, j) = double(i - 2 * j) / 3.;
+
+  cml::matrixd expected = D * X;
+  cml::matrixd expected_t = cml::transpose(D) * X;
+
+  for(int threads : {1, 2, 0}) {
+    auto C1 = cml::sparse_product(A, X, threads);
+    auto C2 = cml::sparse_product(B, X, threads);
+    auto C3 = cml::sparse_transpose_product(A, X, threads);
+    auto C4 = cml::sparse_transpose_product(B, X, threads);
+    for(int i = 0; i < n; ++i)
+      for(int j = 0; j < 4; ++j) {
+        CATCH_CHECK(C1(i, j) == Approx(expected(i, j)).margin(1e-12));
+        CATCH_CHECK(C2(i, j) == Approx(expected(i, j)).margin(1e-12));
+        CATCH_CHECK(C3(i, j) == Approx(expected_t(i, j)).margin(1e-12));
+        CATCH_CHECK(C4(i, j) == Approx(expected_t(i, j)).margin(1e-12));
+      }
+  }
+}
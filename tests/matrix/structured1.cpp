@@ -0,0 +1,189 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+// Make sure the main header compiles cleanly:
+#include <cml/matrix/structured.h>
+
+#include <cml/vector.h>
+#include <cml/matrix.h>
+#include <cml/matrix/determinant.h>
+#include <cml/matrix/generators.h>
+
+/* Testing headers: */
+#include "catch_runner.h"
+
+namespace {
+
+cml::matrixd
+make_general(int rows, int cols)
+{
+  cml::matrixd M(rows, cols);
+  for(int i = 0; i < rows; ++i)
+    for(int j = 0; j < cols; ++j) M(i, j) = 1. + .5 * i - .25 * j + i * j % 3;
+  return M;
+}
+
+template<class Sub>
+cml::matrixd
+make_dense(const cml::readable_matrix<Sub>& A)
+{
+  cml::matrixd D(A.rows(), A.cols());
+  for(int i = 0; i < A.rows(); ++i)
+    for(int j = 0; j < A.cols(); ++j) D(i, j) = A(i, j);
+  return D;
+}
+
+template<class Sub1, class Sub2>
+void
+check_equal(const cml::readable_matrix<Sub1>& A,
+  const cml::readable_matrix<Sub2>& B)
+{
+  CATCH_REQUIRE(A.rows() == B.rows());
+  CATCH_REQUIRE(A.cols() == B.cols());
+  for(int i = 0; i < A.rows(); ++i)
+    for(int j = 0; j < A.cols(); ++j)
+      CATCH_CHECK(
+        A(i, j) == Approx(B(i, j)).epsilon(1e-12).margin(1e-12));
+}
+
+} // namespace
+
+CATCH_TEST_CASE("diagonal1")
+{
+  cml::diagonal_matrixd D(cml::vector3d(2., -1., 4.));
+  CATCH_REQUIRE(D.rows() == 3);
+  CATCH_REQUIRE(D.cols() == 3);
+  CATCH_CHECK(D(1, 1) == -1.);
+  CATCH_CHECK(D(0, 2) == 0.);
+  D.set(2, 2, 5.);
+  CATCH_CHECK(D(2, 2) == 5.);
+  CATCH_CHECK_THROWS_AS(D.set(0, 1, 1.), std::invalid_argument);
+  CATCH_CHECK_THROWS_AS(cml::diagonal_matrixd(make_general(2, 3)),
+    cml::non_square_matrix_error);
+}
+
+CATCH_TEST_CASE("triangular1")
+{
+  auto M = make_general(4, 4);
+  cml::lower_matrixd L(M);
+  cml::upper_matrixd U(M, true);
+  CATCH_CHECK(L.values().size() == 10);
+  for(int i = 0; i < 4; ++i)
+    for(int j = 0; j < 4; ++j) {
+      CATCH_CHECK(L(i, j) == (j <= i ? M(i, j) : 0.));
+      CATCH_CHECK(U(i, j) == (i < j ? M(i, j) : i == j ? 1. : 0.));
+    }
+  CATCH_CHECK_THROWS_AS(L.set(0, 1, 1.), std::invalid_argument);
+  CATCH_CHECK_THROWS_AS(U.set(1, 0, 1.), std::invalid_argument);
+}
+
+CATCH_TEST_CASE("symmetric1")
+{
+  cml::symmetric_matrixd S(3);
+  S.set(0, 2, 7.);
+  S.set(1, 1, 3.);
+  CATCH_CHECK(S.values().size() == 6);
+  CATCH_CHECK(S(2, 0) == 7.);
+  CATCH_CHECK(S(0, 2) == 7.);
+  CATCH_CHECK(S(1, 1) == 3.);
+
+  auto M = make_general(3, 3);
+  cml::symmetric_matrixd T(M);
+  CATCH_CHECK(T(0, 2) == M(2, 0));
+}
+
+CATCH_TEST_CASE("banded1")
+{
+  auto M = make_general(6, 5);
+  cml::banded_matrixd B(M, 1, 2);
+  CATCH_CHECK(B.lower_bandwidth() == 1);
+  CATCH_CHECK(B.upper_bandwidth() == 2);
+  for(int i = 0; i < 6; ++i)
+    for(int j = 0; j < 5; ++j)
+      CATCH_CHECK(B(i, j) == (i - 1 <= j && j <= i + 2 ? M(i, j) : 0.));
+  CATCH_CHECK_THROWS_AS(B.set(3, 0, 1.), std::invalid_argument);
+  CATCH_CHECK_THROWS_AS(cml::banded_matrixd(2, 2, -1, 0),
+    std::invalid_argument);
+}
+
+CATCH_TEST_CASE("product1")
+{
+  const int n = 7;
+  auto A = make_general(n, n);
+  cml::diagonal_matrixd D(A);
+  cml::lower_matrixd L(A);
+  cml::upper_matrixd U(A);
+  cml::symmetric_matrixd S(A);
+  cml::banded_matrixd B(A, 2, 1);
+
+  check_equal(D * A, make_dense(D) * A);
+  check_equal(A * D, A * make_dense(D));
+  check_equal(L * A, make_dense(L) * A);
+  check_equal(A * L, A * make_dense(L));
+  check_equal(U * A, make_dense(U) * A);
+  check_equal(A * U, A * make_dense(U));
+  check_equal(S * A, make_dense(S) * A);
+  check_equal(B * A, make_dense(B) * A);
+  check_equal(A * B, A * make_dense(B));
+  check_equal(L * U, make_dense(L) * make_dense(U));
+  check_equal(U * L, make_dense(U) * make_dense(L));
+  check_equal(B * D, make_dense(B) * make_dense(D));
+
+  cml::vectord x(n);
+  for(int i = 0; i < n; ++i) x[i] = 1. - .5 * i;
+  auto y1 = L * x, y2 = make_dense(L) * x;
+  auto z1 = x * B, z2 = x * make_dense(B);
+  for(int i = 0; i < n; ++i) {
+    CATCH_CHECK(y1[i] == Approx(y2[i]).epsilon(1e-12));
+    CATCH_CHECK(z1[i] == Approx(z2[i]).epsilon(1e-12));
+  }
+}
+
+CATCH_TEST_CASE("solve1")
+{
+  const int n = 6;
+  auto A = make_general(n, n);
+  for(int i = 0; i < n; ++i) A(i, i) += 10.;
+  cml::diagonal_matrixd D(A);
+  cml::lower_matrixd L(A);
+  cml::upper_matrixd U(A);
+
+  cml::vectord b(n);
+  for(int i = 0; i < n; ++i) b[i] = 2. + i;
+  auto xd = cml::solve(D, b);
+  auto xl = cml::solve(L, b);
+  auto xu = cml::solve(U, b);
+  auto bd = D * xd, bl = L * xl, bu = U * xu;
+  for(int i = 0; i < n; ++i) {
+    CATCH_CHECK(bd[i] == Approx(b[i]).epsilon(1e-12));
+    CATCH_CHECK(bl[i] == Approx(b[i]).epsilon(1e-12));
+    CATCH_CHECK(bu[i] == Approx(b[i]).epsilon(1e-12));
+  }
+
+  cml::vectord c(n + 1);
+  CATCH_CHECK_THROWS_AS(cml::solve(L, c),
+    cml::incompatible_matrix_inner_size_error);
+}
+
+CATCH_TEST_CASE("inverse1")
+{
+  const int n = 5;
+  auto A = make_general(n, n);
+  for(int i = 0; i < n; ++i) A(i, i) += 10.;
+  cml::diagonal_matrixd D(A);
+  cml::lower_matrixd L(A);
+  cml::upper_matrixd U(A);
+
+  cml::diagonal_matrixd Dinv = cml::inverse(D);
+  cml::lower_matrixd Linv = cml::inverse(L);
+  cml::upper_matrixd Uinv = cml::inverse(U);
+  auto I = cml::identity(n, n);
+  check_equal(D * Dinv, I);
+  check_equal(L * Linv, I);
+  check_equal(U * Uinv, I);
+
+  CATCH_CHECK(cml::determinant(D) == Approx(cml::determinant(make_dense(D))));
+  CATCH_CHECK(cml::determinant(L) == Approx(cml::determinant(make_dense(L))));
+  CATCH_CHECK(cml::determinant(U) == Approx(cml::determinant(make_dense(U))));
+}
@@ -0,0 +1,258 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+// Make sure the main header compiles cleanly:
+#include <cml/matrix/svd.h>
+
+#include <vector>
+#include <cml/vector.h>
+#include <cml/matrix.h>
+#include <cml/matrix/matrix_product.h>
+#include <cml/matrix/determinant.h>
+#include <cml/mathlib/matrix/rotation.h>
+
+/* Testing headers: */
+#include "catch_runner.h"
+#include "matrix_test_util.h"
+
+namespace {
+
+/* Return R1*diag(d)*R2^T for two fixed rotations R1 and R2: */
+cml::matrix33d
+make_matrix(double d0, double d1, double d2)
+{
+  cml::matrix33d R1, R2, D;
+  cml::matrix_rotation_axis_angle(R1,
+    cml::vector3d(1., -2., .5).normalize(), .9);
+  cml::matrix_rotation_axis_angle(R2,
+    cml::vector3d(-.3, .4, 2.).normalize(), 2.1);
+  D.zero();
+  D(0, 0) = d0;
+  D(1, 1) = d1;
+  D(2, 2) = d2;
+  return R1 * D * cml::transpose(R2);
+}
+
+/* Return the largest element of |A - U*diag(sigma)*V^T|. */
+template<class MatrixA, class MatrixU, class Sigma, class MatrixV>
+double
+svd_residual(const MatrixA& A, const MatrixU& U, const Sigma& sigma,
+  const MatrixV& V)
+{
+  double err = 0.;
+  for(int i = 0; i < A.rows(); ++i)
+    for(int j = 0; j < A.cols(); ++j) {
+      double a = 0.;
+      for(int k = 0; k < sigma.size(); ++k) a += U(i, k) * sigma[k] * V(j, k);
+      err = std::max(err, std::fabs(a - A(i, j)));
+    }
+  return err;
+}
+
+using cml_test::orthonormality_error;
+
+} // namespace
+
+CATCH_TEST_CASE("svd_3x3, known1")
+{
+  cml::matrix33d A = make_matrix(3., -2., .5);
+  cml::matrix33d U, V;
+  cml::vector3d sigma;
+  cml::svd_3x3(A, U, sigma, V);
+
+  CATCH_CHECK(sigma[0] == Approx(3.).epsilon(1e-12));
+  CATCH_CHECK(sigma[1] == Approx(2.).epsilon(1e-12));
+  CATCH_CHECK(sigma[2] == Approx(.5).epsilon(1e-12));
+  CATCH_CHECK(svd_residual(A, U, sigma, V) < 1e-13);
+  CATCH_CHECK(orthonormality_error(U) < 1e-13);
+  CATCH_CHECK(orthonormality_error(V) < 1e-13);
+
+  /* det(A) < 0, so U is a reflection and V a rotation: */
+  CATCH_CHECK(cml::determinant(U) == Approx(-1.).epsilon(1e-12));
+  CATCH_CHECK(cml::determinant(V) == Approx(1.).epsilon(1e-12));
+}
+
+CATCH_TEST_CASE("svd_3x3, general1")
+{
+  cml::matrix33d A(4., -1., 2., .5, 3., -7., 1., 1., 1.);
+  cml::matrix33d U, V;
+  cml::vector3d sigma;
+  cml::svd_3x3(A, U, sigma, V);
+
+  CATCH_CHECK(sigma[0] >= sigma[1]);
+  CATCH_CHECK(sigma[1] >= sigma[2]);
+  CATCH_CHECK(sigma[2] >= 0.);
+  CATCH_CHECK(svd_residual(A, U, sigma, V) < 1e-13);
+  CATCH_CHECK(orthonormality_error(U) < 1e-13);
+  CATCH_CHECK(orthonormality_error(V) < 1e-13);
+  CATCH_CHECK(sigma[0] * sigma[1] * sigma[2]
+    == Approx(std::fabs(cml::determinant(A))).epsilon(1e-12));
+}
+
+CATCH_TEST_CASE("svd_3x3, row_major1")
+{
+  cml::matrix33f_r A(4.f, -1.f, 2.f, .5f, 3.f, -7.f, 1.f, 1.f, 1.f);
+  cml::matrix33f_r U, V;
+  cml::vector3f sigma;
+  cml::svd_3x3(A, U, sigma, V);
+  CATCH_CHECK(svd_residual(A, U, sigma, V) < 1e-5);
+  CATCH_CHECK(orthonormality_error(U) < 1e-5);
+  CATCH_CHECK(orthonormality_error(V) < 1e-5);
+}
+
+CATCH_TEST_CASE("svd_3x3, degenerate1")
+{
+  /* Rank 1, with two zero singular values: */
+  cml::matrix33d A(1., 2., 3., 2., 4., 6., -1., -2., -3.);
+  cml::matrix33d U, V;
+  cml::vector3d sigma;
+  cml::svd_3x3(A, U, sigma, V);
+  CATCH_CHECK(sigma[0] == Approx(std::sqrt(6. * 14.)).epsilon(1e-12));
+  CATCH_CHECK(sigma[1] == Approx(0.).margin(1e-12));
+  CATCH_CHECK(sigma[2] == Approx(0.).margin(1e-12));
+  CATCH_CHECK(svd_residual(A, U, sigma, V) < 1e-13);
+  CATCH_CHECK(orthonormality_error(U) < 1e-13);
+  CATCH_CHECK(orthonormality_error(V) < 1e-13);
+
+  /* Zero: */
+  A.zero();
+  cml::svd_3x3(A, U, sigma, V);
+  CATCH_CHECK(sigma == cml::vector3d(0., 0., 0.));
+  CATCH_CHECK(orthonormality_error(U) < 1e-15);
+  CATCH_CHECK(orthonormality_error(V) < 1e-15);
+
+  /* Repeated singular values: */
+  A = make_matrix(2., 2., 2.);
+  cml::svd_3x3(A, U, sigma, V);
+  CATCH_CHECK(sigma[2] == Approx(2.).epsilon(1e-12));
+  CATCH_CHECK(svd_residual(A, U, sigma, V) < 1e-13);
+}
+
+CATCH_TEST_CASE("polar_3x3, rotation1")
+{
+  cml::matrix33d R0, S0;
+  cml::matrix_rotation_axis_angle(R0,
+    cml::vector3d(.2, 1., -.4).normalize(), 1.3);
+  S0 = cml::matrix33d(2., .3, -.1, .3, 1.5, .2, -.1, .2, .8);
+  cml::matrix33d A = R0 * S0;
+
+  cml::matrix33d R, S;
+  cml::polar_3x3(A, R, S);
+  for(int i = 0; i < 3; ++i)
+    for(int j = 0; j < 3; ++j) {
+      CATCH_CHECK(R(i, j) == Approx(R0(i, j)).margin(1e-13));
+      CATCH_CHECK(S(i, j) == Approx(S0(i, j)).margin(1e-13));
+    }
+}
+
+CATCH_TEST_CASE("polar_3x3, inverted1")
+{
+  /* An inverted element: R stays a rotation, and S absorbs the sign. */
+  cml::matrix33d A = make_matrix(1.2, .9, -.3);
+  cml::matrix33d R, S;
+  cml::polar_3x3(A, R, S);
+  CATCH_CHECK(cml::determinant(R) == Approx(1.).epsilon(1e-12));
+  CATCH_CHECK(orthonormality_error(R) < 1e-13);
+  cml::matrix33d RS = R * S;
+  for(int i = 0; i < 3; ++i)
+    for(int j = 0; j < 3; ++j) {
+      CATCH_CHECK(RS(i, j) == Approx(A(i, j)).margin(1e-13));
+      CATCH_CHECK(S(i, j) == Approx(S(j, i)).margin(1e-13));
+    }
+}
+
+CATCH_TEST_CASE("svd_3x3, batch1")
+{
+  const int n = 150;
+  std::vector<cml::matrix33d> A(n), U(n), V(n), R(n), S(n);
+  std::vector<cml::vector3d> sigma(n);
+  for(int k = 0; k < n; ++k)
+    A[k] = make_matrix(1. + k, .5 * k - 20., .1) + cml::matrix33d(
+      0., .01 * k, 0., 0., 0., -.02 * k, .03 * k, 0., 0.);
+
+  cml::svd_3x3(A.data(), n, U.data(), sigma.data(), V.data(), 2);
+  cml::polar_3x3(A.data(), n, R.data(), S.data());
+  for(int k = 0; k < n; ++k) {
+    cml::matrix33d Uk, Vk, Rk, Sk;
+    cml::vector3d sk;
+    cml::svd_3x3(A[k], Uk, sk, Vk);
+    cml::polar_3x3(A[k], Rk, Sk);
+    CATCH_CHECK(sigma[k] == sk);
+    CATCH_CHECK(U[k] == Uk);
+    CATCH_CHECK(V[k] == Vk);
+    CATCH_CHECK(R[k] == Rk);
+    CATCH_CHECK(S[k] == Sk);
+    CATCH_CHECK(svd_residual(A[k], U[k], sigma[k], V[k]) < 1e-12 * sk[0]);
+  }
+}
+
+CATCH_TEST_CASE("svd, tall1")
+{
+  cml::matrixd A(5, 3, 1., 2., 3., 4., 5., 6., 7., 8., 10., -1., 0., 2., .5,
+    .5, -3.);
+  cml::matrixd U, V;
+  cml::vectord sigma;
+  CATCH_REQUIRE(cml::svd(A, U, sigma, V));
+  CATCH_REQUIRE(U.rows() == 5);
+  CATCH_REQUIRE(U.cols() == 3);
+  CATCH_REQUIRE(sigma.size() == 3);
+  CATCH_REQUIRE(V.rows() == 3);
+  CATCH_REQUIRE(V.cols() == 3);
+  CATCH_CHECK(sigma[0] >= sigma[1]);
+  CATCH_CHECK(sigma[1] >= sigma[2]);
+  CATCH_CHECK(svd_residual(A, U, sigma, V) < 1e-12);
+  CATCH_CHECK(orthonormality_error(U) < 1e-13);
+  CATCH_CHECK(orthonormality_error(V) < 1e-13);
+}
+
+CATCH_TEST_CASE("svd, wide1")
+{
+  cml::matrixd A(2, 4, 1., -2., 3., .5, 0., 4., 1., 2.);
+  cml::matrixd U, V;
+  cml::vectord sigma;
+  CATCH_REQUIRE(cml::svd(A, U, sigma, V));
+  CATCH_REQUIRE(U.rows() == 2);
+  CATCH_REQUIRE(U.cols() == 2);
+  CATCH_REQUIRE(V.rows() == 4);
+  CATCH_REQUIRE(V.cols() == 2);
+  CATCH_CHECK(svd_residual(A, U, sigma, V) < 1e-13);
+  CATCH_CHECK(orthonormality_error(U) < 1e-13);
+  CATCH_CHECK(orthonormality_error(V) < 1e-13);
+}
+
+CATCH_TEST_CASE("svd, rank_deficient1")
+{
+  /* Rows 2 and 3 are combinations of rows 0 and 1: */
+  cml::matrixd A(4, 4, 1., 2., 0., -1., 0., 1., 3., 2., 1., 3., 3., 1., 2.,
+    5., 3., 0.);
+  cml::matrixd U, V;
+  cml::vectord sigma;
+  cml::svd(A, U, sigma, V);
+  CATCH_CHECK(sigma[2] == Approx(0.).margin(1e-12));
+  CATCH_CHECK(sigma[3] == Approx(0.).margin(1e-12));
+  CATCH_CHECK(svd_residual(A, U, sigma, V) < 1e-12);
+  CATCH_CHECK(orthonormality_error(U) < 1e-12);
+  CATCH_CHECK(orthonormality_error(V) < 1e-12);
+}
+
+CATCH_TEST_CASE("svd, fixed1")
+{
+  cml::matrix33d A = make_matrix(5., 1., .25);
+  cml::matrix33d U, V;
+  cml::vector3d sigma;
+  CATCH_REQUIRE(cml::svd(A, U, sigma, V));
+  CATCH_CHECK(sigma[0] == Approx(5.).epsilon(1e-12));
+  CATCH_CHECK(sigma[1] == Approx(1.).epsilon(1e-12));
+  CATCH_CHECK(sigma[2] == Approx(.25).epsilon(1e-12));
+  CATCH_CHECK(svd_residual(A, U, sigma, V) < 1e-13);
+}
+
+CATCH_TEST_CASE("svd, size_error1")
+{
+  cml::matrixd A(4, 3);
+  A.zero();
+  cml::matrix33d U, V;
+  cml::vector3d sigma;
+  CATCH_CHECK_THROWS_AS(cml::svd(A, U, sigma, V), cml::matrix_size_error);
+}
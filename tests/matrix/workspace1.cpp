@@ -0,0 +1,151 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+// Make sure the main header compiles cleanly:
+#include <cml/matrix/workspace.h>
+
+#include <cml/matrix/determinant.h>
+#include <cml/matrix/inverse.h>
+#include <cml/matrix/lu.h>
+#include <cml/matrix.h>
+
+/* Testing headers: */
+#include "catch_runner.h"
+
+namespace {
+
+/* Diagonally dominant, non-symmetric n x n test matrix: */
+cml::matrixd
+make_matrix(int n)
+{
+  cml::matrixd M(n, n);
+  for(int i = 0; i < n; ++i)
+    for(int j = 0; j < n; ++j)
+      M(i, j) = (i == j) ? 2. * n : 1. / (1. + i + 2. * j);
+  return M;
+}
+
+template<class Sub1, class Sub2>
+void
+check_identity_product(const cml::readable_matrix<Sub1>& M,
+  const cml::readable_matrix<Sub2>& Minv)
+{
+  cml::matrixd P = M * Minv;
+  for(int i = 0; i < P.rows(); ++i)
+    for(int j = 0; j < P.cols(); ++j)
+      CATCH_CHECK(P(i, j) == Approx(i == j ? 1. : 0.).margin(1e-12));
+}
+
+} // namespace
+
+CATCH_TEST_CASE("workspace, grows")
+{
+  cml::matrix_workspace<double> W(4);
+  double* v = W.values(16);
+  CATCH_CHECK(W.values(8) == v);
+  CATCH_CHECK(W.indices(12) != nullptr);
+  CATCH_CHECK(W.values(100) != nullptr);
+}
+
+CATCH_TEST_CASE("dynamic, det_small_buffer")
+{
+  auto M = make_matrix(6);
+  cml::matrix_workspace<double> W;
+  auto expected = cml::lu_pivot(M);
+  double det = expected.sign;
+  for(int i = 0; i < 6; ++i) det *= expected.lu(i, i);
+  CATCH_CHECK(cml::determinant(M) == Approx(det).epsilon(1e-12));
+  CATCH_CHECK(cml::determinant(M, W) == Approx(det).epsilon(1e-12));
+}
+
+CATCH_TEST_CASE("dynamic, det_workspace")
+{
+  const int N = CML_MATRIX_SMALL_BUFFER_SIZE + 3;
+  auto M = make_matrix(N);
+  cml::matrix_workspace<double> W(N);
+  double det = cml::determinant(M);
+  CATCH_CHECK(cml::determinant(M, W) == Approx(det).epsilon(1e-12));
+  CATCH_CHECK(cml::determinant(M, W) == Approx(det).epsilon(1e-12));
+}
+
+CATCH_TEST_CASE("fixed, det_workspace")
+{
+  cml::matrix44d M(2., 0., 2., .6, 3., 3., 4., -2., 5., 5., 4., 2., -1., -2.,
+    3.4, -1.);
+  cml::matrix_workspace<double> W;
+  CATCH_CHECK(cml::determinant(M, W) == Approx(-120).epsilon(1e-12));
+}
+
+CATCH_TEST_CASE("dynamic, inverse_small_buffer")
+{
+  auto M = make_matrix(6);
+  cml::matrixd Minv;
+  cml::matrix_workspace<double> W;
+  cml::inverse(M, Minv, W);
+  CATCH_CHECK(Minv.rows() == 6);
+  check_identity_product(M, Minv);
+}
+
+CATCH_TEST_CASE("dynamic, inverse_workspace")
+{
+  const int N = CML_MATRIX_SMALL_BUFFER_SIZE + 3;
+  auto M = make_matrix(N);
+  cml::matrixd Minv;
+  cml::matrix_workspace<double> W;
+  cml::inverse(M, Minv, W);
+  check_identity_product(M, Minv);
+
+  /* Reuse the output and workspace: */
+  cml::matrixd M2 = 2. * M;
+  cml::inverse(M2, Minv, W);
+  check_identity_product(M2, Minv);
+
+  /* Compare against the temporary-returning inverse: */
+  cml::matrixd expected = cml::inverse(M2);
+  for(int i = 0; i < N; ++i)
+    for(int j = 0; j < N; ++j)
+      CATCH_CHECK(Minv(i, j) == Approx(expected(i, j)).margin(1e-14));
+}
+
+CATCH_TEST_CASE("dynamic, inverse_in_place")
+{
+  const int N = CML_MATRIX_SMALL_BUFFER_SIZE + 1;
+  auto M = make_matrix(N);
+  cml::matrixd A = M;
+  cml::matrix_workspace<double> W;
+  cml::inverse(A, A, W);
+  check_identity_product(M, A);
+}
+
+CATCH_TEST_CASE("dynamic, lu_pivot_reuse")
+{
+  auto M = make_matrix(8);
+  auto expected = cml::lu_pivot(M);
+
+  cml::lu_pivot_result<cml::matrixd> result;
+  cml::lu_pivot(M, result);
+  CATCH_CHECK(result.sign == expected.sign);
+  CATCH_CHECK(result.order.size() == 8);
+  for(int i = 0; i < 8; ++i) {
+    CATCH_CHECK(result.order[i] == expected.order[i]);
+    for(int j = 0; j < 8; ++j)
+      CATCH_CHECK(result.lu(i, j) == Approx(expected.lu(i, j)).epsilon(1e-12));
+  }
+
+  /* A second decomposition of the same size reuses the storage: */
+  const double* data = result.lu.data();
+  cml::lu_pivot(M, result);
+  CATCH_CHECK(result.lu.data() == data);
+  CATCH_CHECK(result.sign == expected.sign);
+}
+
+CATCH_TEST_CASE("fixed, lu_pivot_reuse")
+{
+  cml::matrix33d M(2., 0., 2., 3., 3., 4., 5., 5., 4.);
+  auto expected = cml::lu_pivot(M);
+  cml::lu_pivot_result<cml::matrix33d> result;
+  cml::lu_pivot(M, result);
+  CATCH_CHECK(result.sign == expected.sign);
+  for(int i = 0; i < 3; ++i) CATCH_CHECK(result.order[i] == expected.order[i]);
+}
@@ -0,0 +1,196 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+// Make sure the main header compiles cleanly:
+#include <cml/quaternion/dual_quaternion.h>
+
+#include <cml/vector.h>
+#include <cml/matrix.h>
+#include <cml/quaternion.h>
+#include <cml/mathlib/mathlib.h>
+
+/* Testing headers: */
+#include "catch_runner.h"
+
+namespace {
+
+cml::dual_quaterniond
+make_rigid(const cml::vector3d& axis, double angle, const cml::vector3d& t)
+{
+  cml::quaterniond q;
+  cml::quaternion_rotation_axis_angle(q, axis, angle);
+  return cml::dual_quaterniond(q, t);
+}
+
+} // namespace
+
+CATCH_TEST_CASE("rigid1")
+{
+  auto dq = make_rigid(cml::vector3d(0., 0., 1.), M_PI / 2.,
+    cml::vector3d(1., 2., 3.));
+
+  auto t = dq.translation();
+  CATCH_CHECK(t[0] == Approx(1.).epsilon(1e-12));
+  CATCH_CHECK(t[1] == Approx(2.).epsilon(1e-12));
+  CATCH_CHECK(t[2] == Approx(3.).epsilon(1e-12));
+
+  auto p = cml::transform_point(dq, cml::vector3d(1., 0., 0.));
+  CATCH_CHECK(p[0] == Approx(1.).epsilon(1e-12));
+  CATCH_CHECK(p[1] == Approx(3.).epsilon(1e-12));
+  CATCH_CHECK(p[2] == Approx(3.).epsilon(1e-12));
+}
+
+CATCH_TEST_CASE("product1")
+{
+  auto dq1 = make_rigid(cml::vector3d(0., 0., 1.), M_PI / 2.,
+    cml::vector3d(1., 0., 0.));
+  auto dq2 = make_rigid(cml::vector3d(1., 0., 0.), M_PI / 3.,
+    cml::vector3d(0., 2., 0.));
+
+  /* dq1*dq2 applies dq2 first, then dq1: */
+  auto dq = dq1 * dq2;
+  cml::vector3d p(.5, -1., 2.);
+  auto expected = cml::transform_point(dq1, cml::transform_point(dq2, p));
+  auto actual = cml::transform_point(dq, p);
+  for(int i = 0; i < 3; ++i)
+    CATCH_CHECK(actual[i] == Approx(expected[i]).epsilon(1e-12));
+}
+
+CATCH_TEST_CASE("conjugate1")
+{
+  auto dq = make_rigid(cml::vector3d(1., 1., 0.).normalize(), .7,
+    cml::vector3d(-1., 4., 2.));
+  cml::vector3d p(3., -2., 1.);
+  auto q = cml::transform_point(cml::conjugate(dq),
+    cml::transform_point(dq, p));
+  for(int i = 0; i < 3; ++i) CATCH_CHECK(q[i] == Approx(p[i]).epsilon(1e-12));
+}
+
+CATCH_TEST_CASE("normalize1")
+{
+  auto dq = make_rigid(cml::vector3d(0., 1., 0.), 1.2,
+    cml::vector3d(1., 2., 3.));
+  auto scaled = 3. * dq;
+  scaled.dual()[0] += 0.25;  // Break orthogonality slightly.
+  scaled.normalize();
+  CATCH_CHECK(scaled.length() == Approx(1.).epsilon(1e-12));
+  const double rd = cml::dot(scaled.real(), scaled.dual());
+  CATCH_CHECK(0. == Approx(rd).margin(1e-12));
+}
+
+CATCH_TEST_CASE("matrix1")
+{
+  auto dq = make_rigid(cml::vector3d(1., 2., 3.).normalize(), .9,
+    cml::vector3d(4., 5., 6.));
+
+  cml::matrix44d M;
+  cml::matrix_rigid_dual_quaternion(M, dq);
+
+  cml::vector3d p(1., -1., .5);
+  auto expected = cml::transform_point(dq, p);
+  auto actual = cml::transform_point(M, p);
+  for(int i = 0; i < 3; ++i)
+    CATCH_CHECK(actual[i] == Approx(expected[i]).epsilon(1e-12));
+
+  cml::dual_quaterniond dq2;
+  cml::dual_quaternion_rigid_matrix(dq2, M);
+  auto again = cml::transform_point(dq2, p);
+  for(int i = 0; i < 3; ++i)
+    CATCH_CHECK(again[i] == Approx(expected[i]).epsilon(1e-12));
+}
+
+CATCH_TEST_CASE("sclerp1")
+{
+  auto dq0 = make_rigid(cml::vector3d(0., 0., 1.), 0.,
+    cml::vector3d(0., 0., 0.));
+  auto dq1 = make_rigid(cml::vector3d(0., 0., 1.), M_PI / 2.,
+    cml::vector3d(0., 0., 2.));
+
+  CATCH_SECTION("endpoints")
+  {
+    cml::vector3d p(1., 2., 3.);
+    auto p0 = cml::transform_point(cml::sclerp(dq0, dq1, 0.), p);
+    auto p1 = cml::transform_point(cml::sclerp(dq0, dq1, 1.), p);
+    auto e1 = cml::transform_point(dq1, p);
+    for(int i = 0; i < 3; ++i) {
+      CATCH_CHECK(p0[i] == Approx(p[i]).epsilon(1e-12));
+      CATCH_CHECK(p1[i] == Approx(e1[i]).epsilon(1e-12));
+    }
+  }
+
+  CATCH_SECTION("midpoint")
+  {
+    /* A screw about z: half the angle and half the pitch: */
+    auto mid = cml::sclerp(dq0, dq1, .5);
+    auto p = cml::transform_point(mid, cml::vector3d(1., 0., 0.));
+    CATCH_CHECK(p[0] == Approx(std::sqrt(.5)).epsilon(1e-12));
+    CATCH_CHECK(p[1] == Approx(std::sqrt(.5)).epsilon(1e-12));
+    CATCH_CHECK(p[2] == Approx(1.).epsilon(1e-12));
+  }
+
+  CATCH_SECTION("translation")
+  {
+    auto dt = make_rigid(cml::vector3d(0., 0., 1.), 0.,
+      cml::vector3d(2., -4., 6.));
+    auto t = cml::sclerp(dq0, dt, .25).translation();
+    CATCH_CHECK(t[0] == Approx(.5).epsilon(1e-12));
+    CATCH_CHECK(t[1] == Approx(-1.).epsilon(1e-12));
+    CATCH_CHECK(t[2] == Approx(1.5).epsilon(1e-12));
+  }
+}
+
+CATCH_TEST_CASE("blend1")
+{
+  cml::dual_quaterniond bones[] = {
+    make_rigid(cml::vector3d(0., 0., 1.), 0., cml::vector3d(0., 0., 0.)),
+    make_rigid(cml::vector3d(0., 0., 1.), M_PI / 2., cml::vector3d(0., 0., 2.)),
+  };
+
+  CATCH_SECTION("single")
+  {
+    /* Sign-flipped copies of the same bone blend to the bone: */
+    cml::dual_quaterniond flipped[] = {bones[1], -1. * bones[1]};
+    const double w[] = {.5, .5};
+    auto b = cml::dual_quaternion_blend(flipped, w, 2);
+    auto t = b.translation();
+    CATCH_CHECK(t[2] == Approx(2.).epsilon(1e-12));
+  }
+
+  CATCH_SECTION("points")
+  {
+    const cml::vector3d in[] = {
+      cml::vector3d(1., 0., 0.), cml::vector3d(0., 1., 0.),
+      cml::vector3d(1., 1., 1.)};
+    const int indices[] = {0, 1, 1, 0, 0, 1};
+    const double weights[] = {1., 0., 1., 0., .5, .5};
+    cml::vector3d out[3];
+    cml::dual_quaternion_blend_points(bones, indices, weights, 2, in, out, 3);
+
+    CATCH_CHECK(out[0][0] == Approx(1.).epsilon(1e-12));
+    CATCH_CHECK(0. == Approx(out[0][1]).margin(1e-12));
+    CATCH_CHECK(0. == Approx(out[0][2]).margin(1e-12));
+
+    auto e1 = cml::transform_point(bones[1], in[1]);
+    for(int i = 0; i < 3; ++i)
+      CATCH_CHECK(out[1][i] == Approx(e1[i]).margin(1e-12));
+
+    auto mid = cml::dual_quaternion_blend(bones, &weights[4], 2);
+    auto e2 = cml::transform_point(mid, in[2]);
+    for(int i = 0; i < 3; ++i)
+      CATCH_CHECK(out[2][i] == Approx(e2[i]).margin(1e-12));
+  }
+
+  CATCH_SECTION("transform")
+  {
+    double in[2][3] = {{1., 0., 0.}, {0., 1., 0.}};
+    double out[2][3];
+    cml::dual_quaternion_transform_points(bones[1], in, out, 2);
+    for(int k = 0; k < 2; ++k) {
+      auto e = cml::transform_point(bones[1],
+        cml::vector3d(in[k][0], in[k][1], in[k][2]));
+      for(int i = 0; i < 3; ++i)
+        CATCH_CHECK(out[k][i] == Approx(e[i]).margin(1e-12));
+    }
+  }
+}
@@ -75,3 +75,33 @@ CATCH_TEST_CASE("equal1")
   cml::quaterniond w = {1., 2., 3., 4.};
   CATCH_REQUIRE(w == v);
 }
+
+CATCH_TEST_CASE("approx_equal1")
+{
+  cml::quaterniond q(1., 2., 3., 4.);
+  cml::quaterniond r(1., 2., 3., 4. + 1e-10);
+  CATCH_CHECK(cml::approx_equal(q, r, 1e-9));
+  CATCH_CHECK(!cml::approx_equal(q, r, 1e-11));
+  CATCH_CHECK(cml::approx_equal_ulps(q, q, 0));
+  cml::quaterniond n(-1., -2., -3., -4.);
+  CATCH_CHECK(!cml::approx_equal(q, n, 1e-9));
+}
+
+CATCH_TEST_CASE("approx_equal_rotation1")
+{
+  cml::quaterniond q(.5, .5, .5, .5);
+  cml::quaterniond r(-.5, -.5, -.5, -.5 + 1e-12);
+  CATCH_CHECK(cml::approx_equal_rotation(q, r, 1e-9));
+  CATCH_CHECK(cml::approx_equal_rotation(q, q, 0.));
+  CATCH_CHECK(!cml::approx_equal_rotation(q, cml::quaterniond(.5, -.5, .5, .5),
+    1e-9));
+}
+
+CATCH_TEST_CASE("batch_approx_equal1")
+{
+  cml::quaterniond items[] = {{1., 0., 0., 0.}, {0., 1., 0., 0.}};
+  CATCH_CHECK(cml::find_approx_equal(items, 2, cml::quaterniond(0., 1., 0., 0.),
+                1e-9)
+    == 1);
+  CATCH_CHECK(!cml::all_approx_equal(items, items + 1, 1, 1e-9));
+}
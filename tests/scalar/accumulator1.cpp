@@ -0,0 +1,74 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+/* Accumulate float sums in double for this test: */
+#define CML_FLOAT_ACCUMULATOR double
+
+// Make sure the main header compiles cleanly:
+#include <cml/scalar/accumulator.h>
+
+#include <type_traits>
+#include <cml/vector.h>
+#include <cml/matrix.h>
+#include <cml/matrix/lu.h>
+
+/* Testing headers: */
+#include "catch_runner.h"
+
+CATCH_TEST_CASE("accumulator_of1")
+{
+  CATCH_CHECK((std::is_same_v<cml::accumulator_of_t<float>, double>));
+  CATCH_CHECK((std::is_same_v<cml::accumulator_of_t<double>, double>));
+  CATCH_CHECK((std::is_same_v<cml::accumulator_of_t<int>, int>));
+}
+
+CATCH_TEST_CASE("dot1")
+{
+  /* Summing 1 + 2^-24 * n in float loses every small term, since each is
+   * below half an ulp of 1:
+   */
+  const int n = 1000;
+  cml::vectorf a(n + 1), b(n + 1);
+  a[0] = b[0] = 1.f;
+  for(int i = 1; i <= n; ++i) {
+    a[i] = 1.f / 4096.f;
+    b[i] = 1.f / 4096.f;
+  }
+  const float d = cml::dot(a, b);
+  CATCH_CHECK(d == float(1. + n / 16777216.));
+  CATCH_CHECK(d > 1.f);
+  CATCH_CHECK(a.length_squared() == d);
+  CATCH_CHECK(a.length() == float(std::sqrt(1. + n / 16777216.)));
+}
+
+CATCH_TEST_CASE("products1")
+{
+  const int n = 1000;
+  cml::matrixf A(2, n + 1);
+  cml::vectorf x(n + 1);
+  A(0, 0) = A(1, 0) = x[0] = 1.f;
+  for(int j = 1; j <= n; ++j) {
+    A(0, j) = A(1, j) = x[j] = 1.f / 4096.f;
+  }
+  const float expected = float(1. + n / 16777216.);
+
+  const cml::vectorf y = A * x;
+  CATCH_CHECK(y[0] == expected);
+  CATCH_CHECK(y[1] == expected);
+
+  const cml::vectorf z = x * cml::transpose(A);
+  CATCH_CHECK(z[0] == expected);
+
+  const cml::matrixf M = A * cml::transpose(A);
+  CATCH_CHECK(M(0, 1) == expected);
+}
+
+CATCH_TEST_CASE("lu1")
+{
+  cml::matrix33f A(4.f, 3.f, 1.f, 6.f, 3.f, 2.f, 1.f, 5.f, 7.f);
+  cml::vector3f b(1.f, 2.f, 3.f);
+  const cml::vector3f x = cml::lu_solve(cml::lu_pivot(A), b);
+  const cml::vector3f r = A * x - b;
+  for(int i = 0; i < 3; ++i) CATCH_CHECK(r[i] == Approx(0.f).margin(1e-5));
+}
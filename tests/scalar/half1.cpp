@@ -0,0 +1,94 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+// Make sure the main header compiles cleanly:
+#include <cml/scalar/half.h>
+
+#include <cml/vector.h>
+#include <cml/matrix.h>
+
+/* Testing headers: */
+#include "catch_runner.h"
+
+CATCH_TEST_CASE("half, conversion1")
+{
+  /* Exactly representable values round-trip: */
+  const float exact[] = {0.f, 1.f, -2.f, .5f, 1024.f, 65504.f, -65504.f,
+    1.f / 16384.f, 1.f / 16777216.f, 3.140625f};
+  for(float f : exact) CATCH_CHECK(float(cml::half(f)) == f);
+
+  CATCH_CHECK(cml::half(1.f).bits() == 0x3c00);
+  CATCH_CHECK(cml::half(-2.f).bits() == 0xc000);
+  CATCH_CHECK(cml::half(1.f / 16777216.f).bits() == 0x0001);
+
+  /* Round to nearest, ties to even: */
+  CATCH_CHECK(float(cml::half(1.f + 1.f / 4096.f)) == 1.f);
+  CATCH_CHECK(float(cml::half(1.f + 3.f / 2048.f)) == 1.f + 1.f / 512.f);
+  CATCH_CHECK(float(cml::half(1.f / 33554432.f)) == 0.f);
+  CATCH_CHECK(float(cml::half(1.5f / 16777216.f)) == 1.f / 8388608.f);
+
+  /* Overflow, infinity and NaN: */
+  CATCH_CHECK(cml::half(65519.f).bits() == 0x7bff);
+  CATCH_CHECK(cml::half(65520.f).bits() == 0x7c00);
+  CATCH_CHECK(std::isinf(float(cml::half(1e10f))));
+  CATCH_CHECK(std::isnan(float(cml::half(std::nanf("")))));
+  CATCH_CHECK(float(std::numeric_limits<cml::half>::max()) == 65504.f);
+  CATCH_CHECK(float(std::numeric_limits<cml::half>::epsilon()) == 1.f / 1024.f);
+}
+
+CATCH_TEST_CASE("bfloat16, conversion1")
+{
+  CATCH_CHECK(cml::bfloat16(1.f).bits() == 0x3f80);
+  CATCH_CHECK(float(cml::bfloat16(-3.f)) == -3.f);
+  CATCH_CHECK(float(cml::bfloat16(1e30f)) == Approx(1e30f).epsilon(1e-2));
+
+  /* Round to nearest, ties to even: */
+  CATCH_CHECK(float(cml::bfloat16(1.f + 1.f / 256.f)) == 1.f);
+  CATCH_CHECK(float(cml::bfloat16(1.f + 3.f / 256.f)) == 1.f + 1.f / 64.f);
+  CATCH_CHECK(std::isnan(float(cml::bfloat16(std::nanf("")))));
+  CATCH_CHECK(float(std::numeric_limits<cml::bfloat16>::epsilon())
+    == 1.f / 128.f);
+}
+
+CATCH_TEST_CASE("half, arithmetic1")
+{
+  cml::half a(1.5f), b(2.f);
+  CATCH_CHECK(a + b == 3.5f);
+  CATCH_CHECK(a * b == 3.f);
+  CATCH_CHECK(a < b);
+  a += 1;
+  CATCH_CHECK(a == 2.5f);
+  a *= b;
+  CATCH_CHECK(a == 5.f);
+  CATCH_CHECK(cml::scalar_traits<cml::half>::sqrt(cml::half(4.f)) == 2.f);
+  CATCH_CHECK((std::is_same_v<cml::scalar_promote_t<cml::half, cml::half>,
+    cml::half>));
+  CATCH_CHECK((std::is_same_v<cml::scalar_promote_t<cml::half, int>, float>));
+  CATCH_CHECK((std::is_same_v<cml::scalar_promote_t<double, cml::bfloat16>,
+    double>));
+}
+
+CATCH_TEST_CASE("half, storage1")
+{
+  using vector3h = cml::vector<cml::half, cml::compiled<3>>;
+  CATCH_CHECK(sizeof(vector3h) == 3 * sizeof(std::uint16_t));
+
+  vector3h n(cml::vector3f(0.f, .6f, .8f));
+  CATCH_CHECK(n.length() == Approx(1.f).epsilon(1e-3));
+
+  /* Expressions compute in float: */
+  const cml::vector3f v = 2.f * n + cml::vector3f(1.f, 1.f, 1.f);
+  CATCH_CHECK(v[0] == 1.f);
+  CATCH_CHECK(v[1] == Approx(2.2f).epsilon(1e-3));
+
+  /* Dot products accumulate in float (a half sum stalls at 2048): */
+  std::vector<cml::half> data(3000, cml::half(1.f));
+  cml::vector<cml::half, cml::external<>> x(data.data(), int(data.size()));
+  CATCH_CHECK(float(cml::dot(x, x)) == 3000.f);
+
+  cml::matrix<cml::half, cml::compiled<2, 2>> M(1.f, 2.f, 3.f, 4.f);
+  const cml::vector2f y = M * cml::vector2f(1.f, 1.f);
+  CATCH_CHECK(y[0] == 3.f);
+  CATCH_CHECK(y[1] == 7.f);
+}
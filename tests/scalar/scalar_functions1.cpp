@@ -183,3 +183,28 @@ CATCH_TEST_CASE("index_of_max3")
     CATCH_CHECK(i == index[0]);
   }
 }
+
+CATCH_TEST_CASE("approx_equal1")
+{
+  CATCH_CHECK(cml::approx_equal(1., 1. + 1e-9, 1e-8));
+  CATCH_CHECK(!cml::approx_equal(1., 1. + 1e-7, 1e-8));
+  CATCH_CHECK(cml::approx_equal(1e6, 1e6 + 1., 0., 1e-5));
+  CATCH_CHECK(!cml::approx_equal(1e6, 1e6 + 100., 0., 1e-5));
+  CATCH_CHECK(!cml::approx_equal(std::nan(""), std::nan(""), 1., 1.));
+}
+
+CATCH_TEST_CASE("ulp_distance1")
+{
+  CATCH_CHECK(cml::ulp_distance(1., 1.) == 0);
+  CATCH_CHECK(cml::ulp_distance(1., std::nextafter(1., 2.)) == 1);
+  CATCH_CHECK(cml::ulp_distance(1.f, std::nextafter(1.f, 0.f)) == 1);
+  CATCH_CHECK(cml::ulp_distance(0., -0.) == 0);
+  CATCH_CHECK(cml::ulp_distance(-std::numeric_limits<float>::denorm_min(),
+                std::numeric_limits<float>::denorm_min())
+    == 2);
+  CATCH_CHECK(cml::ulp_distance(std::nan(""), 1.)
+    == std::numeric_limits<std::int64_t>::max());
+  CATCH_CHECK(cml::ulp_distance(-std::numeric_limits<double>::max(),
+                std::numeric_limits<double>::max())
+    > 0);
+}
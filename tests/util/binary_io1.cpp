@@ -0,0 +1,139 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+
+// Make sure the main header compiles cleanly:
+#include <cml/util/binary_io.h>
+
+#include <cml/vector.h>
+#include <cml/matrix.h>
+
+/* Testing headers: */
+#include "catch_runner.h"
+
+
+CATCH_TEST_CASE("stream, vector3f")
+{
+  std::vector<cml::vector3f> values;
+  for(int i = 0; i < 10; ++i)
+    values.push_back(cml::vector3f(float(i), float(2 * i), float(3 * i)));
+
+  std::stringstream buffer;
+  cml::write_binary_array(buffer, values);
+  CATCH_CHECK(buffer.str().size()
+    == cml::binary_data_offset + 10 * 3 * sizeof(float));
+
+  auto result = cml::read_binary_array<cml::vector3f>(buffer);
+  CATCH_REQUIRE(result.size() == 10);
+  for(int i = 0; i < 10; ++i) CATCH_CHECK(result[i] == values[i]);
+}
+
+CATCH_TEST_CASE("stream, mismatch1")
+{
+  std::vector<cml::matrix44f_r> values(2, cml::matrix44f_r().identity());
+  std::stringstream buffer;
+  cml::write_binary_array(buffer, values);
+
+  std::stringstream copy1(buffer.str());
+  CATCH_CHECK_THROWS_AS(cml::read_binary_array<cml::matrix44f_c>(copy1),
+    cml::binary_io_error);
+
+  std::stringstream copy2(buffer.str());
+  CATCH_CHECK_THROWS_AS(cml::read_binary_array<cml::matrix44d_r>(copy2),
+    cml::binary_io_error);
+
+  std::stringstream copy3(buffer.str());
+  CATCH_CHECK_THROWS_AS(cml::read_binary_array<cml::vector4f>(copy3),
+    cml::binary_io_error);
+
+  std::stringstream truncated(buffer.str().substr(0, 100));
+  CATCH_CHECK_THROWS_AS(cml::read_binary_array<cml::matrix44f_r>(truncated),
+    cml::binary_io_error);
+}
+
+CATCH_TEST_CASE("stream, corrupt_count1")
+{
+  std::vector<cml::vector3f> values(4, cml::vector3f(1.f, 2.f, 3.f));
+  std::stringstream buffer;
+  cml::write_binary_array(buffer, values);
+
+  /* A count whose byte size overflows: */
+  std::string data = buffer.str();
+  cml::binary_array_header header;
+  std::memcpy(&header, data.data(), sizeof(header));
+  header.count = UINT64_MAX / 4;
+  std::memcpy(&data[0], &header, sizeof(header));
+  std::stringstream overflow(data);
+  CATCH_CHECK_THROWS_AS(cml::read_binary_array<cml::vector3f>(overflow),
+    cml::binary_io_error);
+
+  /* A count far larger than the stream, which must fail without
+   * allocating the whole array:
+   */
+  header.count = INT_MAX;
+  std::memcpy(&data[0], &header, sizeof(header));
+  std::stringstream truncated(data);
+  CATCH_CHECK_THROWS_AS(cml::read_binary_array<cml::vector3f>(truncated),
+    cml::binary_io_error);
+
+  /* A count that does not fit the int indices of mapped arrays: */
+  header.count = std::uint64_t(INT_MAX) + 1;
+  std::memcpy(&data[0], &header, sizeof(header));
+  std::stringstream too_large(data);
+  CATCH_CHECK_THROWS_AS(cml::read_binary_array<cml::vector3f>(too_large),
+    cml::binary_io_error);
+}
+
+CATCH_TEST_CASE("mapped, matrix44f")
+{
+  const std::string path = "binary_io1_matrix44f.bin";
+  std::vector<cml::matrix44f> values;
+  for(int i = 0; i < 5; ++i) {
+    cml::matrix44f M;
+    for(int r = 0; r < 4; ++r)
+      for(int c = 0; c < 4; ++c) M(r, c) = float(100 * i + 10 * r + c);
+    values.push_back(M);
+  }
+  cml::write_binary_array(path, values);
+
+  {
+    cml::mapped_binary_array<cml::matrix44f> mapped(path);
+    CATCH_REQUIRE(mapped.size() == 5);
+    CATCH_CHECK(mapped.header().rows == 4);
+    CATCH_CHECK(mapped.header().layout == cml::row_major_c);
+    CATCH_CHECK(
+      reinterpret_cast<std::uintptr_t>(mapped.data()) % alignof(float) == 0);
+    for(int i = 0; i < 5; ++i) {
+      auto view = mapped[i];
+      CATCH_CHECK(view == values[i]);
+    }
+
+    /* Writes through views are private to the mapping: */
+    mapped[0](0, 0) = -1.f;
+    CATCH_CHECK(mapped[0](0, 0) == -1.f);
+  }
+
+  auto reread = cml::read_binary_array<cml::matrix44f>(path);
+  CATCH_CHECK(reread[0](0, 0) == 0.f);
+  std::remove(path.c_str());
+}
+
+CATCH_TEST_CASE("mapped, errors1")
+{
+  CATCH_CHECK_THROWS_AS(
+    cml::mapped_binary_array<cml::vector3f>("binary_io1_missing.bin"),
+    cml::binary_io_error);
+
+  const std::string path = "binary_io1_vector3d.bin";
+  cml::write_binary_array(path, std::vector<cml::vector3d>(4));
+  CATCH_CHECK_THROWS_AS(cml::mapped_binary_array<cml::vector3f>(path),
+    cml::binary_io_error);
+  CATCH_CHECK(cml::mapped_binary_array<cml::vector3d>(path).size() == 4);
+  std::remove(path.c_str());
+}
@@ -0,0 +1,42 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#include <unordered_set>
+
+// Make sure the main header compiles cleanly:
+#include <cml/util/matrix_hash.h>
+
+#include <cml/matrix/fixed.h>
+#include <cml/matrix/dynamic.h>
+#include <cml/matrix/types.h>
+#include <cml/matrix/comparison.h>
+
+/* Testing headers: */
+#include "catch_runner.h"
+
+
+using matrix33d_table = std::unordered_set<cml::matrix33d>;
+
+CATCH_TEST_CASE("fixed, table1")
+{
+  cml::matrix33d M0(1., 2., 3., 4., 5., 6., 7., 8., 9.);
+  cml::matrix33d M1 = cml::transpose(M0);
+  matrix33d_table table;
+  CATCH_REQUIRE(table.insert(M0).second);
+  CATCH_REQUIRE(table.insert(M1).second);
+  CATCH_REQUIRE(!table.insert(M0).second);
+  CATCH_REQUIRE(table.size() == 2);
+  CATCH_REQUIRE(table.find(M0) != table.end());
+}
+
+using matrixd_table = std::unordered_set<cml::matrixd>;
+
+CATCH_TEST_CASE("dynamic, table1")
+{
+  cml::matrixd M0(2, 2, 1., 2., 3., 4.);
+  matrixd_table table;
+  CATCH_REQUIRE(table.insert(M0).second);
+  CATCH_REQUIRE(table.size() == 1);
+  CATCH_REQUIRE(table.find(M0) != table.end());
+}
@@ -0,0 +1,71 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#include <unordered_set>
+
+// Make sure the main header compiles cleanly:
+#include <cml/util/quantized_hash.h>
+
+#include <cml/vector.h>
+#include <cml/matrix.h>
+#include <cml/quaternion.h>
+
+/* Testing headers: */
+#include "catch_runner.h"
+
+
+CATCH_TEST_CASE("vector, table1")
+{
+  using hash_type = cml::quantized_hash<cml::vector3d>;
+  using equal_type = cml::quantized_equal<cml::vector3d>;
+  std::unordered_set<cml::vector3d, hash_type, equal_type> table(16,
+    hash_type(.01), equal_type(.01));
+
+  CATCH_REQUIRE(table.insert(cml::vector3d(1.001, 2.001, 3.001)).second);
+  CATCH_REQUIRE(!table.insert(cml::vector3d(1.002, 2.002, 3.002)).second);
+  CATCH_REQUIRE(table.insert(cml::vector3d(1.011, 2.001, 3.001)).second);
+  CATCH_REQUIRE(table.size() == 2);
+  CATCH_REQUIRE(table.find(cml::vector3d(1.009, 2.009, 3.009)) != table.end());
+}
+
+CATCH_TEST_CASE("vector, negative1")
+{
+  cml::quantized_equal<cml::vector2d> equal(1.);
+  CATCH_CHECK(equal(cml::vector2d(-.5, .5), cml::vector2d(-.1, .1)));
+  CATCH_CHECK(!equal(cml::vector2d(-.1, .1), cml::vector2d(.1, .1)));
+}
+
+CATCH_TEST_CASE("dynamic vector, size1")
+{
+  cml::quantized_equal<cml::vectord> equal(1.);
+  CATCH_CHECK(!equal(cml::vectord(1., 2.), cml::vectord(1., 2., 3.)));
+}
+
+CATCH_TEST_CASE("matrix, hash1")
+{
+  cml::quantized_hash<cml::matrix22d> hash(.1);
+  cml::quantized_equal<cml::matrix22d> equal(.1);
+  cml::matrix22d M0(1.01, 2.01, 3.01, 4.01);
+  cml::matrix22d M1(1.02, 2.02, 3.02, 4.02);
+  CATCH_CHECK(hash(M0) == hash(M1));
+  CATCH_CHECK(equal(M0, M1));
+  CATCH_CHECK(!equal(M0, cml::transpose(M1)));
+}
+
+CATCH_TEST_CASE("quaternion, hash1")
+{
+  cml::quantized_hash<cml::quaterniond_p> hash(.1);
+  cml::quantized_equal<cml::quaterniond_p> equal(.1);
+  cml::quaterniond_p q0(1.01, 2.01, 3.01, 4.01);
+  cml::quaterniond_p q1(1.02, 2.02, 3.02, 4.02);
+  CATCH_CHECK(hash(q0) == hash(q1));
+  CATCH_CHECK(equal(q0, q1));
+  CATCH_CHECK(hash.cell_size() == Approx(.1).epsilon(1e-12));
+}
+
+CATCH_TEST_CASE("cell size, throws1")
+{
+  using hash_type = cml::quantized_hash<cml::vector3d>;
+  CATCH_CHECK_THROWS_AS(hash_type(0.), std::invalid_argument);
+}
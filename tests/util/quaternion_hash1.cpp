@@ -0,0 +1,28 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#include <unordered_set>
+
+// Make sure the main header compiles cleanly:
+#include <cml/util/quaternion_hash.h>
+
+#include <cml/quaternion.h>
+
+/* Testing headers: */
+#include "catch_runner.h"
+
+
+using quaterniond_table = std::unordered_set<cml::quaterniond_p>;
+
+CATCH_TEST_CASE("fixed, table1")
+{
+  cml::quaterniond_p q0(1., 2., 3., 4.);
+  cml::quaterniond_p q1(4., 3., 2., 1.);
+  quaterniond_table table;
+  CATCH_REQUIRE(table.insert(q0).second);
+  CATCH_REQUIRE(table.insert(q1).second);
+  CATCH_REQUIRE(!table.insert(q0).second);
+  CATCH_REQUIRE(table.size() == 2);
+  CATCH_REQUIRE(table.find(q1) != table.end());
+}
@@ -0,0 +1,104 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+#include <algorithm>
+
+// Make sure the main header compiles cleanly:
+#include <cml/util/spatial_hash_grid.h>
+
+#include <cml/vector.h>
+
+/* Testing headers: */
+#include "catch_runner.h"
+
+
+CATCH_TEST_CASE("insert, cell1")
+{
+  cml::spatial_hash_grid<double> grid(.5);
+  CATCH_CHECK(grid.cell_of(cml::vector3d(.1, -.1, 1.2))
+    == cml::vector<int, cml::fixed<3>>(0, -1, 2));
+  CATCH_CHECK(grid.insert(cml::vector3d(0., 0., 0.)) == 0);
+  CATCH_CHECK(grid.insert(cml::vector3d(.1, 0., 0.)) == 1);
+  CATCH_CHECK(grid.size() == 2);
+  CATCH_CHECK(grid.point(1)[0] == .1);
+  grid.clear();
+  CATCH_CHECK(grid.size() == 0);
+}
+
+CATCH_TEST_CASE("query, near1")
+{
+  cml::spatial_hash_grid<double> grid(1.);
+  for(int i = 0; i < 10; ++i)
+    for(int j = 0; j < 10; ++j) grid.insert(cml::vector3d(.4 * i, .4 * j, 0.));
+
+  /* Brute-force the expected neighbours: */
+  cml::vector3d p(1.9, 2.1, .1);
+  std::vector<int> expected;
+  for(int n = 0; n < grid.size(); ++n)
+    if((grid.point(n) - p).length() <= .7) expected.push_back(n);
+
+  std::vector<int> found;
+  grid.for_each_near(p, .7, [&found](int n) { found.push_back(n); });
+  std::sort(found.begin(), found.end());
+  CATCH_REQUIRE(found.size() == expected.size());
+  CATCH_CHECK(found == expected);
+
+  /* Radius larger than a cell: */
+  found.clear();
+  grid.for_each_near(p, 2.5, [&found](int n) { found.push_back(n); });
+  int count = 0;
+  for(int n = 0; n < grid.size(); ++n)
+    if((grid.point(n) - p).length() <= 2.5) ++count;
+  CATCH_CHECK(int(found.size()) == count);
+}
+
+CATCH_TEST_CASE("query, nearest1")
+{
+  cml::spatial_hash_grid<double> grid(1.);
+  grid.insert(cml::vector3d(0., 0., 0.));
+  grid.insert(cml::vector3d(.9, 0., 0.));
+  grid.insert(cml::vector3d(1.1, 0., 0.));
+  CATCH_CHECK(grid.find_nearest(cml::vector3d(1.05, 0., 0.), 1.) == 2);
+  CATCH_CHECK(grid.find_nearest(cml::vector3d(.1, 0., 0.), 1.) == 0);
+  CATCH_CHECK(grid.find_nearest(cml::vector3d(5., 0., 0.), 1.) == -1);
+}
+
+CATCH_TEST_CASE("weld, points1")
+{
+  /* Points straddling a cell boundary must still weld: */
+  std::vector<cml::vector3d> points = {
+    cml::vector3d(.9999, 0., 0.),
+    cml::vector3d(1.0001, 0., 0.),
+    cml::vector3d(0., 1., 0.),
+    cml::vector3d(0., 1.0002, 0.),
+    cml::vector3d(0., 0., 1.),
+  };
+
+  std::vector<cml::vector3d> welded;
+  auto remap = cml::weld_points(points, 1e-3, welded);
+  CATCH_REQUIRE(welded.size() == 3);
+  CATCH_REQUIRE(remap.size() == 5);
+  CATCH_CHECK(remap[0] == 0);
+  CATCH_CHECK(remap[1] == 0);
+  CATCH_CHECK(remap[2] == 1);
+  CATCH_CHECK(remap[3] == 1);
+  CATCH_CHECK(remap[4] == 2);
+}
+
+CATCH_TEST_CASE("cell size, throws1")
+{
+  CATCH_CHECK_THROWS_AS(cml::spatial_hash_grid<double>(-1.),
+    std::invalid_argument);
+}
+
+CATCH_TEST_CASE("query, size1")
+{
+  cml::spatial_hash_grid<double> grid(.5);
+  grid.insert(cml::vector3d(0., 0., 0.));
+  cml::vectord p(0., 0.);
+  CATCH_CHECK_THROWS_AS(grid.insert(p), cml::vector_size_error);
+  CATCH_CHECK_THROWS_AS(grid.find_nearest(p, 1.), cml::vector_size_error);
+  CATCH_CHECK_THROWS_AS(grid.for_each_near(p, 1., [](int) {}),
+    cml::vector_size_error);
+}
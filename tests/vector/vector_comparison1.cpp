@@ -6,6 +6,7 @@
 #include <cml/vector/comparison.h>
 
 #include <cml/vector/fixed.h>
+#include <cml/vector/dynamic.h>
 #include <cml/vector/types.h>
 
 /* Testing headers: */
@@ -73,3 +74,41 @@ CATCH_TEST_CASE("equal1")
   cml::vector3d w = {1., 2., 3.};
   CATCH_REQUIRE(w == v);
 }
+
+CATCH_TEST_CASE("approx_equal1")
+{
+  cml::vector3d v = {1., 2., 3.};
+  cml::vector3d w = {1., 2. + 1e-10, 3.};
+  CATCH_CHECK(cml::approx_equal(v, w, 1e-9));
+  CATCH_CHECK(!cml::approx_equal(v, w, 1e-11));
+  CATCH_CHECK(cml::approx_equal(v, w, 0., 1e-10));
+
+  cml::vectord d = {1., 2., 3.};
+  CATCH_CHECK(cml::approx_equal(d, w, 1e-9));
+  CATCH_CHECK(!cml::approx_equal(d, cml::vectord(1., 2.), 1e-9));
+  CATCH_CHECK(!cml::approx_equal(v, cml::vector3d(1., std::nan(""), 3.), 1.));
+}
+
+CATCH_TEST_CASE("approx_equal_ulps1")
+{
+  cml::vector3d v = {1., 2., 3.};
+  cml::vector3d w = {1., std::nextafter(2., 3.), 3.};
+  CATCH_CHECK(cml::approx_equal_ulps(v, w, 1));
+  CATCH_CHECK(!cml::approx_equal_ulps(v, w, 0));
+}
+
+CATCH_TEST_CASE("batch_approx_equal1")
+{
+  cml::vector4d items[] = {
+    {0., 0., 0., 1.}, {1., 0., 0., 0.}, {0., 1., 0., 0.}};
+  cml::vector4d copies[] = {
+    {0., 0., 0., 1.}, {1., 0., 0., 0.}, {0., 1., 0., 1e-3}};
+  CATCH_CHECK(cml::find_approx_equal(items, 3, cml::vector4d(1., 0., 0., 1e-12),
+                1e-9)
+    == 1);
+  CATCH_CHECK(cml::find_approx_equal(items, 3, cml::vector4d(1., 1., 1., 1.),
+                1e-9)
+    == -1);
+  CATCH_CHECK(cml::all_approx_equal(items, copies, 2, 1e-9));
+  CATCH_CHECK(!cml::all_approx_equal(items, copies, 3, 1e-9));
+}
@@ -0,0 +1,103 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+// Make sure the main header compiles cleanly:
+#include <cml/vector/elementwise.h>
+
+#include <cml/vector.h>
+#include <cml/vector/reductions.h>
+
+/* Testing headers: */
+#include "catch_runner.h"
+
+CATCH_TEST_CASE("unary1")
+{
+  cml::vector3d v(-4., 9., -0.);
+  cml::vector3d w = cml::abs(v);
+  CATCH_CHECK(w[0] == 4.);
+  CATCH_CHECK(w[1] == 9.);
+  CATCH_CHECK(w[2] == 0.);
+
+  w = cml::sqrt(cml::abs(v));
+  CATCH_CHECK(w[0] == 2.);
+  CATCH_CHECK(w[1] == 3.);
+  CATCH_CHECK(w[2] == 0.);
+
+  cml::vectord d = cml::exp(cml::vector2d(0., 1.));
+  CATCH_REQUIRE(d.size() == 2);
+  CATCH_CHECK(d[0] == 1.);
+  CATCH_CHECK(d[1] == Approx(2.718281828459045).epsilon(1e-12));
+}
+
+CATCH_TEST_CASE("min_max1")
+{
+  cml::vector3d a(1., 5., -2.), b(3., -1., -2.);
+  cml::vector3d lo = cml::min(a, b), hi = cml::max(a, b);
+  CATCH_CHECK(lo[0] == 1.);
+  CATCH_CHECK(lo[1] == -1.);
+  CATCH_CHECK(lo[2] == -2.);
+  CATCH_CHECK(hi[0] == 3.);
+  CATCH_CHECK(hi[1] == 5.);
+  CATCH_CHECK(hi[2] == -2.);
+
+  /* The reductions are still selected by a thread count: */
+  CATCH_CHECK(cml::min(a, cml::thread_count(1)) == -2.);
+  CATCH_CHECK(cml::max(cml::max(a, b)) == 5.);
+}
+
+CATCH_TEST_CASE("clamp1")
+{
+  cml::vector4d v(-1., 0.25, 0.75, 2.);
+  cml::vector4d w = cml::clamp(v, 0., 1.);
+  CATCH_CHECK(w[0] == 0.);
+  CATCH_CHECK(w[1] == 0.25);
+  CATCH_CHECK(w[2] == 0.75);
+  CATCH_CHECK(w[3] == 1.);
+
+  cml::vector4d lo(0., 0.5, 0., 0.), hi(1., 1., 0.5, 3.);
+  w = cml::clamp(v, lo, hi);
+  CATCH_CHECK(w[0] == 0.);
+  CATCH_CHECK(w[1] == 0.5);
+  CATCH_CHECK(w[2] == 0.5);
+  CATCH_CHECK(w[3] == 2.);
+
+  /* Mixed scalar types, and an expression argument: */
+  w = cml::clamp(2. * v, 0, 1.f);
+  CATCH_CHECK(w[1] == 0.5);
+  CATCH_CHECK(w[3] == 1.);
+}
+
+CATCH_TEST_CASE("fma1")
+{
+  cml::vector3d a(1., 2., 3.), b(4., 5., 6.), c(-1., -1., -1.);
+  cml::vector3d w = cml::fma(a, b, c);
+  CATCH_CHECK(w[0] == 3.);
+  CATCH_CHECK(w[1] == 9.);
+  CATCH_CHECK(w[2] == 17.);
+
+  /* The product is not rounded before the addition: */
+  const double e = 1. + 0x1p-30;
+  cml::vectord x(1), y(1), z(1);
+  x[0] = e;
+  y[0] = e;
+  z[0] = -(1. + 0x1p-29);
+  CATCH_CHECK(cml::fma(x, y, z)[0] == 0x1p-60);
+}
+
+CATCH_TEST_CASE("fused1")
+{
+  /* A shading-style expression evaluated without temporaries: */
+  cml::vector3d n(0.5, -2., 1.), l(1., 1., 0.), base(0.1, 0.2, 0.3);
+  cml::vector3d c = cml::clamp(cml::fma(cml::abs(n), l, base), 0., 1.);
+  CATCH_CHECK(c[0] == 0.6);
+  CATCH_CHECK(c[1] == 1.);
+  CATCH_CHECK(c[2] == 0.3);
+}
+
+CATCH_TEST_CASE("size_checking1")
+{
+  cml::vectord a(2), b(3);
+  CATCH_CHECK_THROWS_AS(cml::max(a, b), cml::incompatible_vector_size_error);
+  CATCH_CHECK_THROWS_AS(cml::fma(a, a, b), cml::incompatible_vector_size_error);
+}
@@ -0,0 +1,86 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+// Make sure the main header compiles cleanly:
+#include <cml/vector/generators.h>
+
+#include <cml/vector.h>
+#include <cml/mathlib/vector/generators.h>
+
+/* Testing headers: */
+#include "catch_runner.h"
+
+CATCH_TEST_CASE("generator_types1")
+{
+  {
+    auto xpr = cml::zero(3);
+    using xpr_type = decltype(xpr);
+    CATCH_CHECK((std::is_same<xpr_type::value_type, int>::value));
+    CATCH_CHECK(
+      (std::is_same<xpr_type::size_tag, cml::dynamic_size_tag>::value));
+    CATCH_CHECK(xpr.size() == 3);
+  }
+  {
+    auto xpr = cml::unit<float>(cml::int_c<4>(), 2);
+    using xpr_type = decltype(xpr);
+    CATCH_CHECK((std::is_same<xpr_type::value_type, float>::value));
+    CATCH_CHECK(
+      (std::is_same<xpr_type::size_tag, cml::fixed_size_tag>::value));
+    CATCH_CHECK((xpr_type::array_size == 4));
+  }
+  {
+    auto xpr = cml::constant(2, 0.5f);
+    using xpr_type = decltype(xpr);
+    CATCH_CHECK((std::is_same<xpr_type::value_type, float>::value));
+  }
+}
+
+CATCH_TEST_CASE("generator_assign1")
+{
+  cml::vector3f v = cml::unit(3, 1);
+  CATCH_CHECK(v[0] == 0.f);
+  CATCH_CHECK(v[1] == 1.f);
+  CATCH_CHECK(v[2] == 0.f);
+
+  cml::vectord w = cml::constant(5, 2.5);
+  CATCH_REQUIRE(w.size() == 5);
+  CATCH_CHECK(w[4] == 2.5);
+
+  w = cml::zero(2);
+  CATCH_REQUIRE(w.size() == 2);
+  CATCH_CHECK(w[0] == 0.);
+  CATCH_CHECK(w[1] == 0.);
+
+  /* An out-of-range index gives the zero vector: */
+  v = cml::unit(3, 3);
+  CATCH_CHECK(v[2] == 0.f);
+}
+
+CATCH_TEST_CASE("generator_expression1")
+{
+  cml::vector3f v(1.f, 2.f, 3.f);
+
+  /* The int generators do not promote float expressions to double: */
+  auto xpr = v - cml::unit(3, 0);
+  CATCH_CHECK((std::is_same<decltype(xpr)::value_type, float>::value));
+  cml::vector3f w = xpr;
+  CATCH_CHECK(w[0] == 0.f);
+  CATCH_CHECK(w[1] == 2.f);
+
+  w = v + 2.f * cml::constant(cml::int_c<3>(), 1);
+  CATCH_CHECK(w[0] == 3.f);
+  CATCH_CHECK(w[2] == 5.f);
+
+  /* Same result as the concrete mathlib generator: */
+  cml::vector3d a = cml::axis<3>(2), b = cml::unit(3, 2);
+  CATCH_CHECK(a == b);
+}
+
+CATCH_TEST_CASE("generator_size_checking1")
+{
+  cml::vector3d v;
+  CATCH_CHECK_THROWS_AS(v = cml::zero(4), cml::incompatible_vector_size_error);
+  CATCH_CHECK_THROWS_AS(v + cml::constant(2, 1.),
+    cml::incompatible_vector_size_error);
+}
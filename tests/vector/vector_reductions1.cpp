@@ -0,0 +1,97 @@
+/*-------------------------------------------------------------------------
+ @@COPYRIGHT@@
+ *-----------------------------------------------------------------------*/
+
+// Make sure the main header compiles cleanly:
+#include <cml/vector/reductions.h>
+
+#include <type_traits>
+#include <utility>
+#include <cml/vector.h>
+
+/* Testing headers: */
+#include "catch_runner.h"
+
+namespace {
+
+/* True if min(V, double) compiles: */
+template<class V, class = void> struct has_scalar_min : std::false_type
+{
+};
+
+template<class V>
+struct has_scalar_min<V,
+  std::void_t<decltype(cml::min(std::declval<const V&>(), 0.5))>>
+: std::true_type
+{
+};
+
+} // namespace
+
+CATCH_TEST_CASE("sum1")
+{
+  cml::vector4d v(1., -2., 3., 4.5);
+  CATCH_CHECK(cml::sum(v) == 6.5);
+  CATCH_CHECK(cml::sum(cml::vectord()) == 0.);
+
+  /* Expressions are reduced without a temporary: */
+  CATCH_CHECK(cml::sum(v + 2. * v) == 19.5);
+}
+
+CATCH_TEST_CASE("sum, pairwise1")
+{
+  /* A running float sum of 1e6 copies of 0.1f is off by ~1%: */
+  const int N = 1000000;
+  cml::vectorf v(N);
+  for(int i = 0; i < N; ++i) v[i] = 0.1f;
+  CATCH_CHECK(cml::sum(v) == Approx(100000.).epsilon(1e-5));
+  CATCH_CHECK(
+    cml::sum(v, cml::thread_count(4)) == Approx(100000.).epsilon(1e-5));
+}
+
+CATCH_TEST_CASE("min_max1")
+{
+  cml::vectord v(17);
+  for(int i = 0; i < 17; ++i) v[i] = double((i * 7) % 17) - 8.;
+  /* v[0] = -8, v[5] = 18 % 17 - 8 = -7, ...; v[12] = 84 % 17 - 8 = 8: */
+  CATCH_CHECK(cml::min(v) == -8.);
+  CATCH_CHECK(cml::max(v) == 8.);
+  CATCH_CHECK(cml::argmin(v) == 0);
+  CATCH_CHECK(cml::argmax(v) == 12);
+
+  /* Ties go to the first element: */
+  cml::vectord w(20);
+  for(int i = 0; i < 20; ++i) w[i] = (i == 3 || i == 11) ? 5. : 1.;
+  CATCH_CHECK(cml::argmax(w) == 3);
+  CATCH_CHECK(cml::argmin(w) == 0);
+  CATCH_CHECK(cml::argmin(-w) == 3);
+
+  CATCH_CHECK_THROWS_AS(cml::min(cml::vectord()),
+    cml::minimum_vector_size_error);
+}
+
+CATCH_TEST_CASE("norms1")
+{
+  cml::vector3d v(3., -4., 0.);
+  CATCH_CHECK(cml::norm_1(v) == 7.);
+  CATCH_CHECK(cml::norm_inf(v) == 4.);
+  CATCH_CHECK(cml::norm_frobenius(v) == 5.);
+  CATCH_CHECK(cml::norm_inf(cml::vectord()) == 0.);
+}
+
+CATCH_TEST_CASE("threads1")
+{
+  const int N = 300001;
+  cml::vectord v(N);
+  for(int i = 0; i < N; ++i) v[i] = std::sin(double(i));
+  CATCH_CHECK(
+    cml::sum(v, cml::thread_count(3)) == Approx(cml::sum(v)).epsilon(1e-12));
+  CATCH_CHECK(cml::argmin(v, cml::thread_count(3)) == cml::argmin(v));
+  CATCH_CHECK(cml::argmax(v, cml::thread_count(0)) == cml::argmax(v));
+  CATCH_CHECK(cml::norm_inf(v, cml::thread_count(2)) == cml::norm_inf(v));
+  CATCH_CHECK(cml::norm_frobenius(v, cml::thread_count(5))
+    == Approx(cml::norm_frobenius(v)).epsilon(1e-12));
+
+  /* A scalar is not mistaken for a thread count: */
+  CATCH_CHECK(!has_scalar_min<cml::vectord>::value);
+}